@@ -17,6 +17,12 @@ static U32 min(const U32 a, const U32 b) {
     return (a < b) ? a : b;
 }
 
+//! Load a big-endian word. Compilers reduce this to a load and byte swap where needed.
+static inline U32 loadBe32(const U8* const word) {
+    return (static_cast<U32>(word[0]) << 24) | (static_cast<U32>(word[1]) << 16) | (static_cast<U32>(word[2]) << 8) |
+           static_cast<U32>(word[3]);
+}
+
 namespace CFDP {
 
 Checksum ::Checksum() : m_value(0) {}
@@ -58,9 +64,9 @@ void Checksum ::update(const U8* const data, const U32 offset, const U32 length)
     }
 
     // Add the middle words aligned
-    for (; index + 4 <= length; index += 4) {
-        addWordAligned(&data[index]);
-    }
+    const U32 numWords = (length - index) / 4;
+    this->addWordsAligned(&data[index], numWords);
+    index += numWords * 4;
 
     // Add the last word unaligned if necessary
     if (index < length) {
@@ -69,10 +75,22 @@ void Checksum ::update(const U8* const data, const U32 offset, const U32 length)
     }
 }
 
-void Checksum ::addWordAligned(const U8* const word) {
-    for (U8 i = 0; i < 4; ++i) {
-        addByteAtOffset(word[i], i);
+void Checksum ::addWordsAligned(const U8* const words, const U32 count) {
+    // Four independent lanes break the dependency on a single sum and let compilers vectorize the loop.
+    // The sum is modulo 2^32, so the lanes may wrap and be combined in any order.
+    U32 lanes[4] = {0, 0, 0, 0};
+    U32 word = 0;
+    for (; word + 4 <= count; word += 4) {
+        const U8* const block = &words[4 * word];
+        lanes[0] += loadBe32(&block[0]);
+        lanes[1] += loadBe32(&block[4]);
+        lanes[2] += loadBe32(&block[8]);
+        lanes[3] += loadBe32(&block[12]);
+    }
+    for (; word < count; ++word) {
+        lanes[0] += loadBe32(&words[4 * word]);
     }
+    this->m_value += lanes[0] + lanes[1] + lanes[2] + lanes[3];
 }
 
 void Checksum ::addWordUnaligned(const U8* word, const U8 position, const U8 length) {
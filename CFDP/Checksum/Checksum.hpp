@@ -107,8 +107,9 @@ class Checksum {
     // Private instance methods
     // ----------------------------------------------------------------------
 
-    //! Add a four-byte aligned word to the checksum value
-    void addWordAligned(const U8* const word  //! The word
+    //! Add consecutive four-byte aligned words to the checksum value
+    void addWordsAligned(const U8* const words,  //! The first word
+                         const U32 count         //! The number of words
     );
 
     //! Add a four-byte unaligned word to the checksum value
@@ -0,0 +1,62 @@
+// ======================================================================
+// \title  ChecksumBenchmark.cpp
+// \brief  Throughput comparison of CFDP::Checksum against the byte-at-a-time reference
+//
+// Run the resulting executable directly to print a MB/s table. Both
+// implementations checksum the same data so the results are also cross-checked.
+// ======================================================================
+
+#include <gtest/gtest.h>
+#include <CFDP/Checksum/Checksum.hpp>
+#include <CFDP/Checksum/test/ut/ReferenceChecksum.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+//! Bytes checksummed per measurement, independent of update size
+constexpr U32 BYTES_PER_MEASUREMENT = 16 * 1024 * 1024;
+const U32 UPDATE_SIZES[] = {16, 64, 256, 1024, 4096, 65536};
+
+}  // namespace
+
+TEST(ChecksumBenchmark, Throughput) {
+    std::vector<U8> data(UPDATE_SIZES[sizeof(UPDATE_SIZES) / sizeof(UPDATE_SIZES[0]) - 1] + 1);
+    for (U32 i = 0; i < data.size(); i++) {
+        data[i] = static_cast<U8>(i * 131 + 7);
+    }
+    std::printf("%10s %8s %14s %14s   (MB/s)\n", "size", "offset", "reference", "Checksum");
+
+    for (const U32 size : UPDATE_SIZES) {
+        // Aligned updates, then updates starting one byte into a word to exercise the head and tail
+        for (U32 offset = 0; offset < 2; offset++) {
+            const U32 iterations = BYTES_PER_MEASUREMENT / size;
+            const double megabytes = static_cast<double>(iterations) * size / 1.0e6;
+
+            U32 reference = 0;
+            auto start = std::chrono::steady_clock::now();
+            for (U32 i = 0; i < iterations; i++) {
+                reference = CFDP::referenceChecksumUpdate(reference, &data[offset], offset, size);
+            }
+            const std::chrono::duration<double> referenceElapsed = std::chrono::steady_clock::now() - start;
+
+            CFDP::Checksum checksum;
+            start = std::chrono::steady_clock::now();
+            for (U32 i = 0; i < iterations; i++) {
+                checksum.update(&data[offset], offset, size);
+            }
+            const std::chrono::duration<double> checksumElapsed = std::chrono::steady_clock::now() - start;
+
+            std::printf("%10u %8u %14.1f %14.1f\n", size, offset, megabytes / referenceElapsed.count(),
+                        megabytes / checksumElapsed.count());
+            ASSERT_EQ(reference, checksum.getValue()) << "size " << size << " offset " << offset;
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -5,6 +5,8 @@
 #include "gtest/gtest.h"
 
 #include "CFDP/Checksum/Checksum.hpp"
+#include "CFDP/Checksum/test/ut/ReferenceChecksum.hpp"
+#include "STest/Random/Random.hpp"
 
 using namespace CFDP;
 
@@ -48,7 +50,46 @@ TEST(Checksum, ThreePackets) {
     ASSERT_EQ(expectedValue, checksum.getValue());
 }
 
+TEST(Checksum, EveryOffsetAndLengthMatchesReference) {
+    // Covers all head/tail splits around the four-word block of the aligned path
+    U8 bytes[128];
+    for (U32 i = 0; i < sizeof(bytes); ++i) {
+        bytes[i] = static_cast<U8>(i * 131 + 7);
+    }
+    for (U32 offset = 0; offset < 8; ++offset) {
+        for (U32 length = 0; length + offset <= sizeof(bytes); ++length) {
+            Checksum checksum;
+            checksum.update(&bytes[offset], offset, length);
+            ASSERT_EQ(referenceChecksumUpdate(0, &bytes[offset], offset, length), checksum.getValue())
+                << "offset " << offset << " length " << length;
+        }
+    }
+}
+
+TEST(Checksum, RandomUpdatesMatchReference) {
+    const U32 fileSize = 4096;
+    U8 file[fileSize];
+    for (U32 trial = 0; trial < 200; ++trial) {
+        for (U32 i = 0; i < fileSize; ++i) {
+            file[i] = static_cast<U8>(STest::Random::lowerUpper(0, 255));
+        }
+        // Update over the file in randomly sized pieces, as file transfers do packet by packet
+        const U32 seed = STest::Random::lowerUpper(0, 0xFFFFFFFFU);
+        Checksum checksum(seed);
+        U32 expected = seed;
+        U32 offset = 0;
+        while (offset < fileSize) {
+            const U32 length = STest::Random::lowerUpper(0, fileSize - offset);
+            checksum.update(&file[offset], offset, length);
+            expected = referenceChecksumUpdate(expected, &file[offset], offset, length);
+            offset += length;
+        }
+        ASSERT_EQ(expected, checksum.getValue()) << "trial " << trial;
+    }
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
+    STest::Random::seed();
     return RUN_ALL_TESTS();
 }
@@ -0,0 +1,24 @@
+// ======================================================================
+// \title  CFDP/Checksum/test/ut/ReferenceChecksum.hpp
+// \brief  Byte-at-a-time CFDP checksum used as a reference in tests
+// ======================================================================
+
+#ifndef CFDP_ReferenceChecksum_HPP
+#define CFDP_ReferenceChecksum_HPP
+
+#include <Fw/FPrimeBasicTypes.hpp>
+
+namespace CFDP {
+
+//! Update a checksum value one byte at a time, placing each byte by its file offset within the word
+inline U32 referenceChecksumUpdate(U32 value, const U8* const data, const U32 offset, const U32 length) {
+    for (U32 i = 0; i < length; ++i) {
+        const U32 position = (offset + i) % 4;
+        value += static_cast<U32>(data[i]) << (8 * (3 - position));
+    }
+    return value;
+}
+
+}  // namespace CFDP
+
+#endif
@@ -35,6 +35,10 @@ Os::Queue::Queue::Status QueuedComponentBase::createQueue(FwSizeType depth, FwSi
     return this->m_queue.create(this->getInstance(), queueName, depth, msgSize);
 }
 
+Os::Queue::Status QueuedComponentBase::enableBatchDispatch(FwSizeType maxMessages) {
+    return this->m_queue.enableBatchReceive(maxMessages);
+}
+
 FwSizeType QueuedComponentBase::getNumMsgsDropped() {
     return this->m_msgsDropped;
 }
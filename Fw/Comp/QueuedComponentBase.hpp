@@ -34,6 +34,9 @@ class QueuedComponentBase : public PassiveComponentBase {
     void deinit();                          //!< Allows de-initialization on teardown
     Os::Queue m_queue;                      //!< queue object for active component
     Os::Queue::Status createQueue(FwSizeType depth, FwSizeType msgSize);
+    //! Opt in to batched dispatch: each queue access drains up to maxMessages messages that are then dispatched
+    //! back-to-back. Must be called after the queue is created. See Os::Queue::enableBatchReceive.
+    Os::Queue::Status enableBatchDispatch(FwSizeType maxMessages);
     virtual MsgDispatchStatus doDispatch() = 0;  //!< method to dispatch a single message in the queue.
 #if FW_OBJECT_TO_STRING == 1
     virtual const char* getToStringFormatString();  //!< Format string for toString function
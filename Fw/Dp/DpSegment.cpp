@@ -0,0 +1,102 @@
+// ======================================================================
+// \title  DpSegment.cpp
+// \brief  cpp file for the data product segment file format
+// ======================================================================
+
+#include "Fw/Dp/DpSegment.hpp"
+
+namespace Fw {
+
+// ----------------------------------------------------------------------
+// Entry
+// ----------------------------------------------------------------------
+
+SerializeStatus DpSegment::Entry::serializeTo(SerialBufferBase& buffer) const {
+    SerializeStatus status = buffer.serializeFrom(this->id);
+    if (status == FW_SERIALIZE_OK) {
+        status = buffer.serializeFrom(this->priority);
+    }
+    if (status == FW_SERIALIZE_OK) {
+        status = buffer.serializeFrom(this->timeSeconds);
+    }
+    if (status == FW_SERIALIZE_OK) {
+        status = buffer.serializeFrom(this->timeUSeconds);
+    }
+    if (status == FW_SERIALIZE_OK) {
+        status = buffer.serializeFrom(this->state);
+    }
+    if (status == FW_SERIALIZE_OK) {
+        status = buffer.serializeFrom(this->offset);
+    }
+    if (status == FW_SERIALIZE_OK) {
+        status = buffer.serializeFrom(this->size);
+    }
+    return status;
+}
+
+SerializeStatus DpSegment::Entry::deserializeFrom(SerialBufferBase& buffer) {
+    SerializeStatus status = buffer.deserializeTo(this->id);
+    if (status == FW_SERIALIZE_OK) {
+        status = buffer.deserializeTo(this->priority);
+    }
+    if (status == FW_SERIALIZE_OK) {
+        status = buffer.deserializeTo(this->timeSeconds);
+    }
+    if (status == FW_SERIALIZE_OK) {
+        status = buffer.deserializeTo(this->timeUSeconds);
+    }
+    if (status == FW_SERIALIZE_OK) {
+        status = buffer.deserializeTo(this->state);
+    }
+    if (status == FW_SERIALIZE_OK) {
+        status = buffer.deserializeTo(this->offset);
+    }
+    if (status == FW_SERIALIZE_OK) {
+        status = buffer.deserializeTo(this->size);
+    }
+    return status;
+}
+
+// ----------------------------------------------------------------------
+// Trailer
+// ----------------------------------------------------------------------
+
+SerializeStatus DpSegment::Trailer::serializeTo(SerialBufferBase& buffer) const {
+    SerializeStatus status = buffer.serializeFrom(this->sequence);
+    if (status == FW_SERIALIZE_OK) {
+        status = buffer.serializeFrom(this->timeSeconds);
+    }
+    if (status == FW_SERIALIZE_OK) {
+        status = buffer.serializeFrom(this->timeUSeconds);
+    }
+    if (status == FW_SERIALIZE_OK) {
+        status = buffer.serializeFrom(this->entryCount);
+    }
+    if (status == FW_SERIALIZE_OK) {
+        status = buffer.serializeFrom(TRAILER_MAGIC);
+    }
+    return status;
+}
+
+SerializeStatus DpSegment::Trailer::deserializeFrom(SerialBufferBase& buffer) {
+    SerializeStatus status = buffer.deserializeTo(this->sequence);
+    if (status == FW_SERIALIZE_OK) {
+        status = buffer.deserializeTo(this->timeSeconds);
+    }
+    if (status == FW_SERIALIZE_OK) {
+        status = buffer.deserializeTo(this->timeUSeconds);
+    }
+    if (status == FW_SERIALIZE_OK) {
+        status = buffer.deserializeTo(this->entryCount);
+    }
+    U32 magic = 0;
+    if (status == FW_SERIALIZE_OK) {
+        status = buffer.deserializeTo(magic);
+    }
+    if ((status == FW_SERIALIZE_OK) && (magic != TRAILER_MAGIC)) {
+        status = FW_DESERIALIZE_FORMAT_ERROR;
+    }
+    return status;
+}
+
+}  // end namespace Fw
@@ -0,0 +1,87 @@
+// ======================================================================
+// \title  DpSegment.hpp
+// \brief  hpp file for the data product segment file format
+// ======================================================================
+
+#ifndef Fw_DpSegment_HPP
+#define Fw_DpSegment_HPP
+
+#include "Fw/Dp/DpStateEnumAc.hpp"
+#include "Fw/FPrimeBasicTypes.hpp"
+#include "Fw/Types/Serializable.hpp"
+
+namespace Fw {
+
+//! The layout of a data product segment file
+//!
+//! A segment file holds one or more serialized data product containers
+//! back to back, followed by a footer. The footer is an index with one
+//! Entry per container, in file order, followed by a fixed-size Trailer.
+//! A reader locates the trailer at the end of the file, then the index
+//! immediately before it.
+class DpSegment {
+  public:
+    // ----------------------------------------------------------------------
+    // Constants and Types
+    // ----------------------------------------------------------------------
+
+    //! The value marking a complete segment trailer ("FDPS")
+    static constexpr U32 TRAILER_MAGIC = 0x46445053;
+
+    //! An index entry describing one container in the segment
+    struct Entry {
+        //! The serialized size of an index entry
+        static constexpr FwSizeType SERIALIZED_SIZE = sizeof(FwDpIdType) + sizeof(FwDpPriorityType) +
+                                                      2 * sizeof(U32) + DpState::SERIALIZED_SIZE + 2 * sizeof(U32);
+
+        FwDpIdType id = 0;              //!< The container id
+        FwDpPriorityType priority = 0;  //!< The container priority
+        U32 timeSeconds = 0;            //!< The container time tag seconds
+        U32 timeUSeconds = 0;           //!< The container time tag microseconds
+        DpState state;                  //!< The container state
+        U32 offset = 0;                 //!< The offset of the container packet in the segment
+        U32 size = 0;                   //!< The size of the container packet
+
+        //! Serialize the entry
+        //! \return The serialize status
+        SerializeStatus serializeTo(SerialBufferBase& buffer  //!< The buffer
+        ) const;
+
+        //! Deserialize the entry
+        //! \return The serialize status
+        SerializeStatus deserializeFrom(SerialBufferBase& buffer  //!< The buffer
+        );
+    };
+
+    //! The trailer at the end of a segment file
+    struct Trailer {
+        //! The serialized size of the trailer
+        static constexpr FwSizeType SERIALIZED_SIZE = 5 * sizeof(U32);
+
+        U32 sequence = 0;      //!< The segment sequence number
+        U32 timeSeconds = 0;   //!< The time tag seconds of the first container
+        U32 timeUSeconds = 0;  //!< The time tag microseconds of the first container
+        U32 entryCount = 0;    //!< The number of index entries
+
+        //! Serialize the trailer
+        //! \return The serialize status
+        SerializeStatus serializeTo(SerialBufferBase& buffer  //!< The buffer
+        ) const;
+
+        //! Deserialize the trailer
+        //! \return The serialize status; FW_DESERIALIZE_FORMAT_ERROR if the magic value does not match
+        SerializeStatus deserializeFrom(SerialBufferBase& buffer  //!< The buffer
+        );
+    };
+
+    //! Get the size of the footer for a number of index entries
+    //! \return The footer size
+    static constexpr FwSizeType getFooterSize(FwSizeType entryCount  //!< The number of index entries
+    ) {
+        return entryCount * Entry::SERIALIZED_SIZE + Trailer::SERIALIZED_SIZE;
+    }
+};
+
+}  // end namespace Fw
+
+#endif
@@ -8,6 +8,7 @@
 #include "gtest/gtest.h"
 
 #include "Fw/Dp/DpContainer.hpp"
+#include "Fw/Dp/DpSegment.hpp"
 #include "Fw/Dp/test/ut/DpContainerTester.hpp"
 #include "Fw/Dp/test/util/DpContainerHeader.hpp"
 #include "Fw/Test/UnitTest.hpp"
@@ -180,6 +181,51 @@ TEST(Header, BadPacketDescriptor) {
     ASSERT_EQ(serialStatus, Fw::FW_SERIALIZE_FORMAT_ERROR);
 }
 
+TEST(Segment, FooterRoundTrip) {
+    COMMENT("Test serialization and deserialization of a segment index entry and trailer");
+    U8 footerData[DpSegment::getFooterSize(1)];
+    Fw::ExternalSerializeBuffer footer(footerData, sizeof footerData);
+    DpSegment::Entry entry;
+    entry.id = static_cast<FwDpIdType>(STest::Pick::any());
+    entry.priority = static_cast<FwDpPriorityType>(STest::Pick::any());
+    entry.timeSeconds = STest::Pick::any();
+    entry.timeUSeconds = STest::Pick::startLength(0, 1000000);
+    entry.state = DpState::UNTRANSMITTED;
+    entry.offset = STest::Pick::any();
+    entry.size = STest::Pick::any();
+    DpSegment::Trailer trailer;
+    trailer.sequence = STest::Pick::any();
+    trailer.timeSeconds = entry.timeSeconds;
+    trailer.timeUSeconds = entry.timeUSeconds;
+    trailer.entryCount = 1;
+    ASSERT_EQ(entry.serializeTo(footer), Fw::FW_SERIALIZE_OK);
+    ASSERT_EQ(footer.getSize(), DpSegment::Entry::SERIALIZED_SIZE);
+    ASSERT_EQ(trailer.serializeTo(footer), Fw::FW_SERIALIZE_OK);
+    ASSERT_EQ(footer.getSize(), sizeof footerData);
+    // Read the footer back
+    DpSegment::Entry readEntry;
+    DpSegment::Trailer readTrailer;
+    ASSERT_EQ(readEntry.deserializeFrom(footer), Fw::FW_SERIALIZE_OK);
+    ASSERT_EQ(readTrailer.deserializeFrom(footer), Fw::FW_SERIALIZE_OK);
+    ASSERT_EQ(readEntry.id, entry.id);
+    ASSERT_EQ(readEntry.priority, entry.priority);
+    ASSERT_EQ(readEntry.timeSeconds, entry.timeSeconds);
+    ASSERT_EQ(readEntry.timeUSeconds, entry.timeUSeconds);
+    ASSERT_EQ(readEntry.state, entry.state);
+    ASSERT_EQ(readEntry.offset, entry.offset);
+    ASSERT_EQ(readEntry.size, entry.size);
+    ASSERT_EQ(readTrailer.sequence, trailer.sequence);
+    ASSERT_EQ(readTrailer.timeSeconds, trailer.timeSeconds);
+    ASSERT_EQ(readTrailer.timeUSeconds, trailer.timeUSeconds);
+    ASSERT_EQ(readTrailer.entryCount, trailer.entryCount);
+    // Corrupt the trailer magic value
+    footerData[sizeof footerData - 1] ^= 0xFF;
+    Fw::ExternalSerializeBuffer badTrailer(&footerData[DpSegment::Entry::SERIALIZED_SIZE],
+                                           DpSegment::Trailer::SERIALIZED_SIZE);
+    badTrailer.setBuffLen(DpSegment::Trailer::SERIALIZED_SIZE);
+    ASSERT_EQ(readTrailer.deserializeFrom(badTrailer), Fw::FW_DESERIALIZE_FORMAT_ERROR);
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     STest::Random::seed();
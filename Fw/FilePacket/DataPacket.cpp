@@ -35,6 +35,29 @@ SerializeStatus FilePacket::DataPacket ::toBuffer(Buffer& buffer) const {
     return this->toSerialBuffer(serialBuffer);
 }
 
+SerializeStatus FilePacket::DataPacket ::headerToBuffer(Buffer& buffer) const {
+    FW_ASSERT(this->m_header.m_type == T_DATA);
+    FW_ASSERT(this->fixedLengthSize() == HEADERSIZE, static_cast<FwAssertArgType>(this->fixedLengthSize()));
+    // The data must already be in place behind the header
+    FW_ASSERT(this->m_data == buffer.getData() + HEADERSIZE);
+    if (buffer.getSize() < this->bufferSize()) {
+        return FW_SERIALIZE_NO_ROOM_LEFT;
+    }
+
+    SerialBuffer serialBuffer(buffer.getData(), HEADERSIZE);
+    SerializeStatus status = this->m_header.toSerialBuffer(serialBuffer);
+    if (status != FW_SERIALIZE_OK) {
+        return status;
+    }
+
+    status = serialBuffer.serializeFrom(this->m_byteOffset);
+    if (status != FW_SERIALIZE_OK) {
+        return status;
+    }
+
+    return serialBuffer.serializeFrom(this->m_dataSize);
+}
+
 SerializeStatus FilePacket::DataPacket ::fromSerialBuffer(SerialBuffer& serialBuffer) {
     FW_ASSERT(this->m_header.m_type == T_DATA);
 
@@ -203,6 +203,12 @@ union FilePacket {
         //! Convert this DataPacket to a Buffer
         SerializeStatus toBuffer(Buffer& buffer) const;
 
+        //! Convert this DataPacket to a Buffer already holding the file data
+        //!
+        //! Writes only the fixed-length fields. The packet data must already sit at offset HEADERSIZE of the
+        //! buffer, so the file data is not copied.
+        SerializeStatus headerToBuffer(Buffer& buffer) const;
+
         //! Get this as a Header
         const FilePacket::Header& asHeader() const { return this->m_header; };
 
@@ -103,6 +103,38 @@ TEST(FilePacket, DataPacket) {
     GTest::FilePackets::DataPacket::compare(expected, actualDataPacket);
 }
 
+// Serialize a data packet around data already in the buffer and deserialize it
+TEST(FilePacket, DataPacketInPlace) {
+    const U32 dataSize = 10;
+    U8 bytes[FilePacket::DataPacket::HEADERSIZE + dataSize];
+    U8* const data = &bytes[FilePacket::DataPacket::HEADERSIZE];
+    for (U32 i = 0; i < dataSize; i++) {
+        data[i] = static_cast<U8>(i);
+    }
+    FilePacket::DataPacket expected;
+    expected.initialize(3,         // Sequence index
+                        42,        // Byte offset
+                        dataSize,  // Data size
+                        data       // Data
+    );
+    ASSERT_EQ(expected.bufferSize(), sizeof(bytes));
+    Buffer buffer(bytes, sizeof(bytes));
+    {
+        const SerializeStatus status = expected.headerToBuffer(buffer);
+        ASSERT_EQ(status, FW_SERIALIZE_OK);
+    }
+    FilePacket actual;
+    {
+        const SerializeStatus status = actual.fromBuffer(buffer);
+        ASSERT_EQ(status, FW_SERIALIZE_OK);
+    }
+    const FilePacket::DataPacket& actualDataPacket = actual.asDataPacket();
+    GTest::FilePackets::DataPacket::compare(expected, actualDataPacket);
+    // A buffer too small for the data is rejected
+    Buffer shortBuffer(bytes, sizeof(bytes) - 1);
+    ASSERT_EQ(expected.headerToBuffer(shortBuffer), FW_SERIALIZE_NO_ROOM_LEFT);
+}
+
 // Serialize and deserialize an end packet
 TEST(FilePacket, EndPacket) {
     FilePacket::EndPacket expected;
@@ -61,9 +61,13 @@ void TlmPacket::setBuffer(Fw::ComBuffer& buffer) {
 }
 
 SerializeStatus TlmPacket::addValue(FwChanIdType id, Time& timeTag, TlmBuffer& buffer) {
+    return this->addValue(id, timeTag, buffer.getBuffAddr(), buffer.getSize());
+}
+
+SerializeStatus TlmPacket::addValue(FwChanIdType id, Time& timeTag, const U8* value, FwSizeType size) {
     // check to make sure there is room for all the fields
     FwSizeType left = this->m_tlmBuffer.getCapacity() - this->m_tlmBuffer.getSize();
-    if ((sizeof(FwChanIdType) + Time::SERIALIZED_SIZE + buffer.getSize()) > left) {
+    if ((sizeof(FwChanIdType) + Time::SERIALIZED_SIZE + size) > left) {
         return Fw::FW_SERIALIZE_NO_ROOM_LEFT;
     }
 
@@ -81,8 +85,8 @@ SerializeStatus TlmPacket::addValue(FwChanIdType id, Time& timeTag, TlmBuffer& b
         return stat;
     }
 
-    // telemetry buffer
-    stat = this->m_tlmBuffer.serializeFrom(buffer.getBuffAddr(), buffer.getSize(), Fw::Serialization::OMIT_LENGTH);
+    // telemetry value
+    stat = this->m_tlmBuffer.serializeFrom(value, size, Fw::Serialization::OMIT_LENGTH);
     if (stat != Fw::FW_SERIALIZE_OK) {
         return stat;
     }
@@ -27,6 +27,8 @@ class TlmPacket : public ComPacket {
     SerializeStatus deserializeFrom(SerialBufferBase& buffer, Fw::Endianness mode = Fw::Endianness::BIG) override;
     //! Add telemetry value to buffer.
     SerializeStatus addValue(FwChanIdType id, Time& timeTag, TlmBuffer& buffer);
+    //! Add telemetry value to buffer from serialized bytes of the given size.
+    SerializeStatus addValue(FwChanIdType id, Time& timeTag, const U8* value, FwSizeType size);
     //! extract telemetry value - since there are potentially multiple channel values in the packet,
     //! the size of the entry must be known
     SerializeStatus extractValue(FwChanIdType& id, Time& timeTag, TlmBuffer& buffer, FwSizeType bufferSize);
@@ -4,10 +4,7 @@
 // ======================================================================
 #include <Fw/Types/Assert.hpp>
 #include <Os/File.hpp>
-
-extern "C" {
-#include <Utils/Hash/libcrc/lib_crc.h>  // borrow CRC
-}
+#include <Utils/Hash/libcrc/CRC32Engine.hpp>  // borrow CRC
 namespace Os {
 
 File::File() : m_crc_buffer(), m_handle_storage(), m_delegate(*FileInterface::getDelegate(m_handle_storage)) {
@@ -237,9 +234,8 @@ File::Status File::incrementalCrc(FwSizeType& size) {
         // Read data without waiting for additional data to be available
         status = this->read(this->m_crc_buffer, size, File::WaitType::NO_WAIT);
         if (OP_OK == status) {
-            for (FwSizeType i = 0; i < size && i < FW_FILE_CHUNK_SIZE; i++) {
-                this->m_crc = static_cast<U32>(update_crc_32(this->m_crc, static_cast<CHAR>(this->m_crc_buffer[i])));
-            }
+            const FwSizeType length = (size < FW_FILE_CHUNK_SIZE) ? size : FW_FILE_CHUNK_SIZE;
+            this->m_crc = Utils::CRC32Engine::update(this->m_crc, this->m_crc_buffer, length);
         }
     }
     return status;
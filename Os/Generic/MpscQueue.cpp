@@ -0,0 +1,314 @@
+// ======================================================================
+// \title Os/Generic/MpscQueue.cpp
+// \brief lock-free multi-producer single-consumer queue implementation for Os::Queue
+// ======================================================================
+#include "Os/Generic/MpscQueue.hpp"
+#include <cstring>
+#include <limits>
+#include "Fw/LanguageHelpers.hpp"
+#include "Fw/Types/Assert.hpp"
+#include "Fw/Types/MemAllocator.hpp"
+#include "config/MemoryAllocatorTypeEnumAc.hpp"
+
+namespace Os {
+namespace Generic {
+
+namespace {
+//! Number of lane rings, bounded by the number of distinct priorities
+constexpr FwSizeType LANE_COUNT =
+    (static_cast<FwSizeType>(Os::MPSC_QUEUE_PRIORITY_LANES) <
+     static_cast<FwSizeType>(std::numeric_limits<FwQueuePriorityType>::max()) + 1)
+        ? static_cast<FwSizeType>(Os::MPSC_QUEUE_PRIORITY_LANES)
+        : static_cast<FwSizeType>(std::numeric_limits<FwQueuePriorityType>::max()) + 1;
+static_assert(LANE_COUNT > 0, "MPSC_QUEUE_PRIORITY_LANES must be at least 1");
+
+//! Number of rings: one free ring and one ring per lane
+constexpr FwSizeType RING_COUNT = LANE_COUNT + 1;
+
+//! Round `value` up to a multiple of `alignment`
+FwSizeType align_up(FwSizeType value, FwSizeType alignment) {
+    return ((value + alignment - 1) / alignment) * alignment;
+}
+}  // namespace
+
+void MpscIndexRing ::setup(Cell* cells, FwSizeType capacity) {
+    FW_ASSERT(cells != nullptr);
+    FW_ASSERT((capacity > 0) && ((capacity & (capacity - 1)) == 0), static_cast<FwAssertArgType>(capacity));
+    this->m_cells = cells;
+    this->m_mask = capacity - 1;
+    for (FwSizeType i = 0; i < capacity; i++) {
+        this->m_cells[i].m_sequence.store(i, std::memory_order_relaxed);
+        this->m_cells[i].m_value = 0;
+    }
+    this->m_pushPosition.store(0, std::memory_order_relaxed);
+    this->m_popPosition.store(0, std::memory_order_relaxed);
+}
+
+bool MpscIndexRing ::push(FwSizeType value) {
+    FwSizeType position = this->m_pushPosition.load(std::memory_order_relaxed);
+    Cell* cell = nullptr;
+    while (true) {
+        cell = &this->m_cells[position & this->m_mask];
+        const FwSizeType sequence = cell->m_sequence.load(std::memory_order_acquire);
+        const FwSignedSizeType difference = static_cast<FwSignedSizeType>(sequence - position);
+        // Cell is free for this position: claim it
+        if (difference == 0) {
+            if (this->m_pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+        // Cell still holds a value from the previous lap: ring is full
+        else if (difference < 0) {
+            return false;
+        }
+        // Another producer claimed this position first
+        else {
+            position = this->m_pushPosition.load(std::memory_order_relaxed);
+        }
+    }
+    cell->m_value = value;
+    cell->m_sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+bool MpscIndexRing ::pop(FwSizeType& value) {
+    FwSizeType position = this->m_popPosition.load(std::memory_order_relaxed);
+    Cell* cell = nullptr;
+    while (true) {
+        cell = &this->m_cells[position & this->m_mask];
+        const FwSizeType sequence = cell->m_sequence.load(std::memory_order_acquire);
+        const FwSignedSizeType difference = static_cast<FwSignedSizeType>(sequence - (position + 1));
+        // Cell has been published for this position: claim it
+        if (difference == 0) {
+            if (this->m_popPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+        // Cell not yet published: ring is empty
+        else if (difference < 0) {
+            return false;
+        }
+        // Another consumer claimed this position first
+        else {
+            position = this->m_popPosition.load(std::memory_order_relaxed);
+        }
+    }
+    value = cell->m_value;
+    cell->m_sequence.store(position + this->m_mask + 1, std::memory_order_release);
+    return true;
+}
+
+MpscIndexRing& MpscQueueHandle ::lane_ring(FwQueuePriorityType priority) {
+    const FwSizeType lane = FW_MIN(static_cast<FwSizeType>(priority), LANE_COUNT - 1);
+    return this->m_rings[1 + lane];
+}
+
+bool MpscQueueHandle ::try_send(const U8* buffer, FwSizeType size, FwQueuePriorityType priority) {
+    FwSizeType index = 0;
+    if (not this->free_ring().pop(index)) {
+        return false;
+    }
+    FW_ASSERT(index < this->m_depth, static_cast<FwAssertArgType>(index));
+    // Count before publishing so the receiver never decrements below zero
+    const FwSizeType count = this->m_count.fetch_add(1, std::memory_order_relaxed) + 1;
+    FwSizeType highMark = this->m_highMark.load(std::memory_order_relaxed);
+    while ((count > highMark) &&
+           not this->m_highMark.compare_exchange_weak(highMark, count, std::memory_order_relaxed)) {
+    }
+    // Slot is exclusively owned until its index is published to a lane
+    (void)::memcpy(this->m_data + (this->m_maxSize * index), buffer, static_cast<size_t>(size));
+    this->m_info[index].m_size = size;
+    this->m_info[index].m_priority = priority;
+    // Lane capacity is at least depth, so the push cannot fail
+    const bool pushed = this->lane_ring(priority).push(index);
+    FW_ASSERT(pushed);
+    return true;
+}
+
+bool MpscQueueHandle ::try_receive(U8* destination,
+                                   FwSizeType capacity,
+                                   FwSizeType& actualSize,
+                                   FwQueuePriorityType& priority) {
+    FwSizeType index = 0;
+    bool found = false;
+    // Scan from the highest priority lane down
+    for (FwSizeType lane = LANE_COUNT; (lane > 0) and not found; lane--) {
+        found = this->m_rings[lane].pop(index);
+    }
+    if (not found) {
+        return false;
+    }
+    FW_ASSERT(index < this->m_depth, static_cast<FwAssertArgType>(index));
+    actualSize = this->m_info[index].m_size;
+    priority = this->m_info[index].m_priority;
+    FW_ASSERT(actualSize <= capacity, static_cast<FwAssertArgType>(actualSize), static_cast<FwAssertArgType>(capacity));
+    (void)::memcpy(destination, this->m_data + (this->m_maxSize * index), static_cast<size_t>(actualSize));
+    // Uncount before freeing so the count never exceeds depth
+    (void)this->m_count.fetch_sub(1, std::memory_order_relaxed);
+    // Free ring holds at most depth indices, so the push cannot fail
+    const bool pushed = this->free_ring().push(index);
+    FW_ASSERT(pushed);
+    return true;
+}
+
+MpscQueue::~MpscQueue() {
+    this->teardown();
+}
+
+QueueInterface::Status MpscQueue::create(FwEnumStoreType id,
+                                         const Fw::ConstStringBase& name,
+                                         FwSizeType depth,
+                                         FwSizeType messageSize) {
+    // Ensure we are created exactly once
+    FW_ASSERT(this->m_handle.m_allocation == nullptr);
+    FW_ASSERT(depth > 0);
+
+    // Ring capacity is the next power of two holding depth entries
+    FwSizeType capacity = 1;
+    while (capacity < depth) {
+        FW_ASSERT(capacity <= (std::numeric_limits<FwSizeType>::max() / 2));
+        capacity = capacity * 2;
+    }
+    // Prevent integer overflow when computing the allocation layout
+    const FwSizeType max = std::numeric_limits<FwSizeType>::max();
+    FW_ASSERT(capacity <= (max / 2) / (sizeof(MpscIndexRing::Cell) * RING_COUNT));
+    FW_ASSERT(depth <= (max / 4) / sizeof(MpscQueueHandle::MessageInfo));
+    FW_ASSERT((messageSize == 0) || (depth <= (max / 4) / messageSize));
+
+    // Single allocation: rings | cells | message info | message data
+    const FwSizeType cellsOffset = align_up(sizeof(MpscIndexRing) * RING_COUNT, alignof(MpscIndexRing::Cell));
+    const FwSizeType cellsSize = sizeof(MpscIndexRing::Cell) * RING_COUNT * capacity;
+    const FwSizeType infoOffset = align_up(cellsOffset + cellsSize, alignof(MpscQueueHandle::MessageInfo));
+    const FwSizeType dataOffset = infoOffset + (sizeof(MpscQueueHandle::MessageInfo) * depth);
+    const FwSizeType required = dataOffset + (messageSize * depth);
+
+    Fw::MemAllocator& allocator = Fw::MemAllocatorRegistry::getInstance().getAnAllocator(
+        Fw::MemoryAllocation::MemoryAllocatorType::OS_GENERIC_PRIORITY_QUEUE);
+    FwSizeType size = required;
+    void* allocation = allocator.allocate(id, size, alignof(MpscIndexRing));
+    if (allocation == nullptr) {
+        return QueueInterface::Status::ALLOCATION_FAILED;
+    } else if (size < required) {
+        allocator.deallocate(id, allocation);
+        return QueueInterface::Status::ALLOCATION_FAILED;
+    }
+    U8* bytes = static_cast<U8*>(allocation);
+    MpscIndexRing* rings = Fw::arrayPlacementNew<MpscIndexRing>(Fw::ByteArray(bytes, cellsOffset), RING_COUNT);
+    MpscIndexRing::Cell* cells = Fw::arrayPlacementNew<MpscIndexRing::Cell>(
+        Fw::ByteArray(bytes + cellsOffset, infoOffset - cellsOffset), RING_COUNT * capacity);
+    MpscQueueHandle::MessageInfo* info = Fw::arrayPlacementNew<MpscQueueHandle::MessageInfo>(
+        Fw::ByteArray(bytes + infoOffset, dataOffset - infoOffset), depth);
+    for (FwSizeType i = 0; i < RING_COUNT; i++) {
+        rings[i].setup(cells + (i * capacity), capacity);
+    }
+    // All slots start free
+    for (FwSizeType i = 0; i < depth; i++) {
+        info[i].m_size = 0;
+        info[i].m_priority = 0;
+        const bool pushed = rings[0].push(i);
+        FW_ASSERT(pushed);
+    }
+    // Set local tracking variables
+    this->m_handle.m_id = id;
+    this->m_handle.m_allocation = bytes;
+    this->m_handle.m_rings = rings;
+    this->m_handle.m_info = info;
+    this->m_handle.m_data = bytes + dataOffset;
+    this->m_handle.m_depth = depth;
+    this->m_handle.m_maxSize = messageSize;
+    this->m_handle.m_count.store(0);
+    this->m_handle.m_highMark.store(0);
+    return QueueInterface::Status::OP_OK;
+}
+
+void MpscQueue::teardown() {
+    if (this->m_handle.m_allocation != nullptr) {
+        Fw::MemAllocator& allocator = Fw::MemAllocatorRegistry::getInstance().getAnAllocator(
+            Fw::MemoryAllocation::MemoryAllocatorType::OS_GENERIC_PRIORITY_QUEUE);
+        Fw::arrayPlacementDestruct<MpscIndexRing>(this->m_handle.m_rings, RING_COUNT);
+        allocator.deallocate(this->m_handle.m_id, this->m_handle.m_allocation);
+
+        // Set these pointers to nullptr
+        this->m_handle.m_allocation = nullptr;
+        this->m_handle.m_rings = nullptr;
+        this->m_handle.m_info = nullptr;
+        this->m_handle.m_data = nullptr;
+    }
+}
+
+QueueInterface::Status MpscQueue::send(const U8* buffer,
+                                       FwSizeType size,
+                                       FwQueuePriorityType priority,
+                                       QueueInterface::BlockingType blockType) {
+    FW_ASSERT(buffer != nullptr);
+    if (size > this->m_handle.m_maxSize) {
+        return QueueInterface::Status::SIZE_MISMATCH;
+    }
+    // Fast path: no lock is taken
+    if (not this->m_handle.try_send(buffer, size, priority)) {
+        if (blockType == BlockingType::NONBLOCKING) {
+            return QueueInterface::Status::FULL;
+        }
+        // Slow path: register as a waiter before re-checking so a concurrent receive sees the registration
+        Os::ScopeLock lock(this->m_handle.m_wait_lock);
+        (void)this->m_handle.m_fullWaiters.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        while (not this->m_handle.try_send(buffer, size, priority)) {
+            this->m_handle.m_full.wait(this->m_handle.m_wait_lock);
+        }
+        (void)this->m_handle.m_fullWaiters.fetch_sub(1);
+    }
+    // Wake a blocked receiver only when one is registered
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (this->m_handle.m_emptyWaiters.load() > 0) {
+        // Passing through the lock guarantees the waiter is either re-checking or waiting
+        { Os::ScopeLock lock(this->m_handle.m_wait_lock); }
+        this->m_handle.m_empty.notify();
+    }
+    return QueueInterface::Status::OP_OK;
+}
+
+QueueInterface::Status MpscQueue::receive(U8* destination,
+                                          FwSizeType capacity,
+                                          QueueInterface::BlockingType blockType,
+                                          FwSizeType& actualSize,
+                                          FwQueuePriorityType& priority) {
+    FW_ASSERT(destination != nullptr);
+    // Fast path: no lock is taken
+    if (not this->m_handle.try_receive(destination, capacity, actualSize, priority)) {
+        if (blockType == BlockingType::NONBLOCKING) {
+            return QueueInterface::Status::EMPTY;
+        }
+        // Slow path: register as a waiter before re-checking so a concurrent send sees the registration
+        Os::ScopeLock lock(this->m_handle.m_wait_lock);
+        (void)this->m_handle.m_emptyWaiters.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        while (not this->m_handle.try_receive(destination, capacity, actualSize, priority)) {
+            this->m_handle.m_empty.wait(this->m_handle.m_wait_lock);
+        }
+        (void)this->m_handle.m_emptyWaiters.fetch_sub(1);
+    }
+    // Wake a blocked sender only when one is registered
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (this->m_handle.m_fullWaiters.load() > 0) {
+        // Passing through the lock guarantees the waiter is either re-checking or waiting
+        { Os::ScopeLock lock(this->m_handle.m_wait_lock); }
+        this->m_handle.m_full.notify();
+    }
+    return QueueInterface::Status::OP_OK;
+}
+
+FwSizeType MpscQueue::getMessagesAvailable() const {
+    return this->m_handle.m_count.load();
+}
+
+FwSizeType MpscQueue::getMessageHighWaterMark() const {
+    return this->m_handle.m_highMark.load();
+}
+
+QueueHandle* MpscQueue::getHandle() {
+    return &this->m_handle;
+}
+
+}  // namespace Generic
+}  // namespace Os
@@ -0,0 +1,199 @@
+// ======================================================================
+// \title Os/Generic/MpscQueue.hpp
+// \brief lock-free multi-producer single-consumer queue implementation definitions for Os::Queue
+// ======================================================================
+#include <atomic>
+#include "Os/Condition.hpp"
+#include "Os/Mutex.hpp"
+#include "Os/Queue.hpp"
+#ifndef OS_GENERIC_MPSCQUEUE_HPP
+#define OS_GENERIC_MPSCQUEUE_HPP
+
+namespace Os {
+namespace Generic {
+
+//! \brief bounded lock-free ring of slot indices
+//!
+//! Ring of indices built on per-cell sequence numbers (Vyukov bounded queue). Any number of threads may push and pop
+//! concurrently. Capacity must be a power of two. The producer and consumer positions are padded onto separate cache
+//! lines to avoid false sharing between senders and the receiver.
+struct MpscIndexRing {
+    //! \brief ring cell holding one index and its sequence number
+    struct Cell {
+        std::atomic<FwSizeType> m_sequence;  //!< Sequence number gating access to the cell
+        FwSizeType m_value;                  //!< Stored index
+    };
+    static constexpr FwSizeType CACHE_LINE_SIZE = 64;
+
+    Cell* m_cells = nullptr;  //!< Cell storage
+    FwSizeType m_mask = 0;    //!< Capacity - 1
+    U8 m_pad0[CACHE_LINE_SIZE];
+    std::atomic<FwSizeType> m_pushPosition;  //!< Next position to push into
+    U8 m_pad1[CACHE_LINE_SIZE];
+    std::atomic<FwSizeType> m_popPosition;  //!< Next position to pop from
+    U8 m_pad2[CACHE_LINE_SIZE];
+
+    //!\brief attach cell storage and reset the ring to empty
+    //!\param cells: storage for `capacity` cells
+    //!\param capacity: number of cells, must be a power of two
+    void setup(Cell* cells, FwSizeType capacity);
+
+    //!\brief push an index into the ring
+    //!\param value: index to push
+    //!\return true on success, false when the ring is full
+    bool push(FwSizeType value);
+
+    //!\brief pop an index from the ring
+    //!\param value: (output) popped index
+    //!\return true on success, false when the ring is empty
+    bool pop(FwSizeType& value);
+};
+
+//! \brief critical data stored for the MPSC queue
+//!
+//! The MPSC queue stores message data in an unordered block of `depth` slots. A free ring holds the indices of unused
+//! slots, and one lane ring per priority lane holds the indices of queued messages in arrival order. All rings live in
+//! the single allocation made at create time, leaving only pointers and counters in the handle.
+struct MpscQueueHandle : public QueueHandle {
+    //! \brief per-slot message information
+    struct MessageInfo {
+        FwSizeType m_size;               //!< Size of the message in the slot
+        FwQueuePriorityType m_priority;  //!< Priority the message was sent with
+    };
+
+    U8* m_allocation = nullptr;          //!< Pointer to the single backing allocation
+    MpscIndexRing* m_rings = nullptr;    //!< Free ring followed by MPSC_QUEUE_PRIORITY_LANES lane rings
+    MessageInfo* m_info = nullptr;       //!< Message information per slot
+    U8* m_data = nullptr;                //!< Message data per slot
+    FwSizeType m_depth = 0;              //!< Depth of the queue
+    FwSizeType m_maxSize = 0;            //!< Maximum size allowed of a message
+    std::atomic<FwSizeType> m_count;     //!< Number of occupied slots
+    std::atomic<FwSizeType> m_highMark;  //!< Message count high water mark
+    std::atomic<U32> m_emptyWaiters;     //!< Number of receivers blocked on empty
+    std::atomic<U32> m_fullWaiters;      //!< Number of senders blocked on full
+    FwEnumStoreType m_id = 0;            //!< Identifier for the queue, used for memory allocation
+    Os::Mutex m_wait_lock;               //!< Lock used only by the blocking slow path
+    Os::ConditionVariable m_full;        //!< Queue full condition variable to support blocking
+    Os::ConditionVariable m_empty;       //!< Queue empty condition variable to support blocking
+
+    MpscQueueHandle() : m_count(0), m_highMark(0), m_emptyWaiters(0), m_fullWaiters(0) {}
+
+    //!\brief get the ring holding free slot indices
+    MpscIndexRing& free_ring() { return this->m_rings[0]; }
+
+    //!\brief get the ring holding queued slot indices for a priority
+    MpscIndexRing& lane_ring(FwQueuePriorityType priority);
+
+    //!\brief attempt to send without blocking
+    bool try_send(const U8* buffer, FwSizeType size, FwQueuePriorityType priority);
+
+    //!\brief attempt to receive without blocking
+    bool try_receive(U8* destination, FwSizeType capacity, FwSizeType& actualSize, FwQueuePriorityType& priority);
+};
+
+//! \brief generic lock-free multi-producer single-consumer queue implementation
+//!
+//! An implementation of Os::QueueInterface where senders and the receiver exchange messages through lock-free index
+//! rings. Message data is copied with no lock held. Messages are ordered by priority lane (see
+//! Os::MPSC_QUEUE_PRIORITY_LANES) and FIFO within a lane: priorities at or above the top lane share that lane.
+//! Os::Mutex and Os::ConditionVariable are used only when a BLOCKING call finds the queue empty or full.
+//!
+//! \warning This queue is not ISR safe
+//! \warning allocates memory through the memory allocator registry
+class MpscQueue : public Os::QueueInterface {
+  public:
+    //! \brief default queue interface constructor
+    MpscQueue() = default;
+
+    //! \brief default queue destructor
+    virtual ~MpscQueue();
+
+    //! \brief copy constructor is forbidden
+    MpscQueue(const QueueInterface& other) = delete;
+
+    //! \brief copy constructor is forbidden
+    MpscQueue(const QueueInterface* other) = delete;
+
+    //! \brief assignment operator is forbidden
+    MpscQueue& operator=(const QueueInterface& other) override = delete;
+
+    //! \brief create queue storage
+    //!
+    //! Creates a queue ensuring sufficient storage to hold `depth` messages of `messageSize` size each.
+    //!
+    //! \warning allocates memory through the memory allocator registry
+    //!
+    //! \param id: identifier for the queue, used for memory allocation
+    //! \param name: name of queue
+    //! \param depth: depth of queue in number of messages
+    //! \param messageSize: size of an individual message
+    //! \return: status of the creation
+    Status create(FwEnumStoreType id,
+                  const Fw::ConstStringBase& name,
+                  FwSizeType depth,
+                  FwSizeType messageSize) override;
+
+    //! \brief teardown the queue
+    //!
+    //! Allow for queues to deallocate resources as part of system shutdown. This delegates to the underlying queue
+    //! implementation.
+    void teardown() override;
+
+    //! \brief send a message into the queue
+    //!
+    //! Send a message into the queue, providing the message data, size, priority, and blocking type. When
+    //! `blockType` is set to BLOCKING, this call will block on queue full. Otherwise, this will return an error
+    //! status on queue full.
+    //!
+    //! \warning It is invalid to send a null buffer
+    //! \warning This method will block if the queue is full and blockType is set to BLOCKING
+    //! \warning This method is not ISR safe
+    //!
+    //! \param buffer: message data
+    //! \param size: size of message data
+    //! \param priority: priority of the message
+    //! \param blockType: BLOCKING to block for space or NONBLOCKING to return error when queue is full
+    //! \return: status of the send
+    Status send(const U8* buffer, FwSizeType size, FwQueuePriorityType priority, BlockingType blockType) override;
+
+    //! \brief receive a message from the queue
+    //!
+    //! Receive a message from the queue, providing the message destination, capacity, priority, and blocking type.
+    //! When `blockType` is set to BLOCKING, this call will block on queue empty. Otherwise, this will return an
+    //! error status on queue empty. Actual size received and priority of message is set on success status.
+    //!
+    //! \warning It is invalid to send a null buffer
+    //! \warning This method will block if the queue is empty and blockType is set to BLOCKING
+    //!
+    //! \param destination: destination for message data
+    //! \param capacity: maximum size of message data
+    //! \param blockType: BLOCKING to wait for message or NONBLOCKING to return error when queue is empty
+    //! \param actualSize: (output) actual size of message read
+    //! \param priority: (output) priority of message read
+    //! \return: status of the send
+    Status receive(U8* destination,
+                   FwSizeType capacity,
+                   BlockingType blockType,
+                   FwSizeType& actualSize,
+                   FwQueuePriorityType& priority) override;
+
+    //! \brief get number of messages available
+    //!
+    //! \return number of messages available
+    FwSizeType getMessagesAvailable() const override;
+
+    //! \brief get maximum messages stored at any given time
+    //!
+    //! Returns the maximum number of messages in this queue at any given time. This is the high-water mark for this
+    //! queue.
+    //! \return queue message high-water mark
+    FwSizeType getMessageHighWaterMark() const override;
+
+    QueueHandle* getHandle() override;
+
+    MpscQueueHandle m_handle;
+};
+}  // namespace Generic
+}  // namespace Os
+
+#endif  // OS_GENERIC_MPSCQUEUE_HPP
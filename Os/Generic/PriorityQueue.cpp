@@ -232,6 +232,48 @@ QueueInterface::Status PriorityQueue::receive(U8* destination,
     return QueueInterface::Status::OP_OK;
 }
 
+QueueInterface::Status PriorityQueue::receiveBatch(U8* destination,
+                                                   FwSizeType capacity,
+                                                   FwSizeType maxMessages,
+                                                   QueueInterface::BlockingType blockType,
+                                                   FwSizeType* actualSizes,
+                                                   FwQueuePriorityType* priorities,
+                                                   FwSizeType& actualCount) {
+    FW_ASSERT(maxMessages > 0);
+    actualCount = 0;
+    {
+        Os::ScopeLock lock(this->m_handle.m_data_lock);
+        if (this->m_handle.m_heap.isEmpty() and blockType == BlockingType::NONBLOCKING) {
+            return QueueInterface::Status::EMPTY;
+        }
+        // Loop and lock while empty
+        while (this->m_handle.m_heap.isEmpty()) {
+            this->m_handle.m_empty.wait(this->m_handle.m_data_lock);
+        }
+        // Drain in priority order until the batch is full or the queue is empty
+        while ((actualCount < maxMessages) and not this->m_handle.m_heap.isEmpty()) {
+            FwSizeType index;
+            FW_ASSERT(this->m_handle.m_heap.pop(priorities[actualCount], index));
+            actualSizes[actualCount] = this->m_handle.m_sizes[index];
+            FW_ASSERT(actualSizes[actualCount] <= capacity);
+            this->m_handle.load_data(index, destination + (actualCount * capacity), actualSizes[actualCount]);
+            this->m_handle.return_index(index);
+            actualCount++;
+        }
+    }
+    // Several slots may have been freed, wake every blocked sender
+    this->m_handle.m_full.notifyAll();
+    return QueueInterface::Status::OP_OK;
+}
+
+QueueInterface::Status PriorityQueue::peekPriority(FwQueuePriorityType& priority) {
+    Os::ScopeLock lock(this->m_handle.m_data_lock);
+    if (not this->m_handle.m_heap.peek(priority)) {
+        return QueueInterface::Status::EMPTY;
+    }
+    return QueueInterface::Status::OP_OK;
+}
+
 FwSizeType PriorityQueue::getMessagesAvailable() const {
     return this->m_handle.m_heap.getSize();
 }
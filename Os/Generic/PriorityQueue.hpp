@@ -140,6 +140,37 @@ class PriorityQueue : public Os::QueueInterface {
                    FwSizeType& actualSize,
                    FwQueuePriorityType& priority) override;
 
+    //! \brief receive up to `maxMessages` messages from the queue
+    //!
+    //! Receive a batch of messages under a single acquisition of the data lock. See: QueueInterface::receiveBatch.
+    //! When `blockType` is set to BLOCKING, this call will block until at least one message is available.
+    //!
+    //! \warning This method will block if the queue is empty and blockType is set to BLOCKING
+    //!
+    //! \param destination: destination for message data, at least `capacity * maxMessages` bytes
+    //! \param capacity: maximum size of each message
+    //! \param maxMessages: maximum number of messages to receive
+    //! \param blockType: BLOCKING to wait for a message or NONBLOCKING to return error when queue is empty
+    //! \param actualSizes: (output) actual size of each message read
+    //! \param priorities: (output) priority of each message read
+    //! \param actualCount: (output) number of messages read
+    //! \return: status of the receive
+    Status receiveBatch(U8* destination,
+                        FwSizeType capacity,
+                        FwSizeType maxMessages,
+                        BlockingType blockType,
+                        FwSizeType* actualSizes,
+                        FwQueuePriorityType* priorities,
+                        FwSizeType& actualCount) override;
+
+    //! \brief get the priority of the next message without receiving it
+    //!
+    //! Reads the top of the heap under the data lock. See: QueueInterface::peekPriority.
+    //!
+    //! \param priority: (output) priority of the next message
+    //! \return: status of the peek
+    Status peekPriority(FwQueuePriorityType& priority) override;
+
     //! \brief get number of messages available
     //!
     //! \return number of messages available
@@ -138,6 +138,14 @@ bool MaxHeap::pop(FwQueuePriorityType& value, FwSizeType& id) {
     return true;
 }
 
+bool MaxHeap::peek(FwQueuePriorityType& value) const {
+    if (this->m_size == 0) {
+        return false;
+    }
+    value = this->m_heap[0].value;
+    return true;
+}
+
 // Is the heap full:
 bool MaxHeap::isFull() {
     return (this->m_size == this->m_capacity);
@@ -67,6 +67,14 @@ class MaxHeap {
     //! \param id the identifier of the element popped from the heap
     //!
     bool pop(FwQueuePriorityType& value, FwSizeType& id);
+    //! \brief Peek at the top of the heap.
+    //!
+    //! Return the value of the item that the next pop would return,
+    //! without removing it.
+    //!
+    //! \param value the value of the element at the top of the heap
+    //!
+    bool peek(FwQueuePriorityType& value) const;
     //! \brief Is the heap full?
     //!
     //! Has the heap reached max size. No new items can be put on the
@@ -208,6 +208,30 @@ TEST(Nominal, PushPop) {
     printf("Passed.\n");
 }
 
+TEST(Nominal, Peek) {
+    alignas(Types::MaxHeap::ALIGNMENT) U8 heap_allocation[Types::MaxHeap::ELEMENT_SIZE * DEPTH];
+    Types::MaxHeap heap;
+    heap.create(DEPTH, Fw::ByteArray(heap_allocation, sizeof(heap_allocation)));
+
+    FwQueuePriorityType value = 0;
+    FwSizeType id = 0;
+    ASSERT_FALSE(heap.peek(value));
+
+    ASSERT_TRUE(heap.push(3, 0));
+    ASSERT_TRUE(heap.push(7, 1));
+    ASSERT_TRUE(heap.push(5, 2));
+
+    // Peek reports what pop returns without changing the heap
+    for (FwSizeType ii = 0; ii < 3; ++ii) {
+        FwQueuePriorityType peeked = 0;
+        ASSERT_TRUE(heap.peek(peeked));
+        ASSERT_EQ(heap.getSize(), 3 - ii);
+        ASSERT_TRUE(heap.pop(value, id));
+        ASSERT_EQ(peeked, value);
+    }
+    ASSERT_FALSE(heap.peek(value));
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,120 @@
+// ======================================================================
+// \title Os/Generic/test/ut/MpscQueueTests.cpp
+// \brief tests using generic lock-free MPSC implementation for Os::Queue interface testing
+// ======================================================================
+#include <gtest/gtest.h>
+#include "Fw/Types/String.hpp"
+#include "Os/Generic/MpscQueue.hpp"
+#include "Os/Task.hpp"
+#include "STest/Random/Random.hpp"
+
+namespace {
+
+constexpr FwSizeType STRESS_PRODUCERS = 4;
+constexpr U32 STRESS_MESSAGES = 20000;
+constexpr FwSizeType STRESS_DEPTH = 16;
+
+//! Message sent by a stress producer: the producer index and its sequence number
+struct StressMessage {
+    U32 producer;
+    U32 sequence;
+};
+
+struct StressProducer {
+    Os::Generic::MpscQueue* queue;
+    U32 index;
+};
+
+// Send STRESS_MESSAGES numbered messages, blocking whenever the queue is full
+void stressProducerRoutine(void* pointer) {
+    StressProducer* producer = static_cast<StressProducer*>(pointer);
+    const FwQueuePriorityType priority =
+        static_cast<FwQueuePriorityType>(producer->index % Os::MPSC_QUEUE_PRIORITY_LANES);
+    for (U32 i = 0; i < STRESS_MESSAGES; i++) {
+        const StressMessage message = {producer->index, i};
+        const Os::QueueInterface::Status status =
+            producer->queue->send(reinterpret_cast<const U8*>(&message), sizeof(message), priority,
+                                  Os::QueueInterface::BlockingType::BLOCKING);
+        FW_ASSERT(status == Os::QueueInterface::Status::OP_OK, static_cast<FwAssertArgType>(status));
+    }
+}
+
+}  // namespace
+
+// Priorities above the top lane share it and are received in the order sent
+TEST(MpscQueue, TopLaneIsFifo) {
+    Os::Generic::MpscQueue queue;
+    const FwQueuePriorityType top = static_cast<FwQueuePriorityType>(Os::MPSC_QUEUE_PRIORITY_LANES - 1);
+    const FwQueuePriorityType priorities[] = {0, static_cast<FwQueuePriorityType>(top + 1), top, 1};
+    const U8 expected[] = {1, 2, 3, 0};
+    Fw::String name("MpscQueue");
+    ASSERT_EQ(queue.create(0, name, FW_NUM_ARRAY_ELEMENTS(priorities), sizeof(U8)),
+              Os::QueueInterface::Status::OP_OK);
+    for (U8 i = 0; i < FW_NUM_ARRAY_ELEMENTS(priorities); i++) {
+        ASSERT_EQ(queue.send(&i, sizeof(i), priorities[i], Os::QueueInterface::BlockingType::NONBLOCKING),
+                  Os::QueueInterface::Status::OP_OK);
+    }
+    for (FwSizeType i = 0; i < FW_NUM_ARRAY_ELEMENTS(expected); i++) {
+        U8 received = 0;
+        FwSizeType size = 0;
+        FwQueuePriorityType priority = 0;
+        ASSERT_EQ(queue.receive(&received, sizeof(received), Os::QueueInterface::BlockingType::NONBLOCKING, size,
+                                priority),
+                  Os::QueueInterface::Status::OP_OK);
+        EXPECT_EQ(size, sizeof(U8));
+        EXPECT_EQ(received, expected[i]);
+        EXPECT_EQ(priority, priorities[received]);
+    }
+    EXPECT_EQ(queue.getMessageHighWaterMark(), FW_NUM_ARRAY_ELEMENTS(priorities));
+}
+
+// Concurrent producers against one consumer: every message is received exactly once, in the order its producer sent it
+TEST(MpscQueue, ConcurrentProducers) {
+    Os::Generic::MpscQueue queue;
+    Fw::String name("MpscStress");
+    ASSERT_EQ(queue.create(0, name, STRESS_DEPTH, sizeof(StressMessage)), Os::QueueInterface::Status::OP_OK);
+
+    Os::Task tasks[STRESS_PRODUCERS];
+    StressProducer producers[STRESS_PRODUCERS];
+    for (FwSizeType i = 0; i < STRESS_PRODUCERS; i++) {
+        producers[i] = {&queue, static_cast<U32>(i)};
+        Os::Task::Arguments arguments(Fw::String("MpscProducer"), stressProducerRoutine, &producers[i]);
+        ASSERT_EQ(tasks[i].start(arguments), Os::Task::OP_OK);
+    }
+
+    // Each producer sends on a single priority, which is FIFO, so its messages arrive in sequence order
+    U32 expected[STRESS_PRODUCERS] = {};
+    for (FwSizeType i = 0; i < STRESS_PRODUCERS * STRESS_MESSAGES; i++) {
+        StressMessage message = {0, 0};
+        FwSizeType size = 0;
+        FwQueuePriorityType priority = 0;
+        ASSERT_EQ(queue.receive(reinterpret_cast<U8*>(&message), sizeof(message),
+                                Os::QueueInterface::BlockingType::BLOCKING, size, priority),
+                  Os::QueueInterface::Status::OP_OK);
+        ASSERT_EQ(size, sizeof(message));
+        ASSERT_LT(message.producer, STRESS_PRODUCERS);
+        ASSERT_EQ(priority, message.producer % Os::MPSC_QUEUE_PRIORITY_LANES);
+        ASSERT_EQ(message.sequence, expected[message.producer]) << "lost or duplicated message";
+        expected[message.producer]++;
+    }
+    for (FwSizeType i = 0; i < STRESS_PRODUCERS; i++) {
+        ASSERT_EQ(tasks[i].join(), Os::Task::OP_OK);
+        EXPECT_EQ(expected[i], STRESS_MESSAGES);
+    }
+
+    // Nothing is left behind
+    EXPECT_EQ(queue.getMessagesAvailable(), 0);
+    StressMessage message = {0, 0};
+    FwSizeType size = 0;
+    FwQueuePriorityType priority = 0;
+    EXPECT_EQ(queue.receive(reinterpret_cast<U8*>(&message), sizeof(message),
+                            Os::QueueInterface::BlockingType::NONBLOCKING, size, priority),
+              Os::QueueInterface::Status::EMPTY);
+    EXPECT_LE(queue.getMessageHighWaterMark(), STRESS_DEPTH);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    STest::Random::seed();
+    return RUN_ALL_TESTS();
+}
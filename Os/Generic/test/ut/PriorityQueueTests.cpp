@@ -3,9 +3,117 @@
 // \brief tests using generic priority implementation for Os::Queue interface testing
 // ======================================================================
 #include <gtest/gtest.h>
+#include "Fw/Types/String.hpp"
 #include "Os/Generic/PriorityQueue.hpp"
+#include "Os/Queue.hpp"
 #include "STest/Random/Random.hpp"
 
+// Batched receives drain in priority order and count held messages as available
+TEST(PriorityQueue, BatchReceive) {
+    Os::Queue queue;
+    Fw::String name("BatchQueue");
+    const FwQueuePriorityType priorities[] = {1, 5, 3, 5, 0, 2};
+    const U8 expected[] = {1, 3, 2, 5, 0, 4};
+    ASSERT_EQ(queue.create(0, name, FW_NUM_ARRAY_ELEMENTS(priorities), sizeof(U8)), Os::QueueInterface::Status::OP_OK);
+    ASSERT_EQ(queue.enableBatchReceive(4), Os::QueueInterface::Status::OP_OK);
+    ASSERT_EQ(queue.enableBatchReceive(4), Os::QueueInterface::Status::ALREADY_CREATED);
+    for (U8 i = 0; i < FW_NUM_ARRAY_ELEMENTS(priorities); i++) {
+        ASSERT_EQ(queue.send(&i, sizeof(i), priorities[i], Os::QueueInterface::BlockingType::NONBLOCKING),
+                  Os::QueueInterface::Status::OP_OK);
+    }
+    for (FwSizeType i = 0; i < FW_NUM_ARRAY_ELEMENTS(expected); i++) {
+        U8 received = 0;
+        FwSizeType size = 0;
+        FwQueuePriorityType priority = 0;
+        ASSERT_EQ(queue.receive(&received, sizeof(received), Os::QueueInterface::BlockingType::NONBLOCKING, size,
+                                priority),
+                  Os::QueueInterface::Status::OP_OK);
+        EXPECT_EQ(received, expected[i]);
+        EXPECT_EQ(priority, priorities[received]);
+        EXPECT_EQ(queue.getMessagesAvailable(), FW_NUM_ARRAY_ELEMENTS(expected) - i - 1);
+    }
+    U8 received = 0;
+    FwSizeType size = 0;
+    FwQueuePriorityType priority = 0;
+    EXPECT_EQ(queue.receive(&received, sizeof(received), Os::QueueInterface::BlockingType::NONBLOCKING, size, priority),
+              Os::QueueInterface::Status::EMPTY);
+    queue.teardown();
+}
+
+// A message sent while a batch is held is received ahead of held messages of lower priority only
+TEST(PriorityQueue, BatchReceiveKeepsPriority) {
+    Os::Queue queue;
+    Fw::String name("BatchQueue");
+    ASSERT_EQ(queue.create(0, name, 8, sizeof(U8)), Os::QueueInterface::Status::OP_OK);
+    ASSERT_EQ(queue.enableBatchReceive(4), Os::QueueInterface::Status::OP_OK);
+    // Held batch: 0 (priority 4), 1 (priority 2), 2 (priority 2)
+    const FwQueuePriorityType heldPriorities[] = {4, 2, 2};
+    for (U8 i = 0; i < FW_NUM_ARRAY_ELEMENTS(heldPriorities); i++) {
+        ASSERT_EQ(queue.send(&i, sizeof(i), heldPriorities[i], Os::QueueInterface::BlockingType::NONBLOCKING),
+                  Os::QueueInterface::Status::OP_OK);
+    }
+    U8 received = 0xFF;
+    FwSizeType size = 0;
+    FwQueuePriorityType priority = 0;
+    ASSERT_EQ(queue.receive(&received, sizeof(received), Os::QueueInterface::BlockingType::NONBLOCKING, size, priority),
+              Os::QueueInterface::Status::OP_OK);
+    EXPECT_EQ(received, 0);
+    // Sent while 1 and 2 are held: 3 and 4 outrank them, 5 ties with them and stays behind
+    const U8 late[] = {3, 4, 5};
+    const FwQueuePriorityType latePriorities[] = {7, 3, 2};
+    for (FwSizeType i = 0; i < FW_NUM_ARRAY_ELEMENTS(late); i++) {
+        ASSERT_EQ(queue.send(&late[i], sizeof(U8), latePriorities[i], Os::QueueInterface::BlockingType::NONBLOCKING),
+                  Os::QueueInterface::Status::OP_OK);
+    }
+    ASSERT_EQ(queue.peekPriority(priority), Os::QueueInterface::Status::OP_OK);
+    EXPECT_EQ(priority, 7);
+    const U8 expected[] = {3, 4, 1, 2, 5};
+    for (FwSizeType i = 0; i < FW_NUM_ARRAY_ELEMENTS(expected); i++) {
+        ASSERT_EQ(queue.receive(&received, sizeof(received), Os::QueueInterface::BlockingType::NONBLOCKING, size,
+                                priority),
+                  Os::QueueInterface::Status::OP_OK);
+        EXPECT_EQ(received, expected[i]);
+        EXPECT_EQ(queue.getMessagesAvailable(), FW_NUM_ARRAY_ELEMENTS(expected) - i - 1);
+    }
+    EXPECT_EQ(queue.peekPriority(priority), Os::QueueInterface::Status::EMPTY);
+    queue.teardown();
+}
+
+// A direct batch receive returns at most the requested number of messages in priority order
+TEST(PriorityQueue, ReceiveBatch) {
+    Os::Queue queue;
+    Fw::String name("BatchQueue");
+    const FwQueuePriorityType priorities[] = {0, 7, 7, 2};
+    ASSERT_EQ(queue.create(0, name, FW_NUM_ARRAY_ELEMENTS(priorities), sizeof(U8)), Os::QueueInterface::Status::OP_OK);
+    for (U8 i = 0; i < FW_NUM_ARRAY_ELEMENTS(priorities); i++) {
+        ASSERT_EQ(queue.send(&i, sizeof(i), priorities[i], Os::QueueInterface::BlockingType::NONBLOCKING),
+                  Os::QueueInterface::Status::OP_OK);
+    }
+    U8 received[3] = {0, 0, 0};
+    FwSizeType sizes[3] = {0, 0, 0};
+    FwQueuePriorityType batchPriorities[3] = {0, 0, 0};
+    FwSizeType count = 0;
+    ASSERT_EQ(queue.receiveBatch(received, sizeof(U8), 3, Os::QueueInterface::BlockingType::NONBLOCKING, sizes,
+                                 batchPriorities, count),
+              Os::QueueInterface::Status::OP_OK);
+    ASSERT_EQ(count, 3);
+    EXPECT_EQ(received[0], 1);
+    EXPECT_EQ(received[1], 2);
+    EXPECT_EQ(received[2], 3);
+    EXPECT_EQ(batchPriorities[2], 2);
+    EXPECT_EQ(sizes[0], sizeof(U8));
+    EXPECT_EQ(queue.getMessagesAvailable(), 1);
+    ASSERT_EQ(queue.receiveBatch(received, sizeof(U8), 3, Os::QueueInterface::BlockingType::NONBLOCKING, sizes,
+                                 batchPriorities, count),
+              Os::QueueInterface::Status::OP_OK);
+    ASSERT_EQ(count, 1);
+    EXPECT_EQ(received[0], 0);
+    EXPECT_EQ(queue.receiveBatch(received, sizeof(U8), 3, Os::QueueInterface::BlockingType::NONBLOCKING, sizes,
+                                 batchPriorities, count),
+              Os::QueueInterface::Status::EMPTY);
+    queue.teardown();
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     STest::Random::seed();
@@ -0,0 +1,21 @@
+// ======================================================================
+// \title Os/Generic/test/ut/mpsc/QueueRulesDefinitions.hpp
+// \brief definitions for lock-free MPSC queue testing
+// ======================================================================
+#ifndef OS_GENERIC_TEST_UT_MPSC_QUEUE_RULES_DEFINITIONS
+#define OS_GENERIC_TEST_UT_MPSC_QUEUE_RULES_DEFINITIONS
+#include <deque>
+#include <queue>
+#include "Fw/FPrimeBasicTypes.hpp"
+
+//! Orders priorities by lane: priorities sharing the top lane are received in FIFO order
+struct PriorityCompare {
+    bool operator()(const FwQueuePriorityType& a, const FwQueuePriorityType& b) const {
+        return FW_MIN(static_cast<FwSizeType>(a), static_cast<FwSizeType>(Os::MPSC_QUEUE_PRIORITY_LANES) - 1) <
+               FW_MIN(static_cast<FwSizeType>(b), static_cast<FwSizeType>(Os::MPSC_QUEUE_PRIORITY_LANES) - 1);
+    }
+};
+constexpr FwSizeType QUEUE_MESSAGE_SIZE_UPPER_BOUND = 1024;
+constexpr FwSizeType QUEUE_DEPTH_UPPER_BOUND = 100;
+constexpr bool TESTS_SUPPORT_BLOCKING = true;
+#endif  // OS_GENERIC_TEST_UT_MPSC_QUEUE_RULES_DEFINITIONS
@@ -3,8 +3,12 @@
 // \brief common function implementation for Os::Queue
 // ======================================================================
 #include "Os/Queue.hpp"
+#include <cstring>
+#include <limits>
 #include "Fw/Types/Assert.hpp"
+#include "Fw/Types/MemAllocator.hpp"
 #include "Fw/Types/Serializable.hpp"
+#include "config/MemoryAllocatorTypeEnumAc.hpp"
 
 namespace Os {
 
@@ -13,9 +17,54 @@ FwSizeType Queue::s_queueCount = 0;
 QueueRegistry* Queue::s_queueRegistry = nullptr;
 #endif
 
-Queue::Queue() : m_name(""), m_depth(0), m_size(0), m_delegate(*QueueInterface::getDelegate(m_handle_storage)) {}
+QueueInterface::Status QueueInterface::receiveBatch(U8* destination,
+                                                   FwSizeType capacity,
+                                                   FwSizeType maxMessages,
+                                                   BlockingType blockType,
+                                                   FwSizeType* actualSizes,
+                                                   FwQueuePriorityType* priorities,
+                                                   FwSizeType& actualCount) {
+    FW_ASSERT(destination != nullptr);
+    FW_ASSERT(actualSizes != nullptr);
+    FW_ASSERT(priorities != nullptr);
+    FW_ASSERT(maxMessages > 0);
+    actualCount = 0;
+    // Only the first receive may block, the remainder of the batch is whatever is already queued
+    QueueInterface::Status status = this->receive(destination, capacity, blockType, actualSizes[0], priorities[0]);
+    while (status == QueueInterface::Status::OP_OK) {
+        actualCount++;
+        if (actualCount == maxMessages) {
+            break;
+        }
+        status = this->receive(destination + (actualCount * capacity), capacity, BlockingType::NONBLOCKING,
+                               actualSizes[actualCount], priorities[actualCount]);
+    }
+    return (actualCount > 0) ? QueueInterface::Status::OP_OK : status;
+}
+
+QueueInterface::Status QueueInterface::peekPriority(FwQueuePriorityType& priority) {
+    (void)priority;
+    return QueueInterface::Status::NOT_SUPPORTED;
+}
+
+Queue::Queue()
+    : m_name(""),
+      m_id(0),
+      m_depth(0),
+      m_size(0),
+      m_batchData(nullptr),
+      m_batchSizes(nullptr),
+      m_batchPriorities(nullptr),
+      m_batchCapacity(0),
+      m_batchCount(0),
+      m_batchNext(0),
+      m_batchHeld(0),
+      m_sendCount(0),
+      m_batchSendMark(0),
+      m_delegate(*QueueInterface::getDelegate(m_handle_storage)) {}
 
 Queue::~Queue() {
+    this->releaseBatchArena();
     m_delegate.~QueueInterface();
 }
 
@@ -33,6 +82,7 @@ QueueInterface::Status Queue ::create(FwEnumStoreType id,
     QueueInterface::Status status = this->m_delegate.create(id, name, depth, messageSize);
     if (status == QueueInterface::Status::OP_OK) {
         this->m_name = name;
+        this->m_id = id;
         this->m_depth = depth;
         this->m_size = messageSize;
         ScopeLock lock(Queue::getStaticMutex());
@@ -48,6 +98,7 @@ QueueInterface::Status Queue ::create(FwEnumStoreType id,
 
 void Queue::teardown() {
     FW_ASSERT(&this->m_delegate == reinterpret_cast<QueueInterface*>(&this->m_handle_storage[0]));
+    this->releaseBatchArena();
     return this->m_delegate.teardown();
 }
 
@@ -65,7 +116,11 @@ QueueInterface::Status Queue::send(const U8* buffer,
     else if (size > this->getMessageSize()) {
         return QueueInterface::Status::SIZE_MISMATCH;
     }
-    return this->m_delegate.send(buffer, size, priority, blockType);
+    QueueInterface::Status status = this->m_delegate.send(buffer, size, priority, blockType);
+    if (status == QueueInterface::Status::OP_OK) {
+        this->m_sendCount++;
+    }
+    return status;
 }
 
 QueueInterface::Status Queue::receive(U8* destination,
@@ -83,12 +138,179 @@ QueueInterface::Status Queue::receive(U8* destination,
     else if (capacity < this->getMessageSize()) {
         return QueueInterface::Status::SIZE_MISMATCH;
     }
+    // Serve from held messages when batched receives are enabled
+    else if (this->m_batchCapacity > 0) {
+        return this->receiveFromBatch(destination, capacity, blockType, actualSize, priority);
+    }
     return this->m_delegate.receive(destination, capacity, blockType, actualSize, priority);
 }
 
+QueueInterface::Status Queue::receiveBatch(U8* destination,
+                                           FwSizeType capacity,
+                                           FwSizeType maxMessages,
+                                           QueueInterface::BlockingType blockType,
+                                           FwSizeType* actualSizes,
+                                           FwQueuePriorityType* priorities,
+                                           FwSizeType& actualCount) {
+    FW_ASSERT(&this->m_delegate == reinterpret_cast<QueueInterface*>(&this->m_handle_storage[0]));
+    FW_ASSERT(destination != nullptr);
+    FW_ASSERT(actualSizes != nullptr);
+    FW_ASSERT(priorities != nullptr);
+    FW_ASSERT(maxMessages > 0);
+    actualCount = 0;
+    // Check if initialized
+    if (this->m_depth == 0 || this->m_size == 0) {
+        return QueueInterface::Status::UNINITIALIZED;
+    }
+    // Check capacity before proceeding
+    else if (capacity < this->getMessageSize()) {
+        return QueueInterface::Status::SIZE_MISMATCH;
+    }
+    // Held messages precede anything still in the underlying queue
+    else if (this->m_batchNext < this->m_batchCount) {
+        QueueInterface::Status status = QueueInterface::Status::OP_OK;
+        while ((status == QueueInterface::Status::OP_OK) && (actualCount < maxMessages) &&
+               (this->m_batchNext < this->m_batchCount)) {
+            status = this->receiveFromBatch(destination + (actualCount * capacity), capacity,
+                                            BlockingType::NONBLOCKING, actualSizes[actualCount],
+                                            priorities[actualCount]);
+            actualCount++;
+        }
+        return status;
+    }
+    return this->m_delegate.receiveBatch(destination, capacity, maxMessages, blockType, actualSizes, priorities,
+                                         actualCount);
+}
+
+QueueInterface::Status Queue::peekPriority(FwQueuePriorityType& priority) {
+    FW_ASSERT(&this->m_delegate == reinterpret_cast<QueueInterface*>(&this->m_handle_storage[0]));
+    // Check if initialized
+    if (this->m_depth == 0 || this->m_size == 0) {
+        return QueueInterface::Status::UNINITIALIZED;
+    }
+    QueueInterface::Status status = this->m_delegate.peekPriority(priority);
+    // A held message competes with the head of the underlying queue
+    if (this->m_batchNext < this->m_batchCount) {
+        const FwQueuePriorityType held = this->m_batchPriorities[this->m_batchNext];
+        if (status == QueueInterface::Status::EMPTY) {
+            priority = held;
+            status = QueueInterface::Status::OP_OK;
+        } else if (status == QueueInterface::Status::OP_OK) {
+            priority = FW_MAX(priority, held);
+        }
+    }
+    return status;
+}
+
+QueueInterface::Status Queue::enableBatchReceive(FwSizeType maxMessages) {
+    FW_ASSERT(maxMessages > 0);
+    // Check if initialized
+    if (this->m_depth == 0 || this->m_size == 0) {
+        return QueueInterface::Status::UNINITIALIZED;
+    }
+    // Check for previous enable call
+    else if (this->m_batchCapacity > 0) {
+        return QueueInterface::Status::ALREADY_CREATED;
+    }
+    // Held messages are checked against newly sent ones, which requires peeking the underlying queue
+    FwQueuePriorityType unused = 0;
+    if (this->m_delegate.peekPriority(unused) == QueueInterface::Status::NOT_SUPPORTED) {
+        return QueueInterface::Status::NOT_SUPPORTED;
+    }
+    // Prevent integer overflow when computing the arena size
+    const FwSizeType entrySize = this->m_size + sizeof(FwSizeType) + sizeof(FwQueuePriorityType);
+    FW_ASSERT(maxMessages <= (std::numeric_limits<FwSizeType>::max() / 2) / entrySize);
+
+    // Single allocation: sizes | priorities | data
+    const FwSizeType prioritiesOffset = maxMessages * sizeof(FwSizeType);
+    const FwSizeType dataOffset = prioritiesOffset + (maxMessages * sizeof(FwQueuePriorityType));
+    const FwSizeType required = dataOffset + (maxMessages * this->m_size);
+    FwSizeType size = required;
+    Fw::MemAllocator& allocator = Fw::MemAllocatorRegistry::getInstance().getAnAllocator(
+        Fw::MemoryAllocation::MemoryAllocatorType::OS_GENERIC_PRIORITY_QUEUE);
+    void* allocation = allocator.allocate(this->m_id, size, alignof(FwSizeType));
+    if (allocation == nullptr) {
+        return QueueInterface::Status::ALLOCATION_FAILED;
+    } else if (size < required) {
+        allocator.deallocate(this->m_id, allocation);
+        return QueueInterface::Status::ALLOCATION_FAILED;
+    }
+    U8* bytes = static_cast<U8*>(allocation);
+    this->m_batchSizes = reinterpret_cast<FwSizeType*>(bytes);
+    this->m_batchPriorities = reinterpret_cast<FwQueuePriorityType*>(bytes + prioritiesOffset);
+    this->m_batchData = bytes + dataOffset;
+    this->m_batchCount = 0;
+    this->m_batchNext = 0;
+    this->m_batchHeld = 0;
+    this->m_batchSendMark = this->m_sendCount.load();
+    this->m_batchCapacity = maxMessages;
+    return QueueInterface::Status::OP_OK;
+}
+
+QueueInterface::Status Queue::receiveFromBatch(U8* destination,
+                                               FwSizeType capacity,
+                                               QueueInterface::BlockingType blockType,
+                                               FwSizeType& actualSize,
+                                               FwQueuePriorityType& priority) {
+    // Drain a new batch when all held messages have been returned
+    if (this->m_batchNext == this->m_batchCount) {
+        // Sends counted before the drain are either in the batch or found by a later peek
+        this->m_batchSendMark = this->m_sendCount.load();
+        FwSizeType count = 0;
+        QueueInterface::Status status =
+            this->m_delegate.receiveBatch(this->m_batchData, this->m_size, this->m_batchCapacity, blockType,
+                                          this->m_batchSizes, this->m_batchPriorities, count);
+        if (status != QueueInterface::Status::OP_OK) {
+            return status;
+        }
+        FW_ASSERT((count > 0) && (count <= this->m_batchCapacity), static_cast<FwAssertArgType>(count));
+        this->m_batchCount = count;
+        this->m_batchNext = 0;
+        this->m_batchHeld = count;
+    }
+    // A message sent while the batch is held may outrank it. Peek only when something was sent since the last check.
+    else {
+        const FwSizeType sent = this->m_sendCount.load();
+        if (sent != this->m_batchSendMark) {
+            FwQueuePriorityType next = 0;
+            if ((this->m_delegate.peekPriority(next) == QueueInterface::Status::OP_OK) &&
+                (next > this->m_batchPriorities[this->m_batchNext])) {
+                // Leave the mark unchanged so the next receive checks again
+                return this->m_delegate.receive(destination, capacity, BlockingType::NONBLOCKING, actualSize,
+                                                priority);
+            }
+            this->m_batchSendMark = sent;
+        }
+    }
+    const FwSizeType index = this->m_batchNext;
+    actualSize = this->m_batchSizes[index];
+    priority = this->m_batchPriorities[index];
+    FW_ASSERT(actualSize <= capacity, static_cast<FwAssertArgType>(actualSize), static_cast<FwAssertArgType>(capacity));
+    (void)::memcpy(destination, this->m_batchData + (index * this->m_size), static_cast<size_t>(actualSize));
+    this->m_batchNext = index + 1;
+    this->m_batchHeld--;
+    return QueueInterface::Status::OP_OK;
+}
+
+void Queue::releaseBatchArena() {
+    if (this->m_batchCapacity > 0) {
+        Fw::MemAllocator& allocator = Fw::MemAllocatorRegistry::getInstance().getAnAllocator(
+            Fw::MemoryAllocation::MemoryAllocatorType::OS_GENERIC_PRIORITY_QUEUE);
+        // The arena begins with the sizes array
+        allocator.deallocate(this->m_id, this->m_batchSizes);
+        this->m_batchData = nullptr;
+        this->m_batchSizes = nullptr;
+        this->m_batchPriorities = nullptr;
+        this->m_batchCapacity = 0;
+        this->m_batchCount = 0;
+        this->m_batchNext = 0;
+        this->m_batchHeld = 0;
+    }
+}
+
 FwSizeType Queue::getMessagesAvailable() const {
     FW_ASSERT(&this->m_delegate == reinterpret_cast<const QueueInterface*>(&this->m_handle_storage[0]));
-    return this->m_delegate.getMessagesAvailable();
+    return this->m_delegate.getMessagesAvailable() + this->m_batchHeld.load();
 }
 
 FwSizeType Queue::getMessageHighWaterMark() const {
@@ -11,6 +11,7 @@
 #include <Os/Mutex.hpp>
 #include <Os/Os.hpp>
 #include <Os/QueueString.hpp>
+#include <atomic>
 namespace Os {
 // Forward declaration for registry
 class QueueRegistry;
@@ -124,6 +125,44 @@ class QueueInterface {
                            FwSizeType& actualSize,
                            FwQueuePriorityType& priority) = 0;
 
+    //! \brief receive up to `maxMessages` messages from the queue
+    //!
+    //! Receive a batch of messages in the order successive `receive` calls would return them. Message `i` is written
+    //! to `destination + i * capacity` with its size and priority in `actualSizes[i]` and `priorities[i]`. When
+    //! `blockType` is set to BLOCKING, this call will block until at least one message is available. Otherwise, this
+    //! will return an error status on queue empty. Once one message has been received, the remainder are taken
+    //! without blocking. `actualCount` is set to the number of messages received.
+    //!
+    //! Note: the default implementation repeatedly calls `receive`. Implementations should override it to drain the
+    //! batch under a single lock acquisition.
+    //!
+    //! \param destination: destination for message data, at least `capacity * maxMessages` bytes
+    //! \param capacity: maximum size of each message
+    //! \param maxMessages: maximum number of messages to receive, must be greater than zero
+    //! \param blockType: BLOCKING to wait for a message or NONBLOCKING to return error when queue is empty
+    //! \param actualSizes: (output) actual size of each message read, at least `maxMessages` entries
+    //! \param priorities: (output) priority of each message read, at least `maxMessages` entries
+    //! \param actualCount: (output) number of messages read
+    //! \return: status of the receive
+    virtual Status receiveBatch(U8* destination,
+                                FwSizeType capacity,
+                                FwSizeType maxMessages,
+                                BlockingType blockType,
+                                FwSizeType* actualSizes,
+                                FwQueuePriorityType* priorities,
+                                FwSizeType& actualCount);
+
+    //! \brief get the priority of the next message without receiving it
+    //!
+    //! Set `priority` to the priority of the message the next `receive` would return. Returns EMPTY when no message is
+    //! queued. This never blocks.
+    //!
+    //! Note: the default implementation returns NOT_SUPPORTED.
+    //!
+    //! \param priority: (output) priority of the next message
+    //! \return: status of the peek
+    virtual Status peekPriority(FwQueuePriorityType& priority);
+
     //! \brief get number of messages available
     //!
     //! Returns the number of messages currently available in the queue.
@@ -241,10 +280,61 @@ class Queue final : public QueueInterface {
                    FwSizeType& actualSize,
                    FwQueuePriorityType& priority) override;
 
+    //! \brief receive up to `maxMessages` messages from the queue through delegate
+    //!
+    //! Receive a batch of messages. See: QueueInterface::receiveBatch. Messages already held by batched receives
+    //! (see `enableBatchReceive`) are returned first. This method delegates to the underlying implementation.
+    //!
+    //! \warning This method will block if the queue is empty and blockType is set to BLOCKING
+    //!
+    //! \param destination: destination for message data, at least `capacity * maxMessages` bytes
+    //! \param capacity: maximum size of each message
+    //! \param maxMessages: maximum number of messages to receive, must be greater than zero
+    //! \param blockType: BLOCKING to wait for a message or NONBLOCKING to return error when queue is empty
+    //! \param actualSizes: (output) actual size of each message read, at least `maxMessages` entries
+    //! \param priorities: (output) priority of each message read, at least `maxMessages` entries
+    //! \param actualCount: (output) number of messages read
+    //! \return: status of the receive
+    Status receiveBatch(U8* destination,
+                        FwSizeType capacity,
+                        FwSizeType maxMessages,
+                        BlockingType blockType,
+                        FwSizeType* actualSizes,
+                        FwQueuePriorityType* priorities,
+                        FwSizeType& actualCount) override;
+
+    //! \brief get the priority of the next message without receiving it through delegate
+    //!
+    //! See: QueueInterface::peekPriority. Messages held by batched receives are taken into account. This method
+    //! delegates to the underlying implementation.
+    //!
+    //! \param priority: (output) priority of the next message
+    //! \return: status of the peek
+    Status peekPriority(FwQueuePriorityType& priority) override;
+
+    //! \brief serve single-message receives from batches
+    //!
+    //! Once enabled, a `receive` that finds no held messages drains up to `maxMessages` messages from the underlying
+    //! implementation with a single `receiveBatch` call into an arena owned by this queue. Following `receive` calls
+    //! are served from the arena until it is exhausted. When nothing has been sent since the last check, a held
+    //! message is returned without touching the underlying implementation. Otherwise the underlying implementation is
+    //! peeked and a newly sent message of strictly higher priority is received ahead of the held ones, so messages are
+    //! returned in the same order as without batching.
+    //!
+    //! Requires an underlying implementation supporting `peekPriority`, otherwise NOT_SUPPORTED is returned and
+    //! receives are unchanged. Must be called after `create`, at most once. The arena is allocated through the
+    //! OS_GENERIC_PRIORITY_QUEUE memory allocator and released on `teardown`.
+    //!
+    //! \warning batched receives are only valid for queues with a single receiving task
+    //!
+    //! \param maxMessages: maximum number of messages drained per batch, must be greater than zero
+    //! \return: status of the allocation
+    Status enableBatchReceive(FwSizeType maxMessages);
+
     //! \brief get number of messages available
     //!
-    //! Returns the number of messages currently available in the queue. This method delegates to the underlying
-    //! implementation.
+    //! Returns the number of messages currently available in the queue, including messages held by batched receives.
+    //! This method delegates to the underlying implementation.
     //!
     //! \return number of messages available
     FwSizeType getMessagesAvailable() const override;
@@ -301,11 +391,31 @@ class Queue final : public QueueInterface {
     static Os::Mutex& getStaticMutex();
 
   private:
-    QueueString m_name;              //!< queue name
-    FwSizeType m_depth;              //!< Queue depth
-    FwSizeType m_size;               //!< Maximum message size
-    static Os::Mutex s_countLock;    //!< Lock the count
-    static FwSizeType s_queueCount;  //!< Count of the number of queues
+    //! \brief return the next message held by batched receives, draining a new batch when none are held
+    Status receiveFromBatch(U8* destination,
+                            FwSizeType capacity,
+                            BlockingType blockType,
+                            FwSizeType& actualSize,
+                            FwQueuePriorityType& priority);
+
+    //! \brief release the batched receive arena
+    void releaseBatchArena();
+
+    QueueString m_name;                      //!< queue name
+    FwEnumStoreType m_id;                    //!< Queue identifier, used for memory allocation
+    FwSizeType m_depth;                      //!< Queue depth
+    FwSizeType m_size;                       //!< Maximum message size
+    U8* m_batchData;                         //!< Batched receive arena message data
+    FwSizeType* m_batchSizes;                //!< Batched receive arena message sizes
+    FwQueuePriorityType* m_batchPriorities;  //!< Batched receive arena message priorities
+    FwSizeType m_batchCapacity;              //!< Messages per batch, zero when batching is disabled
+    FwSizeType m_batchCount;                 //!< Messages drained by the last batch
+    FwSizeType m_batchNext;                  //!< Next held message to return
+    std::atomic<FwSizeType> m_batchHeld;     //!< Messages still held, readable from any task
+    std::atomic<FwSizeType> m_sendCount;     //!< Successful sends, used to detect sends while a batch is held
+    FwSizeType m_batchSendMark;              //!< Value of m_sendCount when held messages were last checked
+    static Os::Mutex s_countLock;            //!< Lock the count
+    static FwSizeType s_queueCount;          //!< Count of the number of queues
 
 #if FW_QUEUE_REGISTRATION
   public:
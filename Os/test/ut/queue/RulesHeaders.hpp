@@ -45,8 +45,8 @@ struct Tester : public Os::QueueRegistry {
 
     struct QueueMessageComparer {
         bool operator()(const QueueMessage& a, const QueueMessage& b) {
-            // Compare priority for unequal priority
-            if (a.priority != b.priority) {
+            // Compare priority for priorities the implementation orders differently
+            if (HELPER(a.priority, b.priority) != HELPER(b.priority, a.priority)) {
                 return HELPER(a.priority, b.priority);
             }
             // Cannot have like ordered items
@@ -17,9 +17,13 @@
 #include <Os/Console.hpp>
 #include <Svc/ActiveRateGroup/ActiveRateGroup.hpp>
 #include <config/ActiveRateGroupCfg.hpp>
+#include <limits>
 
 namespace Svc {
 
+static_assert(RateGroupMemberTimes::SIZE == static_cast<FwSizeType>(ActiveRateGroup::CONNECTION_COUNT_MAX),
+              "Member timing telemetry must have one entry per member port");
+
 ActiveRateGroup::ActiveRateGroup(const char* compName)
     : ActiveRateGroupComponentBase(compName),
       m_cycles(0),
@@ -27,7 +31,10 @@ ActiveRateGroup::ActiveRateGroup(const char* compName)
       m_cycleStarted(false),
       m_numContexts(0),
       m_overrunThrottle(0),
-      m_cycleSlips(0) {}
+      m_cycleSlips(0),
+      m_profileEnabled(ACTIVE_RATE_GROUP_PROFILE_ENABLED != 0) {
+    this->resetProfiles();
+}
 
 void ActiveRateGroup::configure(U32 contexts[], FwIndexType numContexts) {
     FW_ASSERT(contexts);
@@ -58,10 +65,28 @@ void ActiveRateGroup::CycleIn_handler(FwIndexType portNum, Os::RawTime& cycleSta
 
     this->m_cycleStarted = false;
 
+    // when profiling, the end time of one member is the start time of the next, so each
+    // member costs a single clock read. The two marks alternate between start and end.
+    const bool profile = this->m_profileEnabled;
+    Os::RawTime marks[2];
+    U8 startMark = 0;
+    if (profile) {
+        marks[startMark].now();
+    }
+
     // invoke any members of the rate group
     for (FwIndexType port = 0; port < this->m_numContexts; port++) {
         if (this->isConnected_RateGroupMemberOut_OutputPort(port)) {
             this->RateGroupMemberOut_out(port, static_cast<U32>(this->m_contexts[port]));
+            if (profile) {
+                const U8 endMark = static_cast<U8>(startMark ^ 1);
+                marks[endMark].now();
+                U32 memberTime;
+                // overflow caps memberTime at the U32 max, same as the cycle time below
+                (void)marks[endMark].getDiffUsec(marks[startMark], memberTime);
+                this->recordMemberTime(port, memberTime);
+                startMark = endMark;
+            }
         }
     }
 
@@ -100,6 +125,11 @@ void ActiveRateGroup::CycleIn_handler(FwIndexType portNum, Os::RawTime& cycleSta
 
     // increment cycle
     this->m_cycles++;
+
+    // update member timing telemetry
+    if (profile && ((this->m_cycles % static_cast<U32>(ACTIVE_RATE_GROUP_PROFILE_TLM_CYCLES)) == 0)) {
+        this->writeProfileTelemetry();
+    }
 }
 
 void ActiveRateGroup::CycleIn_preMsgHook(FwIndexType portNum, Os::RawTime& cycleStart) {
@@ -112,4 +142,81 @@ void ActiveRateGroup::PingIn_handler(FwIndexType portNum, U32 key) {
     this->PingOut_out(0, key);
 }
 
+void ActiveRateGroup::PROFILE_ENABLE_cmdHandler(FwOpcodeType opCode, U32 cmdSeq, Fw::Enabled enable) {
+    this->m_profileEnabled = (enable == Fw::Enabled::ENABLED);
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+}
+
+void ActiveRateGroup::PROFILE_RESET_cmdHandler(FwOpcodeType opCode, U32 cmdSeq) {
+    this->resetProfiles();
+    this->writeProfileTelemetry();
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+}
+
+void ActiveRateGroup::PROFILE_DUMP_cmdHandler(FwOpcodeType opCode, U32 cmdSeq) {
+    for (FwIndexType port = 0; port < this->m_numContexts; port++) {
+        if (this->isConnected_RateGroupMemberOut_OutputPort(port)) {
+            const MemberProfile& profile = this->m_profiles[port];
+            RateGroupMemberHistogram histogram;
+            for (FwSizeType bin = 0; bin < RateGroupMemberHistogram::SIZE; bin++) {
+                histogram[bin] = profile.histogram[bin];
+            }
+            this->log_ACTIVITY_LO_RateGroupMemberProfile(
+                static_cast<U32>(port), profile.calls, (profile.calls == 0) ? 0 : profile.minTime, profile.maxTime,
+                (profile.calls == 0) ? 0 : static_cast<U32>(profile.totalTime / profile.calls), histogram);
+        }
+    }
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+}
+
+void ActiveRateGroup::recordMemberTime(FwIndexType port, U32 memberTime) {
+    MemberProfile& profile = this->m_profiles[port];
+    profile.calls++;
+    profile.totalTime += memberTime;
+    if (memberTime < profile.minTime) {
+        profile.minTime = memberTime;
+    }
+    if (memberTime > profile.maxTime) {
+        profile.maxTime = memberTime;
+    }
+    // bin is the bit width of the time, capped at the last bin
+    FwSizeType bin = 0;
+    for (U32 remaining = memberTime; (remaining != 0) && (bin < RateGroupMemberHistogram::SIZE - 1); remaining >>= 1) {
+        bin++;
+    }
+    // saturate rather than wrap, so a long-running count stays an upper bound
+    if (profile.histogram[bin] < std::numeric_limits<U32>::max()) {
+        profile.histogram[bin]++;
+    }
+}
+
+void ActiveRateGroup::resetProfiles() {
+    for (FwIndexType port = 0; port < CONNECTION_COUNT_MAX; port++) {
+        MemberProfile& profile = this->m_profiles[port];
+        profile.calls = 0;
+        profile.minTime = std::numeric_limits<U32>::max();
+        profile.maxTime = 0;
+        profile.totalTime = 0;
+        for (FwSizeType bin = 0; bin < RateGroupMemberHistogram::SIZE; bin++) {
+            profile.histogram[bin] = 0;
+        }
+    }
+}
+
+void ActiveRateGroup::writeProfileTelemetry() {
+    RateGroupMemberTimes minTimes;
+    RateGroupMemberTimes maxTimes;
+    RateGroupMemberTimes meanTimes;
+    for (FwSizeType port = 0; port < RateGroupMemberTimes::SIZE; port++) {
+        const MemberProfile& profile = this->m_profiles[port];
+        const bool timed = (profile.calls != 0);
+        minTimes[port] = timed ? profile.minTime : 0;
+        maxTimes[port] = profile.maxTime;
+        meanTimes[port] = timed ? static_cast<U32>(profile.totalTime / profile.calls) : 0;
+    }
+    this->tlmWrite_RgMemberMinTime(minTimes);
+    this->tlmWrite_RgMemberMaxTime(maxTimes);
+    this->tlmWrite_RgMemberMeanTime(meanTimes);
+}
+
 }  // namespace Svc
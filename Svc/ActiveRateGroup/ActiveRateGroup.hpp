@@ -25,7 +25,8 @@ namespace Svc {
 //! ActiveRateGroup takes an input cycle call to begin the rate group cycle.
 //! It calls each output port in succession and passes the value in the context
 //! array at the index corresponding to the output port number. It keeps track of the execution
-//! time of the rate group and detects overruns.
+//! time of the rate group and detects overruns. When profiling is enabled it also times each
+//! member port call, so the member that used up a slipped cycle can be identified.
 //!
 
 class ActiveRateGroup final : public ActiveRateGroupComponentBase {
@@ -91,6 +92,49 @@ class ActiveRateGroup final : public ActiveRateGroupComponentBase {
 
     void PingIn_handler(FwIndexType portNum, U32 key);
 
+    //!  \brief PROFILE_ENABLE command handler
+    //!
+    //!  Enables or disables timing of each rate group member
+    //!
+    //!  \param opCode command opcode
+    //!  \param cmdSeq command sequence number
+    //!  \param enable whether member timing is enabled
+
+    void PROFILE_ENABLE_cmdHandler(FwOpcodeType opCode, U32 cmdSeq, Fw::Enabled enable);
+
+    //!  \brief PROFILE_RESET command handler
+    //!
+    //!  Clears the timing statistics of every rate group member
+    //!
+    //!  \param opCode command opcode
+    //!  \param cmdSeq command sequence number
+
+    void PROFILE_RESET_cmdHandler(FwOpcodeType opCode, U32 cmdSeq);
+
+    //!  \brief PROFILE_DUMP command handler
+    //!
+    //!  Emits one event with the timing statistics of each connected rate group member
+    //!
+    //!  \param opCode command opcode
+    //!  \param cmdSeq command sequence number
+
+    void PROFILE_DUMP_cmdHandler(FwOpcodeType opCode, U32 cmdSeq);
+
+    //!  \brief Record the execution time of one member call
+    //!
+    //!  \param port the member port number
+    //!  \param memberTime the execution time in microseconds
+
+    void recordMemberTime(FwIndexType port, U32 memberTime);
+
+    //!  \brief Clear the timing statistics of every member
+
+    void resetProfiles();
+
+    //!  \brief Write the member timing telemetry
+
+    void writeProfileTelemetry();
+
     //!  \brief Task preamble
     //!
     //!  This method is called prior to entering the message loop.
@@ -106,6 +150,18 @@ class ActiveRateGroup final : public ActiveRateGroupComponentBase {
     FwIndexType m_numContexts;             //!< Number of contexts passed in by user
     FwIndexType m_overrunThrottle;         //!< throttle value for overrun events
     U32 m_cycleSlips;                      //!< tracks number of cycle slips
+
+    //! Execution time statistics of one rate group member
+    struct MemberProfile {
+        U64 calls;                                      //!< number of timed calls
+        U32 minTime;                                    //!< minimum execution time in microseconds
+        U32 maxTime;                                    //!< maximum execution time in microseconds
+        U64 totalTime;                                  //!< sum of execution times in microseconds
+        U32 histogram[RateGroupMemberHistogram::SIZE];  //!< log2 execution time bins, saturating at the U32 maximum
+    };
+
+    bool m_profileEnabled;                           //!< whether member calls are timed
+    MemberProfile m_profiles[CONNECTION_COUNT_MAX];  //!< timing statistics per member port
 };
 
 }  // namespace Svc
@@ -39,6 +39,10 @@ void connectPorts(Svc::ActiveRateGroup& impl, Svc::ActiveRateGroupTester& tester
     impl.set_PingOut_OutputPort(0, tester.get_from_PingOut(0));
     tester.connect_to_PingIn(0, impl.get_PingIn_InputPort(0));
 
+    tester.connect_to_CmdDisp(0, impl.get_CmdDisp_InputPort(0));
+    impl.set_CmdStatus_OutputPort(0, tester.get_from_CmdStatus(0));
+    impl.set_CmdReg_OutputPort(0, tester.get_from_CmdReg(0));
+
 #if FW_PORT_TRACING
     // Fw::PortBase::setTrace(true);
 #endif
@@ -107,6 +111,40 @@ TEST(ActiveRateGroupTest, PingPort) {
     tester.runPingTest();
 }
 
+TEST(ActiveRateGroupTest, MemberProfile) {
+    U32 contexts[Svc::ActiveRateGroup::CONNECTION_COUNT_MAX];
+    for (FwIndexType i = 0; i < Svc::ActiveRateGroup::CONNECTION_COUNT_MAX; i++) {
+        contexts[i] = i + 1;
+    }
+
+    Svc::ActiveRateGroup impl("ActiveRateGroup");
+    impl.configure(contexts, FW_NUM_ARRAY_ELEMENTS(contexts));
+    Svc::ActiveRateGroupTester tester(impl);
+
+    tester.init();
+    impl.init(10, 0);
+
+    connectPorts(impl, tester);
+    tester.runMemberProfile(contexts, FW_NUM_ARRAY_ELEMENTS(contexts));
+}
+
+TEST(ActiveRateGroupTest, ProfileBins) {
+    U32 contexts[Svc::ActiveRateGroup::CONNECTION_COUNT_MAX];
+    for (FwIndexType i = 0; i < Svc::ActiveRateGroup::CONNECTION_COUNT_MAX; i++) {
+        contexts[i] = i + 1;
+    }
+
+    Svc::ActiveRateGroup impl("ActiveRateGroup");
+    impl.configure(contexts, FW_NUM_ARRAY_ELEMENTS(contexts));
+    Svc::ActiveRateGroupTester tester(impl);
+
+    tester.init();
+    impl.init(10, 0);
+
+    connectPorts(impl, tester);
+    tester.runProfileBins();
+}
+
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
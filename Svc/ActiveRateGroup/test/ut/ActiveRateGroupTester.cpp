@@ -17,6 +17,7 @@
 #include <Fw/Test/UnitTest.hpp>
 #include <Svc/ActiveRateGroup/test/ut/ActiveRateGroupTester.hpp>
 #include <config/ActiveRateGroupCfg.hpp>
+#include <limits>
 
 #include <cstdio>
 #include <cstring>
@@ -304,4 +305,106 @@ void ActiveRateGroupTester::runPingTest() {
     ASSERT_from_PingOut(0, 0x123);
 }
 
+void ActiveRateGroupTester::runMemberProfile(U32 contexts[], FwIndexType numContexts) {
+    TEST_CASE(101.3.1, "Run rate group member profiling");
+
+    Os::RawTime time;
+    this->clearHistory();
+
+    // telemetry is only written once enough cycles have run
+    for (U32 cycle = 0; cycle < ACTIVE_RATE_GROUP_PROFILE_TLM_CYCLES; cycle++) {
+        ASSERT_TLM_RgMemberMaxTime_SIZE(0);
+        time.now();
+        this->invoke_to_CycleIn(0, time);
+        this->m_impl.doDispatch();
+    }
+    ASSERT_TLM_RgMemberMinTime_SIZE(1);
+    ASSERT_TLM_RgMemberMaxTime_SIZE(1);
+    ASSERT_TLM_RgMemberMeanTime_SIZE(1);
+
+    // every member was timed on every cycle
+    for (FwIndexType port = 0; port < numContexts; port++) {
+        const ActiveRateGroup::MemberProfile& profile = this->m_impl.m_profiles[port];
+        ASSERT_EQ(profile.calls, static_cast<U64>(ACTIVE_RATE_GROUP_PROFILE_TLM_CYCLES));
+        ASSERT_LE(profile.minTime, profile.maxTime);
+        U64 binned = 0;
+        for (FwSizeType bin = 0; bin < RateGroupMemberHistogram::SIZE; bin++) {
+            binned += profile.histogram[bin];
+        }
+        ASSERT_EQ(binned, profile.calls);
+    }
+
+    // dump reports one event per member
+    this->clearHistory();
+    this->sendCmd_PROFILE_DUMP(0, 10);
+    this->m_impl.doDispatch();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, ActiveRateGroupComponentBase::OPCODE_PROFILE_DUMP, 10, Fw::CmdResponse::OK);
+    ASSERT_EVENTS_RateGroupMemberProfile_SIZE(numContexts);
+    for (FwIndexType port = 0; port < numContexts; port++) {
+        const ActiveRateGroup::MemberProfile& profile = this->m_impl.m_profiles[port];
+        RateGroupMemberHistogram histogram;
+        for (FwSizeType bin = 0; bin < RateGroupMemberHistogram::SIZE; bin++) {
+            histogram[bin] = profile.histogram[bin];
+        }
+        ASSERT_EVENTS_RateGroupMemberProfile(port, static_cast<U32>(port), profile.calls, profile.minTime,
+                                             profile.maxTime, static_cast<U32>(profile.totalTime / profile.calls),
+                                             histogram);
+    }
+
+    // reset clears the statistics and reports them
+    this->clearHistory();
+    this->sendCmd_PROFILE_RESET(0, 11);
+    this->m_impl.doDispatch();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, ActiveRateGroupComponentBase::OPCODE_PROFILE_RESET, 11, Fw::CmdResponse::OK);
+    ASSERT_TLM_RgMemberMaxTime_SIZE(1);
+    ASSERT_TLM_RgMemberMaxTime(0, RateGroupMemberTimes(0));
+    for (FwIndexType port = 0; port < numContexts; port++) {
+        ASSERT_EQ(this->m_impl.m_profiles[port].calls, 0U);
+    }
+
+    // disabled profiling leaves the statistics alone
+    this->clearHistory();
+    this->sendCmd_PROFILE_ENABLE(0, 12, Fw::Enabled::DISABLED);
+    this->m_impl.doDispatch();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, ActiveRateGroupComponentBase::OPCODE_PROFILE_ENABLE, 12, Fw::CmdResponse::OK);
+    ASSERT_FALSE(this->m_impl.m_profileEnabled);
+    for (U32 cycle = 0; cycle < ACTIVE_RATE_GROUP_PROFILE_TLM_CYCLES; cycle++) {
+        time.now();
+        this->invoke_to_CycleIn(0, time);
+        this->m_impl.doDispatch();
+    }
+    ASSERT_TLM_RgMemberMaxTime_SIZE(0);
+    for (FwIndexType port = 0; port < numContexts; port++) {
+        ASSERT_EQ(this->m_impl.m_profiles[port].calls, 0U);
+    }
+}
+
+void ActiveRateGroupTester::runProfileBins() {
+    TEST_CASE(101.3.2, "Bin rate group member execution times");
+
+    const U32 times[] = {0, 1, 2, 3, 4, 1000, 0xFFFFFFFF};
+    const FwSizeType bins[] = {0, 1, 2, 2, 3, 10, RateGroupMemberHistogram::SIZE - 1};
+    for (FwSizeType index = 0; index < FW_NUM_ARRAY_ELEMENTS(times); index++) {
+        this->m_impl.resetProfiles();
+        this->m_impl.recordMemberTime(0, times[index]);
+        const ActiveRateGroup::MemberProfile& profile = this->m_impl.m_profiles[0];
+        ASSERT_EQ(profile.histogram[bins[index]], 1U);
+        ASSERT_EQ(profile.minTime, times[index]);
+        ASSERT_EQ(profile.maxTime, times[index]);
+        ASSERT_EQ(profile.totalTime, times[index]);
+    }
+
+    // the call count runs past the U32 range and histogram bins saturate instead of wrapping
+    this->m_impl.resetProfiles();
+    ActiveRateGroup::MemberProfile& profile = this->m_impl.m_profiles[0];
+    profile.calls = std::numeric_limits<U32>::max();
+    profile.histogram[1] = std::numeric_limits<U32>::max();
+    this->m_impl.recordMemberTime(0, 1);
+    ASSERT_EQ(profile.calls, static_cast<U64>(std::numeric_limits<U32>::max()) + 1);
+    ASSERT_EQ(profile.histogram[1], std::numeric_limits<U32>::max());
+}
+
 }  // namespace Svc
@@ -29,6 +29,8 @@ class ActiveRateGroupTester : public ActiveRateGroupGTestBase {
     void runNominal(U32 contexts[], FwIndexType numContexts, FwEnumStoreType instance);
     void runCycleOverrun(U32 contexts[], FwIndexType numContexts, FwEnumStoreType instance);
     void runPingTest();
+    void runMemberProfile(U32 contexts[], FwIndexType numContexts);
+    void runProfileBins();
 
   private:
     void from_RateGroupMemberOut_handler(FwIndexType portNum, U32 context);
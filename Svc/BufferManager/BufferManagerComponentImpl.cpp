@@ -35,7 +35,9 @@ BufferManagerComponentImpl ::BufferManagerComponentImpl(const char* const compNa
       m_highWater(0),
       m_currBuffs(0),
       m_noBuffs(0),
-      m_emptyBuffs(0) {}
+      m_emptyBuffs(0) {
+    memset(this->m_bins, 0, sizeof(this->m_bins));
+}
 
 BufferManagerComponentImpl ::~BufferManagerComponentImpl() {
     if (m_setup) {
@@ -94,23 +96,39 @@ void BufferManagerComponentImpl ::bufferSendIn_handler(const FwIndexType portNum
     // user can make smaller for their own purposes, but it shouldn't be bigger
     FW_ASSERT(fwBuffer.getSize() <= this->m_buffers[id].size, static_cast<FwAssertArgType>(id),
               static_cast<FwAssertArgType>(this->m_mgrId));
-    // clear the allocated flag
+    // clear the allocated flag and make the buffer available again
     this->m_buffers[id].allocated = false;
     this->m_currBuffs--;
+    this->m_bins[this->m_buffers[id].bin].currBuffs--;
+    this->pushFree(static_cast<U16>(id));
 }
 
 Fw::Buffer BufferManagerComponentImpl ::bufferGetCallee_handler(const FwIndexType portNum, Fw::Buffer::SizeType size) {
     // make sure component has been set up
     FW_ASSERT(this->m_setup);
     FW_ASSERT(m_buffers);
-    // find smallest buffer based on size.
-    for (U16 buff = 0; buff < this->m_numStructs; buff++) {
-        if ((not this->m_buffers[buff].allocated) and (size <= this->m_buffers[buff].size)) {
+    // find the first bin with a free buffer that is large enough
+    U16 firstFit = BUFFERMGR_MAX_NUM_BINS;
+    for (U16 bin = 0; bin < BUFFERMGR_MAX_NUM_BINS; bin++) {
+        if ((this->m_bufferBins.bins[bin].numBuffers == 0) or (size > this->m_bufferBins.bins[bin].bufferSize)) {
+            continue;
+        }
+        if (firstFit == BUFFERMGR_MAX_NUM_BINS) {
+            firstFit = bin;
+        }
+        const U16 buff = this->popFree(bin);
+        if (buff != NO_BUFFER) {
+            FW_ASSERT(not this->m_buffers[buff].allocated, static_cast<FwAssertArgType>(buff));
             this->m_buffers[buff].allocated = true;
             this->m_currBuffs++;
             if (this->m_currBuffs > this->m_highWater) {
                 this->m_highWater = this->m_currBuffs;
             }
+            BinState& state = this->m_bins[bin];
+            state.currBuffs++;
+            if (state.currBuffs > state.highWater) {
+                state.highWater = state.currBuffs;
+            }
             Fw::Buffer copy = this->m_buffers[buff].buff;
             // change size to match request
             copy.setSize(size);
@@ -121,9 +139,36 @@ Fw::Buffer BufferManagerComponentImpl ::bufferGetCallee_handler(const FwIndexTyp
     // if no buffers found, return empty buffer
     this->log_WARNING_HI_NoBuffsAvailable(size);
     this->m_noBuffs++;
+    if (firstFit != BUFFERMGR_MAX_NUM_BINS) {
+        this->m_bins[firstFit].noBuffs++;
+    }
     return Fw::Buffer();
 }
 
+U16 BufferManagerComponentImpl ::popFree(U16 bin) {
+    BinState& state = this->m_bins[bin];
+    const U16 buff = state.freeHead;
+    if (buff != NO_BUFFER) {
+        state.freeHead = this->m_buffers[buff].nextFree;
+        if (state.freeHead == NO_BUFFER) {
+            state.freeTail = NO_BUFFER;
+        }
+        this->m_buffers[buff].nextFree = NO_BUFFER;
+    }
+    return buff;
+}
+
+void BufferManagerComponentImpl ::pushFree(U16 buff) {
+    BinState& state = this->m_bins[this->m_buffers[buff].bin];
+    this->m_buffers[buff].nextFree = NO_BUFFER;
+    if (state.freeTail == NO_BUFFER) {
+        state.freeHead = buff;
+    } else {
+        this->m_buffers[state.freeTail].nextFree = buff;
+    }
+    state.freeTail = buff;
+}
+
 void BufferManagerComponentImpl::setup(U16 mgrId,                    //!< manager ID
                                        FwEnumStoreType memId,        //!< Memory segment identifier
                                        Fw::MemAllocator& allocator,  //!< memory allocator
@@ -134,6 +179,7 @@ void BufferManagerComponentImpl::setup(U16 mgrId,                    //!< manage
     this->m_allocator = &allocator;
     // clear bins
     memset(&this->m_bufferBins, 0, sizeof(this->m_bufferBins));
+    memset(this->m_bins, 0, sizeof(this->m_bins));
 
     this->m_bufferBins = bins;
 
@@ -173,6 +219,8 @@ void BufferManagerComponentImpl::setup(U16 mgrId,                    //!< manage
     // walk through entries and initialize them
     U16 currStruct = 0;
     for (U16 bin = 0; bin < BUFFERMGR_MAX_NUM_BINS; bin++) {
+        this->m_bins[bin].freeHead = NO_BUFFER;
+        this->m_bins[bin].freeTail = NO_BUFFER;
         if (this->m_bufferBins.bins[bin].numBuffers) {
             for (U16 binEntry = 0; binEntry < this->m_bufferBins.bins[bin].numBuffers; binEntry++) {
                 // placement new for Fw::Buffer instance. We don't need the new() return value,
@@ -183,6 +231,8 @@ void BufferManagerComponentImpl::setup(U16 mgrId,                    //!< manage
                 this->m_buffers[currStruct].allocated = false;
                 this->m_buffers[currStruct].memory = bufferMem;
                 this->m_buffers[currStruct].size = this->m_bufferBins.bins[bin].bufferSize;
+                this->m_buffers[currStruct].bin = bin;
+                this->pushFree(currStruct);
                 bufferMem += this->m_bufferBins.bins[bin].bufferSize;
                 currStruct++;
             }
@@ -210,6 +260,20 @@ void BufferManagerComponentImpl ::schedIn_handler(const FwIndexType portNum, U32
     this->tlmWrite_TotalBuffs(this->m_numStructs);
     this->tlmWrite_NoBuffs(this->m_noBuffs);
     this->tlmWrite_EmptyBuffs(this->m_emptyBuffs);
+    if (BUFFERMGR_BIN_TELEMETRY) {
+        this->writeBinTelemetry();
+    }
+}
+
+void BufferManagerComponentImpl ::writeBinTelemetry() {
+    BufferManagerBinCounts hiBuffs;
+    BufferManagerBinCounts noBuffs;
+    for (U16 bin = 0; bin < BUFFERMGR_MAX_NUM_BINS; bin++) {
+        hiBuffs[bin] = this->m_bins[bin].highWater;
+        noBuffs[bin] = this->m_bins[bin].noBuffs;
+    }
+    this->tlmWrite_BinHiBuffs(hiBuffs);
+    this->tlmWrite_BinNoBuffs(noBuffs);
 }
 
 }  // end namespace Svc
@@ -29,8 +29,9 @@ namespace Svc {
 //    bin and how many buffers for that bin (numBuffers).
 // 2. The bins should be ordered based on an increasing bufferSize to allow BufferManager to
 //    search for available buffers. When receiving a request for a buffer, the component will
-//    search for the first buffer from the bins that is equal to or greater
-//    than the requested size, starting at the beginning of the table.
+//    search for the first bin with a free buffer that is equal to or greater than the requested
+//    size, starting at the beginning of the table. Each bin keeps a free list of its buffers,
+//    so a request costs at most one check per bin regardless of the number of buffers.
 // 3. Any unused bins should have numBuffers set to 0.
 // 4. A single bin can be specified if a single size is needed.
 //
@@ -124,8 +125,35 @@ class BufferManagerComponentImpl final : public BufferManagerComponentBase {
         U8* memory;                 //!< pointer to memory buffer
         Fw::Buffer::SizeType size;  //!< size of the buffer
         bool allocated;             //!< this buffer has been allocated
+        U16 bin;                    //!< bin the buffer belongs to
+        U16 nextFree;               //!< next buffer in the bin free list, NO_BUFFER at the tail
     };
 
+    //! Free list link value marking the end of a list
+    static const U16 NO_BUFFER = 0xFFFF;
+
+    //! Free list and statistics for one bin. Buffers are taken from the head and returned to the tail so the
+    //! pool is cycled through in order.
+    struct BinState {
+        U16 freeHead;   //!< first free buffer in the bin, NO_BUFFER when none are free
+        U16 freeTail;   //!< last free buffer in the bin, NO_BUFFER when none are free
+        U32 currBuffs;  //!< number of currently allocated buffers in the bin
+        U32 highWater;  //!< high watermark for allocations in the bin
+        U32 noBuffs;    //!< number of failed requests whose smallest fitting bin is this bin
+    };
+
+    //! Take a buffer from the head of a bin free list
+    //! \return buffer index, or NO_BUFFER if the bin has no free buffers
+    U16 popFree(U16 bin);
+
+    //! Return a buffer to the tail of its bin free list
+    void pushFree(U16 buff);
+
+    //! Write the per-bin telemetry channels
+    void writeBinTelemetry();
+
+    BinState m_bins[BUFFERMGR_MAX_NUM_BINS];  //!< free lists and statistics per bin
+
     AllocatedBuffer* m_buffers;     //!< pointer to allocated buffer space
     Fw::MemAllocator* m_allocator;  //!< allocator for memory
     FwEnumStoreType m_memId;        //!< identifier for allocator
@@ -19,6 +19,11 @@ TEST(Nominal, MultSize) {
     tester.multBuffSize();
 }
 
+TEST(Nominal, BinStats) {
+    Svc::BufferManagerTester tester;
+    tester.binStats();
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -458,6 +458,83 @@ void BufferManagerTester::multBuffSize() {
     this->component.cleanup();
 }
 
+void BufferManagerTester::binStats() {
+    BufferManagerComponentImpl::BufferBins bins;
+    memset(&bins, 0, sizeof(bins));
+    bins.bins[0].bufferSize = BIN0_BUFFER_SIZE;
+    bins.bins[0].numBuffers = BIN0_NUM_BUFFERS;
+    bins.bins[1].bufferSize = BIN1_BUFFER_SIZE;
+    bins.bins[1].numBuffers = BIN1_NUM_BUFFERS;
+    bins.bins[2].bufferSize = BIN2_BUFFER_SIZE;
+    bins.bins[2].numBuffers = BIN2_NUM_BUFFERS;
+
+    TestAllocator alloc;
+
+    this->component.setup(MGR_ID, MEM_ID, alloc, bins);
+
+    // each bin free list starts with its buffers in table order
+    ASSERT_EQ(0, this->component.m_bins[0].freeHead);
+    ASSERT_EQ(BIN0_NUM_BUFFERS - 1, this->component.m_bins[0].freeTail);
+    ASSERT_EQ(BIN0_NUM_BUFFERS, this->component.m_bins[1].freeHead);
+    ASSERT_EQ(BufferManagerComponentImpl::NO_BUFFER, this->component.m_bins[3].freeHead);
+
+    // drain bins 1 and 2 with requests that don't fit bin 0
+    Fw::Buffer buffs[BIN1_NUM_BUFFERS + BIN2_NUM_BUFFERS];
+    for (U16 b = 0; b < BIN1_NUM_BUFFERS + BIN2_NUM_BUFFERS; b++) {
+        buffs[b] = this->invoke_to_bufferGetCallee(0, BIN0_BUFFER_SIZE + 1);
+        ASSERT_EQ(buffs[b].getContext(), ((MGR_ID << 16) | (b + BIN0_NUM_BUFFERS)));
+    }
+    ASSERT_EQ(0, this->component.m_bins[0].highWater);
+    ASSERT_EQ(BIN1_NUM_BUFFERS, this->component.m_bins[1].highWater);
+    ASSERT_EQ(BIN2_NUM_BUFFERS, this->component.m_bins[2].highWater);
+    ASSERT_EQ(BufferManagerComponentImpl::NO_BUFFER, this->component.m_bins[1].freeHead);
+    ASSERT_EQ(BufferManagerComponentImpl::NO_BUFFER, this->component.m_bins[2].freeTail);
+
+    // a failure counts against the smallest bin that fits, an oversize request against no bin
+    Fw::Buffer noBuff = this->invoke_to_bufferGetCallee(0, BIN1_BUFFER_SIZE);
+    ASSERT_EQ(0, noBuff.getSize());
+    noBuff = this->invoke_to_bufferGetCallee(0, BIN2_BUFFER_SIZE + 1);
+    ASSERT_EQ(0, noBuff.getSize());
+    ASSERT_EQ(2, this->component.m_noBuffs);
+    ASSERT_EQ(0, this->component.m_bins[0].noBuffs);
+    ASSERT_EQ(1, this->component.m_bins[1].noBuffs);
+    ASSERT_EQ(0, this->component.m_bins[2].noBuffs);
+
+    // bin 0 still serves small requests
+    Fw::Buffer small = this->invoke_to_bufferGetCallee(0, BIN0_BUFFER_SIZE);
+    ASSERT_EQ(small.getContext(), static_cast<U32>(MGR_ID << 16));
+    this->invoke_to_bufferSendIn(0, small);
+
+    // returned buffers are handed out again in the order they came back
+    this->invoke_to_bufferSendIn(0, buffs[2]);
+    this->invoke_to_bufferSendIn(0, buffs[0]);
+    ASSERT_EQ(BIN1_NUM_BUFFERS - 2, this->component.m_bins[1].currBuffs);
+    Fw::Buffer again = this->invoke_to_bufferGetCallee(0, BIN1_BUFFER_SIZE);
+    ASSERT_EQ(again.getContext(), buffs[2].getContext());
+    again = this->invoke_to_bufferGetCallee(0, BIN1_BUFFER_SIZE);
+    ASSERT_EQ(again.getContext(), buffs[0].getContext());
+    ASSERT_EQ(BIN1_NUM_BUFFERS, this->component.m_bins[1].currBuffs);
+    ASSERT_EQ(BIN1_NUM_BUFFERS, this->component.m_bins[1].highWater);
+
+    if (BUFFERMGR_BIN_TELEMETRY) {
+        this->clearHistory();
+        this->invoke_to_schedIn(0, 0);
+        ASSERT_TLM_BinHiBuffs_SIZE(1);
+        ASSERT_EQ(BIN1_NUM_BUFFERS, this->tlmHistory_BinHiBuffs->at(0).arg[1]);
+        ASSERT_EQ(BIN2_NUM_BUFFERS, this->tlmHistory_BinHiBuffs->at(0).arg[2]);
+        ASSERT_TLM_BinNoBuffs_SIZE(1);
+        ASSERT_EQ(1, this->tlmHistory_BinNoBuffs->at(0).arg[1]);
+    }
+
+    for (U16 b = 0; b < BIN1_NUM_BUFFERS + BIN2_NUM_BUFFERS; b++) {
+        this->invoke_to_bufferSendIn(0, buffs[b]);
+    }
+    ASSERT_EQ(0, this->component.m_currBuffs);
+
+    // cleanup BufferManager memory
+    this->component.cleanup();
+}
+
 // ----------------------------------------------------------------------
 // Helper methods
 // ----------------------------------------------------------------------
@@ -48,6 +48,9 @@ class BufferManagerTester : public BufferManagerGTestBase {
     //! Multiple buffer sizes
     void multBuffSize();
 
+    //! Per-bin free lists and statistics
+    void binStats();
+
   private:
     // ----------------------------------------------------------------------
     // Helper methods
@@ -8,6 +8,8 @@
 #include "Svc/Ccsds/Utils/CRC16.hpp"
 #include "config/FppConstantsAc.hpp"
 
+#include <cstring>
+
 namespace Svc {
 
 namespace Ccsds {
@@ -17,10 +19,20 @@ namespace Ccsds {
 // ----------------------------------------------------------------------
 
 TmFramer ::TmFramer(const char* const compName)
-    : TmFramerComponentBase(compName), m_masterFrameCount(0), m_virtualFrameCount(0) {}
+    : TmFramerComponentBase(compName), m_masterFrameCount(0), m_virtualFrameCount(0) {
+    for (FwSizeType i = 0; i < ComCfg::TmFrameBufferCount; i++) {
+        this->m_bufferStates[i] = BufferOwnershipState::OWNED;
+    }
+}
 
 TmFramer ::~TmFramer() {}
 
+void TmFramer ::configure(U32 latencyTicks) {
+    FW_ASSERT(latencyTicks > 0);
+    Os::ScopeLock lock(this->m_lock);
+    this->m_latencyTicks = latencyTicks;
+}
+
 // ----------------------------------------------------------------------
 // Handler implementations for typed input ports
 // ----------------------------------------------------------------------
@@ -28,7 +40,208 @@ TmFramer ::~TmFramer() {}
 void TmFramer ::dataIn_handler(FwIndexType portNum, Fw::Buffer& data, const ComCfg::FrameContext& context) {
     FW_ASSERT(data.getSize() <= ComCfg::TmFrameFixedSize - TMHeader::SERIALIZED_SIZE - TMTrailer::SERIALIZED_SIZE,
               static_cast<FwAssertArgType>(data.getSize()));
-    FW_ASSERT(this->m_bufferState == BufferOwnershipState::OWNED, static_cast<FwAssertArgType>(this->m_bufferState));
+
+    if (this->m_latencyTicks > 0) {
+        {
+            Os::ScopeLock lock(this->m_lock);
+            // Upstream sends one packet at a time, waiting for a status in between
+            FW_ASSERT(not this->m_held.isValid());
+            this->m_statusOwed = true;
+            if (data.isValid()) {
+                this->m_held = data;
+                this->m_heldOffset = 0;
+                this->m_heldContext = context;
+            }
+        }
+        if (not data.isValid()) {
+            this->dataReturnOut_out(0, data, context);  // nothing to frame
+        }
+        this->multiplex();
+        return;
+    }
+
+    Fw::Buffer frameBuffer;
+    {
+        Os::ScopeLock lock(this->m_lock);
+        const bool available = this->acquire_buffer();
+        FW_ASSERT(available, static_cast<FwAssertArgType>(ComCfg::TmFrameBufferCount));
+
+        // Payload packet is wrapped alone at the start of the data field, so the First Header Pointer is 0
+        (void)::memcpy(&this->m_frameBuffers[this->m_currentBuffer][TMHeader::SERIALIZED_SIZE], data.getData(),
+                       static_cast<size_t>(data.getSize()));
+        frameBuffer = this->finish_frame(context, 0, data.getSize());
+        this->m_bufferStates[this->m_currentBuffer] = BufferOwnershipState::NOT_OWNED;
+    }
+    this->dataOut_out(0, frameBuffer, context);
+    this->dataReturnOut_out(0, data, context);  // return ownership of the original data buffer
+}
+
+void TmFramer ::comStatusIn_handler(FwIndexType portNum, Fw::Success& condition) {
+    if (this->m_latencyTicks > 0) {
+        // Upstream is told it may send once its packet is framed, so downstream status only gates sending frames
+        {
+            Os::ScopeLock lock(this->m_lock);
+            this->m_downstreamReady = (condition == Fw::Success::SUCCESS);
+        }
+        this->multiplex();
+        return;
+    }
+    if (this->isConnected_comStatusOut_OutputPort(portNum)) {
+        this->comStatusOut_out(portNum, condition);
+    }
+}
+
+void TmFramer ::dataReturnIn_handler(FwIndexType portNum,
+                                     Fw::Buffer& frameBuffer,
+                                     const ComCfg::FrameContext& context) {
+    // Assert that the returned buffer is one of the members, and set its ownership state
+    const U8* const pool = &this->m_frameBuffers[0][0];
+    FW_ASSERT(frameBuffer.getData() >= pool);
+    FW_ASSERT(frameBuffer.getData() < pool + sizeof(this->m_frameBuffers));
+    const FwSizeType index = static_cast<FwSizeType>(frameBuffer.getData() - pool) / ComCfg::TmFrameFixedSize;
+    {
+        Os::ScopeLock lock(this->m_lock);
+        this->m_bufferStates[index] = BufferOwnershipState::OWNED;
+    }
+    if (this->m_latencyTicks > 0) {
+        this->multiplex();
+    }
+}
+
+void TmFramer ::run_handler(FwIndexType portNum, U32 context) {
+    if (this->m_latencyTicks == 0) {
+        return;
+    }
+    {
+        Os::ScopeLock lock(this->m_lock);
+        if (this->m_frameOpen) {
+            this->m_frameAge++;
+        }
+    }
+    this->multiplex();
+}
+
+// ----------------------------------------------------------------------
+// Helpers
+// ----------------------------------------------------------------------
+
+void TmFramer ::multiplex() {
+    Action action = Action::NONE;
+    do {
+        Fw::Buffer buffer;
+        ComCfg::FrameContext context;
+        action = this->next_action(buffer, context);
+        switch (action) {
+            case Action::SEND_FRAME:
+                this->dataOut_out(0, buffer, context);
+                break;
+            case Action::RETURN_DATA:
+                this->dataReturnOut_out(0, buffer, context);
+                break;
+            case Action::READY: {
+                Fw::Success ready = Fw::Success::SUCCESS;
+                this->comStatusOut_out(0, ready);
+                break;
+            }
+            default:
+                break;
+        }
+    } while (action != Action::NONE);
+}
+
+TmFramer::Action TmFramer ::next_action(Fw::Buffer& buffer, ComCfg::FrameContext& context) {
+    Os::ScopeLock lock(this->m_lock);
+    // Copy the held packet into the frame, returning it once it has been copied entirely
+    while (this->m_held.isValid() && (this->m_frameOpen || this->acquire_buffer()) &&
+           (this->m_frameFill < TmPayloadCapacity)) {
+        this->fill_frame();
+        if (this->m_heldOffset == this->m_held.getSize()) {
+            buffer = this->m_held;
+            context = this->m_heldContext;
+            this->m_held = Fw::Buffer();
+            return Action::RETURN_DATA;
+        }
+    }
+    // Send the frame once it is full or has waited past the latency deadline, and downstream can take it
+    if (this->m_frameOpen && this->m_downstreamReady &&
+        ((this->m_frameFill == TmPayloadCapacity) || (this->m_frameAge >= this->m_latencyTicks))) {
+        context = this->m_frameContext;
+        buffer = this->finish_multiplexed_frame();
+        this->m_bufferStates[this->m_currentBuffer] = BufferOwnershipState::NOT_OWNED;
+        this->m_downstreamReady = false;
+        return Action::SEND_FRAME;
+    }
+    // Ask for the next packet once the last one has been copied
+    if (this->m_statusOwed && not this->m_held.isValid()) {
+        this->m_statusOwed = false;
+        return Action::READY;
+    }
+    return Action::NONE;
+}
+
+void TmFramer ::fill_frame() {
+    U8* const dataField = &this->m_frameBuffers[this->m_currentBuffer][TMHeader::SERIALIZED_SIZE];
+    if (not this->m_frameOpen) {
+        this->m_frameOpen = true;
+        this->m_frameAge = 0;
+        this->m_frameContext = this->m_heldContext;
+        this->m_firstHeaderPointer = NO_FIRST_HEADER;
+        // An Idle Packet started in the previous frame continues first
+        (void)::memcpy(dataField, this->m_idleCarry, static_cast<size_t>(this->m_idleCarrySize));
+        this->m_frameFill = this->m_idleCarrySize;
+        this->m_idleCarrySize = 0;
+    }
+    // The First Header Pointer locates the first packet starting in the frame (Standard 4.1.2.7.6)
+    if ((this->m_heldOffset == 0) && (this->m_firstHeaderPointer == NO_FIRST_HEADER)) {
+        this->m_firstHeaderPointer = static_cast<U16>(this->m_frameFill);
+    }
+    const FwSizeType count =
+        FW_MIN(this->m_held.getSize() - this->m_heldOffset, TmPayloadCapacity - this->m_frameFill);
+    (void)::memcpy(&dataField[this->m_frameFill], this->m_held.getData() + this->m_heldOffset,
+                   static_cast<size_t>(count));
+    this->m_frameFill += count;
+    this->m_heldOffset += count;
+}
+
+Fw::Buffer TmFramer ::finish_multiplexed_frame() {
+    FwSizeType dataSize = this->m_frameFill;
+    const FwSizeType remaining = TmPayloadCapacity - dataSize;
+    if (this->m_firstHeaderPointer == NO_FIRST_HEADER && remaining > 0) {
+        // The Idle Packet filling the frame is the first packet starting in it
+        this->m_firstHeaderPointer = static_cast<U16>(dataSize);
+    }
+    if ((remaining > 0) && (remaining < MIN_IDLE_PACKET_SIZE)) {
+        // Too little room for an Idle Packet: start a minimal one, and continue it at the start of the next frame
+        U8 idlePacket[MIN_IDLE_PACKET_SIZE];
+        Fw::ExternalSerializeBuffer idleSerializer(idlePacket, sizeof(idlePacket));
+        this->serialize_idle_packet(idleSerializer, sizeof(idlePacket));
+        (void)::memcpy(&this->m_frameBuffers[this->m_currentBuffer][TMHeader::SERIALIZED_SIZE + dataSize], idlePacket,
+                       static_cast<size_t>(remaining));
+        this->m_idleCarrySize = sizeof(idlePacket) - remaining;
+        (void)::memcpy(this->m_idleCarry, &idlePacket[remaining], static_cast<size_t>(this->m_idleCarrySize));
+        dataSize = TmPayloadCapacity;
+    }
+    this->m_frameOpen = false;
+    this->m_frameFill = 0;
+    this->m_frameAge = 0;
+    return this->finish_frame(this->m_frameContext, this->m_firstHeaderPointer, dataSize);
+}
+
+bool TmFramer ::acquire_buffer() {
+    // Frame counts are assigned when a frame is finished, so they follow the send order whichever buffer is used
+    for (FwSizeType i = 0; i < ComCfg::TmFrameBufferCount; i++) {
+        const FwSizeType index = (this->m_currentBuffer + i) % ComCfg::TmFrameBufferCount;
+        if (this->m_bufferStates[index] == BufferOwnershipState::OWNED) {
+            this->m_currentBuffer = index;
+            return true;
+        }
+    }
+    return false;
+}
+
+Fw::Buffer TmFramer ::finish_frame(const ComCfg::FrameContext& context, U16 firstHeaderPointer, FwSizeType dataSize) {
+    FW_ASSERT(firstHeaderPointer <= NO_FIRST_HEADER, static_cast<FwAssertArgType>(firstHeaderPointer));
+    FW_ASSERT(dataSize <= TmPayloadCapacity, static_cast<FwAssertArgType>(dataSize));
 
     // -----------------------------------------------
     // Header
@@ -42,9 +255,10 @@ void TmFramer ::dataIn_handler(FwIndexType portNum, Fw::Buffer& data, const ComC
 
     // Data Field Status (Standard 4.1.2.7):
     // - all flags to 0 except segment length id 0b11 per standard (4.1.2.7)
-    // - First Header Pointer is always 0 since we are always wrapping a single entire packet at offset 0
+    // - First Header Pointer in the low 11 bits (4.1.2.7.6)
     U16 dataFieldStatus = 0;
     dataFieldStatus |= 0x3 << TMSubfields::segLengthOffset;  // Seg Length Id '11' (0x3) per Standard (4.1.2.7.5)
+    dataFieldStatus |= firstHeaderPointer;
 
     header.set_globalVcId(globalVcId);
     header.set_masterFrameCount(this->m_masterFrameCount);
@@ -58,18 +272,20 @@ void TmFramer ::dataIn_handler(FwIndexType portNum, Fw::Buffer& data, const ComC
     // -------------------------------------------------
     // Data field
     // -------------------------------------------------
-    // Payload packet
     Fw::SerializeStatus status;
     // Create frame Fw::Buffer using member data field
-    Fw::Buffer frameBuffer = Fw::Buffer(this->m_frameBuffer, sizeof(this->m_frameBuffer));
+    Fw::Buffer frameBuffer = Fw::Buffer(this->m_frameBuffers[this->m_currentBuffer], ComCfg::TmFrameFixedSize);
     auto frameSerializer = frameBuffer.getSerializer();
     status = frameSerializer.serializeFrom(header);
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
-    status = frameSerializer.serializeFrom(data.getData(), data.getSize(), Fw::Serialization::OMIT_LENGTH);
+    // Data is already in place after the header
+    status = frameSerializer.serializeSkip(dataSize);
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
 
     // As per TM Standard 4.2.2.5, fill the rest of the data field with an Idle Packet
-    this->fill_with_idle_packet(frameSerializer);
+    if (dataSize < TmPayloadCapacity) {
+        this->fill_with_idle_packet(frameSerializer);
+    }
 
     // -------------------------------------------------
     // Trailer (CRC)
@@ -77,55 +293,48 @@ void TmFramer ::dataIn_handler(FwIndexType portNum, Fw::Buffer& data, const ComC
     TMTrailer trailer;
     // Compute CRC over the entire frame buffer minus the FECF trailer (Standard 4.1.6)
     U16 crc =
-        Ccsds::Utils::CRC16::compute(frameBuffer.getData(), sizeof(this->m_frameBuffer) - TMTrailer::SERIALIZED_SIZE);
+        Ccsds::Utils::CRC16::compute(frameBuffer.getData(), ComCfg::TmFrameFixedSize - TMTrailer::SERIALIZED_SIZE);
     // Set the Frame Error Control Field (FECF)
     trailer.set_fecf(crc);
     // Move the serializer pointer to the end of the location where the trailer will be serialized
     frameSerializer.moveSerToOffset(ComCfg::TmFrameFixedSize - TMTrailer::SERIALIZED_SIZE);
     status = frameSerializer.serializeFrom(trailer);
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
-
-    this->m_bufferState = BufferOwnershipState::NOT_OWNED;
-    this->dataOut_out(0, frameBuffer, context);
-    this->dataReturnOut_out(0, data, context);  // return ownership of the original data buffer
-}
-
-void TmFramer ::comStatusIn_handler(FwIndexType portNum, Fw::Success& condition) {
-    if (this->isConnected_comStatusOut_OutputPort(portNum)) {
-        this->comStatusOut_out(portNum, condition);
-    }
-}
-
-void TmFramer ::dataReturnIn_handler(FwIndexType portNum,
-                                     Fw::Buffer& frameBuffer,
-                                     const ComCfg::FrameContext& context) {
-    // Assert that the returned buffer is the member, and set ownership state
-    FW_ASSERT(frameBuffer.getData() >= &this->m_frameBuffer[0]);
-    FW_ASSERT(frameBuffer.getData() < &this->m_frameBuffer[0] + sizeof(this->m_frameBuffer));
-    this->m_bufferState = BufferOwnershipState::OWNED;
+    return frameBuffer;
 }
 
 void TmFramer ::fill_with_idle_packet(Fw::SerializeBufferBase& serializer) {
     constexpr U16 endIndex = ComCfg::TmFrameFixedSize - TMTrailer::SERIALIZED_SIZE;
-    constexpr U16 idleApid = static_cast<U16>(ComCfg::Apid::SPP_IDLE_PACKET);
     const U16 startIndex = static_cast<U16>(serializer.getSize());
     const U16 idlePacketSize = static_cast<U16>(endIndex - startIndex);
-    // Length token is defined as the number of bytes of payload data minus 1
-    const U16 lengthToken = static_cast<U16>(idlePacketSize - SpacePacketHeader::SERIALIZED_SIZE - 1);
 
     FW_ASSERT(idlePacketSize >= 7, static_cast<FwAssertArgType>(idlePacketSize));  // 7 bytes minimum for idle packet
     FW_ASSERT(idlePacketSize <= ComCfg::TmFrameFixedSize, static_cast<FwAssertArgType>(idlePacketSize));
 
+    this->serialize_idle_packet(serializer, idlePacketSize);
+}
+
+void TmFramer ::serialize_idle_packet(Fw::SerializeBufferBase& serializer, FwSizeType size) {
+    constexpr U16 idleApid = static_cast<U16>(ComCfg::Apid::SPP_IDLE_PACKET);
+    FW_ASSERT(size >= MIN_IDLE_PACKET_SIZE, static_cast<FwAssertArgType>(size));
+    // Length token is defined as the number of bytes of payload data minus 1
+    const U16 lengthToken = static_cast<U16>(size - SpacePacketHeader::SERIALIZED_SIZE - 1);
+
     SpacePacketHeader header;
     header.set_packetIdentification(idleApid);
     header.set_packetSequenceControl(
         0x3 << SpacePacketSubfields::SeqFlagsOffset);  // Sequence Flags = 0b11 (unsegmented) & unused Seq count
     header.set_packetDataLength(lengthToken);
-    // Serialize header and idle data into the frame
-    serializer.serializeFrom(header);
-    for (U16 i = static_cast<U16>(startIndex + SpacePacketHeader::SERIALIZED_SIZE); i < endIndex; i++) {
-        serializer.serializeFrom(IDLE_DATA_PATTERN);  // Idle data
-    }
+    // Serialize header, then fill the idle data in one pass
+    Fw::SerializeStatus status = serializer.serializeFrom(header);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    const FwSizeType idleDataSize = size - SpacePacketHeader::SERIALIZED_SIZE;
+    FW_ASSERT(serializer.getCapacity() - serializer.getSize() >= idleDataSize,
+              static_cast<FwAssertArgType>(idleDataSize));
+    (void)::memset(serializer.getBuffAddr() + serializer.getSize(), IDLE_DATA_PATTERN,
+                   static_cast<size_t>(idleDataSize));
+    status = serializer.serializeSkip(idleDataSize);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
 }
 }  // namespace Ccsds
 }  // namespace Svc
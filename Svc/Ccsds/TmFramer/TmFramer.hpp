@@ -7,6 +7,7 @@
 #ifndef Svc_Ccsds_TmFramer_HPP
 #define Svc_Ccsds_TmFramer_HPP
 
+#include "Os/Mutex.hpp"
 #include "Svc/Ccsds/TmFramer/TmFramerComponentAc.hpp"
 #include "Svc/Ccsds/Types/FppConstantsAc.hpp"
 #include "Svc/Ccsds/Types/SpacePacketHeaderSerializableAc.hpp"
@@ -35,14 +36,28 @@ class TmFramer final : public TmFramerComponentBase {
     static_assert(TmPayloadCapacity >= FW_FILE_BUFFER_MAX_SIZE + SppOverhead,
                   "TM Frame Fixed Size must be at least large enough to hold Tm Header + Footer, a full file buffer, 2 "
                   "SP headers, and 1 idle byte");
+    static_assert(ComCfg::TmFrameBufferCount > 0, "TmFramer requires at least one frame buffer");
 
     static constexpr U8 IDLE_DATA_PATTERN = 0x44;
 
+    //! Smallest Idle Packet: a Space Packet header and 1 byte of idle data
+    static constexpr FwSizeType MIN_IDLE_PACKET_SIZE = SpacePacketHeader::SERIALIZED_SIZE + 1;
+    //! First Header Pointer value for a frame in which no packet starts (Standard 4.1.2.7.6.4)
+    static constexpr U16 NO_FIRST_HEADER = 0x7FF;
+
     enum class BufferOwnershipState {
         NOT_OWNED,  //!< The buffer is currently not owned by the TmFramer
         OWNED,      //!< The buffer is currently owned by the TmFramer
     };
 
+    //! Next port call made when multiplexing packets
+    enum class Action {
+        NONE,         //!< Nothing left to do
+        SEND_FRAME,   //!< Send a frame on dataOut
+        RETURN_DATA,  //!< Return a framed packet on dataReturnOut
+        READY,        //!< Report SUCCESS on comStatusOut to request more data
+    };
+
   public:
     // ----------------------------------------------------------------------
     // Component construction and destruction
@@ -55,6 +70,12 @@ class TmFramer final : public TmFramerComponentBase {
     //! Destroy TmFramer object
     ~TmFramer();
 
+    //! Enable packet multiplexing. Packets are then packed back to back into frames, a packet that does not fit
+    //! continuing in the next frame, and a frame is sent once full or once it has held data for `latencyTicks` calls
+    //! of the run port. Without this call, each packet is sent in its own frame.
+    void configure(U32 latencyTicks  //!< Run port calls a partial frame may wait before it is sent. Must be > 0
+    );
+
   private:
     // ----------------------------------------------------------------------
     // Handler implementations for typed input ports
@@ -85,6 +106,13 @@ class TmFramer final : public TmFramerComponentBase {
                               Fw::Buffer& data,
                               const ComCfg::FrameContext& context) override;
 
+    //! Handler implementation for run
+    //!
+    //! Sends a partial frame once it has waited past the latency deadline
+    void run_handler(FwIndexType portNum,  //!< The port number
+                     U32 context           //!< The call order
+                     ) override;
+
     // ----------------------------------------------------------------------
     // Helpers
     // ----------------------------------------------------------------------
@@ -94,18 +122,61 @@ class TmFramer final : public TmFramerComponentBase {
     //! start_index index of the frame buffer, and fills it up to the end minus CRC
     void fill_with_idle_packet(Fw::SerializeBufferBase& serializer);
 
+    //! Serialize an Idle Packet of `size` bytes, header included
+    void serialize_idle_packet(Fw::SerializeBufferBase& serializer, FwSizeType size);
+
+    //! Select a free frame buffer as m_currentBuffer, searching in ring order from the last one used
+    //! \return whether a free buffer was found
+    bool acquire_buffer();
+
+    //! Complete the current frame buffer around `dataSize` bytes of data already in its data field: serialize the
+    //! header, fill the rest of the data field with an Idle Packet and serialize the trailer
+    //! \return the frame buffer
+    Fw::Buffer finish_frame(const ComCfg::FrameContext& context, U16 firstHeaderPointer, FwSizeType dataSize);
+
+    //! Make port calls until multiplexing has nothing left to do
+    void multiplex();
+
+    //! Advance the multiplexing state under m_lock, returning the port call to make with its arguments
+    Action next_action(Fw::Buffer& buffer, ComCfg::FrameContext& context);
+
+    //! Copy as much of the held packet as fits into the frame data field
+    void fill_frame();
+
+    //! Complete the multiplexed frame. An Idle Packet that does not fit is carried into the next frame.
+    //! \return the frame buffer
+    Fw::Buffer finish_multiplexed_frame();
+
     // ----------------------------------------------------------------------
     // Members
     // ----------------------------------------------------------------------
   private:
-    // Because the TM protocol use fixed width frames, and only one frame is in transit between ComQueue and
-    // ComInterface at a time, we can use a member fixed-size buffer to hold the frame data
-    U8 m_frameBuffer[ComCfg::TmFrameFixedSize];                        //!< Buffer to hold the frame data
-    BufferOwnershipState m_bufferState = BufferOwnershipState::OWNED;  //!< whether m_frameBuffer is owned by TmFramer
+    // Because the TM protocol use fixed width frames, we can use a pool of member fixed-size buffers to hold the frame
+    // data. Frames held by the driver do not stop the framer from filling the next buffer.
+    U8 m_frameBuffers[ComCfg::TmFrameBufferCount][ComCfg::TmFrameFixedSize];  //!< Buffers to hold the frame data
+    BufferOwnershipState m_bufferStates[ComCfg::TmFrameBufferCount];          //!< whether each buffer is owned
+    FwSizeType m_currentBuffer = 0;  //!< index of the buffer the current frame is built in
 
     // Current implementation uses a single virtual channel, so we can use a single virtual frame count
     U8 m_masterFrameCount;   //!< Master Frame Count - 8 bits - wraps around at 255
     U8 m_virtualFrameCount;  //!< Virtual Frame Count - 8 bits - wraps around at 255
+
+    // Multiplexing state. Packets arrive on one thread and frame returns, status and run calls may arrive on others,
+    // so the state is guarded by m_lock. The lock is never held across port calls, which may call back in.
+    Os::Mutex m_lock;                      //!< guards the multiplexing state
+    U32 m_latencyTicks = 0;                //!< run calls a partial frame may wait, 0 when not multiplexing
+    U32 m_frameAge = 0;                    //!< run calls since the current frame was started
+    bool m_frameOpen = false;              //!< whether the current frame has been started
+    FwSizeType m_frameFill = 0;            //!< bytes of the current frame data field in use
+    U16 m_firstHeaderPointer = 0;          //!< First Header Pointer of the current frame
+    ComCfg::FrameContext m_frameContext;   //!< context of the current frame, taken from its first packet
+    Fw::Buffer m_held;                     //!< packet being framed, returned once fully copied into frames
+    FwSizeType m_heldOffset = 0;           //!< bytes of m_held already copied into frames
+    ComCfg::FrameContext m_heldContext;    //!< context of m_held
+    U8 m_idleCarry[MIN_IDLE_PACKET_SIZE];  //!< end of an Idle Packet that continues at the start of the next frame
+    FwSizeType m_idleCarrySize = 0;        //!< bytes in m_idleCarry
+    bool m_downstreamReady = false;        //!< whether downstream reported SUCCESS since the last frame was sent
+    bool m_statusOwed = true;              //!< whether upstream is waiting for a status before sending more data
 };
 
 }  // namespace Ccsds
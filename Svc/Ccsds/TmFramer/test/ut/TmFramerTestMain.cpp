@@ -36,6 +36,26 @@ TEST(TmFramer, testBufferOwnershipState) {
     tester.testBufferOwnershipState();
 }
 
+TEST(TmFramer, testFramePipelining) {
+    Svc::Ccsds::TmFramerTester tester;
+    tester.testFramePipelining();
+}
+
+TEST(TmFramer, testMultiplexPacking) {
+    Svc::Ccsds::TmFramerTester tester;
+    tester.testMultiplexPacking();
+}
+
+TEST(TmFramer, testMultiplexSpanning) {
+    Svc::Ccsds::TmFramerTester tester;
+    tester.testMultiplexSpanning();
+}
+
+TEST(TmFramer, testIdleCarry) {
+    Svc::Ccsds::TmFramerTester tester;
+    tester.testIdleCarry();
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
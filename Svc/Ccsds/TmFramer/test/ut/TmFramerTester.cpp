@@ -9,6 +9,8 @@
 #include "Svc/Ccsds/Types/TMHeaderSerializableAc.hpp"
 #include "Svc/Ccsds/Types/TMTrailerSerializableAc.hpp"
 
+#include <cstring>
+
 namespace Svc {
 
 namespace Ccsds {
@@ -104,7 +106,7 @@ void TmFramerTester ::testSeqCountWrapAround() {
     this->component.m_virtualFrameCount = 250;
     U8 countWrapAround = 250;  // will wrap around to 0 after 255
     for (U32 iter = 0; iter < 10; iter++) {
-        this->component.m_bufferState = TmFramer::BufferOwnershipState::OWNED;  // reset state to OWNED
+        this->setBufferStates(TmFramer::BufferOwnershipState::OWNED);  // reset states to OWNED
         this->invoke_to_dataIn(0, buffer, defaultContext);
         ASSERT_from_dataOut_SIZE(iter + 1);
         Fw::Buffer outBuffer = this->fromPortHistory_dataOut->at(iter).data;
@@ -133,23 +135,193 @@ void TmFramerTester ::testDataReturn() {
     // Send a buffer that is not the internal buffer of the component, and expect an assertion
     ASSERT_DEATH_IF_SUPPORTED(this->invoke_to_dataReturnIn(0, buffer, defaultContext), "TmFramer.cpp");
 
-    // Now send the expected buffer and expect state to go back to OWNED
-    this->component.m_bufferState = TmFramer::BufferOwnershipState::NOT_OWNED;
-    Fw::Buffer internalBuffer(this->component.m_frameBuffer, sizeof(this->component.m_frameBuffer));
-    this->invoke_to_dataReturnIn(0, internalBuffer, defaultContext);
-    ASSERT_EQ(this->component.m_bufferState, TmFramer::BufferOwnershipState::OWNED);
+    // Now send each of the expected buffers and expect its state to go back to OWNED
+    this->setBufferStates(TmFramer::BufferOwnershipState::NOT_OWNED);
+    for (FwSizeType i = 0; i < ComCfg::TmFrameBufferCount; i++) {
+        Fw::Buffer internalBuffer(this->component.m_frameBuffers[i], ComCfg::TmFrameFixedSize);
+        this->invoke_to_dataReturnIn(0, internalBuffer, defaultContext);
+        ASSERT_EQ(this->component.m_bufferStates[i], TmFramer::BufferOwnershipState::OWNED);
+    }
 }
 
 void TmFramerTester ::testBufferOwnershipState() {
     U8 bufferData[10];
     Fw::Buffer buffer(bufferData, sizeof(bufferData));
     ComCfg::FrameContext context;
-    // force state to be NOT_OWNED and test that assertion is triggered
-    this->component.m_bufferState = TmFramer::BufferOwnershipState::NOT_OWNED;
+    // force all states to be NOT_OWNED and test that assertion is triggered
+    this->setBufferStates(TmFramer::BufferOwnershipState::NOT_OWNED);
     ASSERT_DEATH_IF_SUPPORTED(this->invoke_to_dataIn(0, buffer, context), "TmFramer.cpp");
-    this->component.m_bufferState = TmFramer::BufferOwnershipState::OWNED;
+    const FwSizeType last = ComCfg::TmFrameBufferCount - 1;
+    this->component.m_bufferStates[last] = TmFramer::BufferOwnershipState::OWNED;
     this->invoke_to_dataIn(0, buffer, context);  // this should work now
-    ASSERT_EQ(this->component.m_bufferState, TmFramer::BufferOwnershipState::NOT_OWNED);
+    ASSERT_EQ(this->component.m_bufferStates[last], TmFramer::BufferOwnershipState::NOT_OWNED);
+}
+
+void TmFramerTester ::testFramePipelining() {
+    U8 bufferData[10];
+    Fw::Buffer buffer(bufferData, sizeof(bufferData));
+    ComCfg::FrameContext context;
+    // Frames are built in successive pool buffers while earlier ones are still held downstream
+    for (FwSizeType i = 0; i < ComCfg::TmFrameBufferCount; i++) {
+        this->invoke_to_dataIn(0, buffer, context);
+        ASSERT_from_dataOut_SIZE(i + 1);
+        U8* frame = this->fromPortHistory_dataOut->at(i).data.getData();
+        ASSERT_EQ(frame, this->component.m_frameBuffers[i]);
+        ASSERT_EQ(this->getFrameMcCount(frame), i);
+        ASSERT_EQ(this->getFrameVcCount(frame), i);
+    }
+    // All buffers are in flight
+    ASSERT_DEATH_IF_SUPPORTED(this->invoke_to_dataIn(0, buffer, context), "TmFramer.cpp");
+
+    // Buffers may be returned in any order, and frame counts keep following the send order
+    const FwSizeType last = ComCfg::TmFrameBufferCount - 1;
+    this->invoke_to_dataReturnIn(0, this->fromPortHistory_dataOut->at(last).data, context);
+    this->invoke_to_dataIn(0, buffer, context);
+    ASSERT_from_dataOut_SIZE(ComCfg::TmFrameBufferCount + 1);
+    U8* frame = this->fromPortHistory_dataOut->at(ComCfg::TmFrameBufferCount).data.getData();
+    ASSERT_EQ(frame, this->component.m_frameBuffers[last]);
+    ASSERT_EQ(this->getFrameMcCount(frame), ComCfg::TmFrameBufferCount);
+    ASSERT_EQ(this->getFrameVcCount(frame), ComCfg::TmFrameBufferCount);
+}
+
+void TmFramerTester ::testMultiplexPacking() {
+    U8 firstData[100];
+    U8 secondData[50];
+    ::memset(firstData, 0xA1, sizeof(firstData));
+    ::memset(secondData, 0xB2, sizeof(secondData));
+    Fw::Buffer first(firstData, sizeof(firstData));
+    Fw::Buffer second(secondData, sizeof(secondData));
+    ComCfg::FrameContext context;
+    Fw::Success success = Fw::Success::SUCCESS;
+
+    this->component.configure(2);
+    // Initial downstream status asks upstream for data
+    this->invoke_to_comStatusIn(0, success);
+    ASSERT_from_comStatusOut_SIZE(1);
+    ASSERT_from_comStatusOut(0, success);
+
+    // Each packet is copied into the frame and returned straight away, and more data requested
+    this->invoke_to_dataIn(0, first, context);
+    ASSERT_from_dataReturnOut_SIZE(1);
+    ASSERT_from_comStatusOut_SIZE(2);
+    this->invoke_to_dataIn(0, second, context);
+    ASSERT_from_dataReturnOut_SIZE(2);
+    ASSERT_EQ(this->fromPortHistory_dataReturnOut->at(1).data.getData(), secondData);
+    ASSERT_from_comStatusOut_SIZE(3);
+    ASSERT_from_dataOut_SIZE(0);
+
+    // The partial frame is sent once it reaches the latency deadline
+    this->invoke_to_run(0, 0);
+    ASSERT_from_dataOut_SIZE(0);
+    this->invoke_to_run(0, 0);
+    ASSERT_from_dataOut_SIZE(1);
+    ASSERT_from_comStatusOut_SIZE(3);
+
+    U8* frame = this->fromPortHistory_dataOut->at(0).data.getData();
+    ASSERT_EQ(this->getFrameFhp(frame), 0);
+    ASSERT_EQ(this->getFrameMcCount(frame), 0);
+    ASSERT_EQ(::memcmp(&frame[TMHeader::SERIALIZED_SIZE], firstData, sizeof(firstData)), 0);
+    ASSERT_EQ(::memcmp(&frame[TMHeader::SERIALIZED_SIZE + sizeof(firstData)], secondData, sizeof(secondData)), 0);
+    // An Idle Packet (APID 0x7FF) follows the packets
+    const FwSizeType idleOffset = TMHeader::SERIALIZED_SIZE + sizeof(firstData) + sizeof(secondData);
+    ASSERT_EQ(frame[idleOffset], 0x07);
+    ASSERT_EQ(frame[idleOffset + 1], 0xFF);
+    for (FwSizeType i = idleOffset + SpacePacketHeader::SERIALIZED_SIZE;
+         i < ComCfg::TmFrameFixedSize - TMTrailer::SERIALIZED_SIZE; ++i) {
+        ASSERT_EQ(frame[i], TmFramer::IDLE_DATA_PATTERN) << "Idle data at index " << i;
+    }
+
+    // The next frame is filled in another pool buffer, but waits for downstream status before it is sent
+    this->invoke_to_dataIn(0, first, context);
+    ASSERT_from_dataReturnOut_SIZE(3);
+    this->invoke_to_run(0, 0);
+    this->invoke_to_run(0, 0);
+    ASSERT_from_dataOut_SIZE(1);
+    this->invoke_to_comStatusIn(0, success);
+    ASSERT_from_dataOut_SIZE(2);
+    ASSERT_NE(this->fromPortHistory_dataOut->at(1).data.getData(), frame);
+}
+
+void TmFramerTester ::testMultiplexSpanning() {
+    const FwSizeType packetSize = 300;
+    U8 packetData[4][packetSize];
+    ComCfg::FrameContext context;
+    Fw::Success success = Fw::Success::SUCCESS;
+
+    this->component.configure(1);
+    this->invoke_to_comStatusIn(0, success);
+    for (U8 i = 0; i < 4; i++) {
+        ::memset(packetData[i], i + 1, packetSize);
+        Fw::Buffer packet(packetData[i], packetSize);
+        this->invoke_to_dataIn(0, packet, context);
+    }
+    // The fourth packet fills the frame, which is sent without waiting for run. The rest of the packet continues in
+    // the next frame, built in another pool buffer, so the packet is returned straight away
+    ASSERT_from_dataOut_SIZE(1);
+    ASSERT_from_dataReturnOut_SIZE(4);
+    ASSERT_EQ(this->fromPortHistory_dataReturnOut->at(3).data.getData(), packetData[3]);
+    ASSERT_from_comStatusOut_SIZE(5);
+    Fw::Buffer frameBuffer = this->fromPortHistory_dataOut->at(0).data;
+    U8* frame = frameBuffer.getData();
+    ASSERT_EQ(this->getFrameFhp(frame), 0);
+    ASSERT_EQ(frame[TMHeader::SERIALIZED_SIZE + 3 * packetSize], 4);
+    ASSERT_EQ(frame[ComCfg::TmFrameFixedSize - TMTrailer::SERIALIZED_SIZE - 1], 4);
+
+    const FwSizeType remainder = 4 * packetSize - TmFramer::TmPayloadCapacity;
+    this->invoke_to_dataReturnIn(0, frameBuffer, context);
+    this->invoke_to_comStatusIn(0, success);
+    this->invoke_to_run(0, 0);
+    ASSERT_from_dataOut_SIZE(2);
+
+    frame = this->fromPortHistory_dataOut->at(1).data.getData();
+    // No packet header before the Idle Packet following the remainder
+    ASSERT_EQ(this->getFrameFhp(frame), remainder);
+    ASSERT_EQ(this->getFrameMcCount(frame), 1);
+    ASSERT_EQ(this->getFrameVcCount(frame), 1);
+    ASSERT_EQ(frame[TMHeader::SERIALIZED_SIZE], 4);
+    ASSERT_EQ(frame[TMHeader::SERIALIZED_SIZE + remainder - 1], 4);
+    ASSERT_EQ(frame[TMHeader::SERIALIZED_SIZE + remainder], 0x07);
+}
+
+void TmFramerTester ::testIdleCarry() {
+    U8 largeData[TmFramer::TmPayloadCapacity - 3];
+    U8 smallData[10];
+    ::memset(largeData, 0x11, sizeof(largeData));
+    ::memset(smallData, 0x22, sizeof(smallData));
+    Fw::Buffer large(largeData, sizeof(largeData));
+    Fw::Buffer small(smallData, sizeof(smallData));
+    ComCfg::FrameContext context;
+    Fw::Success success = Fw::Success::SUCCESS;
+
+    this->component.configure(1);
+    this->invoke_to_comStatusIn(0, success);
+    this->invoke_to_dataIn(0, large, context);
+    this->invoke_to_run(0, 0);
+    ASSERT_from_dataOut_SIZE(1);
+
+    // Only 3 bytes are left: the first 3 bytes of a minimal Idle Packet end the frame
+    Fw::Buffer frameBuffer = this->fromPortHistory_dataOut->at(0).data;
+    U8* frame = frameBuffer.getData();
+    const FwSizeType idleOffset = TMHeader::SERIALIZED_SIZE + sizeof(largeData);
+    ASSERT_EQ(this->getFrameFhp(frame), 0);
+    ASSERT_EQ(frame[idleOffset], 0x07);
+    ASSERT_EQ(frame[idleOffset + 1], 0xFF);
+    ASSERT_EQ(frame[idleOffset + 2], 0xC0);
+
+    // The remaining 4 bytes of the Idle Packet start the next frame, and the next packet follows them
+    this->invoke_to_dataReturnIn(0, frameBuffer, context);
+    this->invoke_to_comStatusIn(0, success);
+    this->invoke_to_dataIn(0, small, context);
+    this->invoke_to_run(0, 0);
+    ASSERT_from_dataOut_SIZE(2);
+    frame = this->fromPortHistory_dataOut->at(1).data.getData();
+    ASSERT_EQ(this->getFrameFhp(frame), 4);
+    ASSERT_EQ(this->getFrameMcCount(frame), 1);
+    ASSERT_EQ(frame[TMHeader::SERIALIZED_SIZE], 0x00);      // sequence count
+    ASSERT_EQ(frame[TMHeader::SERIALIZED_SIZE + 1], 0x00);  // packet data length
+    ASSERT_EQ(frame[TMHeader::SERIALIZED_SIZE + 2], 0x00);
+    ASSERT_EQ(frame[TMHeader::SERIALIZED_SIZE + 3], TmFramer::IDLE_DATA_PATTERN);
+    ASSERT_EQ(::memcmp(&frame[TMHeader::SERIALIZED_SIZE + 4], smallData, sizeof(smallData)), 0);
 }
 
 // ----------------------------------------------------------------------
@@ -168,6 +340,14 @@ U8 TmFramerTester::getFrameMcCount(U8* frameData) {
 U8 TmFramerTester::getFrameVcCount(U8* frameData) {
     return frameData[3];
 }
+U16 TmFramerTester::getFrameFhp(U8* frameData) {
+    return static_cast<U16>((frameData[4] & 0x07) << 8 | frameData[5]);
+}
+void TmFramerTester::setBufferStates(TmFramer::BufferOwnershipState state) {
+    for (FwSizeType i = 0; i < ComCfg::TmFrameBufferCount; i++) {
+        this->component.m_bufferStates[i] = state;
+    }
+}
 
 }  // namespace Ccsds
 
@@ -27,6 +27,18 @@ class CRC16 {
     //! \param new_byte: new byte to add to calculation
     void update(U8 new_byte) { this->m_crc = static_cast<U16>(update_crc_ccitt(m_crc, static_cast<char>(new_byte))); };
 
+    //! \brief update CRC with a contiguous block of bytes
+    //!
+    //! \param buffer: pointer to the data buffer
+    //! \param length: length of the data buffer
+    void update(const U8* buffer, FwSizeType length) {
+        U16 crc = this->m_crc;
+        for (FwSizeType i = 0; i < length; ++i) {
+            crc = static_cast<U16>(update_crc_ccitt(crc, static_cast<char>(buffer[i])));
+        }
+        this->m_crc = crc;
+    };
+
     //! \brief finalize and return CRC value
     U16 finalize() {
         // Specified XOR value is 0x0000
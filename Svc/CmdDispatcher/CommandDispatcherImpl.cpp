@@ -19,32 +19,47 @@ static_assert(CMD_DISPATCHER_SEQUENCER_TABLE_SIZE <= std::numeric_limits<U32>::m
 
 namespace Svc {
 CommandDispatcherImpl::CommandDispatcherImpl(const char* name)
-    : CommandDispatcherComponentBase(name), m_seq(0), m_numCmdsDispatched(0), m_numCmdErrors(0), m_numCmdsDropped(0) {
+    : CommandDispatcherComponentBase(name),
+      m_numEntries(0),
+      m_seq(0),
+      m_numCmdsDispatched(0),
+      m_numCmdErrors(0),
+      m_numCmdsDropped(0) {
     memset(this->m_entryTable, 0, sizeof(this->m_entryTable));
     memset(this->m_sequenceTracker, 0, sizeof(this->m_sequenceTracker));
+    for (FwSizeType slot = 0; slot < OPCODE_INDEX_SIZE; slot++) {
+        this->m_opcodeIndex[slot] = OPCODE_INDEX_EMPTY;
+    }
 }
 
 CommandDispatcherImpl::~CommandDispatcherImpl() {}
 
+bool CommandDispatcherImpl::findEntry(FwOpcodeType opCode, FwSizeType& slot) const {
+    // The index is never more than half full, so an empty slot always ends the probe
+    return OpcodeIndex::find(
+        opCode, slot, [this](FwSizeType probe) { return this->m_opcodeIndex[probe] == OPCODE_INDEX_EMPTY; },
+        [this, opCode](FwSizeType probe) { return this->m_entryTable[this->m_opcodeIndex[probe]].opcode == opCode; });
+}
+
 void CommandDispatcherImpl::compCmdReg_handler(FwIndexType portNum, FwOpcodeType opCode) {
-    // search for an empty slot
-    bool slotFound = false;
-    for (FwOpcodeType slot = 0; slot < FW_NUM_ARRAY_ELEMENTS(this->m_entryTable); slot++) {
-        if ((not this->m_entryTable[slot].used) and (not slotFound)) {
-            this->m_entryTable[slot].opcode = opCode;
-            this->m_entryTable[slot].port = portNum;
-            this->m_entryTable[slot].used = true;
-            this->log_DIAGNOSTIC_OpCodeRegistered(opCode, portNum, static_cast<I32>(slot));
-            slotFound = true;
-        } else if ((this->m_entryTable[slot].used) && (this->m_entryTable[slot].opcode == opCode) &&
-                   (this->m_entryTable[slot].port == portNum) && (not slotFound)) {
-            slotFound = true;
-            this->log_DIAGNOSTIC_OpCodeReregistered(opCode, portNum);
-        } else if (this->m_entryTable[slot].used) {  // make sure no duplicates
-            FW_ASSERT(this->m_entryTable[slot].opcode != opCode, static_cast<FwAssertArgType>(opCode));
-        }
+    FwSizeType indexSlot = 0;
+    if (this->findEntry(opCode, indexSlot)) {
+        // make sure no duplicates
+        FW_ASSERT(this->m_entryTable[this->m_opcodeIndex[indexSlot]].port == portNum,
+                  static_cast<FwAssertArgType>(opCode));
+        this->log_DIAGNOSTIC_OpCodeReregistered(opCode, portNum);
+        return;
     }
-    FW_ASSERT(slotFound, static_cast<FwAssertArgType>(opCode));
+    // take the next free slot
+    FW_ASSERT(this->m_numEntries < FW_NUM_ARRAY_ELEMENTS(this->m_entryTable), static_cast<FwAssertArgType>(opCode));
+    const FwOpcodeType slot = this->m_numEntries;
+    this->m_entryTable[slot].opcode = opCode;
+    this->m_entryTable[slot].port = portNum;
+    this->m_entryTable[slot].used = true;
+    this->m_numEntries++;
+    // index the new entry in the empty slot ending its probe sequence
+    this->m_opcodeIndex[indexSlot] = slot;
+    this->log_DIAGNOSTIC_OpCodeRegistered(opCode, portNum, static_cast<I32>(slot));
 }
 
 void CommandDispatcherImpl::compCmdStat_handler(FwIndexType portNum,
@@ -59,10 +74,12 @@ void CommandDispatcherImpl::compCmdStat_handler(FwIndexType portNum,
         FW_ASSERT(response.e != Fw::CmdResponse::OK);
         this->log_COMMAND_OpCodeError(opCode, response);
     }
-    // look for command source
+    // look for command source, starting at the slot the command was placed in when it was free
     FwIndexType portToCall = -1;
     U32 context;
-    for (U32 pending = 0; pending < FW_NUM_ARRAY_ELEMENTS(this->m_sequenceTracker); pending++) {
+    const U32 home = cmdSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE;
+    for (U32 probe = 0; probe < FW_NUM_ARRAY_ELEMENTS(this->m_sequenceTracker); probe++) {
+        const U32 pending = (home + probe) % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE;
         if ((this->m_sequenceTracker[pending].seq == cmdSeq) && (this->m_sequenceTracker[pending].used)) {
             portToCall = this->m_sequenceTracker[pending].callerPort;
             context = this->m_sequenceTracker[pending].context;
@@ -97,22 +114,19 @@ void CommandDispatcherImpl::seqCmdBuff_handler(FwIndexType portNum, Fw::ComBuffe
         return;
     }
 
-    // search for opcode in dispatch table
-    FwOpcodeType entry;
-    bool entryFound = false;
-
-    for (entry = 0; entry < FW_NUM_ARRAY_ELEMENTS(this->m_entryTable); entry++) {
-        if ((this->m_entryTable[entry].used) and (cmdPkt.getOpCode() == this->m_entryTable[entry].opcode)) {
-            entryFound = true;
-            break;
-        }
-    }
+    // look up opcode in dispatch table
+    FwSizeType indexSlot = 0;
+    const bool entryFound = this->findEntry(cmdPkt.getOpCode(), indexSlot);
+    const FwOpcodeType entry = entryFound ? this->m_opcodeIndex[indexSlot] : 0;
     if (entryFound and this->isConnected_compCmdSend_OutputPort(this->m_entryTable[entry].port)) {
         // register command in command tracker only if response port is connect
         if (this->isConnected_seqCmdStatus_OutputPort(portNum)) {
             bool pendingFound = false;
 
-            for (U32 pending = 0; pending < FW_NUM_ARRAY_ELEMENTS(this->m_sequenceTracker); pending++) {
+            // prefer the slot given by the sequence number so completion finds it on the first probe
+            const U32 home = this->m_seq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE;
+            for (U32 probe = 0; probe < FW_NUM_ARRAY_ELEMENTS(this->m_sequenceTracker); probe++) {
+                const U32 pending = (home + probe) % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE;
                 if (not this->m_sequenceTracker[pending].used) {
                     pendingFound = true;
                     this->m_sequenceTracker[pending].used = true;
@@ -15,6 +15,7 @@
 
 #include <Os/Mutex.hpp>
 #include <Svc/CmdDispatcher/CommandDispatcherComponentAc.hpp>
+#include <Utils/Types/HashIndex.hpp>
 #include <config/CommandDispatcherImplCfg.hpp>
 
 namespace Svc {
@@ -132,6 +133,13 @@ class CommandDispatcherImpl final : public CommandDispatcherComponentBase {
     //!  \param cmdSeq the assigned sequence number for the command
     void CMD_CLEAR_TRACKING_cmdHandler(FwOpcodeType opCode, U32 cmdSeq) override;
 
+    //!  \brief find the opcode index slot of an opcode
+    //!
+    //!  \param opCode the opcode to look up
+    //!  \param slot (output) slot in m_opcodeIndex holding the opcode's entry, or the empty slot where it would be added
+    //!  \return true if the opcode is registered
+    bool findEntry(FwOpcodeType opCode, FwSizeType& slot) const;
+
     //!  \brief Called when the command sequence queue overflows
     //!
     //!  Generate event to the user that the command queue overflowed and the
@@ -150,8 +158,9 @@ class CommandDispatcherImpl final : public CommandDispatcherComponentBase {
     //! As each command opcode is registered, a new entry is found
     //! in the table by checking for the "used" flag. The opcode
     //! member is set to the opcode, and the port member set to the
-    //! port to dispatch to. When a new opcode is received for
-    //! execution, the table is traversed until the opcode is located.
+    //! port to dispatch to. Each entry is also recorded in m_opcodeIndex
+    //! so that an opcode received for execution is located without
+    //! traversing the table.
 
     struct DispatchEntry {
         bool used;                                       //!< if entry has been used yet
@@ -159,6 +168,18 @@ class CommandDispatcherImpl final : public CommandDispatcherComponentBase {
         FwIndexType port;                                //!< which port the entry invokes
     } m_entryTable[CMD_DISPATCHER_DISPATCH_TABLE_SIZE];  //!< table of dispatch entries
 
+    //! Opcode index, sized to at least twice the dispatch table to keep probe sequences short
+    using OpcodeIndex = Types::HashIndex<Types::hashIndexBits(2 * CMD_DISPATCHER_DISPATCH_TABLE_SIZE)>;
+    //! Number of slots in the opcode index
+    static constexpr FwSizeType OPCODE_INDEX_SIZE = OpcodeIndex::SLOTS;
+    //! Opcode index value marking an empty slot
+    static constexpr FwOpcodeType OPCODE_INDEX_EMPTY = CMD_DISPATCHER_DISPATCH_TABLE_SIZE;
+
+    //! Open-addressing (linear probing) hash index from opcode to m_entryTable entry. Entries are never removed, so
+    //! a lookup stops at the first empty slot.
+    FwOpcodeType m_opcodeIndex[OPCODE_INDEX_SIZE];
+    FwOpcodeType m_numEntries;  //!< number of used entries in m_entryTable, which fills in registration order
+
     //! \struct SequenceTracker
     //! \brief table used to store opcode that are being executed
     //!
@@ -170,7 +191,8 @@ class CommandDispatcherImpl final : public CommandDispatcherComponentBase {
     //! assigned sequence number for the command. The "opCode" field is
     //! used for the opcode, and the "callerPort" field is used to store
     //! the port number of the caller so the status can be reported back to
-    //! correct port.
+    //! correct port. An entry is placed at slot `seq` modulo the table size when
+    //! that slot is free, so a completion normally finds its entry without searching.
 
     struct SequenceTracker {
         bool used;                                             //!< if this slot is used
@@ -203,6 +203,24 @@ TEST(CmdDispTestOffNominal, CommandQueueOverflow) {
     tester.runCommandQueueOverflow();
 }
 
+TEST(CmdDispTestNominal, FullTableDispatch) {
+    TEST_CASE(102.1.4, "Full Table Dispatch");
+    COMMENT("Fill the dispatch table and verify every opcode dispatches and completes.");
+
+    Svc::CommandDispatcherImpl impl("CmdDispImpl");
+
+    impl.init(10, 0);
+
+    Svc::CommandDispatcherTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl, tester);
+
+    tester.runFullTableDispatch();
+}
+
 #ifndef TGT_OS_TYPE_VXWORKS
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
@@ -966,6 +966,85 @@ void CommandDispatcherTester::runCommandQueueOverflow() {
     ASSERT_TLM_CommandsDropped(0, 6);
 }
 
+FwOpcodeType CommandDispatcherTester::fullTableOpcode(FwOpcodeType entry) {
+    // Mimic component opcode bases with a handful of commands each
+    return static_cast<FwOpcodeType>(0x1000 + ((entry / 8) * 0x100) + (entry % 8));
+}
+
+void CommandDispatcherTester::fillDispatchTable() {
+    for (FwOpcodeType entry = 0; entry < CMD_DISPATCHER_DISPATCH_TABLE_SIZE; entry++) {
+        this->invoke_to_compCmdReg(0, fullTableOpcode(entry));
+    }
+    ASSERT_EQ(this->m_impl.m_numEntries, static_cast<FwOpcodeType>(CMD_DISPATCHER_DISPATCH_TABLE_SIZE));
+}
+
+void CommandDispatcherTester::dispatchCommand(FwOpcodeType opCode, U32 context) {
+    Fw::ComBuffer buff;
+    ASSERT_EQ(buff.serializeFrom(FwPacketDescriptorType(Fw::ComPacketType::FW_PACKET_COMMAND)), Fw::FW_SERIALIZE_OK);
+    ASSERT_EQ(buff.serializeFrom(opCode), Fw::FW_SERIALIZE_OK);
+    this->invoke_to_seqCmdBuff(0, buff, context);
+    ASSERT_EQ(Fw::QueuedComponentBase::MSG_DISPATCH_OK, this->m_impl.doDispatch());
+}
+
+void CommandDispatcherTester::runFullTableDispatch() {
+    this->fillDispatchTable();
+    ASSERT_EVENTS_OpCodeRegistered_SIZE(CMD_DISPATCHER_DISPATCH_TABLE_SIZE);
+
+    // re-registering any entry of a full table is still accepted
+    this->clearEvents();
+    this->invoke_to_compCmdReg(0, fullTableOpcode(CMD_DISPATCHER_DISPATCH_TABLE_SIZE - 1));
+    ASSERT_EVENTS_OpCodeReregistered_SIZE(1);
+
+    // every registered opcode is found and completes back to the sequencer
+    for (FwOpcodeType entry = 0; entry < CMD_DISPATCHER_DISPATCH_TABLE_SIZE; entry++) {
+        const FwOpcodeType opCode = fullTableOpcode(entry);
+        this->clearEvents();
+        this->m_cmdSendRcvd = false;
+        this->m_seqStatusRcvd = false;
+        this->dispatchCommand(opCode, entry);
+        ASSERT_TRUE(this->m_cmdSendRcvd);
+        ASSERT_EQ(this->m_cmdSendOpCode, opCode);
+        ASSERT_EVENTS_OpCodeDispatched_SIZE(1);
+        ASSERT_EVENTS_OpCodeDispatched(0, opCode, 0);
+
+        this->invoke_to_compCmdStat(0, opCode, this->m_cmdSendCmdSeq, Fw::CmdResponse::OK);
+        ASSERT_EQ(Fw::QueuedComponentBase::MSG_DISPATCH_OK, this->m_impl.doDispatch());
+        ASSERT_TRUE(this->m_seqStatusRcvd);
+        ASSERT_EQ(this->m_seqStatusOpCode, opCode);
+        ASSERT_EQ(this->m_seqStatusCmdSeq, static_cast<U32>(entry));
+    }
+
+    // an unregistered opcode is still rejected
+    this->clearEvents();
+    this->dispatchCommand(fullTableOpcode(CMD_DISPATCHER_DISPATCH_TABLE_SIZE), 0);
+    ASSERT_EVENTS_InvalidCommand_SIZE(1);
+}
+
+void CommandDispatcherTester::runFullTableBenchmark(U32 iterations) {
+    this->fillDispatchTable();
+    Os::IntervalTimer timer;
+    timer.start();
+    for (U32 iteration = 0; iteration < iterations; iteration++) {
+        // walk the table backwards so a linear search would see its worst case
+        const FwOpcodeType entry =
+            static_cast<FwOpcodeType>(CMD_DISPATCHER_DISPATCH_TABLE_SIZE - 1 - (iteration % CMD_DISPATCHER_DISPATCH_TABLE_SIZE));
+        const FwOpcodeType opCode = fullTableOpcode(entry);
+        this->dispatchCommand(opCode, iteration);
+        this->invoke_to_compCmdStat(0, opCode, this->m_cmdSendCmdSeq, Fw::CmdResponse::OK);
+        ASSERT_EQ(Fw::QueuedComponentBase::MSG_DISPATCH_OK, this->m_impl.doDispatch());
+        // keep the recorded history from growing without bound
+        if ((iteration % 1024) == 0) {
+            this->clearHistory();
+        }
+    }
+    timer.stop();
+    ASSERT_EQ(this->m_impl.m_numCmdsDispatched, iterations);
+    printf("Dispatched %lu commands against %lu opcodes in %lu us (%.3f us/command)\n",
+           static_cast<unsigned long>(iterations), static_cast<unsigned long>(CMD_DISPATCHER_DISPATCH_TABLE_SIZE),
+           static_cast<unsigned long>(timer.getDiffUsec()),
+           static_cast<double>(timer.getDiffUsec()) / static_cast<double>(iterations));
+}
+
 void CommandDispatcherTester::from_pingOut_handler(const FwIndexType portNum, /*!< The port number*/
                                                    U32 key                    /*!< Value to return to pinger*/
 ) {}
@@ -27,10 +27,22 @@ class CommandDispatcherTester : public CommandDispatcherGTestBase {
     void runNopCommands();
     void runClearCommandTracking();
     void runCommandQueueOverflow();
+    void runFullTableDispatch();
+    //! Dispatch and complete commands against a full dispatch table, printing the mean time per command
+    void runFullTableBenchmark(U32 iterations);
 
   private:
     Svc::CommandDispatcherImpl& m_impl;
 
+    //! Opcode registered in slot `entry` of a full dispatch table
+    static FwOpcodeType fullTableOpcode(FwOpcodeType entry);
+
+    //! Register opcodes until the dispatch table is full
+    void fillDispatchTable();
+
+    //! Send a command packet with the given opcode through the seqCmdBuff port and dispatch it
+    void dispatchCommand(FwOpcodeType opCode, U32 context);
+
     void from_compCmdSend_handler(FwIndexType portNum, FwOpcodeType opCode, U32 cmdSeq, Fw::CmdArgBuffer& args);
 
     void from_pingOut_handler(const FwIndexType portNum, /*!< The port number*/
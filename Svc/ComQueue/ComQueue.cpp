@@ -27,13 +27,18 @@ ComQueue ::QueueConfigurationTable ::QueueConfigurationTable() {
         this->entries[i].depth = 0;
         this->entries[i].mode = Types::QUEUE_FIFO;
         this->entries[i].overflowMode = Types::QUEUE_DROP_NEWEST;
+        this->entries[i].packedSize = 0;
     }
+    this->batchSize = 0;
+    this->dispatchBatch = 0;
 }
 
 ComQueue ::ComQueue(const char* const compName)
     : ComQueueComponentBase(compName),
       m_state(WAITING),
       m_buffer_state(OWNED),
+      m_batch(nullptr),
+      m_batchSize(0),
       m_allocationId(static_cast<FwEnumStoreType>(-1)),
       m_allocator(nullptr),
       m_allocation(nullptr) {
@@ -41,6 +46,9 @@ ComQueue ::ComQueue(const char* const compName)
     for (FwIndexType i = 0; i < TOTAL_PORT_COUNT; i++) {
         this->m_throttle[i] = false;
     }
+    for (FwIndexType i = 0; i < COM_PORT_COUNT; i++) {
+        this->m_packed[i] = false;
+    }
 
     static_assert(TOTAL_PORT_COUNT >= 1, "ComQueue must have more than one port");
 }
@@ -96,15 +104,33 @@ void ComQueue::configure(QueueConfigurationTable queueConfig,
                 // Message size is determined by the type of object being stored, which in turn is determined by the
                 // index of the entry. Those lower than COM_PORT_COUNT are Fw::ComBuffers and those larger Fw::Buffer.
                 entry.msgSize = (entryIndex < COM_PORT_COUNT) ? sizeof(Fw::ComBuffer) : sizeof(Fw::Buffer);
-                // Overflow checks
-                FW_ASSERT((std::numeric_limits<FwSizeType>::max() / entry.depth) >= entry.msgSize,
-                          static_cast<FwAssertArgType>(entry.depth), static_cast<FwAssertArgType>(entry.msgSize));
-                FW_ASSERT(std::numeric_limits<FwSizeType>::max() - (entry.depth * entry.msgSize) >= totalAllocation);
-                totalAllocation += entry.depth * entry.msgSize;
+                // Packed storage holds Fw::Com packets at their actual size and is sized directly in bytes
+                entry.packedSize = queueConfig.entries[entryIndex].packedSize;
+                FW_ASSERT((entry.packedSize == 0) || (entryIndex < COM_PORT_COUNT),
+                          static_cast<FwAssertArgType>(entryIndex));
+                if (entry.packedSize == 0) {
+                    // Overflow checks
+                    FW_ASSERT((std::numeric_limits<FwSizeType>::max() / entry.depth) >= entry.msgSize,
+                              static_cast<FwAssertArgType>(entry.depth), static_cast<FwAssertArgType>(entry.msgSize));
+                    FW_ASSERT(std::numeric_limits<FwSizeType>::max() - (entry.depth * entry.msgSize) >=
+                              totalAllocation);
+                    totalAllocation += entry.depth * entry.msgSize;
+                } else {
+                    FW_ASSERT(std::numeric_limits<FwSizeType>::max() - entry.packedSize >= totalAllocation);
+                    totalAllocation += entry.packedSize;
+                }
                 currentPriorityIndex++;
             }
         }
     }
+    // Batched output is built in a region at the end of the same allocation
+    this->m_batchSize = queueConfig.batchSize;
+    FW_ASSERT((this->m_batchSize == 0) || (this->m_batchSize >= FW_COM_BUFFER_MAX_SIZE),
+              static_cast<FwAssertArgType>(this->m_batchSize));
+    FW_ASSERT(std::numeric_limits<FwSizeType>::max() - this->m_batchSize >= totalAllocation);
+    const FwSizeType queueAllocation = totalAllocation;
+    totalAllocation += this->m_batchSize;
+
     // Allocate a single chunk of memory from the memory allocator. Memory recover is neither needed nor used.
     bool recoverable = false;
     this->m_allocation = this->m_allocator->allocate(this->m_allocationId, totalAllocation, recoverable);
@@ -115,14 +141,22 @@ void ComQueue::configure(QueueConfigurationTable queueConfig,
     FwSizeType allocationOffset = 0;
     for (FwIndexType i = 0; i < TOTAL_PORT_COUNT; i++) {
         // Get current queue's allocation size and safety check the values
-        FwSizeType allocationSize = this->m_prioritizedList[i].depth * this->m_prioritizedList[i].msgSize;
+        const bool packed = this->m_prioritizedList[i].packedSize > 0;
+        FwSizeType allocationSize = packed ? this->m_prioritizedList[i].packedSize
+                                           : this->m_prioritizedList[i].depth * this->m_prioritizedList[i].msgSize;
         FW_ASSERT(this->m_prioritizedList[i].index < static_cast<FwIndexType>(FW_NUM_ARRAY_ELEMENTS(this->m_queues)),
                   static_cast<FwAssertArgType>(this->m_prioritizedList[i].index));
         FW_ASSERT((allocationSize + allocationOffset) <= totalAllocation, static_cast<FwAssertArgType>(allocationSize),
                   static_cast<FwAssertArgType>(allocationOffset), static_cast<FwAssertArgType>(totalAllocation));
 
         // Setup queue's memory allocation, depth, and message size. Setup is skipped for a depth 0 queue
-        if (allocationSize > 0) {
+        if (packed) {
+            const FwIndexType index = this->m_prioritizedList[i].index;
+            this->m_packed[index] = true;
+            this->m_packetQueues[index].setup(reinterpret_cast<U8*>(this->m_allocation) + allocationOffset,
+                                              allocationSize, this->m_prioritizedList[i].mode,
+                                              this->m_prioritizedList[i].overflowMode);
+        } else if (allocationSize > 0) {
             this->m_queues[this->m_prioritizedList[i].index].setup(
                 reinterpret_cast<U8*>(this->m_allocation) + allocationOffset, allocationSize,
                 this->m_prioritizedList[i].depth, this->m_prioritizedList[i].msgSize, this->m_prioritizedList[i].mode,
@@ -130,9 +164,17 @@ void ComQueue::configure(QueueConfigurationTable queueConfig,
         }
         allocationOffset += allocationSize;
     }
-    // Safety check that all memory was used as expected
-    FW_ASSERT(allocationOffset == totalAllocation, static_cast<FwAssertArgType>(allocationOffset),
-              static_cast<FwAssertArgType>(totalAllocation));
+    // Safety check that all queue memory was used as expected
+    FW_ASSERT(allocationOffset == queueAllocation, static_cast<FwAssertArgType>(allocationOffset),
+              static_cast<FwAssertArgType>(queueAllocation));
+    this->m_batch = (this->m_batchSize > 0) ? reinterpret_cast<U8*>(this->m_allocation) + queueAllocation : nullptr;
+
+    // Batched dispatch is an optimization only, queue implementations without it receive one message at a time
+    if (queueConfig.dispatchBatch > 0) {
+        const Os::Queue::Status status = this->enableBatchDispatch(queueConfig.dispatchBatch);
+        FW_ASSERT((status == Os::Queue::Status::OP_OK) || (status == Os::Queue::Status::NOT_SUPPORTED),
+                  static_cast<FwAssertArgType>(status));
+    }
 }
 
 // ----------------------------------------------------------------------
@@ -216,7 +258,12 @@ void ComQueue::SET_QUEUE_PRIORITY_cmdHandler(FwOpcodeType opCode,
 void ComQueue::comPacketQueueIn_handler(const FwIndexType portNum, Fw::ComBuffer& data, U32 context) {
     // Ensure that the port number of comPacketQueueIn is consistent with the expectation
     FW_ASSERT(portNum >= 0 && portNum < COM_PORT_COUNT, static_cast<FwAssertArgType>(portNum));
-    (void)this->enqueue(portNum, QueueType::COM_QUEUE, reinterpret_cast<const U8*>(&data), sizeof(Fw::ComBuffer));
+    if (this->m_packed[portNum]) {
+        // Packed queues store only the packet bytes
+        (void)this->enqueue(portNum, QueueType::COM_QUEUE, data.getBuffAddr(), data.getSize());
+    } else {
+        (void)this->enqueue(portNum, QueueType::COM_QUEUE, reinterpret_cast<const U8*>(&data), sizeof(Fw::ComBuffer));
+    }
 }
 
 void ComQueue::bufferQueueIn_handler(const FwIndexType portNum, Fw::Buffer& fwBuffer) {
@@ -258,16 +305,14 @@ void ComQueue::run_handler(const FwIndexType portNum, U32 context) {
     // Downlink the high-water marks for the Fw::ComBuffer array types
     ComQueueDepth comQueueDepth;
     for (U32 i = 0; i < comQueueDepth.SIZE; i++) {
-        comQueueDepth[i] = static_cast<U32>(this->m_queues[i].get_high_water_mark());
-        this->m_queues[i].clear_high_water_mark();
+        comQueueDepth[i] = static_cast<U32>(this->takeHighWaterMark(static_cast<FwIndexType>(i)));
     }
     this->tlmWrite_comQueueDepth(comQueueDepth);
 
     // Downlink the high-water marks for the Fw::Buffer array types
     BuffQueueDepth buffQueueDepth;
     for (U32 i = 0; i < buffQueueDepth.SIZE; i++) {
-        buffQueueDepth[i] = static_cast<U32>(this->m_queues[i + COM_PORT_COUNT].get_high_water_mark());
-        this->m_queues[i + COM_PORT_COUNT].clear_high_water_mark();
+        buffQueueDepth[i] = static_cast<U32>(this->takeHighWaterMark(static_cast<FwIndexType>(i + COM_PORT_COUNT)));
     }
     this->tlmWrite_buffQueueDepth(buffQueueDepth);
 }
@@ -313,9 +358,17 @@ bool ComQueue::enqueue(const FwIndexType queueNum, QueueType queueType, const U8
               static_cast<FwAssertArgType>(queueType), static_cast<FwAssertArgType>(queueNum));
     const FwIndexType portNum =
         static_cast<FwIndexType>(queueNum - ((queueType == QueueType::COM_QUEUE) ? 0 : COM_PORT_COUNT));
-    FW_ASSERT(expectedSize == size, static_cast<FwAssertArgType>(size), static_cast<FwAssertArgType>(expectedSize));
     FW_ASSERT(portNum >= 0, static_cast<FwAssertArgType>(portNum));
-    Fw::SerializeStatus status = this->m_queues[queueNum].enqueue(data, size);
+    Fw::SerializeStatus status = Fw::FW_SERIALIZE_OK;
+    if ((queueNum < COM_PORT_COUNT) && this->m_packed[queueNum]) {
+        // Packed queues take the packet bytes at their actual size
+        FW_ASSERT(size <= FW_COM_BUFFER_MAX_SIZE, static_cast<FwAssertArgType>(size));
+        status = this->m_packetQueues[queueNum].enqueue(data, size);
+    } else {
+        FW_ASSERT(expectedSize == size, static_cast<FwAssertArgType>(size),
+                  static_cast<FwAssertArgType>(expectedSize));
+        status = this->m_queues[queueNum].enqueue(data, size);
+    }
     if (status == Fw::FW_SERIALIZE_NO_ROOM_LEFT || status == Fw::FW_SERIALIZE_DISCARDED_EXISTING) {
         if (!this->m_throttle[queueNum]) {
             this->log_WARNING_HI_QueueOverflow(queueType, portNum);
@@ -368,15 +421,44 @@ void ComQueue::sendBuffer(Fw::Buffer& buffer, FwIndexType queueIndex) {
     this->m_state = WAITING;
 }
 
+void ComQueue::sendBatch(FwIndexType queueIndex) {
+    FW_ASSERT(queueIndex >= 0 && queueIndex < COM_PORT_COUNT, static_cast<FwAssertArgType>(queueIndex));
+    FW_ASSERT(this->m_packed[queueIndex], static_cast<FwAssertArgType>(queueIndex));
+    FW_ASSERT(this->m_batch != nullptr);
+    FW_ASSERT(this->m_buffer_state == OWNED);
+    Types::PacketQueue& queue = this->m_packetQueues[queueIndex];
+
+    // Append packets in queue order while the next one fits. The batch size is at least FW_COM_BUFFER_MAX_SIZE so the
+    // first packet always fits.
+    FwSizeType used = 0;
+    FwSizeType next = 0;
+    while ((queue.peek_size(next) == Fw::FW_SERIALIZE_OK) && (next <= (this->m_batchSize - used))) {
+        FwSizeType size = 0;
+        const Fw::SerializeStatus status = queue.dequeue(this->m_batch + used, this->m_batchSize - used, size);
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+        used += size;
+    }
+    FW_ASSERT(used > 0);
+
+    // Batched packets are sent as a buffer with no ownership return, like a single Fw::ComBuffer
+    Fw::Buffer batch(this->m_batch, static_cast<Fw::Buffer::SizeType>(used));
+    this->sendBuffer(batch, queueIndex);
+}
+
 void ComQueue::drainQueue(FwIndexType index) {
     FW_ASSERT(index >= 0 && index < TOTAL_PORT_COUNT, static_cast<FwAssertArgType>(index));
     Types::Queue& queue = this->m_queues[index];
 
     // Read all messages from the queue and discard them
     Fw::SerializeStatus status = Fw::FW_SERIALIZE_OK;
-    const FwSizeType available = queue.getQueueSize();
+    const FwSizeType available = this->getQueueSize(index);
     for (FwSizeType i = 0; (i < available) && (status == Fw::FW_SERIALIZE_OK); i++) {
-        if (index < COM_PORT_COUNT) {
+        if ((index < COM_PORT_COUNT) && this->m_packed[index]) {
+            // Packed queues hold only packet bytes, which are read into a scratch Fw::ComBuffer
+            Fw::ComBuffer comBuffer;
+            FwSizeType size = 0;
+            status = this->m_packetQueues[index].dequeue(comBuffer.getBuffAddr(), comBuffer.getCapacity(), size);
+        } else if (index < COM_PORT_COUNT) {
             // Dequeueing is reading the whole persisted Fw::ComBuffer object from the queue's storage.
             // thus it takes an address to the object to fill and the size of the actual object
             Fw::ComBuffer comBuffer;
@@ -404,12 +486,25 @@ void ComQueue::processQueue() {
         Types::Queue& queue = this->m_queues[entry.index];
 
         // Continue onto next prioritized queue if there is no items in the current queue
-        if (queue.getQueueSize() == 0) {
+        if (this->getQueueSize(entry.index) == 0) {
             continue;
         }
 
         // Send out the message based on the type
-        if (entry.index < COM_PORT_COUNT) {
+        if ((entry.index < COM_PORT_COUNT) && this->m_packed[entry.index] && (this->m_batchSize > 0)) {
+            this->sendBatch(entry.index);
+        } else if ((entry.index < COM_PORT_COUNT) && this->m_packed[entry.index]) {
+            // Packed queues hold only packet bytes, which are read into the dequeued Fw::ComBuffer's storage
+            FW_ASSERT(this->m_buffer_state == OWNED);
+            FwSizeType size = 0;
+            auto dequeue_status = this->m_packetQueues[entry.index].dequeue(
+                this->m_dequeued_com_buffer.getBuffAddr(), this->m_dequeued_com_buffer.getCapacity(), size);
+            FW_ASSERT(dequeue_status == Fw::SerializeStatus::FW_SERIALIZE_OK,
+                      static_cast<FwAssertArgType>(dequeue_status));
+            const Fw::SerializeStatus length_status = this->m_dequeued_com_buffer.setBuffLen(size);
+            FW_ASSERT(length_status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(length_status));
+            this->sendComBuffer(this->m_dequeued_com_buffer, entry.index);
+        } else if (entry.index < COM_PORT_COUNT) {
             // Dequeue is reading the whole persisted Fw::ComBuffer object from the queue's storage.
             // thus it takes an address to the object to fill and the size of the actual object.
             FW_ASSERT(this->m_buffer_state == OWNED);
@@ -451,4 +546,25 @@ FwIndexType ComQueue::getQueueNum(Svc::QueueType queueType, FwIndexType portNum)
     // Acquire the queue that we need to drain
     return static_cast<FwIndexType>(portNum + ((queueType == QueueType::COM_QUEUE) ? 0 : COM_PORT_COUNT));
 }
+
+FwSizeType ComQueue::getQueueSize(FwIndexType queueNum) const {
+    FW_ASSERT(queueNum >= 0 && queueNum < TOTAL_PORT_COUNT, static_cast<FwAssertArgType>(queueNum));
+    if ((queueNum < COM_PORT_COUNT) && this->m_packed[queueNum]) {
+        return this->m_packetQueues[queueNum].getQueueSize();
+    }
+    return this->m_queues[queueNum].getQueueSize();
+}
+
+FwSizeType ComQueue::takeHighWaterMark(FwIndexType queueNum) {
+    FW_ASSERT(queueNum >= 0 && queueNum < TOTAL_PORT_COUNT, static_cast<FwAssertArgType>(queueNum));
+    FwSizeType mark = 0;
+    if ((queueNum < COM_PORT_COUNT) && this->m_packed[queueNum]) {
+        mark = this->m_packetQueues[queueNum].get_high_water_mark();
+        this->m_packetQueues[queueNum].clear_high_water_mark();
+    } else {
+        mark = this->m_queues[queueNum].get_high_water_mark();
+        this->m_queues[queueNum].clear_high_water_mark();
+    }
+    return mark;
+}
 }  // end namespace Svc
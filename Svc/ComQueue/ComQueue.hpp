@@ -10,6 +10,7 @@
 #include <Fw/Buffer/Buffer.hpp>
 #include <Fw/Com/ComBuffer.hpp>
 #include <Svc/ComQueue/ComQueueComponentAc.hpp>
+#include <Utils/Types/PacketQueue.hpp>
 #include <Utils/Types/Queue.hpp>
 #include <limits>
 #include "Fw/Types/MemAllocator.hpp"
@@ -54,12 +55,17 @@ class ComQueue final : public ComQueueComponentBase {
      * Queue mode determines whether messages are dequeued in FIFO or LIFO order.
      *
      * Overflow mode determines whether the newest or oldest message is dropped when the queue is full.
+     *
+     * Packed size applies to Fw::Com queues only. When non-zero, the queue stores each packet at its actual size in a
+     * byte ring of that many bytes and depth is ignored; the number of packets held then depends on their sizes rather
+     * than on the worst-case Fw::ComBuffer size. When zero, the queue stores `depth` whole Fw::ComBuffer objects.
      */
     struct QueueConfigurationEntry {
         FwSizeType depth;                       //!< Depth of the queue [0, infinity)
         FwIndexType priority;                   //!< Priority of the queue [0, TOTAL_PORT_COUNT)
         Types::QueueMode mode;                  //!< Queue mode (FIFO or LIFO)
         Types::QueueOverflowMode overflowMode;  //!< Overflow handling mode (DROP_NEWEST or DROP_OLDEST)
+        FwSizeType packedSize;                  //!< Bytes of packed storage for a Fw::Com queue, 0 to store depth
     };
 
     /**
@@ -70,11 +76,22 @@ class ComQueue final : public ComQueueComponentBase {
      * priority.
      *
      * Entries are specified in-order first addressing Fw::Com ports then Fw::Buffer ports.
+     *
+     * Batch size enables sending several packets from one packed Fw::Com queue per comStatusIn handshake. Packets are
+     * concatenated into a single outgoing buffer of at most batchSize bytes, which should be chosen to fit the frame
+     * (e.g. ComCfg::AggregationSize). The buffer carries the context of its first packet. When zero, one packet is sent
+     * per handshake. A non-zero batch size must be at least FW_COM_BUFFER_MAX_SIZE.
+     *
+     * Dispatch batch lets each access to the component's message queue drain up to that many port calls, which are then
+     * handled back-to-back (see Fw::QueuedComponentBase::enableBatchDispatch). When zero, or when the Os::Queue
+     * implementation cannot support it, each port call is received individually.
      */
     struct QueueConfigurationTable {
         QueueConfigurationEntry entries[TOTAL_PORT_COUNT];
+        FwSizeType batchSize;      //!< Largest outgoing buffer built from packed Fw::Com queue packets, 0 to disable
+        FwSizeType dispatchBatch;  //!< Port calls drained per message queue access, 0 to disable
         /**
-         * \brief constructs a basic un-prioritized table with depth 0
+         * \brief constructs a basic un-prioritized table with depth 0 and no packing or batching
          */
         QueueConfigurationTable();
     };
@@ -96,6 +113,7 @@ class ComQueue final : public ComQueueComponentBase {
         Types::QueueOverflowMode overflowMode;  //!< Overflow handling mode
         FwIndexType index;                      //!< Index of this queue in m_queues
         FwSizeType msgSize;                     //!< Message size of messages in this queue
+        FwSizeType packedSize;                  //!< Bytes of packed storage, 0 when the queue stores whole messages
     };
 
     /**
@@ -236,6 +254,11 @@ class ComQueue final : public ComQueueComponentBase {
                     FwIndexType queueIndex  //!< Index of the queue emitting the message
     );
 
+    //! Send as many packets from a packed Fw::Com queue as fit in one batch
+    //!
+    void sendBatch(FwIndexType queueIndex  //!< Index of the packed queue to send from
+    );
+
     void drainQueue(FwIndexType queueNum  //!< Index of the queue to drain
     );
 
@@ -246,12 +269,22 @@ class ComQueue final : public ComQueueComponentBase {
     //! Convert Queue Type & Index into single queueIndex
     FwIndexType getQueueNum(Svc::QueueType queueType, FwIndexType portNum);
 
+    //! Get the number of messages held by a queue
+    FwSizeType getQueueSize(FwIndexType queueNum) const;
+
+    //! Get and clear the message count high-water mark of a queue
+    FwSizeType takeHighWaterMark(FwIndexType queueNum);
+
   private:
     // ----------------------------------------------------------------------
     // Member variables
     // ----------------------------------------------------------------------
     Fw::ComBuffer m_dequeued_com_buffer;                //!< Store a dequeued com buffer so it does not leave scope
     Types::Queue m_queues[TOTAL_PORT_COUNT];            //!< Stores queued data waiting for transmission
+    Types::PacketQueue m_packetQueues[COM_PORT_COUNT];  //!< Stores packed Fw::Com packets waiting for transmission
+    bool m_packed[COM_PORT_COUNT];                      //!< Per-queue flag selecting m_packetQueues over m_queues
+    U8* m_batch;                                        //!< Storage for building batched output
+    FwSizeType m_batchSize;                             //!< Capacity of m_batch, 0 when batching is disabled
     QueueMetadata m_prioritizedList[TOTAL_PORT_COUNT];  //!< Priority sorted list of queue metadata
     bool m_throttle[TOTAL_PORT_COUNT];                  //!< Per-queue EVR throttles
     SendState m_state;                                  //!< State of the component
@@ -114,6 +114,21 @@ TEST(Commands, SetQueuePriorityNegativePriority) {
     tester.testSetQueuePriorityNegativePriority();
 }
 
+TEST(PackedStorage, PackedQueue) {
+    Svc::ComQueueTester tester;
+    tester.testPackedQueue();
+}
+
+TEST(PackedStorage, BatchSend) {
+    Svc::ComQueueTester tester;
+    tester.testBatchSend();
+}
+
+TEST(PackedStorage, DispatchBatch) {
+    Svc::ComQueueTester tester;
+    tester.testDispatchBatch();
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
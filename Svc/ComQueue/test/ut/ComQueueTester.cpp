@@ -6,6 +6,7 @@
 
 #include "ComQueueTester.hpp"
 #include "Fw/Types/MallocAllocator.hpp"
+#include <cstring>
 using namespace std;
 
 Fw::MallocAllocator mallocAllocator;
@@ -946,4 +947,124 @@ void ComQueueTester::testSetQueuePriorityNegativePriority() {
     component.cleanup();
 }
 
+// ----------------------------------------------------------------------
+// Packed Storage Tests
+// ----------------------------------------------------------------------
+
+void ComQueueTester::testPackedQueue() {
+    // Size the first COM queue to hold exactly three packets of BUFFER_LENGTH bytes
+    ComQueue::QueueConfigurationTable configurationTable;
+    configurationTable.entries[0].priority = 0;
+    configurationTable.entries[0].packedSize =
+        3 * Types::PacketQueue::get_stored_size(BUFFER_LENGTH, Types::QUEUE_FIFO);
+    for (FwIndexType i = 1; i < ComQueue::TOTAL_PORT_COUNT; i++) {
+        configurationTable.entries[i].priority = i;
+        configurationTable.entries[i].depth = 1;
+    }
+    component.configure(configurationTable, 0, mallocAllocator);
+
+    U8 data[4][BUFFER_LENGTH] = {BUFFER_DATA, BUFFER_DATA, BUFFER_DATA, BUFFER_DATA};
+    for (U8 i = 0; i < 4; i++) {
+        data[i][BUFFER_DATA_OFFSET] = i;
+        Fw::ComBuffer comBuffer(&data[i][0], sizeof(data[i]));
+        invoke_to_comPacketQueueIn(0, comBuffer, 0);
+    }
+    dispatchAll();
+
+    // The fourth packet does not fit
+    ASSERT_EVENTS_QueueOverflow_SIZE(1);
+    ASSERT_EVENTS_QueueOverflow(0, QueueType::COM_QUEUE, 0);
+
+    // Packets come out at their actual size
+    for (U8 i = 0; i < 3; i++) {
+        emitOneAndCheck(i, data[i], BUFFER_LENGTH);
+    }
+    ASSERT_from_dataOut_SIZE(3);
+
+    // High-water mark is reported as a packet count
+    invoke_to_run(0, 0);
+    dispatchAll();
+    ASSERT_TLM_comQueueDepth_SIZE(1);
+    ComQueueDepth expectedComDepth;
+    expectedComDepth[0] = 3;
+    ASSERT_TLM_comQueueDepth(0, expectedComDepth);
+
+    // Flushing discards packed packets
+    Fw::ComBuffer comBuffer(&data[3][0], sizeof(data[3]));
+    invoke_to_comPacketQueueIn(0, comBuffer, 0);
+    this->sendCmd_FLUSH_QUEUE(0, 0, QueueType::COM_QUEUE, 0);
+    dispatchAll();
+    emitOne();
+    ASSERT_from_dataOut_SIZE(3);
+    component.cleanup();
+}
+
+void ComQueueTester::testBatchSend() {
+    ComQueue::QueueConfigurationTable configurationTable;
+    configurationTable.entries[0].priority = 0;
+    configurationTable.entries[0].packedSize = 4 * FW_COM_BUFFER_MAX_SIZE;
+    for (FwIndexType i = 1; i < ComQueue::TOTAL_PORT_COUNT; i++) {
+        configurationTable.entries[i].priority = i;
+        configurationTable.entries[i].depth = 1;
+    }
+    configurationTable.batchSize = FW_COM_BUFFER_MAX_SIZE;
+    component.configure(configurationTable, 0, mallocAllocator);
+
+    // Small packets are drained together into one outgoing buffer
+    U8 data[5][BUFFER_LENGTH] = {BUFFER_DATA, BUFFER_DATA, BUFFER_DATA, BUFFER_DATA, BUFFER_DATA};
+    U8 expected[5 * BUFFER_LENGTH];
+    for (U8 i = 0; i < 5; i++) {
+        data[i][BUFFER_DATA_OFFSET] = i;
+        ::memcpy(&expected[i * BUFFER_LENGTH], data[i], BUFFER_LENGTH);
+        Fw::ComBuffer comBuffer(&data[i][0], sizeof(data[i]));
+        invoke_to_comPacketQueueIn(0, comBuffer, 0);
+    }
+    dispatchAll();
+    emitOneAndCheck(0, expected, sizeof(expected));
+    ASSERT_EQ(0, this->fromPortHistory_dataOut->at(0).context.get_comQueueIndex());
+    ASSERT_from_bufferReturnOut_SIZE(0);
+
+    // Packets that do not fit in the remaining batch space wait for the next handshake
+    const FwSizeType largeSize = (FW_COM_BUFFER_MAX_SIZE / 2) + 1;
+    U8 large[3][(FW_COM_BUFFER_MAX_SIZE / 2) + 1];
+    for (U8 i = 0; i < 3; i++) {
+        U8 header[BUFFER_LENGTH] = BUFFER_DATA;
+        ::memset(large[i], 0x10 + i, largeSize);
+        ::memcpy(large[i], header, BUFFER_DATA_OFFSET);
+        Fw::ComBuffer comBuffer(&large[i][0], largeSize);
+        invoke_to_comPacketQueueIn(0, comBuffer, 0);
+    }
+    dispatchAll();
+    for (U8 i = 0; i < 3; i++) {
+        emitOneAndCheck(1 + i, large[i], largeSize);
+    }
+    ASSERT_from_dataOut_SIZE(4);
+    component.cleanup();
+}
+
+void ComQueueTester::testDispatchBatch() {
+    U8 data[ComQueue::COM_PORT_COUNT][BUFFER_LENGTH] = {};
+    ComQueue::QueueConfigurationTable configurationTable;
+    for (FwIndexType i = 0; i < ComQueue::TOTAL_PORT_COUNT; i++) {
+        configurationTable.entries[i].priority = i;
+        configurationTable.entries[i].depth = 3;
+    }
+    configurationTable.dispatchBatch = 4;
+    component.configure(configurationTable, 0, mallocAllocator);
+
+    // Port calls are drained several at a time yet every packet is queued and sent in priority order
+    for (FwIndexType portNum = ComQueue::COM_PORT_COUNT - 1; portNum >= 0; portNum--) {
+        data[portNum][BUFFER_DATA_OFFSET] = static_cast<U8>(portNum);
+        Fw::ComBuffer comBuffer(&data[portNum][0], BUFFER_LENGTH);
+        invoke_to_comPacketQueueIn(portNum, comBuffer, 0);
+    }
+    dispatchAll();
+    ASSERT_EQ(this->component.m_queue.getMessagesAvailable(), 0);
+    for (FwIndexType portNum = 0; portNum < ComQueue::COM_PORT_COUNT; portNum++) {
+        emitOneAndCheck(portNum, data[portNum], BUFFER_LENGTH);
+    }
+    ASSERT_from_dataOut_SIZE(ComQueue::COM_PORT_COUNT);
+    component.cleanup();
+}
+
 }  // end namespace Svc
@@ -107,6 +107,12 @@ class ComQueueTester : public ComQueueGTestBase {
 
     void testSetQueuePriorityNegativePriority();
 
+    void testPackedQueue();
+
+    void testBatchSend();
+
+    void testDispatchBatch();
+
   private:
     // ----------------------------------------------------------------------
     // Helper methods
@@ -7,12 +7,17 @@
 
 #include "Svc/DpCatalog/DpCatalog.hpp"
 #include "Fw/Dp/DpContainer.hpp"
+#include "Fw/Dp/DpSegment.hpp"
 #include "Fw/FPrimeBasicTypes.hpp"
 
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
 #include <new>  // placement new
 #include "Fw/Types/StringUtils.hpp"
 #include "Os/File.hpp"
 #include "Os/FileSystem.hpp"
+#include "Utils/Hash/Hash.hpp"
 
 namespace Svc {
 static_assert(DP_MAX_DIRECTORIES > 0, "Configuration DP_MAX_DIRECTORIES must be positive");
@@ -24,14 +29,8 @@ static_assert(DP_MAX_FILES > 0, "Configuration DP_MAX_FILES must be positive");
 DpCatalog ::DpCatalog(const char* const compName)
     : DpCatalogComponentBase(compName),
       m_initialized(false),
-      m_dpTree(nullptr),
-      m_freeListHead(nullptr),
-      m_currentNode(nullptr),
-      m_currentXmitNode(nullptr),
       m_numDpSlots(0),
       m_numDirectories(0),
-      m_stateFileData(nullptr),
-      m_stateFileEntries(0),
       m_memSize(0),
       m_memPtr(nullptr),
       m_allocatorId(0),
@@ -57,15 +56,24 @@ void DpCatalog::configure(Fw::FileNameString directories[DP_MAX_DIRECTORIES],
     FW_ASSERT(numDirs <= DP_MAX_DIRECTORIES, static_cast<FwAssertArgType>(numDirs));
 
     this->m_stateFile = stateFile;
+    // the catalog index is kept next to the state file
+    this->m_indexFile = "";
+    if (stateFile.length() > 0) {
+        this->m_indexFile.format("%s%s", stateFile.toChar(), DP_CATALOG_INDEX_SUFFIX);
+    }
 
     // request memory for catalog which is DP_MAX_FILES * slot size.
     //
-    // A "slot" consists of a set of two memory locations for each data product consisting
-    // an entry in the binary tree and
-    // an entry in the state file data. These may not be fully used in a given
+    // A "slot" consists of a set of memory locations for each data product consisting
+    // of a node and a free node index in the catalog tree and
+    // a node and a free node index in the state file data. These may not be fully used in a given
     // situation based on the number of actual data products, but this provides room for the
     // maximum possible.
-    static const FwSizeType slotSize = sizeof(DpBtreeNode) + sizeof(DpDstateFileEntry);
+    static const FwSizeType slotSize =
+        sizeof(DpTree::Node) + sizeof(DpStateMap::Node) + sizeof(DpTree::Index) + sizeof(DpStateMap::Index);
+    // each array starts at a multiple of the preceding element size, so it is aligned
+    static_assert(alignof(DpTree::Node) % alignof(DpStateMap::Node) == 0, "state nodes must align after tree nodes");
+    static_assert(alignof(DpStateMap::Node) % alignof(DpTree::Index) == 0, "indices must align after state nodes");
     this->m_memSize = DP_MAX_FILES * slotSize;
     bool notUsed;  // we don't need to recover the catalog.
     // request memory. this->m_memSize will be modified if there is less than we requested
@@ -81,18 +89,28 @@ void DpCatalog::configure(Fw::FileNameString directories[DP_MAX_DIRECTORIES],
     // don't get the full amount requested. This allows for graceful degradation
     // if there are memory issues.
     //
-    // 2) Place the binary tree free list at the beginning of the memory.
+    // 2) Place the catalog tree nodes at the beginning of the memory,
+    // followed by the state file data nodes.
     //
-    // 3) Place the state file data in memory after the binary free list
-    // by indexing the free list to one element past the end of
-    // the free list.
+    // 3) Place the free node indices of both after the nodes.
 
     if ((this->m_memSize >= slotSize) and (this->m_memPtr != nullptr)) {
         // set the number of available record slots based on how much memory we actually got
         this->m_numDpSlots = this->m_memSize / slotSize;  // Step 1.
-        this->resetBinaryTree();                          // Step 2
-        // assign pointer for the state file storage - Step 3
-        this->m_stateFileData = reinterpret_cast<DpDstateFileEntry*>(&this->m_freeListHead[this->m_numDpSlots]);
+        // Step 2
+        DpTree::Node* treeNodes = static_cast<DpTree::Node*>(this->m_memPtr);
+        DpStateMap::Node* stateNodes = reinterpret_cast<DpStateMap::Node*>(&treeNodes[this->m_numDpSlots]);
+        // Step 3
+        DpTree::Index* treeFreeNodes = reinterpret_cast<DpTree::Index*>(&stateNodes[this->m_numDpSlots]);
+        DpStateMap::Index* stateFreeNodes = &treeFreeNodes[this->m_numDpSlots];
+        for (FwSizeType slot = 0; slot < this->m_numDpSlots; slot++) {
+            // overlay new instances of the nodes on the memory
+            (void)new (&treeNodes[slot]) DpTree::Node();
+            (void)new (&stateNodes[slot]) DpStateMap::Node();
+        }
+        this->m_dpTree.setStorage(treeNodes, treeFreeNodes, this->m_numDpSlots);
+        this->m_stateFileData.setStorage(stateNodes, stateFreeNodes, this->m_numDpSlots);
+        this->resetBinaryTree();
     } else {
         // if we don't have enough memory, set the number of records
         // to zero for later detection
@@ -112,22 +130,8 @@ void DpCatalog::configure(Fw::FileNameString directories[DP_MAX_DIRECTORIES],
 }
 
 void DpCatalog::resetBinaryTree() {
-    // initialize data structures in the free list
-    // Step 2 in memory partition (see configure() comments)
-    FW_ASSERT(this->m_memPtr);
-    this->m_freeListHead = static_cast<DpBtreeNode*>(this->m_memPtr);
-    for (FwSizeType slot = 0; slot < this->m_numDpSlots; slot++) {
-        // overlay new instance of the DpState entry on the memory
-        (void)new (&this->m_freeListHead[slot]) DpBtreeNode();
-        this->m_freeListHead[slot].left = nullptr;
-        this->m_freeListHead[slot].right = nullptr;
-        // link the free list
-        if (slot > 0) {
-            this->m_freeListHead[slot - 1].left = &this->m_freeListHead[slot];
-        }
-    }
-    // clear binary tree
-    this->m_dpTree = nullptr;
+    // clear the tree; this returns all nodes to the free list
+    this->m_dpTree.clear();
     // reset number of records
     this->m_pendingFiles = 0;
     this->m_pendingDpBytes = 0;
@@ -137,17 +141,10 @@ void DpCatalog::resetBinaryTree() {
 
 void DpCatalog::resetStateFileData() {
     // clear state file data
-    for (FwSizeType slot = 0; slot < this->m_numDpSlots; slot++) {
-        this->m_stateFileData[slot].used = false;
-        this->m_stateFileData[slot].visited = false;
-        (void)new (&this->m_stateFileData[slot].entry.record) DpRecord();
-    }
-    this->m_stateFileEntries = 0;
+    this->m_stateFileData.clear();
 }
 
 Fw::CmdResponse DpCatalog::loadStateFile() {
-    FW_ASSERT(this->m_stateFileData);
-
     // Make sure that a file was specified
     if (this->m_stateFile.length() == 0) {
         this->log_WARNING_LO_NoStateFileSpecified();
@@ -168,7 +165,6 @@ Fw::CmdResponse DpCatalog::loadStateFile() {
     }
 
     FwSizeType fileLoc = 0;
-    this->m_stateFileEntries = 0;
 
     // read entries from the state file
     for (FwSizeType entry = 0; entry < this->m_numDpSlots; entry++) {
@@ -204,40 +200,40 @@ Fw::CmdResponse DpCatalog::loadStateFile() {
         // the source buffer was specifically sized to hold the data
 
         // Deserialize the file directory index
-        Fw::SerializeStatus status = entryBuffer.deserializeTo(this->m_stateFileData[entry].entry.dir);
+        DpStateEntry stateEntry;
+        Fw::SerializeStatus status = entryBuffer.deserializeTo(stateEntry.dir);
         FW_ASSERT(Fw::FW_SERIALIZE_OK == status, status);
-        status = entryBuffer.deserializeTo(this->m_stateFileData[entry].entry.record);
+        status = entryBuffer.deserializeTo(stateEntry.record);
         FW_ASSERT(Fw::FW_SERIALIZE_OK == status, status);
-        this->m_stateFileData[entry].used = true;
-        this->m_stateFileData[entry].visited = false;
+        DpDstateFileEntry fileEntry;
+        fileEntry.record = stateEntry.record;
+        // later entries for the same product replace earlier ones.
+        // Capacity is the number of slots, so this always fits
+        const Fw::Success insStat = this->m_stateFileData.insert(stateEntry, fileEntry);
+        FW_ASSERT(insStat == Fw::Success::SUCCESS, static_cast<FwAssertArgType>(entry));
 
         // increment the file location
         fileLoc += size;
-        this->m_stateFileEntries++;
     }
 
     return Fw::CmdResponse::OK;
 }
 
 void DpCatalog::getFileState(DpStateEntry& entry) {
-    FW_ASSERT(this->m_stateFileData);
-    // search the file state data for the entry
-    for (FwSizeType line = 0; line < this->m_stateFileEntries; line++) {
-        // check for a match (compare dir, then id, priority, & time)
-        if (this->m_stateFileData[line].entry.dir == entry.dir && this->m_stateFileData[line].entry == entry) {
-            // update the transmitted state
-            entry.record.set_state(this->m_stateFileData[line].entry.record.get_state());
-            entry.record.set_blocks(this->m_stateFileData[line].entry.record.get_blocks());
-            // mark it as visited for later pruning if necessary
-            this->m_stateFileData[line].visited = true;
-            return;
-        }
+    // look up the entry in the file state data (compare priority, time, id, & dir)
+    DpDstateFileEntry fileEntry;
+    if (this->m_stateFileData.find(entry, fileEntry) == Fw::Success::SUCCESS) {
+        // update the transmitted state
+        entry.record.set_state(fileEntry.record.get_state());
+        entry.record.set_blocks(fileEntry.record.get_blocks());
+        // mark it as visited for later pruning if necessary
+        fileEntry.visited = true;
+        const Fw::Success status = this->m_stateFileData.insert(entry, fileEntry);
+        FW_ASSERT(status == Fw::Success::SUCCESS, static_cast<FwAssertArgType>(status));
     }
 }
 
 void DpCatalog::pruneAndWriteStateFile() {
-    FW_ASSERT(this->m_stateFileData);
-
     // There is a chance that a data product file can disappear after
     // the state file is written from the last catalog build and transmit.
     // This function will walk the state file data and write back only
@@ -260,16 +256,16 @@ void DpCatalog::pruneAndWriteStateFile() {
     Fw::ExternalSerializeBuffer entryBuffer(buffer, sizeof(buffer));
 
     // write entries to the state file
-    for (FwSizeType entry = 0; entry < this->m_numDpSlots; entry++) {
-        // only write entries that were used
-        if ((this->m_stateFileData[entry].used) and (this->m_stateFileData[entry].visited)) {
+    for (DpStateMap::ConstIterator it = this->m_stateFileData.begin(); it.isInRange(); it++) {
+        // only write entries that were visited
+        if (it->getValue().visited) {
             // reset the buffer for serializing the entry
             entryBuffer.resetSer();
             // serialize the file directory index
-            Fw::SerializeStatus serStat = entryBuffer.serializeFrom(this->m_stateFileData[entry].entry.dir);
+            Fw::SerializeStatus serStat = entryBuffer.serializeFrom(it->getKey().dir);
             // Should always fit
             FW_ASSERT(Fw::FW_SERIALIZE_OK == serStat, serStat);
-            serStat = entryBuffer.serializeFrom(this->m_stateFileData[entry].entry.record);
+            serStat = entryBuffer.serializeFrom(it->getValue().record);
             // Should always fit
             FW_ASSERT(Fw::FW_SERIALIZE_OK == serStat, serStat);
             // write the entry
@@ -288,10 +284,16 @@ void DpCatalog::pruneAndWriteStateFile() {
 }
 
 void DpCatalog::appendFileState(const DpStateEntry& entry) {
-    FW_ASSERT(this->m_stateFileData);
     FW_ASSERT(entry.dir < static_cast<FwIndexType>(this->m_numDirectories), static_cast<FwAssertArgType>(entry.dir),
               static_cast<FwAssertArgType>(this->m_numDirectories));
 
+    // keep the state in memory so a later prune does not drop it.
+    // If the state file data is full, the appended line still holds it until the next prune
+    DpDstateFileEntry fileEntry;
+    fileEntry.visited = true;
+    fileEntry.record = entry.record;
+    (void)this->m_stateFileData.insert(entry, fileEntry);
+
     // We will append state to the existing state file
     // TODO: Have to handle case where state file has partially transmitted
     // state already
@@ -329,6 +331,259 @@ void DpCatalog::appendFileState(const DpStateEntry& entry) {
     stateFile.close();
 }
 
+Fw::SerializeStatus DpCatalog::serializeIndexEntry(const DpStateEntry& entry, Fw::SerialBufferBase& buffer) {
+    Fw::SerializeStatus status = buffer.serializeFrom(entry.dir);
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serializeFrom(entry.record);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serializeFrom(static_cast<U8>(entry.inSegment ? 1 : 0));
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serializeFrom(entry.segSeq);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serializeFrom(entry.segSec);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serializeFrom(entry.segSub);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serializeFrom(entry.segOffset);
+    }
+    return status;
+}
+
+Fw::SerializeStatus DpCatalog::deserializeIndexEntry(DpStateEntry& entry, Fw::SerialBufferBase& buffer) {
+    Fw::SerializeStatus status = buffer.deserializeTo(entry.dir);
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserializeTo(entry.record);
+    }
+    U8 inSegment = 0;
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserializeTo(inSegment);
+        entry.inSegment = (inSegment != 0);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserializeTo(entry.segSeq);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserializeTo(entry.segSec);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserializeTo(entry.segSub);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserializeTo(entry.segOffset);
+    }
+    return status;
+}
+
+bool DpCatalog::loadIndexFile() {
+    // the index is only kept along with a state file,
+    // and doesn't exist before the first build
+    if ((this->m_indexFile.length() == 0) or (not Os::FileSystem::exists(this->m_indexFile.toChar()))) {
+        return false;
+    }
+
+    Os::File indexFile;
+    Os::File::Status stat = indexFile.open(this->m_indexFile.toChar(), Os::File::OPEN_READ);
+    if (stat != Os::File::OP_OK) {
+        this->log_WARNING_HI_CatalogIndexReadError(this->m_indexFile, stat);
+        return false;
+    }
+
+    // working buffer for the header and records
+    static_assert(INDEX_ENTRIES_PER_READ * INDEX_RECORD_SIZE >= INDEX_HEADER_SIZE,
+                  "read buffer must hold the index header");
+    U8 readBuff[INDEX_ENTRIES_PER_READ * INDEX_RECORD_SIZE];
+
+    // read and check the header. The index is only valid for the directories it was built from
+    FwSizeType size = INDEX_HEADER_SIZE;
+    stat = indexFile.read(readBuff, size);
+    if (stat != Os::File::OP_OK) {
+        this->log_WARNING_HI_CatalogIndexReadError(this->m_indexFile, stat);
+        indexFile.close();
+        return false;
+    }
+    Fw::ExternalSerializeBuffer headerBuff(readBuff, INDEX_HEADER_SIZE);
+    Fw::SerializeStatus desStat = headerBuff.setBuffLen(size);
+    FW_ASSERT(desStat == Fw::FW_SERIALIZE_OK, desStat);
+    U32 magic = 0;
+    U32 numDirs = 0;
+    U32 dirHash = 0;
+    desStat = headerBuff.deserializeTo(magic);
+    if (desStat == Fw::FW_SERIALIZE_OK) {
+        desStat = headerBuff.deserializeTo(numDirs);
+    }
+    if (desStat == Fw::FW_SERIALIZE_OK) {
+        desStat = headerBuff.deserializeTo(dirHash);
+    }
+    if ((desStat != Fw::FW_SERIALIZE_OK) or (magic != INDEX_MAGIC) or (numDirs != this->m_numDirectories) or
+        (dirHash != this->directoryHash())) {
+        this->log_WARNING_LO_CatalogIndexInvalid(this->m_indexFile);
+        indexFile.close();
+        return false;
+    }
+
+    U32 loaded = 0;
+    bool full = false;
+    bool done = false;
+    while (not done) {
+        // read a chunk of records
+        size = sizeof(readBuff);
+        stat = indexFile.read(readBuff, size);
+        if (stat != Os::File::OP_OK) {
+            this->log_WARNING_HI_CatalogIndexReadError(this->m_indexFile, stat);
+            indexFile.close();
+            return false;
+        }
+        done = (size < sizeof(readBuff));
+        // a partial record at the end is from an interrupted append, so drop it
+        const FwSizeType records = size / INDEX_RECORD_SIZE;
+        Fw::ExternalSerializeBuffer recordBuff(readBuff, sizeof(readBuff));
+        desStat = recordBuff.setBuffLen(records * INDEX_RECORD_SIZE);
+        FW_ASSERT(desStat == Fw::FW_SERIALIZE_OK, desStat);
+
+        for (FwSizeType record = 0; record < records; record++) {
+            DpStateEntry entry;
+            desStat = DpCatalog::deserializeIndexEntry(entry, recordBuff);
+            if ((desStat != Fw::FW_SERIALIZE_OK) or (entry.dir < 0) or
+                (entry.dir >= static_cast<FwIndexType>(this->m_numDirectories))) {
+                this->log_WARNING_LO_CatalogIndexInvalid(this->m_indexFile);
+                indexFile.close();
+                return false;
+            }
+            // stop if the catalog is full, as a directory scan would
+            if (this->addEntry(entry, ADD_BUILD) < 0) {
+                full = true;
+                done = true;
+                break;
+            }
+            loaded++;
+        }
+    }
+
+    indexFile.close();
+    this->log_ACTIVITY_HI_CatalogIndexLoaded(this->m_indexFile, loaded);
+
+    // products added again at runtime leave superseded records behind, so rewrite the index without them
+    if ((not full) and (loaded > this->m_dpTree.getSize())) {
+        this->writeIndexFile();
+    }
+    return true;
+}
+
+void DpCatalog::writeIndexFile() {
+    if (this->m_indexFile.length() == 0) {
+        return;
+    }
+
+    // a full catalog may have left products out, so it can't stand in for a directory scan
+    if (this->m_dpTree.getSize() >= this->m_dpTree.getCapacity()) {
+        (void)Os::FileSystem::removeFile(this->m_indexFile.toChar());
+        return;
+    }
+
+    // write a temporary file and rename it, so an interrupted write never leaves a partial index
+    Fw::FileNameString tmpFile;
+    tmpFile.format("%s%s", this->m_indexFile.toChar(), ".tmp");
+    Os::File indexFile;
+    Os::File::Status stat = indexFile.open(tmpFile.toChar(), Os::File::OPEN_CREATE, Os::FileInterface::OVERWRITE);
+    if (stat != Os::File::OP_OK) {
+        this->log_WARNING_HI_CatalogIndexWriteError(this->m_indexFile, stat);
+        (void)Os::FileSystem::removeFile(this->m_indexFile.toChar());
+        return;
+    }
+
+    // working buffer for the header and records
+    U8 writeBuff[INDEX_ENTRIES_PER_READ * INDEX_RECORD_SIZE];
+    Fw::ExternalSerializeBuffer recordBuff(writeBuff, sizeof(writeBuff));
+    Fw::SerializeStatus serStat = recordBuff.serializeFrom(INDEX_MAGIC);
+    FW_ASSERT(serStat == Fw::FW_SERIALIZE_OK, serStat);
+    serStat = recordBuff.serializeFrom(static_cast<U32>(this->m_numDirectories));
+    FW_ASSERT(serStat == Fw::FW_SERIALIZE_OK, serStat);
+    serStat = recordBuff.serializeFrom(this->directoryHash());
+    FW_ASSERT(serStat == Fw::FW_SERIALIZE_OK, serStat);
+
+    DpTree::ConstIterator it = this->m_dpTree.begin();
+    while (stat == Os::File::OP_OK) {
+        // fill the buffer with as many records as fit
+        const bool more = it.isInRange();
+        if (more and (recordBuff.getSize() + INDEX_RECORD_SIZE <= sizeof(writeBuff))) {
+            serStat = DpCatalog::serializeIndexEntry(*it, recordBuff);
+            FW_ASSERT(serStat == Fw::FW_SERIALIZE_OK, serStat);
+            it++;
+            continue;
+        }
+        // write the buffer out
+        FwSizeType size = recordBuff.getSize();
+        stat = indexFile.write(writeBuff, size);
+        if ((stat == Os::File::OP_OK) and (size != recordBuff.getSize())) {
+            stat = Os::File::BAD_SIZE;
+        }
+        recordBuff.resetSer();
+        if (not more) {
+            break;
+        }
+    }
+    indexFile.close();
+
+    if (stat != Os::File::OP_OK) {
+        this->log_WARNING_HI_CatalogIndexWriteError(this->m_indexFile, stat);
+        (void)Os::FileSystem::removeFile(tmpFile.toChar());
+        (void)Os::FileSystem::removeFile(this->m_indexFile.toChar());
+        return;
+    }
+
+    Os::FileSystem::Status fsStat = Os::FileSystem::rename(tmpFile.toChar(), this->m_indexFile.toChar());
+    if (fsStat != Os::FileSystem::OP_OK) {
+        this->log_WARNING_HI_CatalogIndexWriteError(this->m_indexFile, fsStat);
+        (void)Os::FileSystem::removeFile(tmpFile.toChar());
+        (void)Os::FileSystem::removeFile(this->m_indexFile.toChar());
+    }
+}
+
+U32 DpCatalog::directoryHash() const {
+    Utils::Hash hash;
+    hash.init();
+    for (FwSizeType dir = 0; dir < this->m_numDirectories; dir++) {
+        // include the terminator so that names can't run together
+        hash.update(this->m_directories[dir].toChar(), this->m_directories[dir].length() + 1);
+    }
+    U32 value = 0;
+    hash.final(value);
+    return value;
+}
+
+void DpCatalog::appendIndexEntry(const DpStateEntry& entry) {
+    // only extend an index from a previous build; without one the next build scans anyway
+    if ((this->m_indexFile.length() == 0) or (not Os::FileSystem::exists(this->m_indexFile.toChar()))) {
+        return;
+    }
+
+    Os::File indexFile;
+    Os::File::Status stat = indexFile.open(this->m_indexFile.toChar(), Os::File::OPEN_APPEND);
+    if (stat == Os::File::OP_OK) {
+        U8 writeBuff[INDEX_RECORD_SIZE];
+        Fw::ExternalSerializeBuffer recordBuff(writeBuff, sizeof(writeBuff));
+        Fw::SerializeStatus serStat = DpCatalog::serializeIndexEntry(entry, recordBuff);
+        FW_ASSERT(serStat == Fw::FW_SERIALIZE_OK, serStat);
+        FwSizeType size = recordBuff.getSize();
+        stat = indexFile.write(writeBuff, size);
+        if ((stat == Os::File::OP_OK) and (size != recordBuff.getSize())) {
+            stat = Os::File::BAD_SIZE;
+        }
+        indexFile.close();
+    }
+
+    // an index missing an entry would hide the product from the next build, so drop it
+    if (stat != Os::File::OP_OK) {
+        this->log_WARNING_HI_CatalogIndexWriteError(this->m_indexFile, stat);
+        (void)Os::FileSystem::removeFile(this->m_indexFile.toChar());
+    }
+}
+
 Fw::CmdResponse DpCatalog::doCatalogBuild() {
     // check initialization
     if (not this->checkInit()) {
@@ -356,13 +611,19 @@ Fw::CmdResponse DpCatalog::doCatalogBuild() {
     // reset free list for entries
     this->resetBinaryTree();
 
-    // fill the binary tree with DP files
-    response = this->fillBinaryTree();
-    if (response != Fw::CmdResponse::OK) {
-        // clean up the binary tree
+    // fill the binary tree from the catalog index if there is one,
+    // otherwise from the DP files
+    if (not this->loadIndexFile()) {
         this->resetBinaryTree();
-        this->resetStateFileData();
-        return response;
+        response = this->fillBinaryTree();
+        if (response != Fw::CmdResponse::OK) {
+            // clean up the binary tree
+            this->resetBinaryTree();
+            this->resetStateFileData();
+            return response;
+        }
+        // save the scan so the next build can skip it
+        this->writeIndexFile();
     }
 
     // prune and rewrite the state file
@@ -419,7 +680,7 @@ Fw::CmdResponse DpCatalog::fillBinaryTree() {
             Fw::String fullFile;
             fullFile.format("%s/%s", this->m_directories[dir].toChar(), this->m_fileList[file].toChar());
 
-            int ret = processFile(fullFile, dir);
+            int ret = processFile(fullFile, dir, ADD_BUILD);
             if (ret < 0) {
                 break;
             }
@@ -477,7 +738,15 @@ FwSizeType DpCatalog::determineDirectory(Fw::String fullFile) {
     return DP_MAX_DIRECTORIES;
 }
 
-int DpCatalog::processFile(Fw::String fullFile, FwSizeType dir) {
+int DpCatalog::processFile(Fw::String fullFile, FwSizeType dir, AddMode mode) {
+    // segment files hold several data products
+    FwSignedSizeType segLoc = Fw::StringUtils::substring_find(
+        fullFile.toChar(), fullFile.length(), DP_SEGMENT_EXT,
+        Fw::StringUtils::string_length(DP_SEGMENT_EXT, sizeof(DP_SEGMENT_EXT)));
+    if (segLoc != -1) {
+        return this->processSegmentFile(fullFile, dir, mode);
+    }
+
     // file class instance for processing files
     Os::File dpFile;
 
@@ -548,42 +817,266 @@ int DpCatalog::processFile(Fw::String fullFile, FwSizeType dir) {
     entry.record.set_tSub(container.getTimeTag().getUSeconds());
     entry.record.set_size(static_cast<U64>(fileSize));
 
+    return this->addEntry(entry, mode);
+}
+
+int DpCatalog::processSegmentFile(const Fw::String& fullFile, FwSizeType dir, AddMode mode) {
+    // file class instance for processing files
+    Os::File segFile;
+
+    // working buffer for the trailer and index entries
+    static constexpr FwSizeType ENTRIES_PER_READ = 16;
+    static_assert(ENTRIES_PER_READ * Fw::DpSegment::Entry::SERIALIZED_SIZE >= Fw::DpSegment::Trailer::SERIALIZED_SIZE,
+                  "read buffer must hold the segment trailer");
+    U8 readBuff[ENTRIES_PER_READ * Fw::DpSegment::Entry::SERIALIZED_SIZE];
+
+    this->log_ACTIVITY_LO_ProcessingFile(fullFile);
+
+    // get file size
+    FwSizeType fileSize = 0;
+    Os::FileSystem::Status sizeStat = Os::FileSystem::getFileSize(fullFile.toChar(), fileSize);
+    if (sizeStat != Os::FileSystem::OP_OK) {
+        this->log_WARNING_HI_FileSizeError(fullFile, sizeStat);
+        return 0;
+    }
+
+    // a segment left open by a reset has no trailer, so its containers are found by walking the file
+    if (fileSize < Fw::DpSegment::Trailer::SERIALIZED_SIZE) {
+        return this->recoverSegmentFile(fullFile, dir, mode, fileSize);
+    }
+
+    Os::File::Status stat = segFile.open(fullFile.toChar(), Os::File::OPEN_READ);
+    if (stat != Os::File::OP_OK) {
+        this->log_WARNING_HI_FileOpenError(fullFile, stat);
+        return 0;
+    }
+
+    // read the trailer at the end of the file
+    FwSizeType size = Fw::DpSegment::Trailer::SERIALIZED_SIZE;
+    stat = segFile.seek(static_cast<FwSignedSizeType>(fileSize - size), Os::File::SeekType::ABSOLUTE);
+    if (stat == Os::File::OP_OK) {
+        stat = segFile.read(readBuff, size);
+    }
+    if ((stat == Os::File::OP_OK) && (size != Fw::DpSegment::Trailer::SERIALIZED_SIZE)) {
+        stat = Os::File::BAD_SIZE;
+    }
+    if (stat != Os::File::OP_OK) {
+        this->log_WARNING_HI_FileReadError(fullFile, stat);
+        segFile.close();
+        return 0;
+    }
+
+    Fw::ExternalSerializeBuffer trailerBuff(readBuff, Fw::DpSegment::Trailer::SERIALIZED_SIZE);
+    Fw::SerializeStatus desStat = trailerBuff.setBuffLen(Fw::DpSegment::Trailer::SERIALIZED_SIZE);
+    FW_ASSERT(desStat == Fw::FW_SERIALIZE_OK, desStat);
+    Fw::DpSegment::Trailer trailer;
+    desStat = trailer.deserializeFrom(trailerBuff);
+    if ((desStat == Fw::FW_SERIALIZE_OK) && (Fw::DpSegment::getFooterSize(trailer.entryCount) > fileSize)) {
+        desStat = Fw::FW_DESERIALIZE_SIZE_MISMATCH;
+    }
+    if (desStat != Fw::FW_SERIALIZE_OK) {
+        segFile.close();
+        return this->recoverSegmentFile(fullFile, dir, mode, fileSize);
+    }
+
+    // the index sits immediately before the trailer
+    const FwSizeType indexOffset = fileSize - Fw::DpSegment::getFooterSize(trailer.entryCount);
+    stat = segFile.seek(static_cast<FwSignedSizeType>(indexOffset), Os::File::SeekType::ABSOLUTE);
+    if (stat != Os::File::OP_OK) {
+        this->log_WARNING_HI_FileReadError(fullFile, stat);
+        segFile.close();
+        return 0;
+    }
+
+    int added = 0;
+    U32 entry = 0;
+    while (entry < trailer.entryCount) {
+        // read a chunk of index entries
+        const FwSizeType chunkEntries = FW_MIN(ENTRIES_PER_READ, static_cast<FwSizeType>(trailer.entryCount - entry));
+        size = chunkEntries * Fw::DpSegment::Entry::SERIALIZED_SIZE;
+        stat = segFile.read(readBuff, size);
+        if ((stat == Os::File::OP_OK) && (size != chunkEntries * Fw::DpSegment::Entry::SERIALIZED_SIZE)) {
+            stat = Os::File::BAD_SIZE;
+        }
+        if (stat != Os::File::OP_OK) {
+            this->log_WARNING_HI_FileReadError(fullFile, stat);
+            break;
+        }
+        Fw::ExternalSerializeBuffer indexBuff(readBuff, size);
+        desStat = indexBuff.setBuffLen(size);
+        FW_ASSERT(desStat == Fw::FW_SERIALIZE_OK, desStat);
+
+        for (FwSizeType chunkEntry = 0; chunkEntry < chunkEntries; chunkEntry++, entry++) {
+            Fw::DpSegment::Entry segEntry;
+            desStat = segEntry.deserializeFrom(indexBuff);
+            FW_ASSERT(desStat == Fw::FW_SERIALIZE_OK, desStat);
+
+            // the container must lie before the index
+            if (static_cast<FwSizeType>(segEntry.offset) + segEntry.size > indexOffset) {
+                this->log_WARNING_HI_FileHdrDesError(fullFile, Fw::FW_DESERIALIZE_SIZE_MISMATCH);
+                continue;
+            }
+
+            int ret = this->addSegmentEntry(fullFile, dir, segEntry, trailer, mode);
+            if (ret < 0) {
+                segFile.close();
+                return -1;
+            }
+            added += ret;
+        }
+    }
+
+    segFile.close();
+    return added;
+}
+
+int DpCatalog::recoverSegmentFile(const Fw::String& fullFile, FwSizeType dir, AddMode mode, FwSizeType fileSize) {
+    // the segment time and sequence number are normally in the trailer, so take them from the file name.
+    // the scan pattern follows DP_SEGMENT_FILENAME_FORMAT, and the name is checked by formatting it again.
+    Fw::DpSegment::Trailer trailer;
+    const char* const baseName = ::strrchr(fullFile.toChar(), '/');
+    bool named = (baseName != nullptr) and
+                 (::sscanf(baseName, "/DpSeg_%" SCNu32 "_%" SCNu32 "_%" SCNu32, &trailer.timeSeconds,
+                           &trailer.timeUSeconds, &trailer.sequence) == 3);
+    if (named) {
+        Fw::FileNameString expected;
+        expected.format(DP_SEGMENT_FILENAME_FORMAT, "", trailer.timeSeconds, trailer.timeUSeconds, trailer.sequence);
+        named = (::strcmp(baseName, expected.toChar()) == 0);
+    }
+    if (not named) {
+        this->log_WARNING_HI_FileHdrDesError(fullFile, Fw::FW_DESERIALIZE_FORMAT_ERROR);
+        return 0;
+    }
+
+    Os::File segFile;
+    Os::File::Status stat = segFile.open(fullFile.toChar(), Os::File::OPEN_READ);
+    if (stat != Os::File::OP_OK) {
+        this->log_WARNING_HI_FileOpenError(fullFile, stat);
+        return 0;
+    }
+
+    // Working buffer for a container header and its hash
+    U8 dpBuff[Fw::DpContainer::MIN_PACKET_SIZE];
+    Fw::Buffer hdrBuff(dpBuff, sizeof(dpBuff));
+    Fw::DpContainer container;
+    container.setBuffer(hdrBuff);
+
+    // containers are written back to back from the start of the file. stop at the first one that
+    // is corrupt or was cut off by the reset
+    int added = 0;
+    FwSizeType offset = 0;
+    while (fileSize - offset >= Fw::DpContainer::MIN_PACKET_SIZE) {
+        FwSizeType size = Fw::DpContainer::DATA_OFFSET;
+        stat = segFile.seek(static_cast<FwSignedSizeType>(offset), Os::File::SeekType::ABSOLUTE);
+        if (stat == Os::File::OP_OK) {
+            stat = segFile.read(dpBuff, size);
+        }
+        if ((stat != Os::File::OP_OK) or (size != Fw::DpContainer::DATA_OFFSET)) {
+            break;
+        }
+        Utils::HashBuffer storedHash;
+        Utils::HashBuffer computedHash;
+        if ((container.deserializeHeader() != Fw::FW_SERIALIZE_OK) or
+            (container.checkHeaderHash(storedHash, computedHash) != Fw::Success::SUCCESS) or
+            (container.getDataSize() > fileSize - offset - Fw::DpContainer::MIN_PACKET_SIZE)) {
+            break;
+        }
+
+        const Fw::Time timeTag = container.getTimeTag();
+        Fw::DpSegment::Entry segEntry;
+        segEntry.id = container.getId();
+        segEntry.priority = container.getPriority();
+        segEntry.timeSeconds = timeTag.getSeconds();
+        segEntry.timeUSeconds = timeTag.getUSeconds();
+        segEntry.state = container.getState();
+        segEntry.offset = static_cast<U32>(offset);
+        segEntry.size = static_cast<U32>(container.getPacketSize());
+        trailer.entryCount++;
+
+        int ret = this->addSegmentEntry(fullFile, dir, segEntry, trailer, mode);
+        if (ret < 0) {
+            segFile.close();
+            return -1;
+        }
+        added += ret;
+        offset += container.getPacketSize();
+    }
+
+    segFile.close();
+    this->log_WARNING_LO_SegmentRecovered(fullFile, trailer.entryCount);
+    return added;
+}
+
+int DpCatalog::addSegmentEntry(const Fw::String& fullFile,
+                               FwSizeType dir,
+                               const Fw::DpSegment::Entry& segEntry,
+                               const Fw::DpSegment::Trailer& trailer,
+                               AddMode mode) {
+    // skip adding an already transmitted product
+    if (segEntry.state == Fw::DpState::TRANSMITTED) {
+        this->log_ACTIVITY_HI_DpFileSkipped(fullFile);
+        return 0;
+    }
+
+    DpStateEntry stateEntry;
+    stateEntry.dir = static_cast<FwIndexType>(dir);
+    stateEntry.record.set_id(segEntry.id);
+    stateEntry.record.set_priority(segEntry.priority);
+    stateEntry.record.set_state(segEntry.state);
+    stateEntry.record.set_tSec(segEntry.timeSeconds);
+    stateEntry.record.set_tSub(segEntry.timeUSeconds);
+    stateEntry.record.set_size(static_cast<U64>(segEntry.size));
+    stateEntry.inSegment = true;
+    stateEntry.segSeq = trailer.sequence;
+    stateEntry.segSec = trailer.timeSeconds;
+    stateEntry.segSub = trailer.timeUSeconds;
+    stateEntry.segOffset = segEntry.offset;
+
+    return this->addEntry(stateEntry, mode);
+}
+
+int DpCatalog::addEntry(DpStateEntry& entry, AddMode mode) {
+    // the catalog isn't built, so only record the entry for the next build
+    if (mode == ADD_INDEX) {
+        this->appendIndexEntry(entry);
+        return 1;
+    }
+
     // check the state file to see if there is transmit state
     this->getFileState(entry);
 
+    // a product that is already in the catalog is only counted once
+    const bool existing = (this->m_dpTree.find(entry) == Fw::Success::SUCCESS);
+
     // insert entry into sorted list. if can't insert, quit
-    DpBtreeNode* addedEntry = this->insertEntry(entry);
-    if (addedEntry == nullptr) {
+    if (not this->insertEntry(entry)) {
         this->log_WARNING_HI_DpInsertError(entry.record);
+        // a full catalog can't be captured by the index,
+        // so drop it and let the next build scan the directories
+        if ((mode == ADD_RUNTIME) and (this->m_indexFile.length() > 0)) {
+            (void)Os::FileSystem::removeFile(this->m_indexFile.toChar());
+        }
         // return and hope new slots open up later
         return -1;
     }
 
-    // increment our counters
-    this->m_pendingFiles++;
-    this->m_pendingDpBytes += entry.record.get_size();
+    if (not existing) {
+        // increment our counters
+        this->m_pendingFiles++;
+        this->m_pendingDpBytes += entry.record.get_size();
+    }
 
-    // make sure we haven't exceeded the limit
-    if (this->m_pendingFiles > this->m_numDpSlots) {
-        this->log_WARNING_HI_DpCatalogFull(entry.record);
-        return -1;
+    // record the runtime addition for the next build
+    if (mode == ADD_RUNTIME) {
+        this->appendIndexEntry(entry);
     }
 
     Fw::FileNameString addedFileName;
-    addedFileName.format(DP_FILENAME_FORMAT, this->m_directories[dir].toChar(), entry.record.get_id(),
+    addedFileName.format(DP_FILENAME_FORMAT, this->m_directories[entry.dir].toChar(), entry.record.get_id(),
                          entry.record.get_tSec(), entry.record.get_tSub());
 
     this->log_ACTIVITY_HI_DpFileAdded(addedFileName);
 
-    // Compute relative priority to current exploration node
-    // For Handling adding a node to a catalog that has
-    // already moved past the inserted node's priority
-    if (this->m_currentNode == nullptr) {
-        this->m_currentNode = addedEntry;
-    } else if (entry < this->m_currentNode->entry) {
-        this->m_currentNode = addedEntry;
-    }
-
     return 1;
 }
 
@@ -619,7 +1112,14 @@ int DpCatalog::DpStateEntry::compareEntries(const DpStateEntry& left, const DpSt
         return 1;
     }
 
-    // if ids are equal we have two nodes with the same value
+    // check directory. Lower index is higher priority
+    else if (left.dir < right.dir) {
+        return -1;
+    } else if (left.dir > right.dir) {
+        return 1;
+    }
+
+    // if all are equal we have two nodes with the same value
     else {
         return 0;
     }
@@ -639,228 +1139,26 @@ bool DpCatalog::DpStateEntry::operator<(const DpStateEntry& other) const {
     return compareEntries(*this, other) < 0;
 }
 
-DpCatalog::DpBtreeNode* DpCatalog::insertEntry(DpStateEntry& entry) {
-    // the tree is filled in the following priority order:
+bool DpCatalog::insertEntry(const DpStateEntry& entry) {
+    // the tree is kept in the following priority order:
     // 1. DP priority - lower number is higher priority
     // 2. DP time - older is higher priority
     // 3. DP ID - lower number is higher priority
 
-    // Higher priority is to the left of the tree
-
-    // if the tree is empty, add the first entry
-    if (this->m_dpTree == nullptr) {
-        bool goodInsert = this->allocateNode(this->m_dpTree, entry);
-        if (not goodInsert) {
-            return nullptr;
-        }
-
-        return this->m_dpTree;
-
-        // otherwise, search depth-first to sort the entry
-    } else {
-        // to avoid recursion, loop through a max of the number of available records
-        DpBtreeNode* node = this->m_dpTree;
-        for (FwSizeType record = 0; record < this->m_numDpSlots; record++) {
-            CheckStat stat = CheckStat::CHECK_CONT;
-            stat = this->checkLeftRight(entry < node->entry, node, entry);
-
-            // act on status
-            if (stat == CheckStat::CHECK_ERROR) {
-                return nullptr;
-            } else if (stat == CheckStat::CHECK_OK) {
-                return node;
-            }
-        }  // end for each possible record
-
-        return nullptr;
-    }
-}
+    // replace the metadata of an entry that is already in the tree
+    (void)this->m_dpTree.remove(entry);
 
-DpCatalog::CheckStat DpCatalog::checkLeftRight(bool condition, DpBtreeNode*& node, const DpStateEntry& newEntry) {
-    if (condition) {
-        if (node->left == nullptr) {
-            bool allocated = this->allocateNode(node->left, newEntry);
-            if (not allocated) {
-                return CheckStat::CHECK_ERROR;
-            }
-            node->left->parent = node;
-            // Let the caller know where node ended up
-            node = node->left;
-            return CheckStat::CHECK_OK;
-        } else {
-            node = node->left;
-            return CheckStat::CHECK_CONT;
-        }
-    } else {
-        if (node->right == nullptr) {
-            bool allocated = this->allocateNode(node->right, newEntry);
-            if (not allocated) {
-                return CheckStat::CHECK_ERROR;
-            }
-            node->right->parent = node;
-            // Let the caller know where node ended up
-            node = node->right;
-            return CheckStat::CHECK_OK;
-        } else {
-            node = node->right;
-            return CheckStat::CHECK_CONT;
-        }
-    }
-}
-
-bool DpCatalog::allocateNode(DpBtreeNode*& newNode, const DpStateEntry& newEntry) {
-    // should always be null since we are allocating an empty slot
-    FW_ASSERT(newNode == nullptr);
-    // make sure there is an entry from the free list
-    if (this->m_freeListHead == nullptr) {
-        this->log_WARNING_HI_DpCatalogFull(newEntry.record);
+    // make sure there is a free slot
+    if (this->m_dpTree.getSize() >= this->m_dpTree.getCapacity()) {
+        this->log_WARNING_HI_DpCatalogFull(entry.record);
         return false;
     }
 
-    // get a new node from the free list
-    newNode = this->m_freeListHead;
-    // move the head of the free list to the next node
-    // If we've at the bottom of the free list, head will now be nullptr
-    this->m_freeListHead = this->m_freeListHead->left;
-
-    // initialize the new node
-    newNode->left = nullptr;
-    newNode->right = nullptr;
-    newNode->parent = nullptr;
-    newNode->entry = newEntry;
-
-    // we got one, so return success
+    const Fw::Success status = this->m_dpTree.insert(entry);
+    FW_ASSERT(status == Fw::Success::SUCCESS, static_cast<FwAssertArgType>(status));
     return true;
 }
 
-void DpCatalog::deallocateNode(DpBtreeNode* node) {
-    DpBtreeNode* parent = node->parent;
-
-    // since nodes are deallocated after xmit, left should be gone
-    // However, left node could be added during xmit
-    if (node->left != nullptr) {
-        // Since we aren't limited to adding just 1 node during file transfer
-        // the left child might not be a leaf
-        // Instead, find the node of closest (but higher) priority to this node
-        // This is the lowest priority node on the left branch
-        // Which is the rightmost node of the left branch
-        DpBtreeNode* rightmostNode = node->left;
-
-        // (i.e. node->left->right->right ... ->right until we hit null)
-
-        // bounded while loop (in case we're linked onto the free list somehow)
-        for (FwSizeType record = 0; record < this->m_numDpSlots && rightmostNode->right != nullptr; record++) {
-            rightmostNode = rightmostNode->right;
-
-            // I really hope these never fire
-            FW_ASSERT(rightmostNode != this->m_freeListHead);
-            FW_ASSERT(rightmostNode != nullptr);
-        }
-
-        FW_ASSERT(rightmostNode != nullptr);
-        FW_ASSERT(rightmostNode->parent != nullptr);
-
-        // We can then swap the node to be deallocated w/ the rightmost
-        // (since it is immediately higher priority than us)
-
-        // Make the "parent" of the deallocated node point at the rightmost
-        if (parent == nullptr) {
-            // this is the root node: has no parent, but needs the root pointer to shift
-            this->m_dpTree = rightmostNode;
-        } else {
-            // patch onto the appropriate parent branch
-            if (parent->left == node) {
-                parent->left = rightmostNode;
-            } else {
-                parent->right = rightmostNode;
-            }
-        }
-
-        // Handle the children of the rightmost node
-        if (rightmostNode == node->left) {
-            // The rightmost node is the immediate left child of the deallocated node
-            // Since it only has left children, shift the left branch up
-            // with node->left taking the place of the deallocated node
-
-            // Nothing we need to do
-            // Just avoid the infinite loop that would occur in this case
-            // on the other branch
-        } else {
-            // If the rightmost node isn't the node to be deallocated's left child,
-            // we can stitch its left branch onto its parent in its place
-            rightmostNode->parent->right = rightmostNode->left;
-
-            // Now connect the deallocated node's left branch onto rightmostNode
-            rightmostNode->left = node->left;
-            node->left->parent = rightmostNode;
-        }
-
-        // Regardless, connect the deallocated node's right branch onto rightmostNode
-        rightmostNode->right = node->right;
-
-        if (node->right != nullptr) {
-            node->right->parent = rightmostNode;
-        }
-
-        // Now that we're done using the parent of rightmost node
-        // Point at actual parent or nullptr if this is the new root
-        rightmostNode->parent = parent;
-
-        // Ensure the Left node no longer points at us
-        FW_ASSERT(node->left->parent != node);
-    } else {
-        // This node only had a right branch
-        // cut out this node and shift the right branch up
-
-        // The root node has no parent, but needs the tree root pointer to shift
-        if (parent == nullptr) {
-            this->m_dpTree = node->right;
-        } else {
-            // Patch the right branch onto
-            // the appropriate parent branch of this node
-            if (parent->left == node) {
-                parent->left = node->right;
-            } else {
-                parent->right = node->right;
-            }
-        }
-
-        // If there is a right branch
-        // Point it at the parent of the removed node
-        if (node->right != nullptr) {
-            FW_ASSERT(node->right->parent != nullptr);
-            node->right->parent = parent;
-        }
-    }
-
-    // clear out the entry
-    node->entry = {};
-    // point this node @ the old head of the free list
-    node->left = m_freeListHead;
-
-    // Ensure the Right node no longer points at us
-    if (node->right != nullptr) {
-        FW_ASSERT(node->right->parent != node);
-    }
-
-    // clear out our right reference
-    node->right = nullptr;
-
-    DpBtreeNode* oldFreeListHead = this->m_freeListHead;
-    // make this node the new head of the free list
-    this->m_freeListHead = node;
-
-    // Node is the head of the free list
-    FW_ASSERT(this->m_freeListHead == node);
-
-    node->parent = nullptr;
-
-    // Ensure this Node only points at next in free list
-    FW_ASSERT(node->left == oldFreeListHead);
-    FW_ASSERT(node->right == nullptr);
-    FW_ASSERT(node->parent == nullptr);
-}
-
 void DpCatalog::sendNextEntry() {
     // Use xmit flag to break upon STOP_XMIT_CATALOG
     if (this->m_xmitInProgress != true) {
@@ -868,24 +1166,38 @@ void DpCatalog::sendNextEntry() {
     }
 
     // look in the tree for the next entry to send
-    this->m_currentXmitNode = this->findNextTreeNode();
-
-    if (this->m_currentXmitNode == nullptr) {
+    if (not this->findNextEntry(this->m_currentXmitEntry)) {
         // if no entry found, we are done
         this->m_xmitInProgress = false;
         this->log_ACTIVITY_HI_CatalogXmitCompleted(this->m_xmitBytes);
+        // drop the downlinked products from the index so it doesn't grow without bound.
+        // a discarded index stays discarded, since it may have left products out
+        if ((this->m_indexFile.length() > 0) and Os::FileSystem::exists(this->m_indexFile.toChar())) {
+            this->writeIndexFile();
+        }
         this->dispatchWaitedResponse(Fw::CmdResponse::OK);
         return;
     } else {
+        const DpStateEntry& entry = this->m_currentXmitEntry;
         // build file name based on the found entry
-        this->m_currXmitFileName.format(
-            DP_FILENAME_FORMAT, this->m_directories[this->m_currentXmitNode->entry.dir].toChar(),
-            this->m_currentXmitNode->entry.record.get_id(), this->m_currentXmitNode->entry.record.get_tSec(),
-            this->m_currentXmitNode->entry.record.get_tSub());
-        this->log_ACTIVITY_LO_SendingProduct(this->m_currXmitFileName,
-                                             static_cast<U32>(this->m_currentXmitNode->entry.record.get_size()),
-                                             this->m_currentXmitNode->entry.record.get_priority());
-        Svc::SendFileResponse resp = this->fileOut_out(0, this->m_currXmitFileName, this->m_currXmitFileName, 0, 0);
+        this->m_currXmitFileName.format(DP_FILENAME_FORMAT, this->m_directories[entry.dir].toChar(),
+                                        entry.record.get_id(), entry.record.get_tSec(), entry.record.get_tSub());
+        this->log_ACTIVITY_LO_SendingProduct(this->m_currXmitFileName, static_cast<U32>(entry.record.get_size()),
+                                             entry.record.get_priority());
+        Svc::SendFileResponse resp;
+        if (entry.inSegment) {
+            // copy the product out of its segment so the ground receives it as a single data product file
+            this->m_segXmitFileName.format(DP_SEGMENT_XMIT_FILENAME_FORMAT,
+                                           this->m_directories[entry.dir].toChar());
+            if (not this->extractSegmentEntry(entry, this->m_segXmitFileName)) {
+                this->m_xmitInProgress = false;
+                this->dispatchWaitedResponse(Fw::CmdResponse::EXECUTION_ERROR);
+                return;
+            }
+            resp = this->fileOut_out(0, this->m_segXmitFileName, this->m_currXmitFileName, 0, 0);
+        } else {
+            resp = this->fileOut_out(0, this->m_currXmitFileName, this->m_currXmitFileName, 0, 0);
+        }
         if (resp.get_status() != Svc::SendFileStatus::STATUS_OK) {
             // warn, but keep going since it may be an issue with this file but others could
             // make it
@@ -895,44 +1207,67 @@ void DpCatalog::sendNextEntry() {
 
 }  // end sendNextEntry()
 
-DpCatalog::DpBtreeNode* DpCatalog::findNextTreeNode() {
-    // check some asserts
-    FW_ASSERT(this->m_xmitInProgress);
+bool DpCatalog::extractSegmentEntry(const DpStateEntry& entry, const Fw::FileNameString& xmitFile) {
+    Fw::FileNameString segFileName;
+    segFileName.format(DP_SEGMENT_FILENAME_FORMAT, this->m_directories[entry.dir].toChar(), entry.segSec,
+                       entry.segSub, entry.segSeq);
 
-    if (this->m_dpTree == nullptr) {
-        // We've run out of entries, we are done
-        this->m_xmitInProgress = false;
-        return nullptr;
+    Os::File segFile;
+    Os::File xmitOut;
+    Os::File::Status stat = segFile.open(segFileName.toChar(), Os::File::OPEN_READ);
+    if (stat == Os::File::OP_OK) {
+        stat = segFile.seek(static_cast<FwSignedSizeType>(entry.segOffset), Os::File::SeekType::ABSOLUTE);
     }
-
-    // start back at the top
-    if (this->m_currentNode == nullptr) {
-        this->m_currentNode = this->m_dpTree;
+    if (stat == Os::File::OP_OK) {
+        stat = xmitOut.open(xmitFile.toChar(), Os::File::OPEN_CREATE, Os::File::OverwriteType::OVERWRITE);
     }
 
-    // Nav left until nullptr
-    // Leads to highest priority node
-    // bounded while loop (in case we're linked onto the free list somehow)
-    for (FwSizeType record = 0; record < this->m_numDpSlots && this->m_currentNode->left != nullptr; record++) {
-        this->m_currentNode = this->m_currentNode->left;
+    // copy the container a chunk at a time
+    U8 chunk[FW_FILE_CHUNK_SIZE];
+    FwSizeType remaining = static_cast<FwSizeType>(entry.record.get_size());
+    while ((stat == Os::File::OP_OK) && (remaining > 0)) {
+        FwSizeType size = FW_MIN(remaining, static_cast<FwSizeType>(sizeof(chunk)));
+        const FwSizeType requested = size;
+        stat = segFile.read(chunk, size);
+        if ((stat == Os::File::OP_OK) && (size != requested)) {
+            stat = Os::File::BAD_SIZE;
+        }
+        if (stat == Os::File::OP_OK) {
+            stat = xmitOut.write(chunk, size);
+        }
+        if ((stat == Os::File::OP_OK) && (size != requested)) {
+            stat = Os::File::BAD_SIZE;
+        }
+        remaining -= size;
+    }
 
-        // I really hope these never fire
-        FW_ASSERT(this->m_currentNode != this->m_freeListHead);
-        FW_ASSERT(this->m_currentNode != nullptr);
+    segFile.close();
+    xmitOut.close();
+    if (stat != Os::File::OP_OK) {
+        this->log_WARNING_HI_SegmentExtractError(segFileName, stat);
+        (void)Os::FileSystem::removeFile(xmitFile.toChar());
+        return false;
     }
+    return true;
+}
 
-    // save the high prio & find next best
-    DpBtreeNode* found = this->m_currentNode;
+bool DpCatalog::findNextEntry(DpStateEntry& entry) {
+    // check some asserts
+    FW_ASSERT(this->m_xmitInProgress);
 
-    // On the next cycle, explore the node to the right, if available,
-    // otherwise the node above
-    if (this->m_currentNode->right != nullptr) {
-        this->m_currentNode = this->m_currentNode->right;
-    } else {
-        this->m_currentNode = this->m_currentNode->parent;
+    // Transmitted entries are removed from the tree, so the
+    // highest priority entry is always the first one. This also
+    // picks up entries added at runtime with a higher priority
+    // than those already sent.
+    DpTree::ConstIterator first = this->m_dpTree.begin();
+    if (not first.isInRange()) {
+        // We've run out of entries, we are done
+        this->m_xmitInProgress = false;
+        return false;
     }
 
-    return found;
+    entry = *first;
+    return true;
 }
 
 bool DpCatalog::checkInit() {
@@ -961,6 +1296,11 @@ void DpCatalog::shutdown() {
 // ----------------------------------------------------------------------
 
 void DpCatalog ::fileDone_handler(FwIndexType portNum, const Svc::SendFileResponse& resp) {
+    // the copy of a segment container is no longer needed
+    if (this->m_currentXmitEntry.inSegment) {
+        (void)Os::FileSystem::removeFile(this->m_segXmitFileName.toChar());
+    }
+
     // check file status
     if (resp.get_status() != Svc::SendFileStatus::STATUS_OK) {
         this->log_WARNING_HI_DpFileXmitError(this->m_currXmitFileName, resp.get_status());
@@ -975,22 +1315,23 @@ void DpCatalog ::fileDone_handler(FwIndexType portNum, const Svc::SendFileRespon
 
     // Since catalog built flag is true
     // we should have a tree w/ at least one element
-    FW_ASSERT(this->m_dpTree);
+    FW_ASSERT(this->m_dpTree.getSize() > 0);
 
     // Reduce pending
-    this->m_pendingDpBytes -= this->m_currentXmitNode->entry.record.get_size();
+    this->m_pendingDpBytes -= this->m_currentXmitEntry.record.get_size();
     this->m_pendingFiles--;
     // Log File Complete & pending
     this->log_ACTIVITY_LO_ProductComplete(this->m_currXmitFileName, this->m_pendingFiles, this->m_pendingDpBytes);
 
     // mark the entry as transmitted
-    this->m_currentXmitNode->entry.record.set_state(Fw::DpState::TRANSMITTED);
+    this->m_currentXmitEntry.record.set_state(Fw::DpState::TRANSMITTED);
     // update the transmitted state in the state file
-    this->appendFileState(this->m_currentXmitNode->entry);
+    this->appendFileState(this->m_currentXmitEntry);
     // add the size
-    this->m_xmitBytes += this->m_currentXmitNode->entry.record.get_size();
-    // deallocate this node
-    this->deallocateNode(this->m_currentXmitNode);
+    this->m_xmitBytes += this->m_currentXmitEntry.record.get_size();
+    // remove the entry from the tree
+    const Fw::Success status = this->m_dpTree.remove(this->m_currentXmitEntry);
+    FW_ASSERT(status == Fw::Success::SUCCESS, static_cast<FwAssertArgType>(status));
     // send the next entry, if it exists
     this->sendNextEntry();
 }
@@ -1015,16 +1356,23 @@ void DpCatalog ::addToCat_handler(FwIndexType portNum,
         return;
     }
 
+    // Both of these are grabbed from the header
+    (void)priority;
+    (void)size;
+
     // Check the catalog has been built
     if (not this->m_catalogBuilt) {
         this->log_ACTIVITY_HI_NotLoaded(fileName);
+        // if there is a catalog index, record the file there so the next build includes it
+        if ((this->m_indexFile.length() > 0) and Os::FileSystem::exists(this->m_indexFile.toChar())) {
+            FwSizeType dir = this->determineDirectory(fileName);
+            if (dir != DP_MAX_DIRECTORIES) {
+                (void)this->processFile(fileName, dir, ADD_INDEX);
+            }
+        }
         return;
     }
 
-    // Both of these are grabbed from the header
-    (void)priority;
-    (void)size;
-
     // Since this is a runtime addition
     // Check if file is in one of our directories
     FwSizeType dir = this->determineDirectory(fileName);
@@ -1036,12 +1384,11 @@ void DpCatalog ::addToCat_handler(FwIndexType portNum,
     }
 
     // ret > 0 := success
-    int ret = processFile(fileName, dir);
+    int ret = processFile(fileName, dir, ADD_RUNTIME);
 
     if (ret > 0) {
         // If we already finished, sendNext only if remainingActive
         if (!this->m_xmitInProgress && this->m_remainActive) {
-            this->m_currentNode = this->m_dpTree;
             this->m_xmitInProgress = true;
             this->sendNextEntry();
         }
@@ -1136,6 +1483,10 @@ void DpCatalog ::STOP_XMIT_CATALOG_cmdHandler(FwOpcodeType opCode, U32 cmdSeq) {
 void DpCatalog ::CLEAR_CATALOG_cmdHandler(FwOpcodeType opCode, U32 cmdSeq) {
     this->resetBinaryTree();
     this->resetStateFileData();
+    // discard the catalog index so the next build scans the directories
+    if (this->m_indexFile.length() > 0) {
+        (void)Os::FileSystem::removeFile(this->m_indexFile.toChar());
+    }
 
     this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
 }
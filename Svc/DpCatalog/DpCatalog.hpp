@@ -10,6 +10,9 @@
 #include "Svc/DpCatalog/DpCatalogComponentAc.hpp"
 #include "Svc/DpCatalog/DpRecordSerializableAc.hpp"
 
+#include <Fw/DataStructures/ExternalRedBlackTreeMap.hpp>
+#include <Fw/DataStructures/ExternalRedBlackTreeSet.hpp>
+#include <Fw/Dp/DpSegment.hpp>
 #include <Fw/Types/MemAllocator.hpp>
 
 #include <Fw/Types/FileNameString.hpp>
@@ -40,7 +43,8 @@ class DpCatalog final : public DpCatalogComponentBase {
     /// @param maxDpFiles The max number of data product files to track
     /// @param directories list of directories to scan
     /// @param numDirs number of supplied directories
-    /// @param stateFile file to store transmit state. Provide a zero-length string if no state tracking
+    /// @param stateFile file to store transmit state. Provide a zero-length string if no state tracking.
+    ///        The persisted catalog index is stored next to it, with DP_CATALOG_INDEX_SUFFIX appended.
     /// @param memId  memory ID for allocator
     /// @param allocator Allocator to supply memory for catalog.
     ///        Instance must survive for shutdown to use for reclaiming memory
@@ -123,10 +127,15 @@ class DpCatalog final : public DpCatalogComponentBase {
 
     struct DpStateEntry {
         friend class DpCatalogTester;
-        FwIndexType dir;  //!< index to m_directories entry that has directory name where DP exists
+        FwIndexType dir = 0;  //!< index to m_directories entry that has directory name where DP exists
         DpRecord record;  //!< data product metadata
+        bool inSegment = false;  //!< true if the DP is a container stored in a segment file
+        U32 segSeq = 0;          //!< segment sequence number
+        U32 segSec = 0;          //!< segment time in seconds
+        U32 segSub = 0;          //!< segment time in subseconds
+        U32 segOffset = 0;       //!< offset of the DP in the segment file
 
-        /// @brief insert an entry into the sorted list; if it exists, update the metadata
+        /// @brief compare two entries in downlink order
         /// @param left an entry to compare
         /// @param right other entry to compare
         /// @return -1 if left is higher priority, 0 if equal, and 1 if right is higher priority
@@ -139,20 +148,37 @@ class DpCatalog final : public DpCatalogComponentBase {
     };
 
     struct DpDstateFileEntry {
-        bool used;     //!< if the entry is used
-        bool visited;  //!< used for state file state; indicates that the entry was found in the search of current data
-                       //!< products
-        DpStateEntry entry;  //!< state entry from file
+        bool visited = false;  //!< used for state file state; indicates that the entry was found in the search of
+                               //!< current data products
+        DpRecord record;       //!< data product metadata from file
     };
 
-    /// @brief A list sorted in priority order for downlink
-    struct DpBtreeNode {
-        DpStateEntry entry;   //!< pointer to DP record
-        DpBtreeNode* left;    //!< left child. Also used for free list
-        DpBtreeNode* right;   //!< right child
-        DpBtreeNode* parent;  //!< parent node
+    /// @brief The catalog, sorted in priority order for downlink
+    using DpTree = Fw::ExternalRedBlackTreeSet<DpStateEntry>;
+
+    /// @brief The state file data, keyed by entry
+    using DpStateMap = Fw::ExternalRedBlackTreeMap<DpStateEntry, DpDstateFileEntry>;
+
+    /// @brief How a processed entry is added
+    enum AddMode {
+        ADD_BUILD,    //!< add to the catalog being built
+        ADD_RUNTIME,  //!< add to the built catalog and append to the index
+        ADD_INDEX,    //!< append to the index only; the catalog is not built
     };
 
+    //! The value marking a catalog index file ("FDPI")
+    static constexpr U32 INDEX_MAGIC = 0x46445049;
+
+    //! The serialized size of the catalog index header: magic value, number of directories, and directory hash
+    static constexpr FwSizeType INDEX_HEADER_SIZE = 3 * sizeof(U32);
+
+    //! The serialized size of a catalog index record
+    static constexpr FwSizeType INDEX_RECORD_SIZE =
+        sizeof(FwIndexType) + DpRecord::SERIALIZED_SIZE + sizeof(U8) + 4 * sizeof(U32);
+
+    //! The number of catalog index records read or written at a time
+    static constexpr FwSizeType INDEX_ENTRIES_PER_READ = 16;
+
     // ----------------------------------
     // Private helpers
     // ----------------------------------
@@ -165,25 +191,50 @@ class DpCatalog final : public DpCatalogComponentBase {
     /// @brief add entry to sorted list and state file; called on each file in it & upon addToCat
     /// @param fullFile full path to file to be processed
     /// @param dir directory index in m_directories
+    /// @param mode how to add the entries
     /// @return -1 for quit, 0 for failure but continue, 1 for success
-    int processFile(Fw::String fullFile, FwSizeType dir);
+    int processFile(Fw::String fullFile, FwSizeType dir, AddMode mode);
 
-    /// @brief insert an entry into the sorted list; if it exists, update the metadata
+    /// @brief add an entry for each container in a segment file; called from processFile
+    /// @param fullFile full path to segment file to be processed
+    /// @param dir directory index in m_directories
+    /// @param mode how to add the entries
+    /// @return -1 for quit, otherwise the number of entries added
+    int processSegmentFile(const Fw::String& fullFile, FwSizeType dir, AddMode mode);
+
+    /// @brief add an entry for each complete container in a segment file without a footer
+    /// @param fullFile full path to segment file to be processed
+    /// @param dir directory index in m_directories
+    /// @param mode how to add the entries
+    /// @param fileSize size of the segment file
+    /// @return -1 for quit, otherwise the number of entries added
+    int recoverSegmentFile(const Fw::String& fullFile, FwSizeType dir, AddMode mode, FwSizeType fileSize);
+
+    /// @brief add an entry for a container in a segment file
+    /// @param fullFile full path to the segment file
+    /// @param dir directory index in m_directories
+    /// @param segEntry the container's segment index entry
+    /// @param trailer the segment trailer identifying the segment
+    /// @param mode how to add the entry
+    /// @return -1 for quit, otherwise the number of entries added
+    int addSegmentEntry(const Fw::String& fullFile,
+                        FwSizeType dir,
+                        const Fw::DpSegment::Entry& segEntry,
+                        const Fw::DpSegment::Trailer& trailer,
+                        AddMode mode);
+
+    /// @brief add an entry to the sorted list and update pending counters
     /// @param entry new entry
-    /// @return failed if couldn't find a slot
-    DpCatalog::DpBtreeNode* insertEntry(DpStateEntry& entry);
-
-    /// @brief enumeration for check and insert function
-    enum CheckStat {
-        CHECK_OK,     //!< check passed and inserted. Can break loop
-        CHECK_CONT,   //!< check passed and find another node to check
-        CHECK_ERROR,  //!< check failed to allocate an entry. Quit function
-    };
+    /// @param mode how to add the entry
+    /// @return -1 for quit, 1 for success
+    int addEntry(DpStateEntry& entry, AddMode mode);
 
-    /// @brief check for left/right insertion
-    CheckStat checkLeftRight(bool condition, DpBtreeNode*& node, const DpStateEntry& newEntry);
+    /// @brief insert an entry into the sorted list; if it exists, update the metadata
+    /// @param entry new entry
+    /// @return false if there was no free slot
+    bool insertEntry(const DpStateEntry& entry);
 
-    /// @brief reset the free list
+    /// @brief reset the sorted list
     void resetBinaryTree();
 
     /// #brief fill  the binary tree from DP files
@@ -206,23 +257,46 @@ class DpCatalog final : public DpCatalogComponentBase {
     /// @param entry entry to add to state file
     void appendFileState(const DpStateEntry& entry);
 
-    /// @brief add an entry to the tree
-    /// @param newNode pointer to newly allocated node
-    /// @param newEntry entry to add
-    /// @return true if a node could be allocated
-    bool allocateNode(DpBtreeNode*& newNode, const DpStateEntry& newEntry);
+    /// @brief serialize a catalog index record
+    /// @param entry entry to serialize
+    /// @param buffer buffer to serialize into
+    /// @return the serialize status
+    static Fw::SerializeStatus serializeIndexEntry(const DpStateEntry& entry, Fw::SerialBufferBase& buffer);
 
-    /// @brief free an entry from the tree
-    /// @param node entry to deallocate
-    void deallocateNode(DpBtreeNode* node);
+    /// @brief deserialize a catalog index record
+    /// @param entry entry to fill
+    /// @param buffer buffer to deserialize from
+    /// @return the serialize status
+    static Fw::SerializeStatus deserializeIndexEntry(DpStateEntry& entry, Fw::SerialBufferBase& buffer);
+
+    /// @brief fill the sorted list from the persisted catalog index
+    /// @return true if the index was loaded; false if it is missing or invalid and the directories must be scanned
+    bool loadIndexFile();
+
+    /// @brief write the persisted catalog index from the sorted list
+    void writeIndexFile();
+
+    /// @brief hash of the configured directory names, stored in the catalog index header
+    /// @return the hash value
+    U32 directoryHash() const;
+
+    /// @brief append an entry to the persisted catalog index
+    /// @param entry entry to append
+    void appendIndexEntry(const DpStateEntry& entry);
 
     /// @brief send the next entry to file downlink
     void sendNextEntry();
 
+    /// @brief copy a data product stored in a segment file to its own file for downlink
+    /// @param entry entry of the data product in the segment
+    /// @param xmitFile file to copy the data product to
+    /// @return true if the copy succeeded
+    bool extractSegmentEntry(const DpStateEntry& entry, const Fw::FileNameString& xmitFile);
+
     /// @brief find the next entry in the tree
-    /// @return pointer if an entry was found, nullptr if no more entries
-    /// @param entry entry to return
-    DpBtreeNode* findNextTreeNode();
+    /// @param entry the highest priority entry, if one was found
+    /// @return true if an entry was found, false if no more entries
+    bool findNextEntry(DpStateEntry& entry);
 
     /// @brief check to see if component successfully initialized
     /// @return bool if it was initialized
@@ -245,10 +319,8 @@ class DpCatalog final : public DpCatalogComponentBase {
     // ----------------------------------
     bool m_initialized;  //!< set when the component has been initialized
 
-    DpBtreeNode* m_dpTree;           //!< The head of the binary tree
-    DpBtreeNode* m_freeListHead;     //!< The head of the free list
-    DpBtreeNode* m_currentNode;      //!< current node for traversing tree
-    DpBtreeNode* m_currentXmitNode;  //!< node being currently transmitted
+    DpTree m_dpTree;                  //!< The catalog sorted for downlink
+    DpStateEntry m_currentXmitEntry;  //!< entry being currently transmitted
 
     FwSizeType m_numDpSlots;  //!< Stores the available number of record slots.
 
@@ -256,9 +328,9 @@ class DpCatalog final : public DpCatalogComponentBase {
     FwSizeType m_numDirectories;                           //!< number of supplied directories
     Fw::String m_fileList[DP_MAX_FILES];                   //!< working array of files/directory
 
-    Fw::FileNameString m_stateFile;      //!< file to store transmit state
-    DpDstateFileEntry* m_stateFileData;  //!< DP state loaded from file
-    FwSizeType m_stateFileEntries;       //!< size of state file data
+    Fw::FileNameString m_stateFile;  //!< file to store transmit state
+    DpStateMap m_stateFileData;      //!< DP state loaded from file
+    Fw::FileNameString m_indexFile;  //!< file to store the catalog index
 
     FwSizeType m_memSize;           //!< size of allocated buffer
     void* m_memPtr;                 //!< stored for shutdown
@@ -268,6 +340,7 @@ class DpCatalog final : public DpCatalogComponentBase {
     bool m_catalogBuilt;                    //!< catalog build is complete (can add DPs at runtime)
     bool m_xmitInProgress;                  //!< set if DP files are in the process of being sent
     Fw::FileNameString m_currXmitFileName;  //!< current file being transmitted
+    Fw::FileNameString m_segXmitFileName;   //!< copy of the segment container being transmitted
     bool m_xmitCmdWait;                     //!< true if waiting for transmission complete to complete xmit command
     U64 m_xmitBytes;                        //!< bytes transmitted for downlink session
     FwOpcodeType m_xmitOpCode;              //!< stored xmit command opcode
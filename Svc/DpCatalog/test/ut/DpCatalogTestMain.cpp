@@ -299,6 +299,21 @@ TEST(NominalManual, BadFileDone) {
     tester.test_BadFileDone();
 }
 
+TEST(NominalManual, SegmentDps) {
+    Svc::DpCatalogTester tester;
+    tester.test_SegmentDps();
+}
+
+TEST(NominalManual, SegmentRecovery) {
+    Svc::DpCatalogTester tester;
+    tester.test_SegmentRecovery();
+}
+
+TEST(NominalManual, IndexedBuild) {
+    Svc::DpCatalogTester tester;
+    tester.test_IndexedBuild();
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
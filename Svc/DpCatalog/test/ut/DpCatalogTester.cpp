@@ -7,7 +7,9 @@
 #include "DpCatalogTester.hpp"
 #include <algorithm>
 #include <cstdlib>
+#include <cstring>
 #include "Fw/Dp/DpContainer.hpp"
+#include "Fw/Dp/DpSegment.hpp"
 #include "Fw/Test/UnitTest.hpp"
 #include "Fw/Types/FileNameString.hpp"
 #include "Fw/Types/MallocAllocator.hpp"
@@ -22,7 +24,9 @@ namespace Svc {
 // ----------------------------------------------------------------------
 
 DpCatalogTester ::DpCatalogTester()
-    : DpCatalogGTestBase("DpCatalogTester", DpCatalogTester::MAX_HISTORY_SIZE), component("DpCatalog") {
+    : DpCatalogGTestBase("DpCatalogTester", DpCatalogTester::MAX_HISTORY_SIZE), component("DpCatalog"),
+      m_sentFileSize(),
+      m_sentFileData() {
     this->initComponents();
     this->connectPorts();
 
@@ -76,24 +80,26 @@ void DpCatalogTester::testTree(DpCatalog::DpStateEntry* input,
     this->component.m_xmitInProgress = true;
 
     // retrieve entries - they should match expected output
-    for (FwIndexType entry = 0; entry < numEntries + 1; entry++) {
-        if (entry == numEntries) {
-            // final request should indicate empty
-            ASSERT_TRUE(this->component.findNextTreeNode() == nullptr);
-        } else if (output[entry].record.get_state() != Fw::DpState::TRANSMITTED) {
-            // Outputs is only composed of the UNTRANSMITTED data products
-            DpCatalog::DpBtreeNode* res = this->component.findNextTreeNode();
-            ASSERT_TRUE(res != nullptr) << "nullptr findNextTreeNode() at " << entry << " out of " << numEntries;
-
-            //  should match expected entry
-            if (res != nullptr) {
-                ASSERT_EQ(res->entry.record, output[entry].record) << "entry mismatch at " << entry;
-            }
-            // Deallocate the "sent" node
-            this->component.deallocateNode(res);
+    for (FwIndexType entry = 0; entry < numEntries; entry++) {
+        // entries that compare equal are the same product, so the catalog holds only one of them
+        if ((entry > 0) && (output[entry] == output[entry - 1])) {
+            continue;
         }
+        DpCatalog::DpStateEntry res;
+        ASSERT_TRUE(this->component.findNextEntry(res)) << "no entry found at " << entry << " out of " << numEntries;
+
+        //  should match expected entry
+        ASSERT_TRUE(res == output[entry]) << "entry mismatch at " << entry;
+        ASSERT_EQ(res.record.get_size(), output[entry].record.get_size()) << "entry mismatch at " << entry;
+
+        // Remove the "sent" entry
+        ASSERT_EQ(this->component.m_dpTree.remove(res), Fw::Success::SUCCESS);
     }
 
+    // final request should indicate empty
+    DpCatalog::DpStateEntry res;
+    ASSERT_FALSE(this->component.findNextEntry(res));
+
     this->component.shutdown();
 }
 
@@ -283,6 +289,83 @@ Fw::String DpCatalogTester::genDP(FwDpIdType id,
     return fileName;
 }
 
+Fw::String DpCatalogTester::genSegment(const DpSet* dpSet,
+                                       FwSizeType numDps,
+                                       U32 sequence,
+                                       const char* dir,
+                                       bool writeFooter) {
+    FW_ASSERT(numDps > 0);
+    Fw::String fileName;
+    fileName.format(DP_SEGMENT_FILENAME_FORMAT, dir, dpSet[0].time.getSeconds(), dpSet[0].time.getUSeconds(),
+                    sequence);
+    COMMENT(fileName.toChar());
+    Os::File segFile;
+    Os::File::Status stat = segFile.open(fileName.toChar(), Os::File::Mode::OPEN_CREATE);
+    if (stat != Os::File::Status::OP_OK) {
+        printf("Error opening file %s: status: %d\n", fileName.toChar(), stat);
+        return "";
+    }
+    // write the containers back to back, recording an index entry for each
+    static constexpr FwSizeType MAX_SEGMENT_DPS = 16;
+    static constexpr FwSizeType MAX_DATA_SIZE = 256;
+    U8 footerData[Fw::DpSegment::getFooterSize(MAX_SEGMENT_DPS)];
+    FW_ASSERT(numDps <= MAX_SEGMENT_DPS, static_cast<FwAssertArgType>(numDps));
+    Fw::ExternalSerializeBuffer footer(footerData, Fw::DpSegment::getFooterSize(numDps));
+    U32 offset = 0;
+    for (FwSizeType dp = 0; dp < numDps; dp++) {
+        U8 packetData[Fw::DpContainer::getPacketSizeForDataSize(MAX_DATA_SIZE)];
+        FW_ASSERT(dpSet[dp].dataSize <= MAX_DATA_SIZE, static_cast<FwAssertArgType>(dpSet[dp].dataSize));
+        Fw::Buffer packetBuffer(packetData, sizeof(packetData));
+        Fw::DpContainer cont(dpSet[dp].id, packetBuffer);
+        cont.setPriority(dpSet[dp].prio);
+        cont.setTimeTag(dpSet[dp].time);
+        cont.setDpState(dpSet[dp].state);
+        cont.setDataSize(dpSet[dp].dataSize);
+        cont.serializeHeader();
+        cont.updateHeaderHash();
+        for (FwSizeType byte = 0; byte < dpSet[dp].dataSize; byte++) {
+            packetData[Fw::DpContainer::DATA_OFFSET + byte] = static_cast<U8>(byte + dp);
+        }
+        cont.updateDataHash();
+        // write the whole packet as DpWriter does
+        FwSizeType size = cont.getPacketSize();
+        stat = segFile.write(packetData, size);
+        if ((stat != Os::File::Status::OP_OK) || (size != cont.getPacketSize())) {
+            printf("Error writing segment file %s: status: %d\n", fileName.toChar(), stat);
+            return "";
+        }
+        Fw::DpSegment::Entry entry;
+        entry.id = dpSet[dp].id;
+        entry.priority = dpSet[dp].prio;
+        entry.timeSeconds = dpSet[dp].time.getSeconds();
+        entry.timeUSeconds = dpSet[dp].time.getUSeconds();
+        entry.state = dpSet[dp].state;
+        entry.offset = offset;
+        entry.size = static_cast<U32>(size);
+        EXPECT_EQ(entry.serializeTo(footer), Fw::FW_SERIALIZE_OK);
+        offset += static_cast<U32>(size);
+    }
+    Fw::DpSegment::Trailer trailer;
+    trailer.sequence = sequence;
+    trailer.timeSeconds = dpSet[0].time.getSeconds();
+    trailer.timeUSeconds = dpSet[0].time.getUSeconds();
+    trailer.entryCount = static_cast<U32>(numDps);
+    EXPECT_EQ(trailer.serializeTo(footer), Fw::FW_SERIALIZE_OK);
+    if (not writeFooter) {
+        segFile.close();
+        return fileName;
+    }
+    FwSizeType size = footer.getSize();
+    stat = segFile.write(footerData, size);
+    if ((stat != Os::File::Status::OP_OK) || (size != footer.getSize())) {
+        printf("Error writing segment file footer %s: status: %d\n", fileName.toChar(), stat);
+        return "";
+    }
+    segFile.close();
+
+    return fileName;
+}
+
 void DpCatalogTester::delDp(FwDpIdType id, const Fw::Time& time, const char* dir) {
     Fw::String fileName;
     fileName.format(DP_FILENAME_FORMAT, dir, id, time.getSeconds(), time.getUSeconds());
@@ -316,6 +399,17 @@ Svc::SendFileResponse DpCatalogTester ::from_fileOut_handler(FwIndexType portNum
                                                              const Fw::StringBase& destFileName,
                                                              U32 offset,
                                                              U32 length) {
+    // Record what the ground would receive before the file goes away
+    const FwSizeType sent = this->fromPortHistory_fileOut->size();
+    if (sent < MAX_SENT_FILES) {
+        this->m_sentFileSize[sent] = 0;
+        (void)Os::FileSystem::getFileSize(sourceFileName.toChar(), this->m_sentFileSize[sent]);
+        Os::File sentFile;
+        FwSizeType size = MAX_SENT_BYTES;
+        if (sentFile.open(sourceFileName.toChar(), Os::File::OPEN_READ) == Os::File::OP_OK) {
+            (void)sentFile.read(this->m_sentFileData[sent], size);
+        }
+    }
     // Tell the DpCatalog that the xmit succeeded
     this->pushFromPortEntry_fileOut(sourceFileName, destFileName, offset, length);
     this->invoke_to_fileDone(0, Svc::SendFileResponse());
@@ -744,4 +838,258 @@ void DpCatalogTester ::test_BadFileDone() {
     this->component.shutdown();
 }
 
+void DpCatalogTester ::test_SegmentDps() {
+    Fw::FileNameString dirs[1];
+    dirs[0] = "./DpTest_Segment";
+    Fw::FileNameString stateFile("./DpTest/dpState.dat");
+    this->makeDpDir(dirs[0].toChar());
+
+    // three products stored in one segment out of priority order, plus one already transmitted
+    static const FwSizeType NUM_DPS = 4;
+    DpSet dpSet[NUM_DPS];
+    const FwDpPriorityType prios[NUM_DPS] = {20, 5, 10, 1};
+    for (FwSizeType dp = 0; dp < NUM_DPS; dp++) {
+        dpSet[dp].id = static_cast<FwDpIdType>(100 + dp);
+        dpSet[dp].prio = prios[dp];
+        dpSet[dp].state = Fw::DpState::UNTRANSMITTED;
+        dpSet[dp].time.set(static_cast<U32>(1000 + dp), 0);
+        dpSet[dp].dataSize = 10 * (dp + 1);
+        dpSet[dp].dir = dirs[0].toChar();
+    }
+    dpSet[3].state = Fw::DpState::TRANSMITTED;
+    const U32 sequence = 7;
+    Fw::String segFileName = this->genSegment(dpSet, NUM_DPS, sequence, dirs[0].toChar());
+    ASSERT_STRNE(segFileName.toChar(), "");
+
+    Fw::MallocAllocator alloc;
+    this->clearHistory();
+    this->component.configure(dirs, 1, stateFile, 100, alloc);
+
+    this->sendCmd_BUILD_CATALOG(0, 10);
+    this->component.doDispatch();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, DpCatalog::OPCODE_BUILD_CATALOG, 10, Fw::CmdResponse::OK);
+    ASSERT_EVENTS_DpFileAdded_SIZE(3);
+    ASSERT_EVENTS_DpFileSkipped_SIZE(1);
+
+    this->sendCmd_START_XMIT_CATALOG(0, 11, Fw::Wait::NO_WAIT, true);
+    while (this->component.m_queue.getMessagesAvailable() > 0) {
+        this->component.doDispatch();
+    }
+
+    // each product is copied out of the segment and sent as its own file, in priority order
+    const FwSizeType order[3] = {1, 2, 0};
+    ASSERT_from_fileOut_SIZE(3);
+    Os::File segFile;
+    ASSERT_EQ(segFile.open(segFileName.toChar(), Os::File::OPEN_READ), Os::File::OP_OK);
+    for (FwSizeType sent = 0; sent < 3; sent++) {
+        const DpSet& dp = dpSet[order[sent]];
+        FwSizeType offset = 0;
+        for (FwSizeType prev = 0; prev < order[sent]; prev++) {
+            offset += Fw::DpContainer::getPacketSizeForDataSize(dpSet[prev].dataSize);
+        }
+        const FwSizeType packetSize = Fw::DpContainer::getPacketSizeForDataSize(dp.dataSize);
+        Fw::String destFileName;
+        destFileName.format(DP_FILENAME_FORMAT, dirs[0].toChar(), dp.id, dp.time.getSeconds(), dp.time.getUSeconds());
+        const auto& request = this->fromPortHistory_fileOut->at(sent);
+        ASSERT_STRNE(request.sourceFileName.toChar(), segFileName.toChar());
+        ASSERT_STREQ(request.destFileName.toChar(), destFileName.toChar());
+        ASSERT_EQ(request.offset, 0U);
+        ASSERT_EQ(request.length, 0U);
+
+        // the ground receives exactly the container's bytes
+        ASSERT_EQ(this->m_sentFileSize[sent], packetSize);
+        U8 expected[MAX_SENT_BYTES];
+        FwSizeType size = packetSize;
+        ASSERT_LE(size, MAX_SENT_BYTES);
+        ASSERT_EQ(segFile.seek(static_cast<FwSignedSizeType>(offset), Os::File::SeekType::ABSOLUTE), Os::File::OP_OK);
+        ASSERT_EQ(segFile.read(expected, size), Os::File::OP_OK);
+        ASSERT_EQ(size, packetSize);
+        ASSERT_EQ(::memcmp(this->m_sentFileData[sent], expected, packetSize), 0);
+
+        // the copy is removed once it is sent
+        ASSERT_FALSE(Os::FileSystem::exists(request.sourceFileName.toChar()));
+    }
+    segFile.close();
+    ASSERT_EVENTS_CatalogXmitCompleted_SIZE(1);
+
+    this->component.shutdown();
+    Os::FileSystem::removeFile(segFileName.toChar());
+}
+
+void DpCatalogTester ::test_SegmentRecovery() {
+    Fw::FileNameString dirs[1];
+    dirs[0] = "./DpTest_SegmentRecovery";
+    Fw::FileNameString stateFile("./DpTest/dpState.dat");
+    this->makeDpDir(dirs[0].toChar());
+
+    // a segment left open by a reset: complete containers, no footer, and part of a container cut off
+    static const FwSizeType NUM_DPS = 3;
+    DpSet dpSet[NUM_DPS];
+    for (FwSizeType dp = 0; dp < NUM_DPS; dp++) {
+        dpSet[dp].id = static_cast<FwDpIdType>(300 + dp);
+        dpSet[dp].prio = static_cast<FwDpPriorityType>(dp);
+        dpSet[dp].state = Fw::DpState::UNTRANSMITTED;
+        dpSet[dp].time.set(static_cast<U32>(3000 + dp), 0);
+        dpSet[dp].dataSize = 20 * (dp + 1);
+        dpSet[dp].dir = dirs[0].toChar();
+    }
+    const U32 sequence = 3;
+    Fw::String segFileName = this->genSegment(dpSet, NUM_DPS, sequence, dirs[0].toChar(), false);
+    ASSERT_STRNE(segFileName.toChar(), "");
+    Os::File segFile;
+    ASSERT_EQ(segFile.open(segFileName.toChar(), Os::File::OPEN_APPEND), Os::File::OP_OK);
+    U8 partial[Fw::DpContainer::MIN_PACKET_SIZE] = {};
+    FwSizeType size = sizeof(partial);
+    ASSERT_EQ(segFile.write(partial, size), Os::File::OP_OK);
+    segFile.close();
+
+    Fw::MallocAllocator alloc;
+    this->clearHistory();
+    this->component.configure(dirs, 1, stateFile, 100, alloc);
+
+    this->sendCmd_BUILD_CATALOG(0, 10);
+    this->component.doDispatch();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, DpCatalog::OPCODE_BUILD_CATALOG, 10, Fw::CmdResponse::OK);
+    ASSERT_EVENTS_SegmentRecovered_SIZE(1);
+    ASSERT_EVENTS_SegmentRecovered(0, segFileName.toChar(), NUM_DPS);
+    ASSERT_EVENTS_DpFileAdded_SIZE(NUM_DPS);
+
+    this->sendCmd_START_XMIT_CATALOG(0, 11, Fw::Wait::NO_WAIT, true);
+    while (this->component.m_queue.getMessagesAvailable() > 0) {
+        this->component.doDispatch();
+    }
+
+    // the recovered products downlink as if the segment had been closed
+    ASSERT_from_fileOut_SIZE(NUM_DPS);
+    for (FwSizeType sent = 0; sent < NUM_DPS; sent++) {
+        const DpSet& dp = dpSet[sent];
+        Fw::String destFileName;
+        destFileName.format(DP_FILENAME_FORMAT, dirs[0].toChar(), dp.id, dp.time.getSeconds(), dp.time.getUSeconds());
+        ASSERT_STREQ(this->fromPortHistory_fileOut->at(sent).destFileName.toChar(), destFileName.toChar());
+        ASSERT_EQ(this->m_sentFileSize[sent], Fw::DpContainer::getPacketSizeForDataSize(dp.dataSize));
+    }
+    ASSERT_EVENTS_CatalogXmitCompleted_SIZE(1);
+
+    this->component.shutdown();
+    Os::FileSystem::removeFile(segFileName.toChar());
+}
+
+void DpCatalogTester ::test_IndexedBuild() {
+    Fw::FileNameString dirs[1];
+    dirs[0] = "./DpTest_Index";
+    Fw::FileNameString stateFile("./DpTest/dpState.dat");
+    Fw::FileNameString indexFile;
+    indexFile.format("%s%s", stateFile.toChar(), DP_CATALOG_INDEX_SUFFIX);
+    this->makeDpDir("./DpTest");
+    this->makeDpDir(dirs[0].toChar());
+
+    static const FwSizeType NUM_DPS = 4;
+    DpSet dpSet[NUM_DPS];
+    for (FwSizeType dp = 0; dp < NUM_DPS; dp++) {
+        dpSet[dp].id = static_cast<FwDpIdType>(200 + dp);
+        dpSet[dp].prio = static_cast<FwDpPriorityType>(NUM_DPS - dp);
+        dpSet[dp].state = Fw::DpState::UNTRANSMITTED;
+        dpSet[dp].time.set(static_cast<U32>(2000 + dp), 0);
+        dpSet[dp].dataSize = 10;
+        dpSet[dp].dir = dirs[0].toChar();
+    }
+    for (FwSizeType dp = 0; dp < NUM_DPS - 1; dp++) {
+        ASSERT_STRNE(this->genDP(dpSet[dp].id, dpSet[dp].prio, dpSet[dp].time, dpSet[dp].dataSize, dpSet[dp].state,
+                                 false, dpSet[dp].dir)
+                         .toChar(),
+                     "");
+    }
+
+    Fw::MallocAllocator alloc;
+    this->clearHistory();
+    this->component.configure(dirs, 1, stateFile, 100, alloc);
+
+    // the first build scans the directory and saves the index
+    this->sendCmd_BUILD_CATALOG(0, 10);
+    this->component.doDispatch();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, DpCatalog::OPCODE_BUILD_CATALOG, 10, Fw::CmdResponse::OK);
+    ASSERT_EVENTS_DpFileAdded_SIZE(NUM_DPS - 1);
+    ASSERT_EVENTS_CatalogIndexLoaded_SIZE(0);
+    ASSERT_TRUE(Os::FileSystem::exists(indexFile.toChar()));
+
+    // a product written without notification isn't seen, since the directory is not scanned again
+    Fw::String lastDp = this->genDP(dpSet[NUM_DPS - 1].id, dpSet[NUM_DPS - 1].prio, dpSet[NUM_DPS - 1].time,
+                                    dpSet[NUM_DPS - 1].dataSize, dpSet[NUM_DPS - 1].state, false, dirs[0].toChar());
+    ASSERT_STRNE(lastDp.toChar(), "");
+    this->clearHistory();
+    this->sendCmd_BUILD_CATALOG(0, 11);
+    this->component.doDispatch();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, DpCatalog::OPCODE_BUILD_CATALOG, 11, Fw::CmdResponse::OK);
+    ASSERT_EVENTS_DpFileAdded_SIZE(NUM_DPS - 1);
+    ASSERT_EVENTS_CatalogIndexLoaded_SIZE(1);
+    ASSERT_EVENTS_CatalogIndexLoaded(0, indexFile.toChar(), NUM_DPS - 1);
+
+    // after a restart, a notification before the build is recorded in the index, once per notification
+    this->component.shutdown();
+    this->component.configure(dirs, 1, stateFile, 100, alloc);
+    this->clearHistory();
+    this->invoke_to_addToCat(0, lastDp, 0, 0);
+    this->component.doDispatch();
+    this->invoke_to_addToCat(0, lastDp, 0, 0);
+    this->component.doDispatch();
+    ASSERT_EVENTS_NotLoaded_SIZE(2);
+    this->sendCmd_BUILD_CATALOG(0, 12);
+    this->component.doDispatch();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, DpCatalog::OPCODE_BUILD_CATALOG, 12, Fw::CmdResponse::OK);
+    ASSERT_EVENTS_CatalogIndexLoaded_SIZE(1);
+    ASSERT_EVENTS_CatalogIndexLoaded(0, indexFile.toChar(), NUM_DPS + 1);
+    ASSERT_EQ(this->component.m_dpTree.getSize(), NUM_DPS);
+
+    // loading the index compacts the superseded record away
+    FwSizeType indexSize = 0;
+    ASSERT_EQ(Os::FileSystem::getFileSize(indexFile.toChar(), indexSize), Os::FileSystem::OP_OK);
+    ASSERT_EQ(indexSize, DpCatalog::INDEX_HEADER_SIZE + NUM_DPS * DpCatalog::INDEX_RECORD_SIZE);
+
+    // all products are sent in priority order
+    this->sendCmd_START_XMIT_CATALOG(0, 13, Fw::Wait::NO_WAIT, false);
+    while (this->component.m_queue.getMessagesAvailable() > 0) {
+        this->component.doDispatch();
+    }
+    ASSERT_from_fileOut_SIZE(NUM_DPS);
+    for (FwSizeType sent = 0; sent < NUM_DPS; sent++) {
+        const DpSet& dp = dpSet[NUM_DPS - 1 - sent];
+        Fw::String fileName;
+        fileName.format(DP_FILENAME_FORMAT, dirs[0].toChar(), dp.id, dp.time.getSeconds(), dp.time.getUSeconds());
+        ASSERT_STREQ(this->fromPortHistory_fileOut->at(sent).sourceFileName.toChar(), fileName.toChar());
+    }
+    ASSERT_EVENTS_CatalogXmitCompleted_SIZE(1);
+
+    // the downlinked products are dropped from the index
+    ASSERT_EQ(Os::FileSystem::getFileSize(indexFile.toChar(), indexSize), Os::FileSystem::OP_OK);
+    ASSERT_EQ(indexSize, DpCatalog::INDEX_HEADER_SIZE);
+
+    // an index built for other directories is not used, even if their number matches
+    Fw::FileNameString otherDirs[1];
+    otherDirs[0] = "./DpTest_IndexOther";
+    this->makeDpDir(otherDirs[0].toChar());
+    this->component.shutdown();
+    this->component.configure(otherDirs, 1, stateFile, 100, alloc);
+    this->clearHistory();
+    this->sendCmd_BUILD_CATALOG(0, 14);
+    this->component.doDispatch();
+    ASSERT_CMD_RESPONSE(0, DpCatalog::OPCODE_BUILD_CATALOG, 14, Fw::CmdResponse::OK);
+    ASSERT_EVENTS_CatalogIndexInvalid_SIZE(1);
+    ASSERT_EVENTS_CatalogIndexLoaded_SIZE(0);
+
+    // clearing the catalog drops the index so the next build scans the directories
+    this->sendCmd_CLEAR_CATALOG(0, 15);
+    this->component.doDispatch();
+    ASSERT_FALSE(Os::FileSystem::exists(indexFile.toChar()));
+
+    this->component.shutdown();
+    for (FwSizeType dp = 0; dp < NUM_DPS; dp++) {
+        this->delDp(dpSet[dp].id, dpSet[dp].time, dpSet[dp].dir);
+    }
+}
+
 }  // namespace Svc
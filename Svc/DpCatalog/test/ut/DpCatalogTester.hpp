@@ -28,6 +28,12 @@ class DpCatalogTester : public DpCatalogGTestBase {
     // Queue depth supplied to the component instance under test
     static const FwSizeType TEST_INSTANCE_QUEUE_DEPTH = 10;
 
+    // Number of files sent on fileOut whose contents are recorded
+    static const FwSizeType MAX_SENT_FILES = 8;
+
+    // Number of bytes recorded from each file sent on fileOut
+    static const FwSizeType MAX_SENT_BYTES = 512;
+
   public:
     // ----------------------------------------------------------------------
     // Construction and destruction
@@ -79,6 +85,15 @@ class DpCatalogTester : public DpCatalogGTestBase {
                      bool hdrHashError,
                      const char* dir);
 
+    //! Generate a segment file holding a set of data products
+    //! \return the segment file name, or an empty string on failure
+    Fw::String genSegment(const DpSet* dpSet,
+                          FwSizeType numDps,
+                          U32 sequence,
+                          const char* dir,
+                          bool writeFooter = true  //!< false to leave the segment as a reset would
+    );
+
     void delDp(FwDpIdType id, const Fw::Time& time, const char* dir);
 
     void makeDpDir(const char* dir);
@@ -127,6 +142,12 @@ class DpCatalogTester : public DpCatalogGTestBase {
     //! The component under test
     DpCatalog component;
 
+    //! Size of each file sent on fileOut when it was sent
+    FwSizeType m_sentFileSize[MAX_SENT_FILES];
+
+    //! Leading bytes of each file sent on fileOut when it was sent
+    U8 m_sentFileData[MAX_SENT_FILES][MAX_SENT_BYTES];
+
   public:
     // ----------------------------------------------------------------------
     // Moved Tests due to private/protected access
@@ -148,6 +169,9 @@ class DpCatalogTester : public DpCatalogGTestBase {
     void test_CompareEntries();
     void test_PingIn();
     void test_BadFileDone();
+    void test_SegmentDps();
+    void test_SegmentRecovery();
+    void test_IndexedBuild();
 };
 
 }  // namespace Svc
@@ -4,9 +4,15 @@
 // \brief  cpp file for DpWriter component implementation class
 // ======================================================================
 
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <new>  // placement new
+
 #include "Svc/DpWriter/DpWriter.hpp"
 #include "Fw/Com/ComPacket.hpp"
 #include "Fw/FPrimeBasicTypes.hpp"
+#include "Fw/Types/Assert.hpp"
 #include "Fw/Types/FileNameString.hpp"
 #include "Fw/Types/Serializable.hpp"
 #include "Os/File.hpp"
@@ -19,12 +25,88 @@ namespace Svc {
 // Construction, initialization, and destruction
 // ----------------------------------------------------------------------
 
-DpWriter::DpWriter(const char* const compName) : DpWriterComponentBase(compName), m_dpFileNamePrefix() {}
+DpWriter::DpWriter(const char* const compName)
+    : DpWriterComponentBase(compName), m_dpFileNamePrefix(), m_fillBatch(&this->m_batches[0]) {
+    static_assert(DP_SEGMENT_MAX_SIZE <= std::numeric_limits<U32>::max(), "segment offsets must fit in U32");
+    static_assert(DP_SEGMENT_MAX_CONTAINERS <= std::numeric_limits<U32>::max(), "segment entry count must fit in U32");
+    static_assert(DP_SEGMENT_BATCH_SIZE > 0, "segment batch size must be positive");
+}
 
 DpWriter::~DpWriter() {}
 
 void DpWriter::configure(const Fw::ConstStringBase& dpFileNamePrefix) {
     this->m_dpFileNamePrefix = dpFileNamePrefix;
+    this->m_mode = FILE_PER_CONTAINER;
+}
+
+void DpWriter::configure(const Fw::ConstStringBase& dpFileNamePrefix,
+                         FwEnumStoreType allocatorId,
+                         Fw::MemAllocator& allocator) {
+    this->m_dpFileNamePrefix = dpFileNamePrefix;
+    this->m_mode = SEGMENTED;
+    if (this->m_segmentMemory != nullptr) {
+        return;
+    }
+    // The index goes first so that it is aligned, followed by the two batches
+    static_assert(alignof(Fw::DpSegment::Entry) <= alignof(std::max_align_t), "allocation must align the index");
+    const FwSizeType indexSize = DP_SEGMENT_MAX_CONTAINERS * sizeof(Fw::DpSegment::Entry);
+    const FwSizeType expectedSize = indexSize + 2 * BATCH_CAPACITY;
+    FwSizeType allocatedSize = expectedSize;
+    bool recoverable = false;  // segment buffers are not recovered
+    this->m_segmentMemory = allocator.allocate(allocatorId, allocatedSize, recoverable);
+    FW_ASSERT(this->m_segmentMemory != nullptr);
+    FW_ASSERT(allocatedSize >= expectedSize, static_cast<FwAssertArgType>(allocatedSize),
+              static_cast<FwAssertArgType>(expectedSize));
+    this->m_allocatorId = allocatorId;
+    this->m_allocator = &allocator;
+
+    U8* const memory = static_cast<U8*>(this->m_segmentMemory);
+    this->m_segmentIndex = reinterpret_cast<Fw::DpSegment::Entry*>(memory);
+    for (FwSizeType i = 0; i < DP_SEGMENT_MAX_CONTAINERS; i++) {
+        (void)new (&this->m_segmentIndex[i]) Fw::DpSegment::Entry();
+    }
+    this->m_batches[0].m_data = &memory[indexSize];
+    this->m_batches[1].m_data = &memory[indexSize + BATCH_CAPACITY];
+}
+
+void DpWriter::cleanup() {
+    FW_ASSERT(not this->m_writerRunning);
+    if ((this->m_allocator != nullptr) and (this->m_segmentMemory != nullptr)) {
+        this->m_allocator->deallocate(this->m_allocatorId, this->m_segmentMemory);
+    }
+    this->m_segmentMemory = nullptr;
+    this->m_segmentIndex = nullptr;
+    this->m_batches[0].m_data = nullptr;
+    this->m_batches[1].m_data = nullptr;
+    this->m_mode = FILE_PER_CONTAINER;
+}
+
+void DpWriter::startSegmentWriter(FwTaskPriorityType priority,
+                                  Os::Task::ParamType stackSize,
+                                  Os::Task::ParamType cpuAffinity) {
+    FW_ASSERT(not this->m_writerRunning);
+    this->m_writerQuit = false;
+    this->m_writerRunning = true;
+    Os::TaskString name("DpSegWriter");
+    Os::Task::Arguments arguments(name, segmentWriterTaskEntry, this, priority, stackSize, cpuAffinity);
+    const Os::Task::Status status = this->m_writerTask.start(arguments);
+    FW_ASSERT(status == Os::Task::OP_OK, status);
+}
+
+void DpWriter::stopSegmentWriter() {
+    // Close the open segment so that its footer reaches the disk
+    if (this->m_segmentOpen) {
+        this->closeSegment();
+    }
+    if (this->m_writerRunning) {
+        {
+            Os::ScopeLock lock(this->m_writerMutex);
+            this->m_writerQuit = true;
+            this->m_batchReady.notify();
+        }
+        (void)this->m_writerTask.join();
+        this->m_writerRunning = false;
+    }
 }
 
 // ----------------------------------------------------------------------
@@ -92,14 +174,21 @@ void DpWriter::bufferSendIn_handler(const FwIndexType portNum, Fw::Buffer& buffe
     if (status == Fw::Success::SUCCESS) {
         container.updateDataHash();
     }
+    // In segmented mode, append the container to the current segment
+    // Containers too large for a segment are written to their own file
+    const bool useSegment =
+        (this->m_mode == SEGMENTED) and (container.getPacketSize() <= static_cast<FwSizeType>(DP_SEGMENT_MAX_SIZE));
+    if ((status == Fw::Success::SUCCESS) and useSegment) {
+        status = this->appendToSegment(container);
+    }
     // Write the file
     FwSizeType fileSize = 0;
-    if (status == Fw::Success::SUCCESS) {
+    if ((status == Fw::Success::SUCCESS) and not useSegment) {
         status = this->writeFile(container, fileName, fileSize);
-    }
-    // Send the DpWritten notification
-    if (status == Fw::Success::SUCCESS) {
-        this->sendNotification(container, fileName, fileSize);
+        // Send the DpWritten notification
+        if (status == Fw::Success::SUCCESS) {
+            this->sendNotification(container, fileName, fileSize);
+        }
     }
     // Deallocate the buffer
     if (buffer.isValid()) {
@@ -115,11 +204,30 @@ void DpWriter::schedIn_handler(const FwIndexType portNum, U32 context) {
     // portNum and context are not used
     (void)portNum;
     (void)context;
+    // Close the current segment when it is old enough; otherwise flush it
+    if (this->m_segmentOpen) {
+        ++this->m_segmentAge;
+        if (this->m_segmentAge >= DP_SEGMENT_MAX_AGE_TICKS) {
+            this->closeSegment();
+        } else if (this->m_fillBatch->m_size > 0) {
+            this->submitBatch();
+        }
+    }
+    // Read the counters updated by the segment writer
+    U64 numBytesWritten = 0;
+    U32 numSuccessfulWrites = 0;
+    U32 numFailedWrites = 0;
+    {
+        Os::ScopeLock lock(this->m_writerMutex);
+        numBytesWritten = this->m_numBytesWritten;
+        numSuccessfulWrites = this->m_numSuccessfulWrites;
+        numFailedWrites = this->m_numFailedWrites;
+    }
     // Write telemetry
     this->tlmWrite_NumBuffersReceived(this->m_numBuffersReceived);
-    this->tlmWrite_NumBytesWritten(this->m_numBytesWritten);
-    this->tlmWrite_NumSuccessfulWrites(this->m_numSuccessfulWrites);
-    this->tlmWrite_NumFailedWrites(this->m_numFailedWrites);
+    this->tlmWrite_NumBytesWritten(numBytesWritten);
+    this->tlmWrite_NumSuccessfulWrites(numSuccessfulWrites);
+    this->tlmWrite_NumFailedWrites(numFailedWrites);
     this->tlmWrite_NumErrors(this->m_numErrors);
 }
 
@@ -195,7 +303,7 @@ Fw::Success::T DpWriter::writeFile(const Fw::DpContainer& container,
         fileStatus = file.write(buffer.getData(), writeSize);
         // If a successful write occurred, then update the number of bytes written
         if (fileStatus == Os::File::OP_OK) {
-            this->m_numBytesWritten += static_cast<U64>(writeSize);
+            this->updateWriteCounts(writeSize, 0, 0);
         }
         if ((fileStatus == Os::File::OP_OK) and (writeSize == static_cast<FwSizeType>(fileSize))) {
             // If the write status is success, and the number of bytes written
@@ -210,9 +318,9 @@ Fw::Success::T DpWriter::writeFile(const Fw::DpContainer& container,
     }
     // Update the count of successful or failed writes
     if (status == Fw::Success::SUCCESS) {
-        this->m_numSuccessfulWrites++;
+        this->updateWriteCounts(0, 1, 0);
     } else {
-        this->m_numFailedWrites++;
+        this->updateWriteCounts(0, 0, 1);
     }
     // Return the status
     return status;
@@ -228,4 +336,193 @@ void DpWriter::sendNotification(const Fw::DpContainer& container,
     }
 }
 
+void DpWriter::updateWriteCounts(FwSizeType bytesWritten, U32 successfulWrites, U32 failedWrites) {
+    // The segment writer task updates the counters concurrently with the component thread
+    Os::ScopeLock lock(this->m_writerMutex);
+    this->m_numBytesWritten += static_cast<U64>(bytesWritten);
+    this->m_numSuccessfulWrites += successfulWrites;
+    this->m_numFailedWrites += failedWrites;
+}
+
+// ----------------------------------------------------------------------
+// Private helper functions for segment writing
+// ----------------------------------------------------------------------
+
+Fw::Success::T DpWriter::appendToSegment(const Fw::DpContainer& container) {
+    const FwSizeType packetSize = container.getPacketSize();
+    // Roll over to a new segment if the container does not fit in the current one
+    if (this->m_segmentOpen) {
+        const bool full = (this->m_segmentTrailer.entryCount >= DP_SEGMENT_MAX_CONTAINERS) or
+                          (this->m_segmentSize + packetSize > DP_SEGMENT_MAX_SIZE);
+        if (full) {
+            this->closeSegment();
+        }
+    }
+    if (not this->m_segmentOpen) {
+        this->openSegment(container);
+    }
+    // Record the container in the segment index
+    const Fw::Time timeTag = container.getTimeTag();
+    Fw::DpSegment::Entry& entry = this->m_segmentIndex[this->m_segmentTrailer.entryCount];
+    entry.id = container.getId();
+    entry.priority = container.getPriority();
+    entry.timeSeconds = timeTag.getSeconds();
+    entry.timeUSeconds = timeTag.getUSeconds();
+    entry.state = container.getState();
+    entry.offset = static_cast<U32>(this->m_segmentSize);
+    entry.size = static_cast<U32>(packetSize);
+    this->m_segmentTrailer.entryCount++;
+    if (entry.priority < this->m_segmentPriority) {
+        this->m_segmentPriority = entry.priority;
+    }
+    // Copy the container into the fill batch, submitting each batch as it fills
+    const U8* data = container.getBuffer().getData();
+    FwSizeType remaining = packetSize;
+    while (remaining > 0) {
+        Batch& batch = *this->m_fillBatch;
+        const FwSizeType space = DP_SEGMENT_BATCH_SIZE - batch.m_size;
+        const FwSizeType copySize = FW_MIN(remaining, space);
+        (void)::memcpy(&batch.m_data[batch.m_size], data, static_cast<size_t>(copySize));
+        batch.m_size += copySize;
+        data += copySize;
+        remaining -= copySize;
+        if (remaining == 0) {
+            batch.m_numContainers++;
+        }
+        if (batch.m_size == DP_SEGMENT_BATCH_SIZE) {
+            this->submitBatch();
+        }
+    }
+    this->m_segmentSize += packetSize;
+    return Fw::Success::SUCCESS;
+}
+
+void DpWriter::openSegment(const Fw::DpContainer& container) {
+    FW_ASSERT(not this->m_segmentOpen);
+    const Fw::Time timeTag = container.getTimeTag();
+    this->m_segmentTrailer.sequence = this->m_segmentSequence++;
+    this->m_segmentTrailer.timeSeconds = timeTag.getSeconds();
+    this->m_segmentTrailer.timeUSeconds = timeTag.getUSeconds();
+    this->m_segmentTrailer.entryCount = 0;
+    this->m_segmentSize = 0;
+    this->m_segmentAge = 0;
+    this->m_segmentPriority = container.getPriority();
+    this->m_segmentOpen = true;
+    Batch& batch = *this->m_fillBatch;
+    FW_ASSERT(batch.m_size == 0, static_cast<FwAssertArgType>(batch.m_size));
+    batch.m_openSegment = true;
+    batch.m_fileName.format(DP_SEGMENT_FILENAME_FORMAT, this->m_dpFileNamePrefix.toChar(),
+                            this->m_segmentTrailer.timeSeconds, this->m_segmentTrailer.timeUSeconds,
+                            this->m_segmentTrailer.sequence);
+}
+
+void DpWriter::closeSegment() {
+    FW_ASSERT(this->m_segmentOpen);
+    Batch& batch = *this->m_fillBatch;
+    // The batch reserves room for the largest footer beyond DP_SEGMENT_BATCH_SIZE
+    Fw::ExternalSerializeBuffer footer(&batch.m_data[batch.m_size], BATCH_CAPACITY - batch.m_size);
+    Fw::SerializeStatus status = Fw::FW_SERIALIZE_OK;
+    for (U32 i = 0; i < this->m_segmentTrailer.entryCount; i++) {
+        status = this->m_segmentIndex[i].serializeTo(footer);
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    }
+    status = this->m_segmentTrailer.serializeTo(footer);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    batch.m_size += footer.getSize();
+    batch.m_closeSegment = true;
+    batch.m_segmentContainers = this->m_segmentTrailer.entryCount;
+    batch.m_priority = this->m_segmentPriority;
+    this->m_segmentOpen = false;
+    this->submitBatch();
+}
+
+void DpWriter::submitBatch() {
+    Batch* const batch = this->m_fillBatch;
+    if (this->m_writerRunning) {
+        // Wait for the writer task to finish the previous batch, then hand this one off
+        Os::ScopeLock lock(this->m_writerMutex);
+        while (this->m_pendingBatch != nullptr) {
+            this->m_batchDone.wait(this->m_writerMutex);
+        }
+        this->m_pendingBatch = batch;
+        this->m_batchReady.notify();
+    } else {
+        this->writeBatch(*batch);
+    }
+    // Start filling the other batch. Batch metadata carries the segment file name forward.
+    Batch* const next = (batch == &this->m_batches[0]) ? &this->m_batches[1] : &this->m_batches[0];
+    next->m_size = 0;
+    next->m_numContainers = 0;
+    next->m_openSegment = false;
+    next->m_closeSegment = false;
+    next->m_fileName = batch->m_fileName;
+    this->m_fillBatch = next;
+}
+
+void DpWriter::writeBatch(Batch& batch) {
+    if (batch.m_openSegment) {
+        const Os::File::Status fileStatus = this->m_segmentFile.open(batch.m_fileName.toChar(), Os::File::OPEN_CREATE);
+        this->m_segmentFileOpen = (fileStatus == Os::File::OP_OK);
+        this->m_segmentFileSize = 0;
+        if (not this->m_segmentFileOpen) {
+            this->log_WARNING_HI_FileOpenError(static_cast<U32>(fileStatus), batch.m_fileName);
+        }
+    }
+    // After an open or write error, the rest of the segment is dropped
+    if (this->m_segmentFileOpen and (batch.m_size > 0)) {
+        FwSizeType writeSize = batch.m_size;
+        const Os::File::Status fileStatus = this->m_segmentFile.write(batch.m_data, writeSize);
+        if (fileStatus == Os::File::OP_OK) {
+            this->m_segmentFileSize += writeSize;
+        }
+        if ((fileStatus != Os::File::OP_OK) or (writeSize != batch.m_size)) {
+            this->log_WARNING_HI_FileWriteError(static_cast<U32>(fileStatus), static_cast<U32>(writeSize),
+                                                static_cast<U32>(batch.m_size), batch.m_fileName);
+            this->m_segmentFile.close();
+            this->m_segmentFileOpen = false;
+        }
+        this->updateWriteCounts((fileStatus == Os::File::OP_OK) ? writeSize : 0, 0, 0);
+    }
+    if (this->m_segmentFileOpen) {
+        this->updateWriteCounts(0, batch.m_numContainers, 0);
+    } else {
+        this->updateWriteCounts(0, 0, batch.m_numContainers);
+    }
+    if (batch.m_closeSegment and this->m_segmentFileOpen) {
+        this->m_segmentFile.close();
+        this->m_segmentFileOpen = false;
+        this->log_ACTIVITY_LO_SegmentWritten(batch.m_segmentContainers, static_cast<U32>(this->m_segmentFileSize),
+                                             batch.m_fileName);
+        if (this->isConnected_dpWrittenOut_OutputPort(0)) {
+            this->dpWrittenOut_out(0, batch.m_fileName, batch.m_priority, this->m_segmentFileSize);
+        }
+    }
+}
+
+void DpWriter::segmentWriterTaskEntry(void* ptr) {
+    FW_ASSERT(ptr != nullptr);
+    DpWriter* const writer = static_cast<DpWriter*>(ptr);
+    writer->segmentWriterLoop();
+}
+
+void DpWriter::segmentWriterLoop() {
+    this->m_writerMutex.lock();
+    while (true) {
+        while ((this->m_pendingBatch == nullptr) and not this->m_writerQuit) {
+            this->m_batchReady.wait(this->m_writerMutex);
+        }
+        if (this->m_pendingBatch == nullptr) {
+            break;
+        }
+        Batch* const batch = this->m_pendingBatch;
+        // Write without holding the lock so the component thread can keep filling the other batch
+        this->m_writerMutex.unlock();
+        this->writeBatch(*batch);
+        this->m_writerMutex.lock();
+        this->m_pendingBatch = nullptr;
+        this->m_batchDone.notify();
+    }
+    this->m_writerMutex.unlock();
+}
+
 }  // end namespace Svc
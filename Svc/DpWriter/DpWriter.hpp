@@ -10,9 +10,15 @@
 #include <config/DpCfg.hpp>
 
 #include "Fw/Dp/DpContainer.hpp"
+#include "Fw/Dp/DpSegment.hpp"
 #include "Fw/Types/FileNameString.hpp"
+#include "Fw/Types/MemAllocator.hpp"
 #include "Fw/Types/String.hpp"
 #include "Fw/Types/SuccessEnumAc.hpp"
+#include "Os/Condition.hpp"
+#include "Os/File.hpp"
+#include "Os/Mutex.hpp"
+#include "Os/Task.hpp"
 #include "Svc/DpWriter/DpWriterComponentAc.hpp"
 
 namespace Svc {
@@ -20,6 +26,17 @@ namespace Svc {
 class DpWriter final : public DpWriterComponentBase {
     friend class DpWriterTester;
 
+  public:
+    // ----------------------------------------------------------------------
+    // Types
+    // ----------------------------------------------------------------------
+
+    //! The way containers are stored on disk
+    enum Mode {
+        FILE_PER_CONTAINER,  //!< Write each container to its own file
+        SEGMENTED            //!< Append containers to rolling segment files
+    };
+
   public:
     // ----------------------------------------------------------------------
     // Construction, initialization, and destruction
@@ -34,10 +51,33 @@ class DpWriter final : public DpWriterComponentBase {
     //!
     ~DpWriter();
 
-    //! Configure writer
+    //! Configure writer in FILE_PER_CONTAINER mode
     void configure(const Fw::ConstStringBase& dpFileNamePrefix  //!< The file name prefix for writing DP files
     );
 
+    //! Configure writer in SEGMENTED mode
+    //! The segment write batches and index are allocated from the allocator on the first call
+    void configure(const Fw::ConstStringBase& dpFileNamePrefix,  //!< The file name prefix for writing DP files
+                   FwEnumStoreType allocatorId,                   //!< The id passed to the allocator
+                   Fw::MemAllocator& allocator                    //!< The allocator for the segment buffers
+    );
+
+    //! Deallocate the segment buffers
+    //! Call this after stopSegmentWriter
+    void cleanup();
+
+    //! Start the segment writer task
+    //! In SEGMENTED mode, write batches are handed to this task. If the task is
+    //! not started, batches are written on the component thread.
+    void startSegmentWriter(FwTaskPriorityType priority = Os::Task::TASK_PRIORITY_DEFAULT,  //!< The task priority
+                            Os::Task::ParamType stackSize = Os::Task::TASK_DEFAULT,        //!< The stack size
+                            Os::Task::ParamType cpuAffinity = Os::Task::TASK_DEFAULT       //!< The CPU affinity
+    );
+
+    //! Close any open segment and stop the segment writer task, if it is running
+    //! Call this after the component thread has exited
+    void stopSegmentWriter();
+
   private:
     // ----------------------------------------------------------------------
     // Handler implementations for user-defined typed input ports
@@ -95,6 +135,61 @@ class DpWriter final : public DpWriterComponentBase {
                           FwSizeType packetSize                //!< The packet size
     );
 
+    //! Update the write counters
+    void updateWriteCounts(FwSizeType bytesWritten,  //!< The number of bytes written
+                           U32 successfulWrites,     //!< The number of successful writes
+                           U32 failedWrites          //!< The number of failed writes
+    );
+
+  private:
+    // ----------------------------------------------------------------------
+    // Private helper functions for segment writing
+    // ----------------------------------------------------------------------
+
+    //! The capacity of a batch: container bytes, plus room for the largest footer
+    static constexpr FwSizeType BATCH_CAPACITY =
+        DP_SEGMENT_BATCH_SIZE + Fw::DpSegment::getFooterSize(DP_SEGMENT_MAX_CONTAINERS);
+
+    //! A batch of segment file bytes
+    struct Batch {
+        //! The batch data: container bytes, followed by the footer when the batch closes the segment
+        //! Points to BATCH_CAPACITY bytes of the segment allocation
+        U8* m_data = nullptr;
+        FwSizeType m_size = 0;               //!< The number of bytes in the batch
+        U32 m_numContainers = 0;             //!< The number of containers that end in the batch
+        bool m_openSegment = false;          //!< Whether to create the segment file before writing
+        bool m_closeSegment = false;         //!< Whether to close the segment file after writing
+        U32 m_segmentContainers = 0;         //!< The number of containers in the segment, valid when closing
+        FwDpPriorityType m_priority = 0;     //!< The segment priority, valid when closing
+        Fw::FileNameString m_fileName;       //!< The segment file name
+    };
+
+    //! Append a container to the current segment
+    //! \return Success or failure
+    Fw::Success::T appendToSegment(const Fw::DpContainer& container  //!< The container
+    );
+
+    //! Start a new segment for a container
+    void openSegment(const Fw::DpContainer& container  //!< The first container in the segment
+    );
+
+    //! Serialize the segment footer into the fill batch and submit it
+    void closeSegment();
+
+    //! Hand the fill batch to the segment writer and start a new fill batch
+    void submitBatch();
+
+    //! Write a batch to the segment file
+    void writeBatch(Batch& batch  //!< The batch
+    );
+
+    //! Entry point of the segment writer task
+    static void segmentWriterTaskEntry(void* ptr  //!< Pointer to the DpWriter
+    );
+
+    //! Loop of the segment writer task
+    void segmentWriterLoop();
+
   private:
     // ----------------------------------------------------------------------
     // Private member variables
@@ -119,6 +214,76 @@ class DpWriter final : public DpWriterComponentBase {
     //! The precise meaning depends on the DP format string
     //! For example, this could be a directory path prefix
     Fw::FileNameString m_dpFileNamePrefix;
+
+    //! The storage mode
+    Mode m_mode = FILE_PER_CONTAINER;
+
+    //! Guards the write counters and the batch handoff
+    Os::Mutex m_writerMutex;
+
+    //! Signaled when a batch is pending or the writer task should quit
+    Os::ConditionVariable m_batchReady;
+
+    //! Signaled when the writer task finishes a batch
+    Os::ConditionVariable m_batchDone;
+
+    //! The write batches
+    Batch m_batches[2];
+
+    //! The batch being filled on the component thread
+    Batch* m_fillBatch;
+
+    //! The batch handed to the writer task, or nullptr if the writer task is idle
+    Batch* m_pendingBatch = nullptr;
+
+    //! The segment writer task
+    Os::Task m_writerTask;
+
+    //! Whether the segment writer task is running
+    bool m_writerRunning = false;
+
+    //! Whether the segment writer task should quit
+    bool m_writerQuit = false;
+
+    //! The open segment file, used only by the segment writer
+    Os::File m_segmentFile;
+
+    //! Whether the segment file is open for writing, used only by the segment writer
+    bool m_segmentFileOpen = false;
+
+    //! The number of bytes written to the segment file, used only by the segment writer
+    FwSizeType m_segmentFileSize = 0;
+
+    //! Whether a segment is being filled
+    bool m_segmentOpen = false;
+
+    //! The number of container bytes in the current segment
+    FwSizeType m_segmentSize = 0;
+
+    //! The number of schedIn ticks since the current segment was opened
+    U32 m_segmentAge = 0;
+
+    //! The highest priority (lowest value) of the containers in the current segment
+    FwDpPriorityType m_segmentPriority = 0;
+
+    //! The next segment sequence number
+    U32 m_segmentSequence = 0;
+
+    //! The trailer of the current segment
+    Fw::DpSegment::Trailer m_segmentTrailer;
+
+    //! The index of the current segment
+    //! Points to DP_SEGMENT_MAX_CONTAINERS entries of the segment allocation
+    Fw::DpSegment::Entry* m_segmentIndex = nullptr;
+
+    //! The memory holding the segment index and write batches, allocated in SEGMENTED mode only
+    void* m_segmentMemory = nullptr;
+
+    //! The allocator id of the segment memory
+    FwEnumStoreType m_allocatorId = 0;
+
+    //! The allocator of the segment memory
+    Fw::MemAllocator* m_allocator = nullptr;
 };
 
 }  // end namespace Svc
@@ -38,6 +38,13 @@ class AbstractState {
     //! The maximum buffer size
     static constexpr FwSizeType MAX_BUFFER_SIZE = Fw::DpContainer::getPacketSizeForDataSize(MAX_DATA_SIZE);
 
+    //! The maximum number of containers in a segment test
+    static constexpr FwSizeType MAX_SEGMENT_CONTAINERS = 4;
+
+    //! The maximum segment file size in a segment test
+    static constexpr FwSizeType MAX_SEGMENT_FILE_SIZE =
+        MAX_SEGMENT_CONTAINERS * MAX_BUFFER_SIZE + Fw::DpSegment::getFooterSize(MAX_SEGMENT_CONTAINERS);
+
   public:
     // ----------------------------------------------------------------------
     // Constructors
@@ -125,6 +132,12 @@ class AbstractState {
     //! Data for write results
     U8 m_writeResultData[MAX_BUFFER_SIZE] = {};
 
+    //! Data for segment write results
+    U8 m_segmentResultData[MAX_SEGMENT_FILE_SIZE] = {};
+
+    //! Expected segment file data
+    U8 m_segmentExpectedData[MAX_SEGMENT_FILE_SIZE] = {};
+
     //! Bit mask for processing out port calls
     Fw::DpCfg::ProcType::SerialType m_procTypes;
 };
@@ -122,6 +122,12 @@ TEST(SchedIn, OK) {
     tester.OK();
 }
 
+TEST(SegmentWrite, OK) {
+    COMMENT("Write several containers to a segment file in segmented mode.");
+    SegmentWrite::Tester tester;
+    tester.OK();
+}
+
 }  // namespace Svc
 
 int main(int argc, char** argv) {
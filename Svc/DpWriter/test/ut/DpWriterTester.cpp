@@ -24,6 +24,7 @@ DpWriterTester ::DpWriterTester()
 }
 
 DpWriterTester ::~DpWriterTester() {
+    this->component.cleanup();
     this->component.deinit();
 }
 
@@ -70,6 +71,18 @@ void DpWriterTester::constructDpFileName(FwDpIdType id, const Fw::Time& timeTag,
                     timeTag.getUSeconds());
 }
 
+void DpWriterTester::constructDpSegmentFileName(U32 sequence, const Fw::Time& timeTag, Fw::StringBase& fileName) {
+    fileName.format(DP_SEGMENT_FILENAME_FORMAT, this->component.m_dpFileNamePrefix.toChar(), timeTag.getSeconds(),
+                    timeTag.getUSeconds(), sequence);
+}
+
+void DpWriterTester::configureSegmented() {
+    const Fw::FileNameString prefix(this->component.m_dpFileNamePrefix);
+    this->component.configure(prefix, 0, this->allocator);
+    ASSERT_EQ(this->component.m_mode, DpWriter::SEGMENTED);
+    ASSERT_NE(this->component.m_segmentIndex, nullptr);
+}
+
 void DpWriterTester::checkProcTypes(const Fw::DpContainer& container) {
     U32 expectedNumProcTypes = 0;
     const Fw::DpCfg::ProcType::SerialType procTypes = container.getProcTypes();
@@ -7,6 +7,7 @@
 #ifndef Svc_DpWriterTester_HPP
 #define Svc_DpWriterTester_HPP
 
+#include "Fw/Types/MallocAllocator.hpp"
 #include "Svc/DpWriter/DpWriter.hpp"
 #include "Svc/DpWriter/DpWriterGTestBase.hpp"
 #include "Svc/DpWriter/test/ut/AbstractState.hpp"
@@ -72,6 +73,15 @@ class DpWriterTester : public DpWriterGTestBase {
                              Fw::StringBase& fileName  //!< The file name (output)
     );
 
+    //! Construct a DP segment file name
+    void constructDpSegmentFileName(U32 sequence,             //!< The segment sequence number (input)
+                                    const Fw::Time& timeTag,  //!< The time tag of the first container (input)
+                                    Fw::StringBase& fileName  //!< The file name (output)
+    );
+
+    //! Configure the component to write segment files
+    void configureSegmented();
+
     //! Check processing types
     void checkProcTypes(const Fw::DpContainer& container  //!< The container
     );
@@ -101,6 +111,9 @@ class DpWriterTester : public DpWriterGTestBase {
     //! The component under test
     DpWriter component;
 
+    //! The allocator for the segment buffers
+    Fw::MallocAllocator allocator;
+
   public:
     // ----------------------------------------------------------------------
     // Accessor methods for protected/private members
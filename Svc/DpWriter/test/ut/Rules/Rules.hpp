@@ -50,6 +50,7 @@ RULES_DEF_RULE(FileOpenStatus, OK)
 RULES_DEF_RULE(FileWriteStatus, Error)
 RULES_DEF_RULE(FileWriteStatus, OK)
 RULES_DEF_RULE(SchedIn, OK)
+RULES_DEF_RULE(SegmentWrite, OK)
 
 }  // namespace Rules
 
@@ -0,0 +1,131 @@
+// ======================================================================
+// \title  SegmentWrite.cpp
+// \brief  SegmentWrite class implementation
+// ======================================================================
+
+#include "Svc/DpWriter/test/ut/Rules/SegmentWrite.hpp"
+#include "Fw/Dp/DpSegment.hpp"
+#include "Os/Stub/test/File.hpp"
+#include "STest/Pick/Pick.hpp"
+#include "Svc/DpWriter/test/ut/Rules/Testers.hpp"
+
+namespace Svc {
+
+// ----------------------------------------------------------------------
+// Rule definitions
+// ----------------------------------------------------------------------
+
+bool TestState ::precondition__SegmentWrite__OK() const {
+    const auto& fileData = Os::Stub::File::Test::StaticData::data;
+    bool result = true;
+    result &= (fileData.openStatus == Os::File::Status::OP_OK);
+    result &= (fileData.writeStatus == Os::File::Status::OP_OK);
+    return result;
+}
+
+void TestState ::action__SegmentWrite__OK() {
+    // Clear the history
+    this->clearHistory();
+    // Capture segment writes in a buffer that holds several containers and a footer
+    auto& fileData = Os::Stub::File::Test::StaticData::data;
+    fileData.writeResult = this->abstractState.m_segmentResultData;
+    fileData.writeResultSize = sizeof(this->abstractState.m_segmentResultData);
+    fileData.pointer = 0;
+    // Switch the component to segmented mode
+    this->configureSegmented();
+    // Send the containers
+    const FwSizeType numContainers = STest::Pick::lowerUpper(1, AbstractState::MAX_SEGMENT_CONTAINERS);
+    Fw::DpSegment::Entry expectedIndex[AbstractState::MAX_SEGMENT_CONTAINERS];
+    FwSizeType segmentSize = 0;
+    FwDpPriorityType segmentPriority = 0;
+    for (FwSizeType i = 0; i < numContainers; i++) {
+        this->abstractState.m_NumBuffersReceived.value++;
+        Fw::Buffer buffer = this->abstractState.getDpBuffer();
+        this->invoke_to_bufferSendIn(0, buffer);
+        this->doDispatch();
+        // The container is batched, so nothing is written or reported yet
+        ASSERT_EVENTS_SIZE(0);
+        ASSERT_from_dpWrittenOut_SIZE(0);
+        ASSERT_from_deallocBufferSendOut_SIZE(i + 1);
+        ASSERT_from_deallocBufferSendOut(i, buffer);
+        ASSERT_EQ(fileData.pointer, 0);
+        // Record the expected segment contents
+        Fw::DpContainer container;
+        container.setBuffer(buffer);
+        ASSERT_EQ(container.deserializeHeader(), Fw::FW_SERIALIZE_OK);
+        Fw::DpSegment::Entry& entry = expectedIndex[i];
+        entry.id = container.getId();
+        entry.priority = container.getPriority();
+        entry.timeSeconds = container.getTimeTag().getSeconds();
+        entry.timeUSeconds = container.getTimeTag().getUSeconds();
+        entry.state = container.getState();
+        entry.offset = static_cast<U32>(segmentSize);
+        entry.size = static_cast<U32>(buffer.getSize());
+        (void)::memcpy(&this->abstractState.m_segmentExpectedData[segmentSize], buffer.getData(),
+                       static_cast<size_t>(buffer.getSize()));
+        segmentSize += buffer.getSize();
+        if ((i == 0) or (entry.priority < segmentPriority)) {
+            segmentPriority = entry.priority;
+        }
+    }
+    // The first schedIn tick flushes the batch to the segment file
+    this->invoke_to_schedIn(0, 0);
+    this->doDispatch();
+    ASSERT_EQ(fileData.pointer, segmentSize);
+    ASSERT_EQ(0, ::memcmp(this->abstractState.m_segmentExpectedData, fileData.writeResult, segmentSize));
+    ASSERT_TLM_NumSuccessfulWrites(0, static_cast<U32>(numContainers));
+    ASSERT_TLM_NumBytesWritten(0, static_cast<U64>(segmentSize));
+    // The segment is closed when it reaches its maximum age
+    for (U32 tick = 1; tick < DP_SEGMENT_MAX_AGE_TICKS; tick++) {
+        this->clearHistory();
+        this->invoke_to_schedIn(0, 0);
+        this->doDispatch();
+    }
+    const FwSizeType fileSize = segmentSize + Fw::DpSegment::getFooterSize(numContainers);
+    ASSERT_EQ(fileData.pointer, fileSize);
+    Fw::FileNameString fileName;
+    this->constructDpSegmentFileName(0, Fw::Time(expectedIndex[0].timeSeconds, expectedIndex[0].timeUSeconds),
+                                     fileName);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_SegmentWritten_SIZE(1);
+    ASSERT_EVENTS_SegmentWritten(0, static_cast<U32>(numContainers), static_cast<U32>(fileSize), fileName.toChar());
+    ASSERT_from_dpWrittenOut_SIZE(1);
+    ASSERT_from_dpWrittenOut(0, fileName, segmentPriority, fileSize);
+    ASSERT_TLM_NumBytesWritten(0, static_cast<U64>(fileSize));
+    // Check the footer
+    const FwSizeType footerSize = Fw::DpSegment::getFooterSize(numContainers);
+    Fw::ExternalSerializeBuffer footer(&fileData.writeResult[segmentSize], footerSize);
+    ASSERT_EQ(footer.setBuffLen(footerSize), Fw::FW_SERIALIZE_OK);
+    for (FwSizeType i = 0; i < numContainers; i++) {
+        Fw::DpSegment::Entry entry;
+        ASSERT_EQ(entry.deserializeFrom(footer), Fw::FW_SERIALIZE_OK);
+        ASSERT_EQ(entry.id, expectedIndex[i].id);
+        ASSERT_EQ(entry.priority, expectedIndex[i].priority);
+        ASSERT_EQ(entry.timeSeconds, expectedIndex[i].timeSeconds);
+        ASSERT_EQ(entry.timeUSeconds, expectedIndex[i].timeUSeconds);
+        ASSERT_EQ(entry.state, expectedIndex[i].state);
+        ASSERT_EQ(entry.offset, expectedIndex[i].offset);
+        ASSERT_EQ(entry.size, expectedIndex[i].size);
+    }
+    Fw::DpSegment::Trailer trailer;
+    ASSERT_EQ(trailer.deserializeFrom(footer), Fw::FW_SERIALIZE_OK);
+    ASSERT_EQ(trailer.sequence, 0);
+    ASSERT_EQ(trailer.timeSeconds, expectedIndex[0].timeSeconds);
+    ASSERT_EQ(trailer.timeUSeconds, expectedIndex[0].timeUSeconds);
+    ASSERT_EQ(trailer.entryCount, numContainers);
+}
+
+namespace SegmentWrite {
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void Tester ::OK() {
+    this->ruleOK.apply(this->testState);
+    this->testState.printEvents();
+}
+
+}  // namespace SegmentWrite
+
+}  // namespace Svc
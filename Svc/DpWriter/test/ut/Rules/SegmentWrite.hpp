@@ -0,0 +1,46 @@
+// ======================================================================
+// \title  SegmentWrite.hpp
+// \brief  SegmentWrite class interface
+// ======================================================================
+
+#ifndef Svc_SegmentWrite_HPP
+#define Svc_SegmentWrite_HPP
+
+#include "Svc/DpWriter/test/ut/Rules/Rules.hpp"
+#include "Svc/DpWriter/test/ut/TestState/TestState.hpp"
+
+namespace Svc {
+
+namespace SegmentWrite {
+
+class Tester {
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    //! OK
+    void OK();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Rules
+    // ----------------------------------------------------------------------
+
+    //! Rule SegmentWrite::OK
+    Rules::SegmentWrite::OK ruleOK;
+
+  public:
+    // ----------------------------------------------------------------------
+    // Public member variables
+    // ----------------------------------------------------------------------
+
+    //! Test state
+    TestState testState;
+};
+
+}  // namespace SegmentWrite
+
+}  // namespace Svc
+
+#endif
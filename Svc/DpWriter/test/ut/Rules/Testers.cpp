@@ -23,6 +23,8 @@ FileWriteStatus::Tester fileWriteStatus;
 
 SchedIn::Tester schedIn;
 
+SegmentWrite::Tester segmentWrite;
+
 }  // namespace Testers
 
 }  // namespace Svc
@@ -17,6 +17,7 @@
 #include "Svc/DpWriter/test/ut/Rules/FileOpenStatus.hpp"
 #include "Svc/DpWriter/test/ut/Rules/FileWriteStatus.hpp"
 #include "Svc/DpWriter/test/ut/Rules/SchedIn.hpp"
+#include "Svc/DpWriter/test/ut/Rules/SegmentWrite.hpp"
 
 namespace Svc {
 
@@ -32,6 +33,8 @@ extern FileWriteStatus::Tester fileWriteStatus;
 
 extern SchedIn::Tester schedIn;
 
+extern SegmentWrite::Tester segmentWrite;
+
 }  // namespace Testers
 
 }  // namespace Svc
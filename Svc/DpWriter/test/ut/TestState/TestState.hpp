@@ -40,6 +40,7 @@ class TestState : public DpWriterTester {
     TEST_STATE_DEF_RULE(FileWriteStatus, Error)
     TEST_STATE_DEF_RULE(FileWriteStatus, OK)
     TEST_STATE_DEF_RULE(SchedIn, OK)
+    TEST_STATE_DEF_RULE(SegmentWrite, OK)
 };
 
 }  // namespace Svc
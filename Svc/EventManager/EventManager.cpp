@@ -9,16 +9,35 @@
 
 #include <Fw/Types/Assert.hpp>
 #include <Os/File.hpp>
+#include <Os/Task.hpp>
 #include <Svc/EventManager/EventManager.hpp>
-#include <cstring>
+#include <limits>
 
 namespace Svc {
 static_assert(std::numeric_limits<FwSizeType>::max() >= TELEM_ID_FILTER_SIZE,
               "TELEM_ID_FILTER_SIZE must fit within range of FwSizeType");
+static_assert(TELEM_ID_FILTER_SIZE > 0, "TELEM_ID_FILTER_SIZE must be positive");
+static_assert(EVENT_MANAGER_THROTTLE_IDS > 0, "EVENT_MANAGER_THROTTLE_IDS must be positive");
+static_assert(EVENT_MANAGER_THROTTLE_COUNT_DEFAULT <= MAX_TOKEN_BUCKET_TOKENS,
+              "EVENT_MANAGER_THROTTLE_COUNT_DEFAULT must not exceed MAX_TOKEN_BUCKET_TOKENS");
+static_assert(EVENT_MANAGER_THROTTLE_REPORT_TICKS != 1,
+              "EVENT_MANAGER_THROTTLE_REPORT_TICKS of 1 reports every other tick; use 0 to report every tick");
+static_assert((EVENT_MANAGER_THROTTLE_COUNT_DEFAULT == 0) || (EVENT_MANAGER_THROTTLE_INTERVAL_DEFAULT > 0),
+              "EVENT_MANAGER_THROTTLE_INTERVAL_DEFAULT must be positive when throttling");
 typedef EventManager_Enabled Enabled;
 typedef EventManager_FilterSeverity FilterSeverity;
 
-EventManager::EventManager(const char* name) : EventManagerComponentBase(name) {
+EventManager::EventManager(const char* name)
+    : EventManagerComponentBase(name),
+      m_numFilteredIDs(0),
+      m_filterSequence(0),
+      m_numThrottled(0),
+      m_throttleEpoch(0),
+      m_throttleCount(EVENT_MANAGER_THROTTLE_COUNT_DEFAULT),
+      m_throttleInterval(EVENT_MANAGER_THROTTLE_INTERVAL_DEFAULT),
+      m_runTicks(0),
+      m_reportLimiter(EVENT_MANAGER_THROTTLE_REPORT_TICKS, 0),
+      m_packEvents(EVENT_MANAGER_PACK_EVENTS_DEFAULT) {
     // set filter defaults
     this->m_filterState[FilterSeverity::WARNING_HI].enabled =
         FILTER_WARNING_HI_DEFAULT ? Enabled::ENABLED : Enabled::DISABLED;
@@ -33,7 +52,10 @@ EventManager::EventManager(const char* name) : EventManagerComponentBase(name) {
     this->m_filterState[FilterSeverity::DIAGNOSTIC].enabled =
         FILTER_DIAGNOSTIC_DEFAULT ? Enabled::ENABLED : Enabled::DISABLED;
 
-    memset(m_filteredIDs, 0, sizeof(m_filteredIDs));
+    // clear ID filter
+    for (FwSizeType slot = 0; slot < FILTER_SLOTS; slot++) {
+        this->m_filteredIDs[slot].store(0);
+    }
 }
 
 EventManager::~EventManager() {}
@@ -84,11 +106,9 @@ void EventManager::LogRecv_handler(FwIndexType portNum,
             return;
     }
 
-    // check ID filters
-    for (FwSizeType entry = 0; entry < TELEM_ID_FILTER_SIZE; entry++) {
-        if ((m_filteredIDs[entry] == id) && (severity != Fw::LogSeverity::FATAL)) {
-            return;
-        }
+    // check ID filter. FATAL events are never filtered
+    if ((severity != Fw::LogSeverity::FATAL) && this->isFiltered(id)) {
+        return;
     }
 
     // send event to the logger thread
@@ -106,16 +126,29 @@ void EventManager::loqQueue_internalInterfaceHandler(FwEventIdType id,
                                                      const Fw::Time& timeTag,
                                                      const Fw::LogSeverity& severity,
                                                      const Fw::LogBuffer& args) {
-    // Serialize event
+    // check throttle for the ID. FATAL events are never throttled
+    if ((this->m_throttleCount > 0) && (severity != Fw::LogSeverity::FATAL) && !this->checkThrottle(id)) {
+        return;
+    }
+
+    // Serialize event after any events already packed
     this->m_logPacket.setId(id);
     this->m_logPacket.setTimeTag(timeTag);
     this->m_logPacket.setLogBuffer(args);
-    this->m_comBuffer.resetSer();
+    const FwSizeType packedSize = this->m_comBuffer.getSize();
     Fw::SerializeStatus stat = this->m_logPacket.serializeTo(this->m_comBuffer);
+    if ((stat != Fw::FW_SERIALIZE_OK) && (packedSize > 0)) {
+        // event does not fit behind the packed events, so drop the partial copy and send it in the next packet
+        stat = this->m_comBuffer.setBuffLen(packedSize);
+        FW_ASSERT(Fw::FW_SERIALIZE_OK == stat, static_cast<FwAssertArgType>(stat));
+        this->sendEvents();
+        stat = this->m_logPacket.serializeTo(this->m_comBuffer);
+    }
     FW_ASSERT(Fw::FW_SERIALIZE_OK == stat, static_cast<FwAssertArgType>(stat));
 
-    if (this->isConnected_PktSend_OutputPort(0)) {
-        this->PktSend_out(0, this->m_comBuffer, 0);
+    // packed events wait for a full packet or the next run tick, except a FATAL which is sent right away
+    if (!this->m_packEvents || (Fw::LogSeverity::FATAL == severity.e)) {
+        this->sendEvents();
     }
 }
 
@@ -132,40 +165,38 @@ void EventManager::SET_ID_FILTER_cmdHandler(FwOpcodeType opCode,  //!< The opcod
                                             FwEventIdType ID,
                                             Enabled idEnabled  //!< ID filter state
 ) {
+    // zero is reserved for empty filter slots
+    if (ID == 0) {
+        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::VALIDATION_ERROR);
+        return;
+    }
+
+    // search table for existing entry, ending at the empty slot where it would be added
+    FwSizeType slot = 0;
+    const bool found = this->findFilterSlot(ID, slot);
+
     if (Enabled::ENABLED == idEnabled.e) {  // add ID
-        // search list for existing entry
-        for (FwSizeType entry = 0; entry < TELEM_ID_FILTER_SIZE; entry++) {
-            if (this->m_filteredIDs[entry] == ID) {
-                this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
-                this->log_ACTIVITY_HI_ID_FILTER_ENABLED(ID);
-                return;
-            }
-        }
-        // if not already a match, search for an open slot
-        for (FwSizeType entry = 0; entry < TELEM_ID_FILTER_SIZE; entry++) {
-            if (this->m_filteredIDs[entry] == 0) {
-                this->m_filteredIDs[entry] = ID;
-                this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
-                this->log_ACTIVITY_HI_ID_FILTER_ENABLED(ID);
+        if (!found) {
+            // if there is no more room, send an error event
+            if (this->m_numFilteredIDs >= TELEM_ID_FILTER_SIZE) {
+                this->log_WARNING_LO_ID_FILTER_LIST_FULL(ID);
+                this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
                 return;
             }
+            this->m_filteredIDs[slot].store(ID, std::memory_order_release);
+            this->m_numFilteredIDs++;
         }
-        // if an empty slot was not found, send an error event
-        this->log_WARNING_LO_ID_FILTER_LIST_FULL(ID);
-        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
+        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+        this->log_ACTIVITY_HI_ID_FILTER_ENABLED(ID);
     } else {  // remove ID
-        // search list for existing entry
-        for (FwSizeType entry = 0; entry < TELEM_ID_FILTER_SIZE; entry++) {
-            if (this->m_filteredIDs[entry] == ID) {
-                this->m_filteredIDs[entry] = 0;  // zero entry
-                this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
-                this->log_ACTIVITY_HI_ID_FILTER_REMOVED(ID);
-                return;
-            }
+        if (!found) {
+            this->log_WARNING_LO_ID_FILTER_NOT_FOUND(ID);
+            this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
+            return;
         }
-        // if it gets here, wasn't found
-        this->log_WARNING_LO_ID_FILTER_NOT_FOUND(ID);
-        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
+        this->releaseFilterSlot(slot);
+        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+        this->log_ACTIVITY_HI_ID_FILTER_REMOVED(ID);
     }
 }
 
@@ -180,18 +211,186 @@ void EventManager::DUMP_FILTER_STATE_cmdHandler(FwOpcodeType opCode,  //!< The o
     }
 
     // iterate through ID filter
-    for (FwSizeType entry = 0; entry < TELEM_ID_FILTER_SIZE; entry++) {
-        if (this->m_filteredIDs[entry] != 0) {
-            this->log_ACTIVITY_HI_ID_FILTER_ENABLED(this->m_filteredIDs[entry]);
+    for (FwSizeType slot = 0; slot < FILTER_SLOTS; slot++) {
+        const FwEventIdType id = this->m_filteredIDs[slot].load();
+        if (id != 0) {
+            this->log_ACTIVITY_HI_ID_FILTER_ENABLED(id);
         }
     }
 
     this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
 }
 
+void EventManager::SET_EVENT_THROTTLE_cmdHandler(FwOpcodeType opCode, U32 cmdSeq, U32 count, U32 interval) {
+    // a token bucket holds a limited number of tokens, and must be replenished at some interval
+    if ((count > MAX_TOKEN_BUCKET_TOKENS) || ((count > 0) && (interval == 0))) {
+        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::VALIDATION_ERROR);
+        return;
+    }
+    this->m_throttleCount = count;
+    this->m_throttleInterval = interval;
+    // forget the throttled IDs so each starts again under the new settings
+    for (FwSizeType slot = 0; slot < THROTTLE_SLOTS; slot++) {
+        this->m_throttle[slot].id = 0;
+    }
+    this->m_numThrottled = 0;
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+}
+
+void EventManager::SET_EVENT_PACKING_cmdHandler(FwOpcodeType opCode, U32 cmdSeq, Enabled packEvents) {
+    this->m_packEvents = (Enabled::ENABLED == packEvents.e);
+    // no events are held once packing is disabled
+    if (!this->m_packEvents) {
+        this->sendEvents();
+    }
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+}
+
 void EventManager::pingIn_handler(const FwIndexType portNum, U32 key) {
     // return key
     this->pingOut_out(0, key);
 }
 
+void EventManager::run_handler(const FwIndexType portNum, U32 context) {
+    this->m_runTicks++;
+    // events wait at most one tick to be packed
+    this->sendEvents();
+    if (this->m_reportLimiter.trigger()) {
+        this->reportThrottled();
+    }
+}
+
+bool EventManager::findFilterSlot(FwEventIdType id, FwSizeType& slot) const {
+    // The table is never more than half full, so an empty slot always ends the probe
+    return FilterIndex::find(
+        id, slot, [this](FwSizeType probe) { return this->m_filteredIDs[probe].load(std::memory_order_acquire) == 0; },
+        [this, id](FwSizeType probe) { return this->m_filteredIDs[probe].load(std::memory_order_acquire) == id; });
+}
+
+bool EventManager::isFiltered(FwEventIdType id) const {
+    // A removal moves an entry back past a lookup that has already probed its new slot, so a miss is only trusted
+    // when no removal overlapped the lookup. An ID found is always filtered.
+    U32 attempts = 0;
+    while (true) {
+        const U32 sequence = this->m_filterSequence.load(std::memory_order_acquire);
+        FwSizeType slot = 0;
+        if (this->findFilterSlot(id, slot)) {
+            return true;
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (((sequence & 1U) == 0) && (this->m_filterSequence.load(std::memory_order_relaxed) == sequence)) {
+            return false;
+        }
+        // The removal only moves a few IDs, so a short spin usually suffices. Sleeping after that lets a preempted
+        // component thread finish.
+        static const U32 SPIN_ATTEMPTS = 100;
+        if (attempts < SPIN_ATTEMPTS) {
+            attempts++;
+        } else {
+            (void)Os::Task::delay(Fw::TimeInterval(0, 1));
+        }
+    }
+}
+
+void EventManager::releaseFilterSlot(FwSizeType slot) {
+    // Close the gap by moving back later entries of the probe run, so lookups still stop at the first empty slot.
+    // A lookup running alongside can miss a moved entry, so the sequence lock makes it look again.
+    const U32 sequence = this->m_filterSequence.load(std::memory_order_relaxed);
+    this->m_filterSequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::atomic<FwEventIdType>* ids = this->m_filteredIDs;
+    const FwSizeType hole = FilterIndex::remove(
+        slot, [ids](FwSizeType probe) { return ids[probe].load(std::memory_order_relaxed) == 0; },
+        [ids](FwSizeType probe) { return ids[probe].load(std::memory_order_relaxed); },
+        [ids](FwSizeType from, FwSizeType to) {
+            ids[to].store(ids[from].load(std::memory_order_relaxed), std::memory_order_release);
+        });
+    this->m_filteredIDs[hole].store(0, std::memory_order_release);
+    this->m_filterSequence.store(sequence + 2, std::memory_order_release);
+    FW_ASSERT(this->m_numFilteredIDs > 0);
+    this->m_numFilteredIDs--;
+}
+
+FwSizeType EventManager::findThrottleSlot(FwEventIdType id) const {
+    // The table is never more than half full, so an empty slot always ends the probe
+    FwSizeType slot = 0;
+    (void)ThrottleIndex::find(
+        id, slot, [this](FwSizeType probe) { return this->m_throttle[probe].id == 0; },
+        [this, id](FwSizeType probe) { return this->m_throttle[probe].id == id; });
+    return slot;
+}
+
+Fw::Time EventManager::throttleTime() const {
+    // Utils::TokenBucket counts its interval in microseconds, so each run tick stands for one microsecond
+    return Fw::Time(TimeBase::TB_NONE, static_cast<U32>(this->m_runTicks / 1000000),
+                    static_cast<U32>(this->m_runTicks % 1000000));
+}
+
+bool EventManager::checkThrottle(FwEventIdType id) {
+    // Buckets are timed by run ticks rather than the event time tags, which come from each sender's clock and may
+    // jump or go backwards
+    const Fw::Time now = this->throttleTime();
+    ThrottleEntry& entry = this->m_throttle[this->findThrottleSlot(id)];
+    if (entry.id == 0) {
+        // once the table is full, new IDs pass until quiet IDs are released
+        if (this->m_numThrottled >= EVENT_MANAGER_THROTTLE_IDS) {
+            return true;
+        }
+        entry.id = id;
+        entry.dropped = 0;
+        entry.bucket = Utils::TokenBucket(this->m_throttleInterval, this->m_throttleCount, this->m_throttleCount,
+                                          this->m_throttleCount, now);
+        this->m_numThrottled++;
+    }
+    entry.epoch = this->m_throttleEpoch;
+    if (entry.bucket.trigger(now)) {
+        return true;
+    }
+    if (entry.dropped < std::numeric_limits<U32>::max()) {
+        entry.dropped++;
+    }
+    return false;
+}
+
+void EventManager::releaseThrottleSlot(FwSizeType slot) {
+    // Close the gap by moving back later entries of the probe run, so lookups still stop at the first empty slot
+    ThrottleEntry* entries = this->m_throttle;
+    const FwSizeType hole = ThrottleIndex::remove(
+        slot, [entries](FwSizeType probe) { return entries[probe].id == 0; },
+        [entries](FwSizeType probe) { return entries[probe].id; },
+        [entries](FwSizeType from, FwSizeType to) { entries[to] = entries[from]; });
+    this->m_throttle[hole].id = 0;
+    FW_ASSERT(this->m_numThrottled > 0);
+    this->m_numThrottled--;
+}
+
+void EventManager::reportThrottled() {
+    FwSizeType slot = 0;
+    while (slot < THROTTLE_SLOTS) {
+        ThrottleEntry& entry = this->m_throttle[slot];
+        if (entry.id == 0) {
+            slot++;
+            continue;
+        }
+        if (entry.dropped > 0) {
+            this->log_WARNING_LO_ID_THROTTLED(entry.id, entry.dropped);
+            entry.dropped = 0;
+        }
+        if (entry.epoch == this->m_throttleEpoch) {
+            slot++;
+        } else {
+            // ID sent no events since the last report. Another entry may move into the slot, so check it again.
+            this->releaseThrottleSlot(slot);
+        }
+    }
+    this->m_throttleEpoch++;
+}
+
+void EventManager::sendEvents() {
+    if ((this->m_comBuffer.getSize() > 0) && this->isConnected_PktSend_OutputPort(0)) {
+        this->PktSend_out(0, this->m_comBuffer, 0);
+    }
+    this->m_comBuffer.resetSer();
+}
+
 }  // namespace Svc
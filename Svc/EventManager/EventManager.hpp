@@ -10,6 +10,10 @@
 
 #include <Fw/Log/LogPacket.hpp>
 #include <Svc/EventManager/EventManagerComponentAc.hpp>
+#include <Utils/RateLimiter.hpp>
+#include <Utils/TokenBucket.hpp>
+#include <Utils/Types/HashIndex.hpp>
+#include <atomic>
 #include <config/EventManagerCfg.hpp>
 
 namespace Svc {
@@ -46,12 +50,58 @@ class EventManager final : public EventManagerComponentBase {
                                       U32 cmdSeq            //!< The command sequence number
     );
 
+    void SET_EVENT_THROTTLE_cmdHandler(FwOpcodeType opCode,  //!< The opcode
+                                       U32 cmdSeq,           //!< The command sequence number
+                                       U32 count,            //!< Events allowed per ID each interval
+                                       U32 interval          //!< Throttle interval in calls of the run port
+    );
+
+    void SET_EVENT_PACKING_cmdHandler(FwOpcodeType opCode,             //!< The opcode
+                                      U32 cmdSeq,                      //!< The command sequence number
+                                      EventManager_Enabled packEvents  //!< Event packing state
+    );
+
     //! Handler implementation for pingIn
     //!
     void pingIn_handler(const FwIndexType portNum, /*!< The port number*/
                         U32 key                    /*!< Value to return to pinger*/
     );
 
+    //! Handler implementation for run
+    //!
+    void run_handler(const FwIndexType portNum, /*!< The port number*/
+                     U32 context                /*!< The call order*/
+    );
+
+    //! Find the ID filter slot of an ID, or the empty slot ending its probe. Safe to call from any thread.
+    //! \return true if the ID is in the ID filter
+    bool findFilterSlot(FwEventIdType id, FwSizeType& slot) const;
+
+    //! Check whether an ID is in the ID filter. Safe to call from any thread.
+    bool isFiltered(FwEventIdType id) const;
+
+    //! Remove the ID filter entry in a slot
+    void releaseFilterSlot(FwSizeType slot);
+
+    //! Find the throttle slot of an ID, or the empty slot ending its probe
+    FwSizeType findThrottleSlot(FwEventIdType id) const;
+
+    //! Check an event against the throttle for its ID
+    //! \return true if the event may be sent
+    bool checkThrottle(FwEventIdType id);
+
+    //! Time of the throttle token buckets, counting one microsecond per run tick
+    Fw::Time throttleTime() const;
+
+    //! Remove the throttle entry in a slot
+    void releaseThrottleSlot(FwSizeType slot);
+
+    //! Report IDs that dropped events and release IDs that went quiet
+    void reportThrottled();
+
+    //! Send the events held in m_comBuffer
+    void sendEvents();
+
     // Filter state
     struct t_filterState {
         EventManager_Enabled enabled;  //<! filter is enabled
@@ -61,9 +111,43 @@ class EventManager final : public EventManagerComponentBase {
     Fw::LogPacket m_logPacket;  //!< packet buffer for assembling log packets
     Fw::ComBuffer m_comBuffer;  //!< com buffer for sending event buffers
 
-    // array of filtered event IDs.
-    // value of 0 means no entry
-    FwEventIdType m_filteredIDs[TELEM_ID_FILTER_SIZE];
+    //! Index of the ID filter table, sized to twice the filter size
+    using FilterIndex = Types::HashIndex<Types::hashIndexBits(2 * TELEM_ID_FILTER_SIZE)>;
+    //! Number of slots in the ID filter table
+    static constexpr FwSizeType FILTER_SLOTS = FilterIndex::SLOTS;
+
+    //! Open-addressing (linear probing) hash set of filtered event IDs. A value of 0 means no entry. The table is
+    //! never more than half full, so a lookup stops at the first empty slot. LogRecv reads it without locking;
+    //! entries are only added and removed on the component thread.
+    std::atomic<FwEventIdType> m_filteredIDs[FILTER_SLOTS];
+    FwSizeType m_numFilteredIDs;  //!< number of IDs in m_filteredIDs
+    //! Sequence lock of m_filteredIDs. Odd while a removal moves entries, so lookups that overlap it are repeated
+    std::atomic<U32> m_filterSequence;
+
+    //! Index of the throttle table, sized to twice the number of throttled IDs
+    using ThrottleIndex = Types::HashIndex<Types::hashIndexBits(2 * EVENT_MANAGER_THROTTLE_IDS)>;
+    //! Number of slots in the throttle table
+    static constexpr FwSizeType THROTTLE_SLOTS = ThrottleIndex::SLOTS;
+
+    //! Throttle state of one event ID
+    struct ThrottleEntry {
+        ThrottleEntry() : id(0), epoch(0), dropped(0), bucket(0, 0) {}
+        FwEventIdType id;           //!< event ID, 0 means no entry
+        U32 epoch;                  //!< report epoch in which the ID last sent an event
+        U32 dropped;                //!< events dropped since the last report
+        Utils::TokenBucket bucket;  //!< tokens for sending events
+    };
+
+    //! Open-addressing (linear probing) hash table of throttled event IDs, used on the component thread only
+    ThrottleEntry m_throttle[THROTTLE_SLOTS];
+    FwSizeType m_numThrottled;           //!< number of IDs in m_throttle
+    U32 m_throttleEpoch;                 //!< current report epoch
+    U32 m_throttleCount;                 //!< events allowed per ID each interval. 0 disables throttling
+    U32 m_throttleInterval;              //!< throttle interval in run ticks
+    U64 m_runTicks;                      //!< calls of the run port, the monotonic clock of the throttle
+    Utils::RateLimiter m_reportLimiter;  //!< limits throttle reports to one per EVENT_MANAGER_THROTTLE_REPORT_TICKS
+
+    bool m_packEvents;  //!< pack events back to back into m_comBuffer until it is full or the next run tick
 };
 
 }  // namespace Svc
@@ -22,6 +22,7 @@ void connectPorts(Svc::EventManager& impl, Svc::EventManagerTester& tester) {
     impl.set_FatalAnnounce_OutputPort(0, tester.get_from_FatalAnnounce(0));
 
     tester.connect_to_LogRecv(0, impl.get_LogRecv_InputPort(0));
+    tester.connect_to_run(0, impl.get_run_InputPort(0));
 
     impl.set_Log_OutputPort(0, tester.get_from_Log(0));
     impl.set_LogText_OutputPort(0, tester.get_from_LogText(0));
@@ -137,6 +138,40 @@ TEST(EventManagerTest, FatalTesting) {
     tester.runEventFatal();
 }
 
+TEST(EventManagerTest, ThrottleTest) {
+    TEST_CASE(100.1.4, "Throttle events by ID");
+
+    Svc::EventManager impl("EventManager");
+
+    impl.init(10, 0);
+
+    Svc::EventManagerTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl, tester);
+
+    tester.runThrottle();
+}
+
+TEST(EventManagerTest, PackingTest) {
+    TEST_CASE(100.1.5, "Pack events into packets");
+
+    Svc::EventManager impl("EventManager");
+
+    impl.init(10, 0);
+
+    Svc::EventManagerTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl, tester);
+
+    tester.runPacking();
+}
+
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -23,6 +23,7 @@ EventManagerTester::EventManagerTester(Svc::EventManager& inst)
     : Svc::EventManagerGTestBase("testerbase", 100),
       m_impl(inst),
       m_receivedPacket(false),
+      m_packetCount(0),
       m_receivedFatalEvent(false) {}
 
 EventManagerTester::~EventManagerTester() {
@@ -35,6 +36,7 @@ void EventManagerTester::from_PktSend_handler(const FwIndexType portNum,  //!< T
 ) {
     this->m_sentPacket = data;
     this->m_receivedPacket = true;
+    this->m_packetCount++;
 }
 
 void EventManagerTester::from_FatalAnnounce_handler(const FwIndexType portNum,  //!< The port number
@@ -452,6 +454,196 @@ void EventManagerTester::runEventFatal() {
     this->sendCmd_SET_EVENT_FILTER(0, cmdSeq, FilterSeverity::DIAGNOSTIC, Enabled::ENABLED);
 }
 
+void EventManagerTester::runThrottle() {
+    U32 cmdSeq = 21;
+
+    // reject settings a token bucket cannot hold
+    this->clearHistory();
+    this->sendCmd_SET_EVENT_THROTTLE(0, cmdSeq, MAX_TOKEN_BUCKET_TOKENS + 1, 1000000);
+    this->m_impl.doDispatch();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, EventManager::OPCODE_SET_EVENT_THROTTLE, cmdSeq, Fw::CmdResponse::VALIDATION_ERROR);
+    this->clearHistory();
+    this->sendCmd_SET_EVENT_THROTTLE(0, cmdSeq, 2, 0);
+    this->m_impl.doDispatch();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, EventManager::OPCODE_SET_EVENT_THROTTLE, cmdSeq, Fw::CmdResponse::VALIDATION_ERROR);
+
+    // allow two events per ID every 100 run ticks
+    const U32 INTERVAL_TICKS = 100;
+    this->clearHistory();
+    this->sendCmd_SET_EVENT_THROTTLE(0, cmdSeq, 2, INTERVAL_TICKS);
+    this->m_impl.doDispatch();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, EventManager::OPCODE_SET_EVENT_THROTTLE, cmdSeq, Fw::CmdResponse::OK);
+
+    Fw::Time timeTag(TimeBase::TB_NONE, 1, 0);
+    this->m_packetCount = 0;
+    for (U32 event = 0; event < 5; event++) {
+        this->sendEvent(50, Fw::LogSeverity::WARNING_HI, timeTag, event);
+    }
+    ASSERT_EQ(2u, this->m_packetCount);
+
+    // other IDs have their own tokens
+    this->sendEvent(51, Fw::LogSeverity::WARNING_HI, timeTag, 0);
+    ASSERT_EQ(3u, this->m_packetCount);
+
+    // FATAL events are never throttled
+    this->sendEvent(50, Fw::LogSeverity::FATAL, timeTag, 0);
+    ASSERT_EQ(4u, this->m_packetCount);
+
+    // the first tick reports the dropped events
+    U32 ticks = 0;
+    this->clearEvents();
+    this->invoke_to_run(0, 0);
+    this->m_impl.doDispatch();
+    ticks++;
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_ID_THROTTLED_SIZE(1);
+    ASSERT_EVENTS_ID_THROTTLED(0, 50, 3);
+
+    // later reports wait for the report period
+    this->clearEvents();
+    for (U32 tick = 1; tick < EVENT_MANAGER_THROTTLE_REPORT_TICKS; tick++) {
+        this->sendEvent(50, Fw::LogSeverity::WARNING_HI, timeTag, tick);
+        this->invoke_to_run(0, 0);
+        this->m_impl.doDispatch();
+        ticks++;
+    }
+    ASSERT_EQ(4u, this->m_packetCount);
+    ASSERT_EVENTS_SIZE(0);
+    this->invoke_to_run(0, 0);
+    this->m_impl.doDispatch();
+    ticks++;
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_ID_THROTTLED(0, 50, EVENT_MANAGER_THROTTLE_REPORT_TICKS - 1);
+
+    // tokens are replenished after the interval in run ticks. Event time tags, however far they move, do not count.
+    Fw::Time later(TimeBase::TB_NONE, 1000, 0);
+    while (ticks < INTERVAL_TICKS) {
+        this->sendEvent(50, Fw::LogSeverity::WARNING_HI, later, ticks);
+        this->invoke_to_run(0, 0);
+        this->m_impl.doDispatch();
+        ticks++;
+    }
+    ASSERT_EQ(4u, this->m_packetCount);
+    this->clearEvents();
+    for (U32 event = 0; event < 3; event++) {
+        this->sendEvent(50, Fw::LogSeverity::WARNING_HI, later, event);
+    }
+    ASSERT_EQ(6u, this->m_packetCount);
+
+    // an ID quiet for a report period is released, so it starts again with full tokens
+    for (U32 tick = 0; tick < 2 * EVENT_MANAGER_THROTTLE_REPORT_TICKS; tick++) {
+        this->invoke_to_run(0, 0);
+        this->m_impl.doDispatch();
+    }
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_ID_THROTTLED_SIZE(1);
+    for (U32 event = 0; event < 3; event++) {
+        this->sendEvent(50, Fw::LogSeverity::WARNING_HI, later, event);
+    }
+    ASSERT_EQ(8u, this->m_packetCount);
+
+    // disable throttling
+    this->clearHistory();
+    this->sendCmd_SET_EVENT_THROTTLE(0, cmdSeq, 0, 0);
+    this->m_impl.doDispatch();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, EventManager::OPCODE_SET_EVENT_THROTTLE, cmdSeq, Fw::CmdResponse::OK);
+    for (U32 event = 0; event < 5; event++) {
+        this->sendEvent(50, Fw::LogSeverity::WARNING_HI, later, event);
+    }
+    ASSERT_EQ(13u, this->m_packetCount);
+}
+
+void EventManagerTester::runPacking() {
+    U32 cmdSeq = 21;
+    Fw::Time timeTag(TimeBase::TB_NONE, 1, 2);
+
+    this->clearHistory();
+    this->sendCmd_SET_EVENT_PACKING(0, cmdSeq, Enabled::ENABLED);
+    this->m_impl.doDispatch();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, EventManager::OPCODE_SET_EVENT_PACKING, cmdSeq, Fw::CmdResponse::OK);
+
+    // events are held until the next tick
+    this->m_packetCount = 0;
+    for (FwEventIdType id = 1; id <= 3; id++) {
+        this->sendEvent(id, Fw::LogSeverity::WARNING_HI, timeTag, id);
+    }
+    ASSERT_EQ(0u, this->m_packetCount);
+    this->invoke_to_run(0, 0);
+    this->m_impl.doDispatch();
+    ASSERT_EQ(1u, this->m_packetCount);
+    this->checkPackedEvents(1, 3);
+
+    // a tick with no events sends nothing
+    this->invoke_to_run(0, 0);
+    this->m_impl.doDispatch();
+    ASSERT_EQ(1u, this->m_packetCount);
+
+    // an event that does not fit sends the full packet and starts the next one
+    const FwSizeType eventSize =
+        sizeof(FwPacketDescriptorType) + sizeof(FwEventIdType) + Fw::Time::SERIALIZED_SIZE + sizeof(U32);
+    const U32 perPacket = static_cast<U32>(FW_COM_BUFFER_MAX_SIZE / eventSize);
+    for (U32 event = 0; event <= perPacket; event++) {
+        this->sendEvent(100 + event, Fw::LogSeverity::WARNING_HI, timeTag, 100 + event);
+    }
+    ASSERT_EQ(2u, this->m_packetCount);
+    this->checkPackedEvents(100, perPacket);
+
+    // a FATAL event is sent right away with the events held before it
+    this->sendEvent(101 + perPacket, Fw::LogSeverity::FATAL, timeTag, 101 + perPacket);
+    ASSERT_EQ(3u, this->m_packetCount);
+    this->checkPackedEvents(100 + perPacket, 2);
+
+    // disabling packing sends the events held
+    this->sendEvent(300, Fw::LogSeverity::WARNING_HI, timeTag, 300);
+    ASSERT_EQ(3u, this->m_packetCount);
+    this->clearHistory();
+    this->sendCmd_SET_EVENT_PACKING(0, cmdSeq, Enabled::DISABLED);
+    this->m_impl.doDispatch();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, EventManager::OPCODE_SET_EVENT_PACKING, cmdSeq, Fw::CmdResponse::OK);
+    ASSERT_EQ(4u, this->m_packetCount);
+    this->checkPackedEvents(300, 1);
+
+    // then each event is sent on its own
+    this->sendEvent(301, Fw::LogSeverity::WARNING_HI, timeTag, 301);
+    ASSERT_EQ(5u, this->m_packetCount);
+    this->checkPackedEvents(301, 1);
+}
+
+void EventManagerTester::sendEvent(FwEventIdType id, Fw::LogSeverity severity, const Fw::Time& timeTag, U32 value) {
+    Fw::LogBuffer buff;
+    Fw::SerializeStatus stat = buff.serializeFrom(value);
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, stat);
+    Fw::Time sentTimeTag(timeTag);
+    this->invoke_to_LogRecv(0, id, sentTimeTag, severity, buff);
+    this->m_impl.doDispatch();
+}
+
+void EventManagerTester::checkPackedEvents(FwEventIdType firstId, U32 count) {
+    // each event was sent with its ID as its argument
+    for (U32 event = 0; event < count; event++) {
+        FwPacketDescriptorType desc;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK, this->m_sentPacket.deserializeTo(desc));
+        ASSERT_EQ(desc, static_cast<FwPacketDescriptorType>(Fw::ComPacketType::FW_PACKET_LOG));
+        FwEventIdType sentId;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK, this->m_sentPacket.deserializeTo(sentId));
+        ASSERT_EQ(firstId + event, sentId);
+        Fw::Time recTimeTag;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK, this->m_sentPacket.deserializeTo(recTimeTag));
+        ASSERT_TRUE(Fw::Time(TimeBase::TB_NONE, 1, 2) == recTimeTag);
+        U32 readVal;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK, this->m_sentPacket.deserializeTo(readVal));
+        ASSERT_EQ(firstId + event, readVal);
+    }
+    // packet should be empty
+    ASSERT_EQ(this->m_sentPacket.getDeserializeSizeLeft(), 0u);
+}
+
 void EventManagerTester::writeEvent(FwEventIdType id, Fw::LogSeverity severity, U32 value) {
     Fw::LogBuffer buff;
 
@@ -27,6 +27,8 @@ class EventManagerTester : public Svc::EventManagerGTestBase {
     void runEventFatal();
     void runFileDump();
     void runFileDumpErrors();
+    void runThrottle();
+    void runPacking();
 
   private:
     void from_PktSend_handler(const FwIndexType portNum,  //!< The port number
@@ -41,6 +43,7 @@ class EventManagerTester : public Svc::EventManagerGTestBase {
 
     bool m_receivedPacket;
     Fw::ComBuffer m_sentPacket;
+    U32 m_packetCount;
 
     bool m_receivedFatalEvent;
     FwEventIdType m_fatalID;
@@ -48,6 +51,8 @@ class EventManagerTester : public Svc::EventManagerGTestBase {
     void runWithFilters(Fw::LogSeverity filter);
 
     void writeEvent(FwEventIdType id, Fw::LogSeverity severity, U32 value);
+    void sendEvent(FwEventIdType id, Fw::LogSeverity severity, const Fw::Time& timeTag, U32 value);
+    void checkPackedEvents(FwEventIdType firstId, U32 count);
     void readEvent(FwEventIdType id, Fw::LogSeverity severity, U32 value, Os::File& file);
 
     // enumeration to tell what kind of error to inject
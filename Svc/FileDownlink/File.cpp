@@ -14,6 +14,7 @@
 #include <Fw/Types/Assert.hpp>
 #include <Os/FileSystem.hpp>
 #include <Svc/FileDownlink/FileDownlink.hpp>
+#include <limits>
 
 namespace Svc {
 
@@ -43,19 +44,26 @@ Os::File::Status FileDownlink::File ::open(const char* const sourceFileName, con
     this->m_checksum = checksum;
 
     // Open osFile for reading
+    this->m_position = 0;
     return this->m_osFile.open(sourceFileName, Os::File::OPEN_READ);
 }
 
 Os::File::Status FileDownlink::File ::read(U8* const data, const U32 byteOffset, const U32 size) {
     Os::File::Status status;
-    status = this->m_osFile.seek(byteOffset, Os::File::SeekType::ABSOLUTE);
-    if (status != Os::File::OP_OK) {
-        return status;
+    // Sequential reads continue from the current position without a seek
+    if (byteOffset != this->m_position) {
+        status = this->m_osFile.seek(byteOffset, Os::File::SeekType::ABSOLUTE);
+        if (status != Os::File::OP_OK) {
+            return status;
+        }
+        this->m_position = byteOffset;
     }
 
     FwSizeType intSize = size;
     status = this->m_osFile.read(data, intSize);
 
+    // Position is unknown after a failed read, force a seek on the next one
+    this->m_position = std::numeric_limits<U32>::max();
     if (status != Os::File::OP_OK) {
         return status;
     }
@@ -63,6 +71,7 @@ Os::File::Status FileDownlink::File ::read(U8* const data, const U32 byteOffset,
     if (static_cast<U32>(intSize) != size) {
         return Os::File::BAD_SIZE;
     }
+    this->m_position = byteOffset + size;
     this->m_checksum.update(data, byteOffset, size);
 
     return Os::File::OP_OK;
@@ -37,7 +37,19 @@ FileDownlink ::FileDownlink(const char* const name)
       m_lastCompletedType(Fw::FilePacket::T_NONE),
       m_lastBufferId(0),
       m_curEntry(),
-      m_cntxId(0) {}
+      m_cntxId(0),
+      m_readChunk(0),
+      m_sendChunk(0),
+      m_chunksInFlight(0),
+      m_transferInFlight(0),
+      m_transferId(0) {
+    static_assert(FILEDOWNLINK_WINDOW_SIZE > 0, "FileDownlink window must hold at least one packet");
+    static_assert(FILEDOWNLINK_READ_AHEAD_CHUNKS >= FILEDOWNLINK_WINDOW_SIZE,
+                  "FileDownlink read-ahead ring must hold the full window");
+    for (U32 i = 0; i < FILEDOWNLINK_READ_AHEAD_CHUNKS; i++) {
+        this->m_chunks[i].state = CHUNK_FREE;
+    }
+}
 
 void FileDownlink ::configure(U32 cooldown, U32 cycleTime, U32 fileQueueDepth) {
     this->m_cooldown = cooldown;
@@ -137,9 +149,20 @@ void FileDownlink ::pingIn_handler(const FwIndexType portNum, U32 key) {
 }
 
 void FileDownlink ::bufferReturn_handler(const FwIndexType portNum, Fw::Buffer& fwBuffer) {
+    // Data packet returns always free their chunk, but only those of the transfer in progress move it along
+    bool currentTransfer = false;
+    if (this->returnChunk(fwBuffer.getContext(), currentTransfer)) {
+        // A stale return may free the window space a current transfer with nothing in flight is waiting on
+        const bool windowFreed = (not currentTransfer) && (this->m_transferInFlight == 0) &&
+                                 (this->m_chunks[this->m_sendChunk].state == CHUNK_READY);
+        if ((not currentTransfer && not windowFreed) ||
+            (this->m_mode.get() != Mode::WAIT && this->m_mode.get() != Mode::CANCEL)) {
+            return;
+        }
+    }
     // If this is a stale buffer (old, timed-out, or both), then ignore its return.
-    // File downlink actions only respond to the return of the most-recently-sent buffer.
-    if (this->m_lastBufferId != fwBuffer.getContext() + 1 || this->m_mode.get() == Mode::IDLE) {
+    // Other file downlink actions only respond to the return of the most-recently-sent buffer.
+    else if (this->m_lastBufferId != fwBuffer.getContext() + 1 || this->m_mode.get() == Mode::IDLE) {
         return;
     }
     // Non-ignored buffers cannot be returned in "DOWNLINK" and "IDLE" state.  Only in "WAIT", "CANCEL" state.
@@ -293,6 +316,8 @@ void FileDownlink ::sendFile(const char* sourceFilename, const char* destFilenam
     }
 
     // Send file and switch to WAIT mode
+    this->m_transferId++;
+    this->m_transferInFlight = 0;
     this->getBuffer(this->m_buffer, FILE_PACKET);
     this->sendStartPacket();
     this->m_mode.set(Mode::WAIT);
@@ -312,34 +337,107 @@ void FileDownlink ::sendFile(const char* sourceFilename, const char* destFilenam
     }
 }
 
-Os::File::Status FileDownlink ::sendDataPacket(U32& byteOffset) {
-    FW_ASSERT(byteOffset < this->m_endOffset);
+Os::File::Status FileDownlink ::readAhead() {
     const U32 maxDataSize =
         FILEDOWNLINK_INTERNAL_BUFFER_SIZE - Fw::FilePacket::DataPacket::HEADERSIZE - sizeof(FwPacketDescriptorType);
-    const U32 dataSize =
-        (byteOffset + maxDataSize > this->m_endOffset) ? (this->m_endOffset - byteOffset) : maxDataSize;
-    U8 buffer[maxDataSize];
-    // This will be last data packet sent
-    if (dataSize + byteOffset == this->m_endOffset) {
-        this->m_lastCompletedType = Fw::FilePacket::T_DATA;
+    // Read the file sequentially into free chunks, in ring order
+    while (this->m_byteOffset < this->m_endOffset) {
+        Chunk& chunk = this->m_chunks[this->m_readChunk];
+        if (chunk.state != CHUNK_FREE) {
+            break;
+        }
+        const U32 dataSize = (this->m_byteOffset + maxDataSize > this->m_endOffset)
+                                 ? (this->m_endOffset - this->m_byteOffset)
+                                 : maxDataSize;
+        // Leave room for the packet descriptor and data packet header in front of the data
+        U8* const data = &chunk.memory[sizeof(FwPacketDescriptorType) + Fw::FilePacket::DataPacket::HEADERSIZE];
+        const Os::File::Status status = this->m_file.read(data, this->m_byteOffset, dataSize);
+        if (status != Os::File::OP_OK) {
+            this->m_warnings.fileRead(status);
+            return status;
+        }
+        chunk.byteOffset = this->m_byteOffset;
+        chunk.dataSize = static_cast<U16>(dataSize);
+        chunk.sequenceIndex = this->m_sequenceIndex;
+        chunk.transferId = this->m_transferId;
+        chunk.state = CHUNK_READY;
+        ++this->m_sequenceIndex;
+        this->m_byteOffset += dataSize;
+        this->m_readChunk = (this->m_readChunk + 1) % FILEDOWNLINK_READ_AHEAD_CHUNKS;
     }
+    return Os::File::OP_OK;
+}
 
-    const Os::File::Status status = this->m_file.read(buffer, byteOffset, dataSize);
-    if (status != Os::File::OP_OK) {
-        this->m_warnings.fileRead(status);
-        return status;
+void FileDownlink ::sendReadyChunks() {
+    // Send chunks in ring order until the window is full
+    while (this->m_chunksInFlight < FILEDOWNLINK_WINDOW_SIZE) {
+        Chunk& chunk = this->m_chunks[this->m_sendChunk];
+        if (chunk.state != CHUNK_READY) {
+            break;
+        }
+        FW_ASSERT(chunk.transferId == this->m_transferId, static_cast<FwAssertArgType>(chunk.transferId));
+        Fw::FilePacket::DataPacket dataPacket;
+        dataPacket.initialize(
+            chunk.sequenceIndex, chunk.byteOffset, chunk.dataSize,
+            &chunk.memory[sizeof(FwPacketDescriptorType) + Fw::FilePacket::DataPacket::HEADERSIZE]);
+        Fw::Buffer buffer(chunk.memory, sizeof(FwPacketDescriptorType) + dataPacket.bufferSize());
+        FW_ASSERT(buffer.getSize() <= FILEDOWNLINK_INTERNAL_BUFFER_SIZE,
+                  static_cast<FwAssertArgType>(buffer.getSize()));
+        // Serialize packet descriptor FW_PACKET_FILE to the buffer
+        Fw::SerializeStatus status = buffer.getSerializer().serializeFrom(
+            static_cast<FwPacketDescriptorType>(Fw::ComPacketType::FW_PACKET_FILE));
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK);
+        // Serialize the data packet header in front of the data already in the buffer
+        Fw::Buffer offsetBuffer(chunk.memory + sizeof(FwPacketDescriptorType), dataPacket.bufferSize());
+        status = dataPacket.headerToBuffer(offsetBuffer);
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK);
+        // This will be last data packet sent
+        if (chunk.byteOffset + chunk.dataSize == this->m_endOffset) {
+            this->m_lastCompletedType = Fw::FilePacket::T_DATA;
+        }
+        chunk.bufferId = this->m_lastBufferId;
+        this->m_lastBufferId++;
+        buffer.setContext(chunk.bufferId);
+        chunk.state = CHUNK_SENT;
+        ++this->m_chunksInFlight;
+        ++this->m_transferInFlight;
+        this->m_sendChunk = (this->m_sendChunk + 1) % FILEDOWNLINK_READ_AHEAD_CHUNKS;
+        this->bufferSendOut_out(0, buffer);
+        this->m_packetsSent.packetSent();
     }
+}
 
-    Fw::FilePacket::DataPacket dataPacket;
-    dataPacket.initialize(this->m_sequenceIndex, byteOffset, static_cast<U16>(dataSize), buffer);
-    ++this->m_sequenceIndex;
-    Fw::FilePacket filePacket;
-    filePacket.fromDataPacket(dataPacket);
-    this->sendFilePacket(filePacket);
-
-    byteOffset += dataSize;
+bool FileDownlink ::returnChunk(U32 bufferId, bool& currentTransfer) {
+    for (U32 i = 0; i < FILEDOWNLINK_READ_AHEAD_CHUNKS; i++) {
+        Chunk& chunk = this->m_chunks[i];
+        if (chunk.state == CHUNK_SENT && chunk.bufferId == bufferId) {
+            chunk.state = CHUNK_FREE;
+            FW_ASSERT(this->m_chunksInFlight > 0);
+            --this->m_chunksInFlight;
+            currentTransfer = (chunk.transferId == this->m_transferId);
+            if (currentTransfer) {
+                FW_ASSERT(this->m_transferInFlight > 0);
+                --this->m_transferInFlight;
+            }
+            return true;
+        }
+    }
+    return false;
+}
 
-    return Os::File::OP_OK;
+void FileDownlink ::dropReadyChunks() {
+    // Ready chunks follow the send position, rewind reading to the first of them
+    const Chunk& first = this->m_chunks[this->m_sendChunk];
+    if (first.state == CHUNK_READY) {
+        this->m_byteOffset = first.byteOffset;
+        this->m_sequenceIndex = first.sequenceIndex;
+    }
+    for (U32 i = 0; i < FILEDOWNLINK_READ_AHEAD_CHUNKS; i++) {
+        if (this->m_chunks[i].state == CHUNK_READY) {
+            this->m_chunks[i].state = CHUNK_FREE;
+        }
+    }
+    this->m_readChunk = this->m_sendChunk;
 }
 
 void FileDownlink ::sendCancelPacket() {
@@ -368,6 +466,8 @@ void FileDownlink ::sendCancelPacket() {
 }
 
 void FileDownlink ::sendEndPacket() {
+    // Data packets have used buffer ids since the start packet, take a new one so the return is recognized
+    this->getBuffer(this->m_buffer, FILE_PACKET);
     CFDP::Checksum checksum;
     this->m_file.getChecksum(checksum);
 
@@ -412,6 +512,7 @@ void FileDownlink ::sendFilePacket(const Fw::FilePacket& filePacket) {
 }
 
 void FileDownlink ::enterCooldown() {
+    this->dropReadyChunks();
     this->m_file.getOsFile().close();
     this->m_mode.set(Mode::COOLDOWN);
     this->m_lastCompletedType = Fw::FilePacket::T_NONE;
@@ -423,15 +524,15 @@ void FileDownlink ::downlinkPacket() {
               static_cast<FwAssertArgType>(this->m_lastCompletedType));
     FW_ASSERT(this->m_mode.get() == Mode::CANCEL || this->m_mode.get() == Mode::DOWNLINK,
               static_cast<FwAssertArgType>(this->m_mode.get()));
-    // If canceled mode and currently downlinking data then send a cancel packet
-    if (this->m_mode.get() == Mode::CANCEL && this->m_lastCompletedType == Fw::FilePacket::T_START) {
-        this->sendCancelPacket();
-        this->m_lastCompletedType = Fw::FilePacket::T_CANCEL;
+    // When canceling, chunks read ahead are never sent
+    if (this->m_mode.get() == Mode::CANCEL) {
+        this->dropReadyChunks();
     }
-    // If in downlink mode and currently downlinking data then continue with the next packer
+    // If in downlink mode and currently downlinking data then fill the window with the next packets
     else if (this->m_mode.get() == Mode::DOWNLINK && this->m_lastCompletedType == Fw::FilePacket::T_START) {
-        // Send the next packet, or fail doing so
-        const Os::File::Status status = this->sendDataPacket(this->m_byteOffset);
+        // Send what was read ahead first, then read ahead into the free chunks, or fail doing so
+        this->sendReadyChunks();
+        const Os::File::Status status = this->readAhead();
         if (status != Os::File::OP_OK) {
             this->log_WARNING_HI_SendDataFail(this->m_file.getSourceName(), this->m_byteOffset);
             this->enterCooldown();
@@ -440,6 +541,20 @@ void FileDownlink ::downlinkPacket() {
             // Don't go to wait state
             return;
         }
+        this->sendReadyChunks();
+    }
+    // Data packets in flight must all return before the cancel or end packet is sent
+    if (this->m_transferInFlight > 0) {
+        if (this->m_mode.get() == Mode::DOWNLINK) {
+            this->m_mode.set(Mode::WAIT);
+        }
+        this->m_curTimer = 0;
+        return;
+    }
+    // If canceled mode and currently downlinking data then send a cancel packet
+    if (this->m_mode.get() == Mode::CANCEL && this->m_lastCompletedType == Fw::FilePacket::T_START) {
+        this->sendCancelPacket();
+        this->m_lastCompletedType = Fw::FilePacket::T_CANCEL;
     }
     // If in downlink mode or cancel and finished downlinking data then send the last packet
     else if (this->m_lastCompletedType == Fw::FilePacket::T_DATA) {
@@ -72,7 +72,7 @@ class FileDownlink final : public FileDownlinkComponentBase {
 
       public:
         //! Constructor
-        File() : m_size(0) {}
+        File() : m_size(0), m_position(0) {}
 
       private:
         //! The source file name
@@ -87,6 +87,9 @@ class FileDownlink final : public FileDownlinkComponentBase {
         //! The file size
         U32 m_size;
 
+        //! The position of the OS file, used to skip the seek on sequential reads
+        U32 m_position;
+
         //! The checksum for the file
         CFDP::Checksum m_checksum;
 
@@ -210,6 +213,25 @@ class FileDownlink final : public FileDownlinkComponentBase {
     //! Each type has a buffer to store it.
     enum PacketType { FILE_PACKET, CANCEL_PACKET, COUNT_PACKET_TYPE };
 
+    //! State of a chunk in the read-ahead ring
+    enum ChunkState : U8 {
+        CHUNK_FREE,   //!< Chunk may be read into
+        CHUNK_READY,  //!< Chunk holds file data waiting to be sent
+        CHUNK_SENT,   //!< Chunk is in flight until its buffer is returned
+    };
+
+    //! A chunk of the read-ahead ring. File data is read directly behind room for the packet descriptor and
+    //! data packet header, and the header is serialized in front of it when the chunk is sent.
+    struct Chunk {
+        U8 memory[FILEDOWNLINK_INTERNAL_BUFFER_SIZE];  //!< Packet memory
+        U32 byteOffset;                                //!< File offset of the chunk data
+        U32 sequenceIndex;                             //!< Sequence index of the data packet
+        U32 transferId;                                //!< Transfer the chunk was read for
+        U32 bufferId;                                  //!< Buffer context while the chunk is in flight
+        U16 dataSize;                                  //!< Size of the chunk data
+        ChunkState state;                              //!< State of the chunk
+    };
+
   public:
     // ----------------------------------------------------------------------
     // Construction, initialization, and destruction
@@ -314,7 +336,10 @@ class FileDownlink final : public FileDownlinkComponentBase {
     );
 
     // Individual packet transfer functions
-    Os::File::Status sendDataPacket(U32& byteOffset);
+    Os::File::Status readAhead();
+    void sendReadyChunks();
+    bool returnChunk(U32 bufferId, bool& currentTransfer);
+    void dropReadyChunks();
     void sendCancelPacket();
     void sendEndPacket();
     void sendStartPacket();
@@ -349,6 +374,24 @@ class FileDownlink final : public FileDownlinkComponentBase {
     //! Buffer's memory backing
     U8 m_memoryStore[COUNT_PACKET_TYPE][FILEDOWNLINK_INTERNAL_BUFFER_SIZE];
 
+    //! Read-ahead ring of data packet chunks
+    Chunk m_chunks[FILEDOWNLINK_READ_AHEAD_CHUNKS];
+
+    //! Next chunk of the ring to read file data into
+    U32 m_readChunk;
+
+    //! Next chunk of the ring to send
+    U32 m_sendChunk;
+
+    //! Number of chunks in flight, including those of earlier transfers
+    U32 m_chunksInFlight;
+
+    //! Number of data packets of the current transfer in flight
+    U32 m_transferInFlight;
+
+    //! Identifier of the current transfer
+    U32 m_transferId;
+
     //! The mode
     Mode m_mode;
 
@@ -385,7 +428,7 @@ class FileDownlink final : public FileDownlinkComponentBase {
     //! Buffer size for file data
     U32 m_bufferSize;
 
-    //! Current byte offset in file
+    //! Byte offset in file of the next chunk to read
     U32 m_byteOffset;
 
     //! Amount of bytes left to read
@@ -34,6 +34,21 @@ TEST(FileDownlink, SendFilePort) {
     tester.sendFilePort();
 }
 
+TEST(FileDownlink, DownlinkWindowed) {
+    Svc::FileDownlinkTester tester;
+    tester.downlinkWindowed();
+}
+
+TEST(FileDownlink, CancelWithChunksInFlight) {
+    Svc::FileDownlinkTester tester;
+    tester.cancelWithChunksInFlight();
+}
+
+TEST(FileDownlink, StaleChunkReturn) {
+    Svc::FileDownlinkTester tester;
+    tester.staleChunkReturn();
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -10,6 +10,7 @@
 // ======================================================================
 
 #include <unistd.h>
+#include <algorithm>
 #include <cerrno>
 
 #include "FileDownlinkTester.hpp"
@@ -28,7 +29,12 @@ namespace Svc {
 // ----------------------------------------------------------------------
 
 FileDownlinkTester ::FileDownlinkTester()
-    : FileDownlinkGTestBase("Tester", MAX_HISTORY_SIZE), component("FileDownlink"), buffers_index(0) {
+    : FileDownlinkGTestBase("Tester", MAX_HISTORY_SIZE),
+      component("FileDownlink"),
+      buffers_index(0),
+      maxChunksInFlight(0),
+      holdDataBuffers(false),
+      heldCount(0) {
     this->component.configure(COOLDOWN_MS, CYCLE_MS, 10);
     this->connectPorts();
     this->initComponents();
@@ -286,12 +292,184 @@ void FileDownlinkTester ::sendFilePort() {
     this->removeFile(sourceFileName);
 }
 
+void FileDownlinkTester ::downlinkWindowed() {
+    // Create a file spanning more data packets than the read-ahead ring, with a short last packet
+    const char* const sourceFileName = "source.bin";
+    const char* const destFileName = "dest.bin";
+    const U32 maxDataSize =
+        FILEDOWNLINK_INTERNAL_BUFFER_SIZE - Fw::FilePacket::DataPacket::HEADERSIZE - sizeof(FwPacketDescriptorType);
+    const U32 numDataPackets = FILEDOWNLINK_READ_AHEAD_CHUNKS + 2;
+    const U32 fileSize = maxDataSize * (numDataPackets - 1) + 1;
+    ASSERT_LE(fileSize, FILE_BUFFER_CAPACITY);
+    U8 data[FILE_BUFFER_CAPACITY];
+    for (U32 i = 0; i < fileSize; i++) {
+        data[i] = static_cast<U8>(i);
+    }
+    FileBuffer fileBufferOut(data, fileSize);
+    fileBufferOut.write(sourceFileName);
+
+    // Send the file and assert COMMAND_OK
+    this->sendFile(sourceFileName, destFileName, Fw::CmdResponse::OK);
+
+    // Assert telemetry
+    ASSERT_TLM_PacketsSent_SIZE(numDataPackets + 2);
+    ASSERT_TLM_FilesSent_SIZE(1);
+
+    // The window was filled but never exceeded, and every data packet came back
+    ASSERT_EQ(FILEDOWNLINK_WINDOW_SIZE, this->maxChunksInFlight);
+    ASSERT_EQ(0U, this->component.m_chunksInFlight);
+
+    // Validate the packet history
+    History<Fw::FilePacket::DataPacket> dataPackets(MAX_HISTORY_SIZE);
+    CFDP::Checksum checksum;
+    fileBufferOut.getChecksum(checksum);
+    validatePacketHistory(*this->fromPortHistory_bufferSendOut, dataPackets, Fw::FilePacket::T_END,
+                          numDataPackets + 2, checksum, 0);
+
+    // Compare the outgoing and incoming files
+    FileBuffer fileBufferIn(dataPackets);
+    ASSERT_EQ(true, FileBuffer::compare(fileBufferIn, fileBufferOut));
+
+    // Assert idle mode
+    ASSERT_EQ(FileDownlink::Mode::IDLE, this->component.m_mode.get());
+
+    // Remove the outgoing file
+    this->removeFile(sourceFileName);
+}
+
+void FileDownlinkTester ::cancelWithChunksInFlight() {
+    const char* const sourceFileName = "source.bin";
+    const char* const destFileName = "dest.bin";
+    this->writeWindowedFile(sourceFileName);
+    this->holdDataBuffers = true;
+
+    // Start the downlink and fill the window
+    Fw::CmdStringArg sourceCmdStringArg(sourceFileName);
+    Fw::CmdStringArg destCmdStringArg(destFileName);
+    this->sendCmd_SendFile(INSTANCE, CMD_SEQ, sourceCmdStringArg, destCmdStringArg);
+    this->component.doDispatch();       // Dispatch start command
+    this->component.Run_handler(0, 0);  // Dequeue the file and send the start packet
+    this->component.doDispatch();       // Process return of the start packet and fill the window
+    ASSERT_EQ(FILEDOWNLINK_WINDOW_SIZE, this->heldCount);
+    ASSERT_EQ(FILEDOWNLINK_WINDOW_SIZE, this->component.m_transferInFlight);
+    ASSERT_from_bufferSendOut_SIZE(1 + FILEDOWNLINK_WINDOW_SIZE);
+
+    this->cancel(Fw::CmdResponse::OK);
+    this->cmdResponseHistory->clear();
+    ASSERT_EQ(FileDownlink::Mode::CANCEL, this->component.m_mode.get());
+
+    // No cancel packet while any data packet is in flight
+    this->returnHeldBuffers(FILEDOWNLINK_WINDOW_SIZE - 1);
+    ASSERT_from_bufferSendOut_SIZE(1 + FILEDOWNLINK_WINDOW_SIZE);
+    ASSERT_EQ(1U, this->component.m_transferInFlight);
+    ASSERT_EQ(FileDownlink::Mode::CANCEL, this->component.m_mode.get());
+
+    // The last return sends the cancel packet, numbered after the last data packet sent
+    this->returnHeldBuffers(1);
+    ASSERT_EQ(0U, this->component.m_chunksInFlight);
+    this->component.doDispatch();  // Process return of the cancel packet
+
+    History<Fw::FilePacket::DataPacket> dataPackets(MAX_HISTORY_SIZE);
+    CFDP::Checksum checksum;
+    validatePacketHistory(*this->fromPortHistory_bufferSendOut, dataPackets, Fw::FilePacket::T_CANCEL,
+                          FILEDOWNLINK_WINDOW_SIZE + 2, checksum, 0);
+
+    Fw::CmdResponse resp =
+        (FILEDOWNLINK_COMMAND_FAILURES_DISABLED) ? Fw::CmdResponse::OK : Fw::CmdResponse::EXECUTION_ERROR;
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, FileDownlink::OPCODE_SENDFILE, CMD_SEQ, resp);
+    ASSERT_EVENTS_DownlinkCanceled_SIZE(1);
+    ASSERT_EQ(FileDownlink::Mode::COOLDOWN, this->component.m_mode.get());
+
+    this->removeFile(sourceFileName);
+}
+
+void FileDownlinkTester ::staleChunkReturn() {
+    const char* const sourceFileName = "source.bin";
+    const char* const destFileName = "dest.bin";
+    this->writeWindowedFile(sourceFileName);
+    this->holdDataBuffers = true;
+
+    // Start the first downlink, fill the window, and read one chunk ahead of it
+    Fw::CmdStringArg sourceCmdStringArg(sourceFileName);
+    Fw::CmdStringArg destCmdStringArg(destFileName);
+    this->sendCmd_SendFile(INSTANCE, CMD_SEQ, sourceCmdStringArg, destCmdStringArg);
+    this->component.doDispatch();       // Dispatch start command
+    this->component.Run_handler(0, 0);  // Dequeue the file and send the start packet
+    this->component.doDispatch();       // Process return of the start packet and fill the window
+    ASSERT_EQ(FILEDOWNLINK_WINDOW_SIZE, this->heldCount);
+
+    // Cut the file after the chunks read so far, so the next read fails
+    const U32 maxDataSize =
+        FILEDOWNLINK_INTERNAL_BUFFER_SIZE - Fw::FilePacket::DataPacket::HEADERSIZE - sizeof(FwPacketDescriptorType);
+    ASSERT_EQ(0, ::truncate(sourceFileName, static_cast<off_t>(maxDataSize * FILEDOWNLINK_READ_AHEAD_CHUNKS)));
+
+    // The first return sends the chunk read ahead, then the read fails and the downlink ends with the window full
+    this->returnHeldBuffers(1);
+    ASSERT_EVENTS_SendDataFail_SIZE(1);
+    ASSERT_EQ(FileDownlink::Mode::COOLDOWN, this->component.m_mode.get());
+    ASSERT_EQ(FILEDOWNLINK_WINDOW_SIZE, this->heldCount);
+    ASSERT_EQ(FILEDOWNLINK_WINDOW_SIZE, this->component.m_chunksInFlight);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, FileDownlink::OPCODE_SENDFILE, CMD_SEQ,
+                        (FILEDOWNLINK_COMMAND_FAILURES_DISABLED) ? Fw::CmdResponse::OK
+                                                                 : Fw::CmdResponse::EXECUTION_ERROR);
+    while (this->component.m_mode.get() != FileDownlink::Mode::IDLE) {
+        this->component.Run_handler(0, 0);
+    }
+    this->clearHistory();
+    this->holdDataBuffers = false;
+
+    // Start a second downlink while the data packets of the first are still in flight
+    const char* const sourceFileName2 = "source2.bin";
+    const char* const destFileName2 = "dest2.bin";
+    U8 data[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    FileBuffer fileBufferOut(data, sizeof(data));
+    fileBufferOut.write(sourceFileName2);
+    Fw::CmdStringArg sourceCmdStringArg2(sourceFileName2);
+    Fw::CmdStringArg destCmdStringArg2(destFileName2);
+    this->sendCmd_SendFile(INSTANCE, CMD_SEQ, sourceCmdStringArg2, destCmdStringArg2);
+    this->component.doDispatch();       // Dispatch start command
+    this->component.Run_handler(0, 0);  // Dequeue the file and send the start packet
+    this->component.doDispatch();       // Process return of the start packet, the data waits for the window
+    ASSERT_from_bufferSendOut_SIZE(1);
+    ASSERT_EQ(0U, this->component.m_transferInFlight);
+    ASSERT_EQ(FileDownlink::Mode::WAIT, this->component.m_mode.get());
+
+    // A stale return frees the window for the data packet, and is not counted against the second downlink
+    this->returnHeldBuffers(1);
+    ASSERT_from_bufferSendOut_SIZE(2);
+    ASSERT_EQ(1U, this->component.m_transferInFlight);
+    ASSERT_EQ(FILEDOWNLINK_WINDOW_SIZE, this->component.m_chunksInFlight);
+    this->component.doDispatch();  // Process return of the data packet and send the end packet
+    this->component.doDispatch();  // Process return of the end packet
+    ASSERT_EVENTS_FileSent_SIZE(1);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, FileDownlink::OPCODE_SENDFILE, CMD_SEQ, Fw::CmdResponse::OK);
+
+    // The remaining stale returns only free their chunks
+    this->returnHeldBuffers(FILEDOWNLINK_WINDOW_SIZE - 1);
+    ASSERT_EQ(0U, this->component.m_chunksInFlight);
+    ASSERT_EQ(FileDownlink::Mode::COOLDOWN, this->component.m_mode.get());
+
+    History<Fw::FilePacket::DataPacket> dataPackets(MAX_HISTORY_SIZE);
+    CFDP::Checksum checksum;
+    fileBufferOut.getChecksum(checksum);
+    validatePacketHistory(*this->fromPortHistory_bufferSendOut, dataPackets, Fw::FilePacket::T_END, 3, checksum, 0);
+    FileBuffer fileBufferIn(dataPackets);
+    ASSERT_EQ(true, FileBuffer::compare(fileBufferIn, fileBufferOut));
+
+    this->removeFile(sourceFileName);
+    this->removeFile(sourceFileName2);
+}
+
 // ----------------------------------------------------------------------
 // Handlers for from ports
 // ----------------------------------------------------------------------
 
 void FileDownlinkTester ::from_bufferSendOut_handler(const FwIndexType portNum, Fw::Buffer& buffer) {
     ASSERT_LT(buffers_index, FW_NUM_ARRAY_ELEMENTS(this->buffers));
+    this->maxChunksInFlight = std::max(this->maxChunksInFlight, this->component.m_chunksInFlight);
     // Copy buffer before recycling
     U8* data = new U8[buffer.getSize()];
     this->buffers[buffers_index] = data;  // NOLINT(clang-analyzer-security.ArrayBound)
@@ -300,6 +478,17 @@ void FileDownlinkTester ::from_bufferSendOut_handler(const FwIndexType portNum,
     Fw::Buffer buffer_new = buffer;
     buffer_new.setData(data);
     pushFromPortEntry_bufferSendOut(buffer_new);
+    // Data packets are sent from the read-ahead chunks
+    bool dataPacket = false;
+    for (U32 i = 0; i < FILEDOWNLINK_READ_AHEAD_CHUNKS; i++) {
+        dataPacket = dataPacket || (buffer.getData() == this->component.m_chunks[i].memory);
+    }
+    if (this->holdDataBuffers && dataPacket) {
+        ASSERT_LT(this->heldCount, FW_NUM_ARRAY_ELEMENTS(this->heldBuffers));
+        this->heldBuffers[this->heldCount] = buffer;
+        this->heldCount++;
+        return;
+    }
     invoke_to_bufferReturn(0, buffer);
 }
 
@@ -413,6 +602,32 @@ void FileDownlinkTester ::cancel(const Fw::CmdResponse response) {
     ASSERT_CMD_RESPONSE(0, FileDownlink::OPCODE_CANCEL, CMD_SEQ, response);
 }
 
+void FileDownlinkTester ::writeWindowedFile(const char* const sourceFileName) {
+    const U32 maxDataSize =
+        FILEDOWNLINK_INTERNAL_BUFFER_SIZE - Fw::FilePacket::DataPacket::HEADERSIZE - sizeof(FwPacketDescriptorType);
+    const U32 fileSize = maxDataSize * (FILEDOWNLINK_READ_AHEAD_CHUNKS + 1) + 1;
+    ASSERT_LE(fileSize, FILE_BUFFER_CAPACITY);
+    U8 data[FILE_BUFFER_CAPACITY];
+    for (U32 i = 0; i < fileSize; i++) {
+        data[i] = static_cast<U8>(i);
+    }
+    FileBuffer fileBufferOut(data, fileSize);
+    fileBufferOut.write(sourceFileName);
+}
+
+void FileDownlinkTester ::returnHeldBuffers(const U32 count) {
+    ASSERT_LE(count, this->heldCount);
+    for (U32 i = 0; i < count; i++) {
+        Fw::Buffer buffer = this->heldBuffers[0];
+        for (U32 j = 1; j < this->heldCount; j++) {
+            this->heldBuffers[j - 1] = this->heldBuffers[j];
+        }
+        this->heldCount--;
+        this->invoke_to_bufferReturn(0, buffer);
+        this->component.doDispatch();
+    }
+}
+
 void FileDownlinkTester ::removeFile(const char* const name) {
     const int status = ::unlink(name);
     if (status != 0) {
@@ -17,8 +17,8 @@
 #include <Svc/FileDownlink/FileDownlink.hpp>
 #include "FileDownlinkGTestBase.hpp"
 
-#define MAX_HISTORY_SIZE 10
-#define FILE_BUFFER_CAPACITY 100
+#define MAX_HISTORY_SIZE (FILEDOWNLINK_READ_AHEAD_CHUNKS + 10)
+#define FILE_BUFFER_CAPACITY ((FILEDOWNLINK_READ_AHEAD_CHUNKS + 2) * FILEDOWNLINK_INTERNAL_BUFFER_SIZE)
 
 namespace Svc {
 
@@ -107,6 +107,24 @@ class FileDownlinkTester : public FileDownlinkGTestBase {
     //!
     void sendFilePort();
 
+    //! Downlink windowed
+    //! Downlink a file spanning more data packets than the read-ahead ring
+    //! Verify that the window is filled and never exceeded
+    //!
+    void downlinkWindowed();
+
+    //! Cancel with chunks in flight
+    //! Cancel a downlink while data packets are in flight
+    //! Verify that the cancel packet is sent only after every data packet returns
+    //!
+    void cancelWithChunksInFlight();
+
+    //! Stale chunk return
+    //! End a downlink on a read error while data packets are in flight, then downlink another file
+    //! Verify that returns from the first transfer free the window without driving the second
+    //!
+    void staleChunkReturn();
+
   private:
     // ----------------------------------------------------------------------
     // Handlers for from ports
@@ -162,6 +180,17 @@ class FileDownlinkTester : public FileDownlinkGTestBase {
     void cancel(const Fw::CmdResponse response  //!< The expected command response
     );
 
+    //! Write a file spanning more data packets than the read-ahead ring
+    //!
+    void writeWindowedFile(const char* const sourceFileName  //!< The file name
+    );
+
+    //! Return the data packet buffers held by the tester, oldest first
+    //! Dispatch each return before the next one
+    //!
+    void returnHeldBuffers(const U32 count  //!< The number of buffers to return
+    );
+
     //! Remove a file
     //!
     void removeFile(const char* const name  //!< The file name
@@ -230,6 +259,22 @@ class FileDownlinkTester : public FileDownlinkGTestBase {
     //!
     U32 buffers_index;
 
+    //! Most data packets seen in flight at once
+    //!
+    U32 maxChunksInFlight;
+
+    //! Whether data packet buffers are held instead of returned
+    //!
+    bool holdDataBuffers;
+
+    //! Data packet buffers held by the tester
+    //!
+    Fw::Buffer heldBuffers[FILEDOWNLINK_READ_AHEAD_CHUNKS];
+
+    //! Number of held data packet buffers
+    //!
+    U32 heldCount;
+
     //! The current sequence index
     //!
     U32 sequenceIndex;
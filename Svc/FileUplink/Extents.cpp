@@ -0,0 +1,76 @@
+// ======================================================================
+// \title  Extents.cpp
+// \brief  cpp file for FileUplink::Extents
+//
+// \copyright
+// Copyright 2009-2025, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Fw/Types/Assert.hpp>
+#include <Svc/FileUplink/FileUplink.hpp>
+
+namespace Svc {
+
+bool FileUplink::Extents::add(const U32 start, const U32 end) {
+    FW_ASSERT(start < end, static_cast<FwAssertArgType>(start), static_cast<FwAssertArgType>(end));
+    // Find the first extent ending at or after start: it is the first that may overlap or touch [start, end)
+    U32 first = 0;
+    while (first < this->m_count && this->m_extents[first].end < start) {
+        ++first;
+    }
+    // Find the end of the extents starting at or before end: they all overlap or touch [start, end)
+    U32 last = first;
+    while (last < this->m_count && this->m_extents[last].start <= end) {
+        ++last;
+    }
+    if (first == last) {
+        // No extent to merge with, insert a new one
+        if (this->m_count == FILEUPLINK_MAX_EXTENTS) {
+            return false;
+        }
+        for (U32 i = this->m_count; i > first; --i) {
+            this->m_extents[i] = this->m_extents[i - 1];
+        }
+        this->m_extents[first].start = start;
+        this->m_extents[first].end = end;
+        ++this->m_count;
+        return true;
+    }
+    // Merge [start, end) and extents first through last - 1 into extent first
+    Extent& merged = this->m_extents[first];
+    merged.start = (start < merged.start) ? start : merged.start;
+    merged.end = (end > this->m_extents[last - 1].end) ? end : this->m_extents[last - 1].end;
+    const U32 removed = last - first - 1;
+    for (U32 i = last; i < this->m_count; ++i) {
+        this->m_extents[i - removed] = this->m_extents[i];
+    }
+    this->m_count -= removed;
+    return true;
+}
+
+bool FileUplink::Extents::findGap(const U32 start, const U32 end, U32& gapStart, U32& gapEnd) const {
+    U32 position = start;
+    for (U32 i = 0; i < this->m_count && position < end; ++i) {
+        const Extent& extent = this->m_extents[i];
+        if (extent.end <= position) {
+            continue;
+        }
+        if (extent.start > position) {
+            gapStart = position;
+            gapEnd = (extent.start < end) ? extent.start : end;
+            return true;
+        }
+        position = extent.end;
+    }
+    if (position < end) {
+        gapStart = position;
+        gapEnd = end;
+        return true;
+    }
+    return false;
+}
+
+}  // namespace Svc
@@ -15,6 +15,7 @@
 #include <Svc/FileUplink/FileUplink.hpp>
 
 #include <cstring>
+#include <limits>
 namespace Svc {
 
 Os::File::Status FileUplink::File::open(const Fw::FilePacket::StartPacket& startPacket) {
@@ -27,25 +28,110 @@ Os::File::Status FileUplink::File::open(const Fw::FilePacket::StartPacket& start
     this->size = startPacket.getFileSize();
     CFDP::Checksum checksum;
     this->m_checksum = checksum;
+    this->m_received.reset();
+    this->m_position = 0;
+    this->m_bufferLength = 0;
     return this->osFile.open(path, Os::File::OPEN_WRITE);
 }
 
 Os::File::Status FileUplink::File::write(const U8* const data, const U32 byteOffset, const U32 length) {
-    Os::File::Status status;
-    status = this->osFile.seek(byteOffset, Os::File::SeekType::ABSOLUTE);
+    // Write only the gaps so retransmitted bytes are neither rewritten nor counted twice in the checksum
+    const U32 end = byteOffset + length;
+    U32 position = byteOffset;
+    U32 gapStart = 0;
+    U32 gapEnd = 0;
+    while (this->findUnreceived(position, end, gapStart, gapEnd)) {
+        const Os::File::Status status = this->stage(&data[gapStart - byteOffset], gapStart, gapEnd - gapStart);
+        if (status != Os::File::OP_OK) {
+            return status;
+        }
+        position = gapEnd;
+    }
+    return Os::File::OP_OK;
+}
+
+Os::File::Status FileUplink::File::flush() {
+    if (this->m_bufferLength == 0) {
+        return Os::File::OP_OK;
+    }
+    const U32 length = this->m_bufferLength;
+    this->m_bufferLength = 0;
+    return this->writeThrough(this->m_buffer, this->m_bufferOffset, length);
+}
+
+bool FileUplink::File::isReceived(const U32 byteOffset, const U32 length) const {
+    U32 gapStart = 0;
+    U32 gapEnd = 0;
+    return not this->findUnreceived(byteOffset, byteOffset + length, gapStart, gapEnd);
+}
+
+bool FileUplink::File::findUnreceived(const U32 start, const U32 end, U32& gapStart, U32& gapEnd) const {
+    // Bytes in the write-back buffer are received but not yet recorded in the extents
+    const U32 bufferEnd = this->m_bufferOffset + this->m_bufferLength;
+    U32 position = start;
+    while (this->m_received.findGap(position, end, gapStart, gapEnd)) {
+        if (this->m_bufferLength == 0 || gapEnd <= this->m_bufferOffset || gapStart >= bufferEnd) {
+            return true;
+        }
+        if (gapStart < this->m_bufferOffset) {
+            gapEnd = this->m_bufferOffset;
+            return true;
+        }
+        if (bufferEnd < gapEnd) {
+            gapStart = bufferEnd;
+            return true;
+        }
+        position = gapEnd;
+    }
+    return false;
+}
+
+Os::File::Status FileUplink::File::stage(const U8* const data, const U32 byteOffset, const U32 length) {
+    // Extend the buffered run when the bytes continue it and fit
+    if (this->m_bufferLength > 0 && byteOffset == this->m_bufferOffset + this->m_bufferLength &&
+        length <= FILEUPLINK_WRITE_BUFFER_SIZE - this->m_bufferLength) {
+        memcpy(&this->m_buffer[this->m_bufferLength], data, length);
+        this->m_bufferLength += length;
+        return Os::File::OP_OK;
+    }
+    const Os::File::Status status = this->flush();
     if (status != Os::File::OP_OK) {
         return status;
     }
+    if (length >= FILEUPLINK_WRITE_BUFFER_SIZE) {
+        return this->writeThrough(data, byteOffset, length);
+    }
+    memcpy(this->m_buffer, data, length);
+    this->m_bufferOffset = byteOffset;
+    this->m_bufferLength = length;
+    return Os::File::OP_OK;
+}
+
+Os::File::Status FileUplink::File::writeThrough(const U8* const data, const U32 byteOffset, const U32 length) {
+    Os::File::Status status;
+    // Sequential writes continue from the current position without a seek
+    if (byteOffset != this->m_position) {
+        this->m_position = std::numeric_limits<U32>::max();
+        status = this->osFile.seek(byteOffset, Os::File::SeekType::ABSOLUTE);
+        if (status != Os::File::OP_OK) {
+            return status;
+        }
+    }
 
     FwSizeType intLength = length;
     // Note: not waiting for the file write to finish
+    this->m_position = std::numeric_limits<U32>::max();
     status = this->osFile.write(data, intLength, Os::File::WaitType::NO_WAIT);
     if (status != Os::File::OP_OK) {
         return status;
     }
 
     FW_ASSERT(static_cast<U32>(intLength) == length, static_cast<FwAssertArgType>(intLength));
-    this->m_checksum.update(data, byteOffset, length);
+    this->m_position = byteOffset + length;
+    // Bytes beyond the extent limit stay unrecorded and are reported missing, so they are not counted here
+    if (this->m_received.add(byteOffset, byteOffset + length)) {
+        this->m_checksum.update(data, byteOffset, length);
+    }
     return Os::File::OP_OK;
 }
 
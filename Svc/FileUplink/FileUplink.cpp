@@ -25,13 +25,22 @@ FileUplink::FileUplink(const char* const name)
     : FileUplinkComponentBase(name),
       m_receiveMode(START),
       m_lastSequenceIndex(0),
-      m_lastPacketWriteStatus(Os::File::MAX_STATUS),
+      m_endReceived(false),
+      m_retransmitTimeout(0),
+      m_retransmitTicks(0),
       m_filesReceived(this),
       m_packetsReceived(this),
-      m_warnings(this) {}
+      m_warnings(this) {
+    static_assert(FILEUPLINK_WRITE_BUFFER_SIZE > 0, "FileUplink write-back buffer must not be empty");
+    static_assert(FILEUPLINK_MAX_EXTENTS > 0, "FileUplink must track at least one extent");
+}
 
 FileUplink::~FileUplink() {}
 
+void FileUplink::configure(const U32 retransmitTimeout) {
+    this->m_retransmitTimeout = retransmitTimeout;
+}
+
 // ----------------------------------------------------------------------
 // Handler implementations for user-defined typed input ports
 // ----------------------------------------------------------------------
@@ -91,6 +100,17 @@ void FileUplink::pingIn_handler(const FwIndexType portNum, U32 key) {
     this->pingOut_out(0, key);
 }
 
+void FileUplink::run_handler(const FwIndexType portNum, U32 context) {
+    // Abandon a file whose missing data was not retransmitted in time
+    if (this->m_receiveMode == DATA && this->m_endReceived) {
+        ++this->m_retransmitTicks;
+        if (this->m_retransmitTicks >= this->m_retransmitTimeout) {
+            this->m_warnings.retransmitTimeout(this->m_file.name);
+            this->goToStartMode();
+        }
+    }
+}
+
 // ----------------------------------------------------------------------
 // Private helper functions
 // ----------------------------------------------------------------------
@@ -123,15 +143,19 @@ void FileUplink::handleDataPacket(const Fw::FilePacket::DataPacket& dataPacket)
     }
 
     const U32 sequenceIndex = dataPacket.asHeader().getSequenceIndex();
+    const U32 byteOffset = dataPacket.getByteOffset();
+    const U32 dataSize = dataPacket.getDataSize();
 
-    // skip this packet if it is a duplicate and it has already been written
-    if (this->m_lastPacketWriteStatus == Os::File::OP_OK && this->checkDuplicatedPacket(sequenceIndex)) {
+    // skip this packet if it is a duplicate and all of its data has already been received
+    if (dataSize > 0 && this->m_file.isReceived(byteOffset, dataSize)) {
+        this->m_warnings.packetDuplicate(sequenceIndex);
         return;
     }
 
-    this->checkSequenceIndex(sequenceIndex);
-    const U32 byteOffset = dataPacket.getByteOffset();
-    const U32 dataSize = dataPacket.getDataSize();
+    // data retransmitted after the END packet fills gaps and is expected out of order
+    if (not this->m_endReceived) {
+        this->checkSequenceIndex(sequenceIndex);
+    }
     if (byteOffset + dataSize > this->m_file.size) {
         this->m_warnings.packetOutOfBounds(sequenceIndex, this->m_file.name);
         return;
@@ -141,23 +165,36 @@ void FileUplink::handleDataPacket(const Fw::FilePacket::DataPacket& dataPacket)
         this->m_warnings.fileWrite(this->m_file.name);
     }
 
-    this->m_lastPacketWriteStatus = status;
+    if (this->m_endReceived) {
+        // Retransmitted data restarts the timeout
+        this->m_retransmitTicks = 0;
+        this->finishIfComplete();
+    }
 }
 
 void FileUplink::handleEndPacket(const Fw::FilePacket::EndPacket& endPacket) {
     this->m_packetsReceived.packetReceived();
     if (this->m_receiveMode == DATA) {
-        this->m_filesReceived.fileReceived();
-        this->checkSequenceIndex(endPacket.asHeader().getSequenceIndex());
-        this->compareChecksums(endPacket);
-        this->log_ACTIVITY_HI_FileReceived(this->m_file.name);
-        if (this->isConnected_fileAnnounce_OutputPort(0)) {
-            this->fileAnnounce_out(0, this->m_file.name);
+        // A repeated END packet may follow retransmitted data, only the first one is in sequence
+        if (not this->m_endReceived) {
+            this->checkSequenceIndex(endPacket.asHeader().getSequenceIndex());
+        }
+        this->m_endReceived = true;
+        this->m_retransmitTicks = 0;
+        endPacket.getChecksum(this->m_endChecksum);
+        this->finishIfComplete();
+        if (this->m_receiveMode == DATA) {
+            this->reportMissingRanges();
+            // Without retransmission the file ends here, otherwise stay in DATA mode so that retransmitted packets
+            // can fill the gaps
+            if (this->m_retransmitTimeout == 0) {
+                this->finishFile();
+            }
         }
     } else {
         this->m_warnings.invalidReceiveMode(Fw::FilePacket::T_END);
+        this->goToStartMode();
     }
-    this->goToStartMode();
 }
 
 void FileUplink::handleCancelPacket() {
@@ -173,36 +210,63 @@ void FileUplink::checkSequenceIndex(const U32 sequenceIndex) {
     this->m_lastSequenceIndex = sequenceIndex;
 }
 
-bool FileUplink::checkDuplicatedPacket(const U32 sequenceIndex) {
-    // check for duplicate packet
-    if (sequenceIndex == this->m_lastSequenceIndex) {
-        this->m_warnings.packetDuplicate(sequenceIndex);
-        return true;
+void FileUplink::compareChecksums() {
+    CFDP::Checksum computed;
+    this->m_file.getChecksum(computed);
+    if (computed != this->m_endChecksum) {
+        this->m_warnings.badChecksum(computed.getValue(), this->m_endChecksum.getValue());
+    }
+}
+
+void FileUplink::finishIfComplete() {
+    FW_ASSERT(this->m_endReceived);
+    if (this->m_file.flush() != Os::File::OP_OK) {
+        this->m_warnings.fileWrite(this->m_file.name);
+    }
+    if (this->m_file.isReceived(0, this->m_file.size)) {
+        this->finishFile();
     }
+}
 
-    return false;
+void FileUplink::finishFile() {
+    this->m_filesReceived.fileReceived();
+    this->compareChecksums();
+    this->log_ACTIVITY_HI_FileReceived(this->m_file.name);
+    if (this->isConnected_fileAnnounce_OutputPort(0)) {
+        this->fileAnnounce_out(0, this->m_file.name);
+    }
+    this->goToStartMode();
 }
 
-void FileUplink::compareChecksums(const Fw::FilePacket::EndPacket& endPacket) {
-    CFDP::Checksum computed, stored;
-    this->m_file.getChecksum(computed);
-    endPacket.getChecksum(stored);
-    if (computed != stored) {
-        this->m_warnings.badChecksum(computed.getValue(), stored.getValue());
+void FileUplink::reportMissingRanges() {
+    U32 missingBytes = 0;
+    U32 missingRanges = 0;
+    U32 gapStart = 0;
+    U32 gapEnd = 0;
+    U32 position = 0;
+    while (this->m_file.findUnreceived(position, this->m_file.size, gapStart, gapEnd)) {
+        if (missingRanges < FILEUPLINK_MAX_REPORTED_GAPS) {
+            this->log_WARNING_LO_MissingRange(gapStart, gapEnd - gapStart);
+        }
+        missingBytes += gapEnd - gapStart;
+        ++missingRanges;
+        position = gapEnd;
     }
+    this->m_warnings.fileIncomplete(this->m_file.name, missingBytes, missingRanges);
 }
 
 void FileUplink::goToStartMode() {
+    this->m_file.discard();
     this->m_file.osFile.close();
     this->m_receiveMode = START;
     this->m_lastSequenceIndex = 0;
-    this->m_lastPacketWriteStatus = Os::File::MAX_STATUS;
+    this->m_endReceived = false;
 }
 
 void FileUplink::goToDataMode() {
     this->m_receiveMode = DATA;
     this->m_lastSequenceIndex = 0;
-    this->m_lastPacketWriteStatus = Os::File::MAX_STATUS;
+    this->m_endReceived = false;
 }
 
 }  // namespace Svc
@@ -16,6 +16,7 @@
 #include <Fw/FilePacket/FilePacket.hpp>
 #include <Os/File.hpp>
 #include <Svc/FileUplink/FileUplinkComponentAc.hpp>
+#include <config/FileUplinkCfg.hpp>
 
 namespace Svc {
 
@@ -30,10 +31,48 @@ class FileUplink final : public FileUplinkComponentBase {
     //! The ReceiveMode type
     typedef enum { START, DATA } ReceiveMode;
 
+    //! The byte ranges of a file written so far, kept sorted and disjoint
+    class Extents {
+        friend class FileUplinkTester;
+
+      public:
+        //! Construct an empty Extents object
+        Extents() : m_count(0) {}
+
+      public:
+        //! Remove all extents
+        void reset() { this->m_count = 0; }
+
+        //! Record the bytes [start, end) as written, merging with overlapping or adjacent extents
+        //! \return false if recording them would need more than FILEUPLINK_MAX_EXTENTS extents
+        bool add(const U32 start, const U32 end);
+
+        //! Find the first range of bytes within [start, end) not covered by any extent
+        //! \return true if a gap [gapStart, gapEnd) was found, false if [start, end) is fully covered
+        bool findGap(const U32 start, const U32 end, U32& gapStart, U32& gapEnd) const;
+
+      private:
+        //! A range [start, end) of written bytes
+        struct Extent {
+            U32 start;
+            U32 end;
+        };
+
+        //! The extents, sorted by start offset
+        Extent m_extents[FILEUPLINK_MAX_EXTENTS];
+
+        //! The number of extents in use
+        U32 m_count;
+    };
+
     //! An object representing an incoming file
     class File {
         friend class FileUplinkTester;
 
+      public:
+        //! Construct a File object
+        File() : size(0), m_position(0), m_bufferOffset(0), m_bufferLength(0) {}
+
       public:
         //! The file size
         U32 size;
@@ -48,15 +87,50 @@ class FileUplink final : public FileUplinkComponentBase {
         //! The checksum for the file
         ::CFDP::Checksum m_checksum;
 
+        //! The byte ranges written to the OS file and counted in the checksum
+        Extents m_received;
+
+        //! The position of the OS file, or an invalid value when unknown
+        U32 m_position;
+
+        //! The write-back buffer, holding one contiguous run of data not yet written to the OS file
+        U8 m_buffer[FILEUPLINK_WRITE_BUFFER_SIZE];
+
+        //! The file offset of the data in the write-back buffer
+        U32 m_bufferOffset;
+
+        //! The number of bytes in the write-back buffer
+        U32 m_bufferLength;
+
       public:
         //! Open the OS file for writing and initialize the checksum
         Os::File::Status open(const Fw::FilePacket::StartPacket& startPacket);
 
-        //! Write bytes into the OS file and update the checksum
+        //! Write the bytes not yet received into the OS file, through the write-back buffer
         Os::File::Status write(const U8* const data, const U32 byteOffset, const U32 length);
 
+        //! Write the write-back buffer into the OS file
+        Os::File::Status flush();
+
+        //! Drop the data in the write-back buffer without writing it
+        void discard() { this->m_bufferLength = 0; }
+
+        //! Check whether all bytes in [byteOffset, byteOffset + length) have been received
+        bool isReceived(const U32 byteOffset, const U32 length) const;
+
+        //! Find the first range of bytes within [start, end) not yet received
+        //! \return true if a gap [gapStart, gapEnd) was found, false if [start, end) has been received
+        bool findUnreceived(const U32 start, const U32 end, U32& gapStart, U32& gapEnd) const;
+
         //! Get the checksum
         void getChecksum(::CFDP::Checksum& checksum) { checksum = this->m_checksum; }
+
+      private:
+        //! Add received bytes to the write-back buffer, flushing it first when they do not extend its run
+        Os::File::Status stage(const U8* const data, const U32 byteOffset, const U32 length);
+
+        //! Write received bytes into the OS file, then record them and update the checksum
+        Os::File::Status writeThrough(const U8* const data, const U32 byteOffset, const U32 length);
     };
 
     //! Object to record files received
@@ -135,6 +209,12 @@ class FileUplink final : public FileUplinkComponentBase {
         //! Record a Bad Checksum warning
         void badChecksum(const U32 computed, const U32 read);
 
+        //! Record a File Incomplete warning
+        void fileIncomplete(Fw::LogStringArg& fileName, const U32 missingBytes, const U32 missingRanges);
+
+        //! Record a Retransmit Timeout warning
+        void retransmitTimeout(Fw::LogStringArg& fileName);
+
       private:
         //! Record a warning
         void warning() {
@@ -164,6 +244,12 @@ class FileUplink final : public FileUplinkComponentBase {
     //!
     ~FileUplink();
 
+    //! Configure retransmission of data missing at the END packet
+    //!
+    void configure(const U32 retransmitTimeout  //!< Number of run port calls to wait for missing data after the
+                                                //!< END packet. Zero (the default) finishes the file at the END packet.
+    );
+
   private:
     // ----------------------------------------------------------------------
     // Handler implementations for user-defined typed input ports
@@ -181,6 +267,12 @@ class FileUplink final : public FileUplinkComponentBase {
                         U32 key                    /*!< Value to return to pinger*/
     );
 
+    //! Handler implementation for run
+    //!
+    void run_handler(const FwIndexType portNum,  //!< The port number
+                     U32 context                 //!< The call order
+    );
+
   private:
     // ----------------------------------------------------------------------
     // Private helper functions
@@ -201,11 +293,17 @@ class FileUplink final : public FileUplinkComponentBase {
     //! Check sequence index
     void checkSequenceIndex(const U32 sequenceIndex);
 
-    //! Check if a received packet is a duplicate
-    bool checkDuplicatedPacket(const U32 sequenceIndex);
+    //! Compare the computed checksum with the one stored in the END packet
+    void compareChecksums();
 
-    //! Compare checksums
-    void compareChecksums(const Fw::FilePacket::EndPacket& endPacket);
+    //! Finish the file once all of its data has been received after the END packet
+    void finishIfComplete();
+
+    //! Check the checksum, then announce the file and go to START mode
+    void finishFile();
+
+    //! Report the missing byte ranges of the file
+    void reportMissingRanges();
 
     //! Go to START mode
     void goToStartMode();
@@ -224,8 +322,17 @@ class FileUplink final : public FileUplinkComponentBase {
     //! The sequence index of the last packet received
     U32 m_lastSequenceIndex;
 
-    //! The write status of the last packet received
-    Os::File::Status m_lastPacketWriteStatus;
+    //! Whether the END packet has been received for the file being assembled
+    bool m_endReceived;
+
+    //! Number of run port calls to wait for missing data after the END packet, zero when not retransmitting
+    U32 m_retransmitTimeout;
+
+    //! Number of run port calls since the END packet or the last data packet after it
+    U32 m_retransmitTicks;
+
+    //! The checksum stored in the END packet
+    ::CFDP::Checksum m_endChecksum;
 
     //! The file being assembled
     File m_file;
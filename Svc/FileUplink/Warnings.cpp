@@ -45,6 +45,16 @@ void FileUplink::Warnings::fileWrite(Fw::LogStringArg& fileName) {
     this->warning();
 }
 
+void FileUplink::Warnings::fileIncomplete(Fw::LogStringArg& fileName, const U32 missingBytes, const U32 missingRanges) {
+    this->m_fileUplink->log_WARNING_HI_FileIncomplete(fileName, missingBytes, missingRanges);
+    this->warning();
+}
+
+void FileUplink::Warnings::retransmitTimeout(Fw::LogStringArg& fileName) {
+    this->m_fileUplink->log_WARNING_HI_RetransmitTimeout(fileName);
+    this->warning();
+}
+
 void FileUplink::Warnings::badChecksum(const U32 computed, const U32 read) {
     this->m_fileUplink->log_WARNING_HI_BadChecksum(this->m_fileUplink->m_file.name, computed, read);
     this->warning();
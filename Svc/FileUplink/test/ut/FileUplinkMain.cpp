@@ -64,6 +64,26 @@ TEST(FileUplink, CancelPacketInDataMode) {
     tester.cancelPacketInDataMode();
 }
 
+TEST(FileUplink, PacketsReordered) {
+    Svc::FileUplinkTester tester;
+    tester.packetsReordered();
+}
+
+TEST(FileUplink, PacketRetransmitted) {
+    Svc::FileUplinkTester tester;
+    tester.packetRetransmitted();
+}
+
+TEST(FileUplink, PacketMissingAtEnd) {
+    Svc::FileUplinkTester tester;
+    tester.packetMissingAtEnd();
+}
+
+TEST(FileUplink, RetransmitTimeout) {
+    Svc::FileUplinkTester tester;
+    tester.retransmitTimeout();
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
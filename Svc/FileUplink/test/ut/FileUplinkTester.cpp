@@ -19,6 +19,7 @@
 #define INSTANCE 0
 #define MAX_HISTORY_SIZE 10
 #define QUEUE_DEPTH 10
+#define RETRANSMIT_TIMEOUT 3
 
 namespace Svc {
 
@@ -163,14 +164,28 @@ void FileUplinkTester ::fileWriteError() {
     // Close the file so writing will fail
     this->component.m_file.osFile.close();
 
-    // Send the data packet (packet 1)
+    // Send the data packet (packet 1), held in the write-back buffer
     const size_t byteOffset = PACKET_SIZE;
     this->sendDataPacket(byteOffset, packetData);
-    ASSERT_TLM_SIZE(2);
+    ASSERT_TLM_SIZE(1);
     ASSERT_TLM_PacketsReceived(0, ++this->expectedPacketsReceived);
+    ASSERT_EVENTS_SIZE(0);
+
+    // Send the end packet (packet 2), writing the buffer fails and the file ends incomplete
+    CFDP::Checksum checksum;
+    this->sendEndPacket(checksum);
+    ASSERT_TLM_SIZE(4);
+    ASSERT_TLM_PacketsReceived(0, ++this->expectedPacketsReceived);
+    ASSERT_TLM_Warnings_SIZE(2);
     ASSERT_TLM_Warnings(0, 1);
-    ASSERT_EVENTS_SIZE(1);
+    ASSERT_TLM_Warnings(1, 2);
+    ASSERT_TLM_FilesReceived(0, 1);
+    ASSERT_EVENTS_SIZE(4);
     ASSERT_EVENTS_FileWriteError(0, destPath);
+    ASSERT_EVENTS_FileIncomplete(0, destPath, fileSize, 1);
+    ASSERT_EVENTS_MissingRange(0, 0, fileSize);
+    ASSERT_EVENTS_FileReceived(0, destPath);
+    ASSERT_EQ(FileUplink::START, this->component.m_receiveMode);
 }
 
 void FileUplinkTester ::startPacketInDataMode() {
@@ -289,7 +304,6 @@ void FileUplinkTester ::packetDuplicated() {
 
     ASSERT_EQ(0, component.m_lastSequenceIndex);
     ASSERT_EQ(1, this->sequenceIndex);
-    ASSERT_EQ(Os::File::MAX_STATUS, component.m_lastPacketWriteStatus);
 
     // Send data packet 1
     const size_t byteOffset = 0;
@@ -298,14 +312,15 @@ void FileUplinkTester ::packetDuplicated() {
     ASSERT_TLM_PacketsReceived(0, ++this->expectedPacketsReceived);
     ASSERT_TLM_Warnings_SIZE(0);
 
-    // capture the checksum after sending the first packet
+    // capture the checksum after writing the first packet, data is only counted once it leaves the write-back buffer
+    ASSERT_EQ(Os::File::OP_OK, component.m_file.flush());
     const ::CFDP::Checksum expectedChecksum(component.m_file.m_checksum);
+    ASSERT_NE(::CFDP::Checksum(), expectedChecksum);
 
     // Simulate duplication of packet 1
     --this->sequenceIndex;
 
     ASSERT_EQ(this->sequenceIndex, component.m_lastSequenceIndex);
-    ASSERT_EQ(Os::File::OP_OK, component.m_lastPacketWriteStatus);
 
     // Send data packet 1 again
     this->sendDataPacket(byteOffset, packetData);
@@ -317,9 +332,10 @@ void FileUplinkTester ::packetDuplicated() {
     ASSERT_EVENTS_PacketDuplicate(0, component.m_lastSequenceIndex);
 
     // verify that the checksum hasn't changed
+    ASSERT_EQ(Os::File::OP_OK, component.m_file.flush());
     ASSERT_EQ(expectedChecksum, component.m_file.m_checksum);
 
-    this->removeFile("test.bin");
+    this->removeFile(destPath);
 }
 
 void FileUplinkTester ::cancelPacketInStartMode() {
@@ -382,6 +398,188 @@ void FileUplinkTester ::cancelPacketInDataMode() {
     this->removeFile("test.bin");
 }
 
+void FileUplinkTester ::packetsReordered() {
+    const char* const sourcePath = "source.bin";
+    const char* const destPath = "dest.bin";
+    const U32 numPackets = 3;
+    U8 packetData[numPackets][PACKET_SIZE] = {{0, 1, 2, 3, 4}, {5, 6, 7, 8, 9}, {10, 11, 12, 13, 14}};
+    const U8* const linearPacketData = reinterpret_cast<U8*>(packetData);
+    const size_t fileSize = sizeof(packetData);
+
+    // Send the start packet
+    this->sendStartPacket(sourcePath, destPath, fileSize);
+    ASSERT_EVENTS_SIZE(0);
+
+    // Send the data packets in the order 2, 0, 1
+    const size_t order[numPackets] = {2, 0, 1};
+    for (size_t i = 0; i < numPackets; ++i) {
+        this->sendDataPacket(order[i] * PACKET_SIZE, packetData[order[i]]);
+        ASSERT_TLM_SIZE(1);
+        ASSERT_TLM_PacketsReceived(0, ++this->expectedPacketsReceived);
+        ASSERT_EVENTS_SIZE(0);
+    }
+
+    // Packets 0 and 1 are adjacent and are coalesced into one pending write
+    ASSERT_EQ(0U, this->component.m_file.m_bufferOffset);
+    ASSERT_EQ(2U * PACKET_SIZE, this->component.m_file.m_bufferLength);
+
+    // Send the end packet
+    CFDP::Checksum checksum;
+    checksum.update(linearPacketData, 0, fileSize);
+    this->sendEndPacket(checksum);
+    ASSERT_TLM_SIZE(2);
+    ASSERT_TLM_PacketsReceived(0, ++this->expectedPacketsReceived);
+    ASSERT_TLM_FilesReceived(0, 1);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileReceived(0, destPath);
+    ASSERT_EQ(FileUplink::START, this->component.m_receiveMode);
+
+    // Verify the file data
+    this->verifyFileData(destPath, linearPacketData, fileSize);
+
+    // Remove the file
+    this->removeFile(destPath);
+}
+
+void FileUplinkTester ::packetRetransmitted() {
+    const char* const sourcePath = "source.bin";
+    const char* const destPath = "dest.bin";
+    const U32 numPackets = 3;
+    U8 packetData[numPackets][PACKET_SIZE] = {{0, 1, 2, 3, 4}, {5, 6, 7, 8, 9}, {10, 11, 12, 13, 14}};
+    const U8* const linearPacketData = reinterpret_cast<U8*>(packetData);
+    const size_t fileSize = sizeof(packetData);
+    this->component.configure(RETRANSMIT_TIMEOUT);
+
+    // Send the start packet (packet 0)
+    this->sendStartPacket(sourcePath, destPath, fileSize);
+    ASSERT_EVENTS_SIZE(0);
+
+    // Send data packet 1
+    this->sendDataPacket(0, packetData[0]);
+    ASSERT_EVENTS_SIZE(0);
+
+    // Simulate dropping of packet 2, then send data packet 3
+    ++this->sequenceIndex;
+    this->sendDataPacket(2 * PACKET_SIZE, packetData[2]);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_PacketOutOfOrder(0, 3, 1);
+
+    // Send the end packet (packet 4), the missing range is reported and the file stays open
+    CFDP::Checksum checksum;
+    checksum.update(linearPacketData, 0, fileSize);
+    this->sendEndPacket(checksum);
+    ASSERT_TLM_SIZE(2);
+    ASSERT_TLM_Warnings(0, 2);
+    ASSERT_TLM_FilesReceived_SIZE(0);
+    ASSERT_EVENTS_SIZE(2);
+    ASSERT_EVENTS_FileIncomplete(0, destPath, PACKET_SIZE, 1);
+    ASSERT_EVENTS_MissingRange(0, PACKET_SIZE, PACKET_SIZE);
+    ASSERT_from_fileAnnounce_SIZE(0);
+    ASSERT_EQ(FileUplink::DATA, this->component.m_receiveMode);
+
+    // Retransmit packet 2, completing the file
+    this->sequenceIndex = 2;
+    this->sendDataPacket(PACKET_SIZE, packetData[1]);
+    ASSERT_TLM_SIZE(2);
+    ASSERT_TLM_FilesReceived(0, 1);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileReceived(0, destPath);
+    ASSERT_from_fileAnnounce_SIZE(1);
+    ASSERT_EQ(FileUplink::START, this->component.m_receiveMode);
+
+    // Verify the file data
+    this->verifyFileData(destPath, linearPacketData, fileSize);
+
+    // Remove the file
+    this->removeFile(destPath);
+}
+
+void FileUplinkTester ::packetMissingAtEnd() {
+    const char* const sourcePath = "source.bin";
+    const char* const destPath = "dest.bin";
+    const U32 numPackets = 3;
+    U8 packetData[numPackets][PACKET_SIZE] = {{0, 1, 2, 3, 4}, {5, 6, 7, 8, 9}, {10, 11, 12, 13, 14}};
+    const U8* const linearPacketData = reinterpret_cast<U8*>(packetData);
+    const size_t fileSize = sizeof(packetData);
+
+    // Send the start packet (packet 0) and data packet 1
+    this->sendStartPacket(sourcePath, destPath, fileSize);
+    this->sendDataPacket(0, packetData[0]);
+    ASSERT_EVENTS_SIZE(0);
+
+    // Simulate dropping of packet 2, then send data packet 3
+    ++this->sequenceIndex;
+    this->sendDataPacket(2 * PACKET_SIZE, packetData[2]);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_PacketOutOfOrder(0, 3, 1);
+
+    // Send the end packet (packet 4), without retransmission the file ends with the missing range
+    CFDP::Checksum checksum;
+    checksum.update(linearPacketData, 0, fileSize);
+    this->sendEndPacket(checksum);
+    ASSERT_TLM_FilesReceived(0, 1);
+    ASSERT_EVENTS_SIZE(4);
+    ASSERT_EVENTS_MissingRange(0, PACKET_SIZE, PACKET_SIZE);
+    ASSERT_EVENTS_FileIncomplete(0, destPath, PACKET_SIZE, 1);
+    ASSERT_EVENTS_BadChecksum_SIZE(1);
+    ASSERT_EVENTS_FileReceived(0, destPath);
+    ASSERT_from_fileAnnounce_SIZE(1);
+    ASSERT_EQ(FileUplink::START, this->component.m_receiveMode);
+
+    // Remove the file
+    this->removeFile(destPath);
+}
+
+void FileUplinkTester ::retransmitTimeout() {
+    const char* const sourcePath = "source.bin";
+    const char* const destPath = "dest.bin";
+    const U32 numPackets = 3;
+    U8 packetData[numPackets][PACKET_SIZE] = {{0, 1, 2, 3, 4}, {5, 6, 7, 8, 9}, {10, 11, 12, 13, 14}};
+    const U8* const linearPacketData = reinterpret_cast<U8*>(packetData);
+    const size_t fileSize = sizeof(packetData);
+    this->component.configure(RETRANSMIT_TIMEOUT);
+
+    // Run calls before the END packet do not count
+    this->sendStartPacket(sourcePath, destPath, fileSize);
+    for (U32 i = 0; i < RETRANSMIT_TIMEOUT; i++) {
+        this->runOnce();
+    }
+    ASSERT_EQ(FileUplink::DATA, this->component.m_receiveMode);
+
+    // Send only data packet 3 and the end packet, leaving the first two packets missing
+    this->sequenceIndex = 3;
+    this->sendDataPacket(2 * PACKET_SIZE, packetData[2]);
+    CFDP::Checksum checksum;
+    checksum.update(linearPacketData, 0, fileSize);
+    this->sendEndPacket(checksum);
+    ASSERT_EVENTS_FileIncomplete(0, destPath, 2 * PACKET_SIZE, 1);
+    ASSERT_EQ(FileUplink::DATA, this->component.m_receiveMode);
+
+    // A retransmitted packet restarts the timeout
+    for (U32 i = 0; i < RETRANSMIT_TIMEOUT - 1; i++) {
+        this->runOnce();
+    }
+    this->sequenceIndex = 1;
+    this->sendDataPacket(0, packetData[0]);
+    ASSERT_EQ(FileUplink::DATA, this->component.m_receiveMode);
+    for (U32 i = 0; i < RETRANSMIT_TIMEOUT - 1; i++) {
+        this->runOnce();
+    }
+    ASSERT_EVENTS_SIZE(0);
+    ASSERT_EQ(FileUplink::DATA, this->component.m_receiveMode);
+
+    // The file is abandoned when the rest never arrives
+    this->runOnce();
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_RetransmitTimeout(0, destPath);
+    ASSERT_TLM_FilesReceived_SIZE(0);
+    ASSERT_from_fileAnnounce_SIZE(0);
+    ASSERT_EQ(FileUplink::START, this->component.m_receiveMode);
+
+    // Remove the file
+    this->removeFile(destPath);
+}
+
 // ----------------------------------------------------------------------
 // Handlers for from ports
 // ----------------------------------------------------------------------
@@ -425,6 +623,9 @@ void FileUplinkTester ::connectPorts() {
 
     // announce
     this->component.set_fileAnnounce_OutputPort(0, this->get_from_fileAnnounce(0));
+
+    // run
+    this->connect_to_run(0, this->component.get_run_InputPort(0));
 }
 
 void FileUplinkTester ::initComponents() {
@@ -456,6 +657,12 @@ void FileUplinkTester ::sendFilePacket(const Fw::FilePacket& filePacket) {
     ASSERT_from_bufferSendOut(0, buffer);
 }
 
+void FileUplinkTester ::runOnce() {
+    this->clearHistory();
+    this->invoke_to_run(0, 0);
+    this->component.doDispatch();
+}
+
 void FileUplinkTester ::sendStartPacket(const char* const sourcePath,
                                         const char* const destPath,
                                         const size_t fileSize) {
@@ -87,6 +87,22 @@ class FileUplinkTester : public FileUplinkGTestBase {
     //!
     void cancelPacketInDataMode();
 
+    //! Send a file with its packets reordered
+    //!
+    void packetsReordered();
+
+    //! Send a file with a lost packet retransmitted after the END packet
+    //!
+    void packetRetransmitted();
+
+    //! Send a file with a lost packet and retransmission disabled
+    //!
+    void packetMissingAtEnd();
+
+    //! Send a file with lost packets that are not retransmitted in time
+    //!
+    void retransmitTimeout();
+
   private:
     // ----------------------------------------------------------------------
     // Handlers for from ports
@@ -120,6 +136,10 @@ class FileUplinkTester : public FileUplinkGTestBase {
     //!
     void sendFilePacket(const Fw::FilePacket& filePacket);
 
+    //! Invoke the run port and dispatch the call
+    //!
+    void runOnce();
+
     //! Send a StartPacket
     //!
     void sendStartPacket(const char* const sourcePath,  //!< The source path
@@ -19,6 +19,7 @@ FpySequencer ::FpySequencer(const char* const compName)
       m_allocatorId(0),
       m_sequenceFilePath("<invalid_seq>"),
       m_sequenceObj(),
+      m_decodedStatementCount(0),
       m_computedCRC(0),
       m_sequenceBlockState(),
       m_savedOpCode(0),
@@ -446,8 +447,13 @@ void FpySequencer::updateDebugTelemetryStruct() {
         }
 
         const Fpy::Statement& nextStmt = this->m_sequenceObj.get_statements()[this->m_runtime.nextStatementIndex];
+        const DirectiveUnion* directive = this->getDecodedDirective(this->m_runtime.nextStatementIndex);
         DirectiveUnion directiveUnion;
-        Fw::Success status = this->deserializeDirective(nextStmt, directiveUnion);
+        Fw::Success status = Fw::Success::SUCCESS;
+        if (directive == nullptr) {
+            status = this->deserializeDirective(nextStmt, directiveUnion);
+            directive = &directiveUnion;
+        }
 
         if (status != Fw::Success::SUCCESS) {
             this->m_debug.reachedEndOfFile = false;
@@ -464,7 +470,7 @@ void FpySequencer::updateDebugTelemetryStruct() {
             this->m_debug.reachedEndOfFile = false;
             this->m_debug.nextStatementReadSuccess = true;
             this->m_debug.nextStatementOpcode = nextStmt.get_opCode();
-            this->m_debug.nextCmdOpcode = directiveUnion.constCmd.get_opCode();
+            this->m_debug.nextCmdOpcode = directive->constCmd.get_opCode();
             this->m_debug.nextStatementIndex = this->m_runtime.nextStatementIndex;
             this->m_debug.stackSize = this->m_runtime.stack.size;
             return;
@@ -490,6 +496,7 @@ void FpySequencer::updateDebugTelemetryStruct() {
 void FpySequencer::parametersLoaded() {
     parameterUpdated(PARAMID_STATEMENT_TIMEOUT_SECS);
     parameterUpdated(PARAMID_FLAG_DEFAULT_EXIT_ON_CMD_FAIL);
+    parameterUpdated(PARAMID_STATEMENT_BUDGET);
 }
 
 void FpySequencer::parameterUpdated(FwPrmIdType id) {
@@ -503,6 +510,10 @@ void FpySequencer::parameterUpdated(FwPrmIdType id) {
             this->tlmWrite_PRM_FLAG_DEFAULT_EXIT_ON_CMD_FAIL(this->paramGet_FLAG_DEFAULT_EXIT_ON_CMD_FAIL(valid));
             break;
         }
+        case PARAMID_STATEMENT_BUDGET: {
+            this->tlmWrite_PRM_STATEMENT_BUDGET(this->paramGet_STATEMENT_BUDGET(valid));
+            break;
+        }
         default: {
             FW_ASSERT(0, static_cast<FwAssertArgType>(id));  // coding error, forgot to include in switch statement
         }
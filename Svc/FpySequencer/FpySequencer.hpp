@@ -603,6 +603,14 @@ class FpySequencer : public FpySequencerComponentBase {
     Fw::String m_sequenceFilePath;
     // the sequence, loaded in memory
     Fpy::Sequence m_sequenceObj;
+    // directives decoded from m_sequenceObj during validation, one per statement. each entry points
+    // into m_decodedArena, or is nullptr if the statement must be decoded at dispatch time
+    const DirectiveUnion* m_decodedDirectives[Fpy::MAX_SEQUENCE_STATEMENT_COUNT];
+    // how many entries of m_decodedDirectives are valid for m_sequenceObj
+    U32 m_decodedStatementCount;
+    // backing storage for decoded directives. only the union member for the opcode is
+    // constructed, so each entry takes up the size of its own type instead of the whole union
+    alignas(DirectiveUnion) U8 m_decodedArena[Fpy::DECODED_DIRECTIVE_ARENA_SIZE];
     // live running computation of CRC (updated as we read)
     U32 m_computedCRC;
 
@@ -726,6 +734,8 @@ class FpySequencer : public FpySequencerComponentBase {
     // reads and validates the footer from the m_sequenceBuffer
     // return SUCCESS if sequence is valid, FAILURE otherwise
     Fw::Success readFooter();
+    // decodes the statements of a validated sequence into m_decodedArena
+    void predecodeStatements();
 
     // reads some bytes from the open file into the m_sequenceBuffer.
     // updates the CRC by default, but can be turned off if the contents
@@ -746,14 +756,33 @@ class FpySequencer : public FpySequencerComponentBase {
     // dispatches the next statement
     Signal dispatchStatement();
 
+    // returns the directive pre-decoded for a statement during validation,
+    // or nullptr if the statement has to be decoded when it is dispatched
+    const DirectiveUnion* getDecodedDirective(U32 statementIdx) const;
+
     // deserializes a directive from bytes into the Fpy type
     // returns success if able to deserialize, and returns the Fpy type object
     // as a reference, in a union of all the possible directive type objects
     Fw::Success deserializeDirective(const Fpy::Statement& stmt, DirectiveUnion& deserializedDirective);
 
+    // decodes the args of a statement into the Fpy type without emitting any events.
+    // decodedSize is set to the size of the Fpy type for this opcode, or 0 if the opcode is unknown
+    Fw::SerializeStatus decodeDirective(const Fpy::Statement& stmt,
+                                        Fw::ExternalSerializeBuffer& argBuf,
+                                        DirectiveUnion& deserializedDirective,
+                                        FwSizeType& decodedSize);
+
     // dispatches a deserialized sequencer directive to the right handler.
     void dispatchDirective(const DirectiveUnion& directive, const Fpy::DirectiveId& id);
 
+    // returns true if the directive can't block or wait on anything outside of the
+    // sequencer, so it can run immediately inside of dispatchStatement
+    static bool canRunInline(const Fpy::DirectiveId& id);
+
+    // runs a directive that canRunInline immediately, instead of through its internal interface.
+    // returns stmtResponse_success or stmtResponse_failure
+    Signal runDirectiveInline(const DirectiveUnion& directive, const Fpy::DirectiveId& id);
+
     // checks whether the currently executing statement timed out
     Signal checkStatementTimeout();
 
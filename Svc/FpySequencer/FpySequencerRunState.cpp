@@ -13,148 +13,171 @@ U32 FpySequencer::currentStatementIdx() {
     return this->m_runtime.nextStatementIndex - 1;
 }
 
-Signal FpySequencer::dispatchStatement() {
-    // check to make sure no array out of bounds, or if it is out of bounds it's only 1 out of bound
-    // as that indicates eof
-    FW_ASSERT(this->m_runtime.nextStatementIndex <= this->m_sequenceObj.get_header().get_statementCount());
+// returns the directive pre-decoded for a statement during validation,
+// or nullptr if the statement has to be decoded when it is dispatched
+const FpySequencer::DirectiveUnion* FpySequencer::getDecodedDirective(U32 statementIdx) const {
+    if (statementIdx >= this->m_decodedStatementCount) {
+        return nullptr;
+    }
+    return this->m_decodedDirectives[statementIdx];
+}
 
-    if (this->m_runtime.nextStatementIndex == this->m_sequenceObj.get_header().get_statementCount()) {
-        return Signal::result_dispatchStatement_noMoreStatements;
+Signal FpySequencer::dispatchStatement() {
+    // directives that can't block run back to back, up to the statement budget, before we
+    // yield to the state machine. breakpoints are only checked by the state machine, so
+    // run one statement at a time while one could be hit
+    Fw::ParamValid valid;
+    U32 statementBudget = this->paramGet_STATEMENT_BUDGET(valid);
+    if ((valid != Fw::ParamValid::VALID && valid != Fw::ParamValid::DEFAULT) || statementBudget == 0 ||
+        this->m_breakpoint.breakpointInUse || this->m_breakpoint.breakBeforeNextLine) {
+        statementBudget = 1;
     }
 
-    const Fpy::Statement& nextStatement = this->m_sequenceObj.get_statements()[this->m_runtime.nextStatementIndex];
-    this->m_runtime.nextStatementIndex++;
-    this->m_runtime.currentStatementOpcode = nextStatement.get_opCode();
-    this->m_runtime.currentCmdOpcode = 0;  // we haven't deserialized the directive yet, so we don't know if it's a cmd
+    for (U32 statementsRun = 1;; statementsRun++) {
+        // check to make sure no array out of bounds, or if it is out of bounds it's only 1 out of bound
+        // as that indicates eof
+        FW_ASSERT(this->m_runtime.nextStatementIndex <= this->m_sequenceObj.get_header().get_statementCount());
 
-    Fw::Success result;
-    DirectiveUnion directiveUnion;
+        if (this->m_runtime.nextStatementIndex == this->m_sequenceObj.get_header().get_statementCount()) {
+            return Signal::result_dispatchStatement_noMoreStatements;
+        }
 
-    result = this->deserializeDirective(nextStatement, directiveUnion);
+        const Fpy::Statement& nextStatement = this->m_sequenceObj.get_statements()[this->m_runtime.nextStatementIndex];
+        this->m_runtime.nextStatementIndex++;
+        this->m_runtime.currentStatementOpcode = nextStatement.get_opCode();
+        // we haven't deserialized the directive yet, so we don't know if it's a cmd
+        this->m_runtime.currentCmdOpcode = 0;
 
-    if (!result) {
-        return Signal::result_dispatchStatement_failure;
-    }
+        // use the directive decoded during validation if there is one, otherwise decode it now
+        const DirectiveUnion* directive = this->getDecodedDirective(this->currentStatementIdx());
+        DirectiveUnion directiveUnion;
+        if (directive == nullptr) {
+            Fw::Success result = this->deserializeDirective(nextStatement, directiveUnion);
 
-    if (this->m_runtime.currentStatementOpcode == Fpy::DirectiveId::CONST_CMD) {
-        // update the opcode of the cmd we will await
-        this->m_runtime.currentCmdOpcode = directiveUnion.constCmd.get_opCode();
-    }
+            if (!result) {
+                return Signal::result_dispatchStatement_failure;
+            }
+            directive = &directiveUnion;
+        }
 
-    this->dispatchDirective(directiveUnion,
-                            Fpy::DirectiveId(static_cast<Fpy::DirectiveId::T>(nextStatement.get_opCode())));
-    this->m_runtime.currentStatementDispatchTime =
-        getTime();  // set dispatch time right after we have successfully dispatched
+        if (this->m_runtime.currentStatementOpcode == Fpy::DirectiveId::CONST_CMD) {
+            // update the opcode of the cmd we will await
+            this->m_runtime.currentCmdOpcode = directive->constCmd.get_opCode();
+        }
 
-    this->m_statementsDispatched++;
+        const Fpy::DirectiveId id(static_cast<Fpy::DirectiveId::T>(nextStatement.get_opCode()));
+        if (statementsRun < statementBudget && FpySequencer::canRunInline(id)) {
+            // run it now, then move straight on to the next statement
+            this->m_statementsDispatched++;
+            if (this->runDirectiveInline(*directive, id) != Signal::stmtResponse_success) {
+                return Signal::result_dispatchStatement_failure;
+            }
+            continue;
+        }
+
+        this->dispatchDirective(*directive, id);
+        this->m_runtime.currentStatementDispatchTime =
+            getTime();  // set dispatch time right after we have successfully dispatched
+
+        this->m_statementsDispatched++;
 
-    return Signal::result_dispatchStatement_success;
+        return Signal::result_dispatchStatement_success;
+    }
 }
 
 // deserializes a directive from bytes into the Fpy type
 // returns success if able to deserialize, and returns the Fpy type object
 // as a reference, in a union of all the possible directive type objects
 Fw::Success FpySequencer::deserializeDirective(const Fpy::Statement& stmt, DirectiveUnion& deserializedDirective) {
-    Fw::SerializeStatus status;
     // make our own esb so we can deser from stmt without breaking its constness
     Fw::ExternalSerializeBuffer argBuf(const_cast<U8*>(stmt.get_argBuf().getBuffAddr()), stmt.get_argBuf().getSize());
     argBuf.setBuffLen(stmt.get_argBuf().getSize());
 
+    FwSizeType decodedSize = 0;
+    Fw::SerializeStatus status = this->decodeDirective(stmt, argBuf, deserializedDirective, decodedSize);
+    if (decodedSize == 0) {
+        // unsure what this opcode is. check compiler version matches sequencer
+        this->log_WARNING_HI_UnknownSequencerDirective(stmt.get_opCode(), this->currentStatementIdx(),
+                                                       this->m_sequenceFilePath);
+        return Fw::Success::FAILURE;
+    }
+    if (status != Fw::SerializeStatus::FW_SERIALIZE_OK) {
+        this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(), status,
+                                                       argBuf.getDeserializeSizeLeft(), argBuf.getSize());
+        return Fw::Success::FAILURE;
+    }
+    return Fw::Success::SUCCESS;
+}
+
+// decodes the args of a statement into the Fpy type without emitting any events, so that it can be
+// used both at dispatch time and when pre-decoding a sequence during validation.
+// decodedSize is set to the size of the Fpy type for this opcode, or 0 if the opcode is unknown
+Fw::SerializeStatus FpySequencer::decodeDirective(const Fpy::Statement& stmt,
+                                                  Fw::ExternalSerializeBuffer& argBuf,
+                                                  DirectiveUnion& deserializedDirective,
+                                                  FwSizeType& decodedSize) {
+    Fw::SerializeStatus status = Fw::SerializeStatus::FW_SERIALIZE_OK;
+    decodedSize = 0;
+
     switch (stmt.get_opCode()) {
         case Fpy::DirectiveId::WAIT_REL: {
             // in order to use a type with non trivial ctor in cpp union, have to manually construct and destruct it
             new (&deserializedDirective.waitRel) FpySequencer_WaitRelDirective();
+            decodedSize = sizeof(FpySequencer_WaitRelDirective);
             // wait rel does not need deser
-            if (argBuf.getDeserializeSizeLeft() != 0) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(),
-                                                               Fw::SerializeStatus::FW_DESERIALIZE_SIZE_MISMATCH,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
-            }
             break;
         }
         case Fpy::DirectiveId::WAIT_ABS: {
             new (&deserializedDirective.waitAbs) FpySequencer_WaitAbsDirective();
+            decodedSize = sizeof(FpySequencer_WaitAbsDirective);
             // wait abs does not need deser
-            if (argBuf.getDeserializeSizeLeft() != 0) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(),
-                                                               Fw::SerializeStatus::FW_DESERIALIZE_SIZE_MISMATCH,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
-            }
             break;
         }
         case Fpy::DirectiveId::GOTO: {
             new (&deserializedDirective.gotoDirective) FpySequencer_GotoDirective();
+            decodedSize = sizeof(FpySequencer_GotoDirective);
             status = argBuf.deserializeTo(deserializedDirective.gotoDirective);
-            if (status != Fw::SerializeStatus::FW_SERIALIZE_OK || argBuf.getDeserializeSizeLeft() != 0) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(), status,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
-            }
             break;
         }
         case Fpy::DirectiveId::IF: {
             new (&deserializedDirective.ifDirective) FpySequencer_IfDirective();
+            decodedSize = sizeof(FpySequencer_IfDirective);
             status = argBuf.deserializeTo(deserializedDirective.ifDirective);
-            if (status != Fw::SerializeStatus::FW_SERIALIZE_OK || argBuf.getDeserializeSizeLeft() != 0) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(), status,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
-            }
             break;
         }
         case Fpy::DirectiveId::NO_OP: {
             new (&deserializedDirective.noOp) FpySequencer_NoOpDirective();
+            decodedSize = sizeof(FpySequencer_NoOpDirective);
             // no op does not need deser
-            if (argBuf.getDeserializeSizeLeft() != 0) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(),
-                                                               Fw::SerializeStatus::FW_DESERIALIZE_SIZE_MISMATCH,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
-            }
             break;
         }
         case Fpy::DirectiveId::PUSH_TLM_VAL: {
             new (&deserializedDirective.pushTlmVal) FpySequencer_PushTlmValDirective();
+            decodedSize = sizeof(FpySequencer_PushTlmValDirective);
             status = argBuf.deserializeTo(deserializedDirective.pushTlmVal);
-            if (status != Fw::SerializeStatus::FW_SERIALIZE_OK || argBuf.getDeserializeSizeLeft() != 0) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(), status,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
-            }
             break;
         }
         case Fpy::DirectiveId::PUSH_TLM_VAL_AND_TIME: {
             new (&deserializedDirective.pushTlmValAndTime) FpySequencer_PushTlmValAndTimeDirective();
+            decodedSize = sizeof(FpySequencer_PushTlmValAndTimeDirective);
             status = argBuf.deserializeTo(deserializedDirective.pushTlmValAndTime);
-            if (status != Fw::SerializeStatus::FW_SERIALIZE_OK || argBuf.getDeserializeSizeLeft() != 0) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(), status,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
-            }
             break;
         }
         case Fpy::DirectiveId::PUSH_PRM: {
             new (&deserializedDirective.pushPrm) FpySequencer_PushPrmDirective();
+            decodedSize = sizeof(FpySequencer_PushPrmDirective);
             status = argBuf.deserializeTo(deserializedDirective.pushPrm);
-            if (status != Fw::SerializeStatus::FW_SERIALIZE_OK || argBuf.getDeserializeSizeLeft() != 0) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(), status,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
-            }
             break;
         }
         case Fpy::DirectiveId::CONST_CMD: {
             new (&deserializedDirective.constCmd) FpySequencer_ConstCmdDirective();
+            decodedSize = sizeof(FpySequencer_ConstCmdDirective);
 
             // first deserialize the opcode
             FwOpcodeType opcode;
             status = argBuf.deserializeTo(opcode);
             if (status != Fw::SerializeStatus::FW_SERIALIZE_OK) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(), status,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
+                return status;
             }
 
             deserializedDirective.constCmd.set_opCode(opcode);
@@ -163,10 +186,7 @@ Fw::Success FpySequencer::deserializeDirective(const Fpy::Statement& stmt, Direc
 
             // check to make sure the value will fit in the FpySequencer_ConstCmdDirective::argBuf
             if (cmdArgBufSize > Fpy::MAX_DIRECTIVE_SIZE) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(),
-                                                               Fw::SerializeStatus::FW_DESERIALIZE_FORMAT_ERROR,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
+                return Fw::SerializeStatus::FW_DESERIALIZE_FORMAT_ERROR;
             }
 
             // okay, it will fit. put it in
@@ -174,9 +194,7 @@ Fw::Success FpySequencer::deserializeDirective(const Fpy::Statement& stmt, Direc
                                           Fw::Serialization::OMIT_LENGTH);
 
             if (status != Fw::SerializeStatus::FW_SERIALIZE_OK) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(), status,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
+                return status;
             }
 
             // now there should be nothing left, otherwise coding err
@@ -237,67 +255,43 @@ Fw::Success FpySequencer::deserializeDirective(const Fpy::Statement& stmt, Direc
         case Fpy::DirectiveId::ITRUNC_64_16:
         case Fpy::DirectiveId::ITRUNC_64_32: {
             new (&deserializedDirective.stackOp) FpySequencer_StackOpDirective();
-            if (argBuf.getDeserializeSizeLeft() != 0) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(),
-                                                               Fw::SerializeStatus::FW_DESERIALIZE_SIZE_MISMATCH,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
-            }
+            decodedSize = sizeof(FpySequencer_StackOpDirective);
             deserializedDirective.stackOp.set__op(stmt.get_opCode());
             break;
         }
         case Fpy::DirectiveId::EXIT: {
             new (&deserializedDirective.exit) FpySequencer_ExitDirective();
-            if (argBuf.getDeserializeSizeLeft() != 0) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(),
-                                                               Fw::SerializeStatus::FW_DESERIALIZE_SIZE_MISMATCH,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
-            }
+            decodedSize = sizeof(FpySequencer_ExitDirective);
             break;
         }
         case Fpy::DirectiveId::ALLOCATE: {
             new (&deserializedDirective.allocate) FpySequencer_AllocateDirective();
+            decodedSize = sizeof(FpySequencer_AllocateDirective);
             status = argBuf.deserializeTo(deserializedDirective.allocate);
-            if (status != Fw::SerializeStatus::FW_SERIALIZE_OK || argBuf.getDeserializeSizeLeft() != 0) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(), status,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
-            }
             break;
         }
         case Fpy::DirectiveId::STORE_REL_CONST_OFFSET: {
             new (&deserializedDirective.storeRelConstOffset) FpySequencer_StoreRelConstOffsetDirective();
+            decodedSize = sizeof(FpySequencer_StoreRelConstOffsetDirective);
             status = argBuf.deserializeTo(deserializedDirective.storeRelConstOffset);
-            if (status != Fw::SerializeStatus::FW_SERIALIZE_OK || argBuf.getDeserializeSizeLeft() != 0) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(), status,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
-            }
             break;
         }
         case Fpy::DirectiveId::LOAD_REL: {
             new (&deserializedDirective.loadRel) FpySequencer_LoadRelDirective();
+            decodedSize = sizeof(FpySequencer_LoadRelDirective);
             status = argBuf.deserializeTo(deserializedDirective.loadRel);
-            if (status != Fw::SerializeStatus::FW_SERIALIZE_OK || argBuf.getDeserializeSizeLeft() != 0) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(), status,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
-            }
             break;
         }
         case Fpy::DirectiveId::PUSH_VAL: {
             new (&deserializedDirective.pushVal) FpySequencer_PushValDirective();
+            decodedSize = sizeof(FpySequencer_PushValDirective);
 
             // how many bytes are left?
             FwSizeType bufSize = argBuf.getDeserializeSizeLeft();
 
             // check to make sure the value will fit in the FpySequencer_PushValDirective::val buf
             if (bufSize > Fpy::MAX_DIRECTIVE_SIZE) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(),
-                                                               Fw::SerializeStatus::FW_DESERIALIZE_FORMAT_ERROR,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
+                return Fw::SerializeStatus::FW_DESERIALIZE_FORMAT_ERROR;
             }
 
             // okay, it will fit. put it in
@@ -305,9 +299,7 @@ Fw::Success FpySequencer::deserializeDirective(const Fpy::Statement& stmt, Direc
                 argBuf.deserializeTo(deserializedDirective.pushVal.get_val(), bufSize, Fw::Serialization::OMIT_LENGTH);
 
             if (status != Fw::SerializeStatus::FW_SERIALIZE_OK) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(), status,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
+                return status;
             }
 
             // now there should be nothing left, otherwise coding err
@@ -320,152 +312,96 @@ Fw::Success FpySequencer::deserializeDirective(const Fpy::Statement& stmt, Direc
         }
         case Fpy::DirectiveId::DISCARD: {
             new (&deserializedDirective.discard) FpySequencer_DiscardDirective();
+            decodedSize = sizeof(FpySequencer_DiscardDirective);
             status = argBuf.deserializeTo(deserializedDirective.discard);
-            if (status != Fw::SerializeStatus::FW_SERIALIZE_OK || argBuf.getDeserializeSizeLeft() != 0) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(), status,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
-            }
             break;
         }
         case Fpy::DirectiveId::MEMCMP: {
             new (&deserializedDirective.memCmp) FpySequencer_MemCmpDirective();
+            decodedSize = sizeof(FpySequencer_MemCmpDirective);
             status = argBuf.deserializeTo(deserializedDirective.memCmp);
-            if (status != Fw::SerializeStatus::FW_SERIALIZE_OK || argBuf.getDeserializeSizeLeft() != 0) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(), status,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
-            }
             break;
         }
         case Fpy::DirectiveId::STACK_CMD: {
             new (&deserializedDirective.stackCmd) FpySequencer_StackCmdDirective();
+            decodedSize = sizeof(FpySequencer_StackCmdDirective);
             status = argBuf.deserializeTo(deserializedDirective.stackCmd);
-            if (status != Fw::SerializeStatus::FW_SERIALIZE_OK || argBuf.getDeserializeSizeLeft() != 0) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(), status,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
-            }
             break;
         }
         case Fpy::DirectiveId::PUSH_TIME: {
             new (&deserializedDirective.pushTime) FpySequencer_PushTimeDirective();
-            if (argBuf.getDeserializeSizeLeft() != 0) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(),
-                                                               Fw::SerializeStatus::FW_DESERIALIZE_SIZE_MISMATCH,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
-            }
+            decodedSize = sizeof(FpySequencer_PushTimeDirective);
             break;
         }
         case Fpy::DirectiveId::SET_FLAG: {
             new (&deserializedDirective.setFlag) FpySequencer_SetFlagDirective();
+            decodedSize = sizeof(FpySequencer_SetFlagDirective);
             status = argBuf.deserializeTo(deserializedDirective.setFlag);
-            if (status != Fw::SerializeStatus::FW_SERIALIZE_OK || argBuf.getDeserializeSizeLeft() != 0) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(), status,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
-            }
             break;
         }
         case Fpy::DirectiveId::GET_FLAG: {
             new (&deserializedDirective.getFlag) FpySequencer_GetFlagDirective();
+            decodedSize = sizeof(FpySequencer_GetFlagDirective);
             status = argBuf.deserializeTo(deserializedDirective.getFlag);
-            if (status != Fw::SerializeStatus::FW_SERIALIZE_OK || argBuf.getDeserializeSizeLeft() != 0) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(), status,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
-            }
             break;
         }
         case Fpy::DirectiveId::GET_FIELD: {
             new (&deserializedDirective.getField) FpySequencer_GetFieldDirective();
+            decodedSize = sizeof(FpySequencer_GetFieldDirective);
             status = argBuf.deserializeTo(deserializedDirective.getField);
-            if (status != Fw::SerializeStatus::FW_SERIALIZE_OK || argBuf.getDeserializeSizeLeft() != 0) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(), status,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
-            }
             break;
         }
         case Fpy::DirectiveId::PEEK: {
             new (&deserializedDirective.peek) FpySequencer_PeekDirective();
-            if (argBuf.getDeserializeSizeLeft() != 0) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(),
-                                                               Fw::SerializeStatus::FW_DESERIALIZE_SIZE_MISMATCH,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
-            }
+            decodedSize = sizeof(FpySequencer_PeekDirective);
             break;
         }
         case Fpy::DirectiveId::STORE_REL: {
             new (&deserializedDirective.storeRel) FpySequencer_StoreRelDirective();
+            decodedSize = sizeof(FpySequencer_StoreRelDirective);
             status = argBuf.deserializeTo(deserializedDirective.storeRel);
-            if (status != Fw::SerializeStatus::FW_SERIALIZE_OK || argBuf.getDeserializeSizeLeft() != 0) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(), status,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
-            }
             break;
         }
         case Fpy::DirectiveId::CALL: {
             new (&deserializedDirective.call) FpySequencer_CallDirective();
-            if (argBuf.getDeserializeSizeLeft() != 0) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(),
-                                                               Fw::SerializeStatus::FW_DESERIALIZE_SIZE_MISMATCH,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
-            }
+            decodedSize = sizeof(FpySequencer_CallDirective);
             break;
         }
         case Fpy::DirectiveId::RETURN: {
             new (&deserializedDirective.returnDirective) FpySequencer_ReturnDirective();
+            decodedSize = sizeof(FpySequencer_ReturnDirective);
             status = argBuf.deserializeTo(deserializedDirective.returnDirective);
-            if (status != Fw::SerializeStatus::FW_SERIALIZE_OK || argBuf.getDeserializeSizeLeft() != 0) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(), status,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
-            }
             break;
         }
         case Fpy::DirectiveId::LOAD_ABS: {
             new (&deserializedDirective.loadAbs) FpySequencer_LoadAbsDirective();
+            decodedSize = sizeof(FpySequencer_LoadAbsDirective);
             status = argBuf.deserializeTo(deserializedDirective.loadAbs);
-            if (status != Fw::SerializeStatus::FW_SERIALIZE_OK || argBuf.getDeserializeSizeLeft() != 0) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(), status,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
-            }
             break;
         }
         case Fpy::DirectiveId::STORE_ABS: {
             new (&deserializedDirective.storeAbs) FpySequencer_StoreAbsDirective();
+            decodedSize = sizeof(FpySequencer_StoreAbsDirective);
             status = argBuf.deserializeTo(deserializedDirective.storeAbs);
-            if (status != Fw::SerializeStatus::FW_SERIALIZE_OK || argBuf.getDeserializeSizeLeft() != 0) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(), status,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
-            }
             break;
         }
         case Fpy::DirectiveId::STORE_ABS_CONST_OFFSET: {
             new (&deserializedDirective.storeAbsConstOffset) FpySequencer_StoreAbsConstOffsetDirective();
+            decodedSize = sizeof(FpySequencer_StoreAbsConstOffsetDirective);
             status = argBuf.deserializeTo(deserializedDirective.storeAbsConstOffset);
-            if (status != Fw::SerializeStatus::FW_SERIALIZE_OK || argBuf.getDeserializeSizeLeft() != 0) {
-                this->log_WARNING_HI_DirectiveDeserializeError(stmt.get_opCode(), this->currentStatementIdx(), status,
-                                                               argBuf.getDeserializeSizeLeft(), argBuf.getSize());
-                return Fw::Success::FAILURE;
-            }
             break;
         }
         default: {
-            // unsure what this opcode is. check compiler version matches sequencer
-            this->log_WARNING_HI_UnknownSequencerDirective(stmt.get_opCode(), this->currentStatementIdx(),
-                                                           this->m_sequenceFilePath);
-            return Fw::Success::FAILURE;
+            // unknown opcode, decodedSize stays 0
+            return Fw::SerializeStatus::FW_DESERIALIZE_FORMAT_ERROR;
         }
     }
-    return Fw::Success::SUCCESS;
+
+    if (status == Fw::SerializeStatus::FW_SERIALIZE_OK && argBuf.getDeserializeSizeLeft() != 0) {
+        // every directive must consume all of its args
+        return Fw::SerializeStatus::FW_DESERIALIZE_SIZE_MISMATCH;
+    }
+    return status;
 }
 
 // dispatches a deserialized sequencer directive to the right handler.
@@ -645,6 +581,180 @@ void FpySequencer::dispatchDirective(const DirectiveUnion& directive, const Fpy:
     FW_ASSERT(0, static_cast<FwAssertArgType>(id));
 }
 
+// returns true if the directive can't block or wait on anything outside of the
+// sequencer, so it can run immediately inside of dispatchStatement
+bool FpySequencer::canRunInline(const Fpy::DirectiveId& id) {
+    switch (id) {
+        case Fpy::DirectiveId::INVALID:
+        case Fpy::DirectiveId::WAIT_REL:
+        case Fpy::DirectiveId::WAIT_ABS:
+        case Fpy::DirectiveId::PUSH_TLM_VAL:
+        case Fpy::DirectiveId::PUSH_TLM_VAL_AND_TIME:
+        case Fpy::DirectiveId::PUSH_PRM:
+        case Fpy::DirectiveId::CONST_CMD:
+        case Fpy::DirectiveId::STACK_CMD: {
+            return false;
+        }
+        default: {
+            return true;
+        }
+    }
+}
+
+// runs a directive that canRunInline immediately, instead of through its internal interface.
+// returns stmtResponse_success or stmtResponse_failure
+Signal FpySequencer::runDirectiveInline(const DirectiveUnion& directive, const Fpy::DirectiveId& id) {
+    DirectiveError error = DirectiveError::NO_ERROR;
+    Signal response = Signal::stmtResponse_failure;
+    switch (id) {
+        case Fpy::DirectiveId::GOTO: {
+            response = this->goto_directiveHandler(directive.gotoDirective, error);
+            break;
+        }
+        case Fpy::DirectiveId::IF: {
+            response = this->if_directiveHandler(directive.ifDirective, error);
+            break;
+        }
+        case Fpy::DirectiveId::NO_OP: {
+            response = this->noOp_directiveHandler(directive.noOp, error);
+            break;
+        }
+        // fallthrough on purpose
+        case Fpy::DirectiveId::OR:
+        case Fpy::DirectiveId::AND:
+        case Fpy::DirectiveId::IEQ:
+        case Fpy::DirectiveId::INE:
+        case Fpy::DirectiveId::UGT:
+        case Fpy::DirectiveId::ULT:
+        case Fpy::DirectiveId::ULE:
+        case Fpy::DirectiveId::UGE:
+        case Fpy::DirectiveId::SGT:
+        case Fpy::DirectiveId::SLT:
+        case Fpy::DirectiveId::SLE:
+        case Fpy::DirectiveId::SGE:
+        case Fpy::DirectiveId::FEQ:
+        case Fpy::DirectiveId::FNE:
+        case Fpy::DirectiveId::FLT:
+        case Fpy::DirectiveId::FLE:
+        case Fpy::DirectiveId::FGT:
+        case Fpy::DirectiveId::FGE:
+        case Fpy::DirectiveId::NOT:
+        case Fpy::DirectiveId::FPEXT:
+        case Fpy::DirectiveId::FPTRUNC:
+        case Fpy::DirectiveId::FPTOSI:
+        case Fpy::DirectiveId::FPTOUI:
+        case Fpy::DirectiveId::SITOFP:
+        case Fpy::DirectiveId::UITOFP:
+        case Fpy::DirectiveId::ADD:
+        case Fpy::DirectiveId::SUB:
+        case Fpy::DirectiveId::MUL:
+        case Fpy::DirectiveId::UDIV:
+        case Fpy::DirectiveId::SDIV:
+        case Fpy::DirectiveId::UMOD:
+        case Fpy::DirectiveId::SMOD:
+        case Fpy::DirectiveId::FADD:
+        case Fpy::DirectiveId::FSUB:
+        case Fpy::DirectiveId::FMUL:
+        case Fpy::DirectiveId::FDIV:
+        case Fpy::DirectiveId::FPOW:
+        case Fpy::DirectiveId::FLOG:
+        case Fpy::DirectiveId::FMOD:
+        case Fpy::DirectiveId::SIEXT_8_64:
+        case Fpy::DirectiveId::SIEXT_16_64:
+        case Fpy::DirectiveId::SIEXT_32_64:
+        case Fpy::DirectiveId::ZIEXT_8_64:
+        case Fpy::DirectiveId::ZIEXT_16_64:
+        case Fpy::DirectiveId::ZIEXT_32_64:
+        case Fpy::DirectiveId::ITRUNC_64_8:
+        case Fpy::DirectiveId::ITRUNC_64_16:
+        case Fpy::DirectiveId::ITRUNC_64_32: {
+            response = this->stackOp_directiveHandler(directive.stackOp, error);
+            break;
+        }
+        case Fpy::DirectiveId::EXIT: {
+            response = this->exit_directiveHandler(directive.exit, error);
+            break;
+        }
+        case Fpy::DirectiveId::ALLOCATE: {
+            response = this->allocate_directiveHandler(directive.allocate, error);
+            break;
+        }
+        case Fpy::DirectiveId::STORE_REL_CONST_OFFSET: {
+            response = this->storeRelConstOffset_directiveHandler(directive.storeRelConstOffset, error);
+            break;
+        }
+        case Fpy::DirectiveId::LOAD_REL: {
+            response = this->loadRel_directiveHandler(directive.loadRel, error);
+            break;
+        }
+        case Fpy::DirectiveId::PUSH_VAL: {
+            response = this->pushVal_directiveHandler(directive.pushVal, error);
+            break;
+        }
+        case Fpy::DirectiveId::DISCARD: {
+            response = this->discard_directiveHandler(directive.discard, error);
+            break;
+        }
+        case Fpy::DirectiveId::MEMCMP: {
+            response = this->memCmp_directiveHandler(directive.memCmp, error);
+            break;
+        }
+        case Fpy::DirectiveId::PUSH_TIME: {
+            response = this->pushTime_directiveHandler(directive.pushTime, error);
+            break;
+        }
+        case Fpy::DirectiveId::SET_FLAG: {
+            response = this->setFlag_directiveHandler(directive.setFlag, error);
+            break;
+        }
+        case Fpy::DirectiveId::GET_FLAG: {
+            response = this->getFlag_directiveHandler(directive.getFlag, error);
+            break;
+        }
+        case Fpy::DirectiveId::GET_FIELD: {
+            response = this->getField_directiveHandler(directive.getField, error);
+            break;
+        }
+        case Fpy::DirectiveId::PEEK: {
+            response = this->peek_directiveHandler(directive.peek, error);
+            break;
+        }
+        case Fpy::DirectiveId::STORE_REL: {
+            response = this->storeRel_directiveHandler(directive.storeRel, error);
+            break;
+        }
+        case Fpy::DirectiveId::CALL: {
+            response = this->call_directiveHandler(directive.call, error);
+            break;
+        }
+        case Fpy::DirectiveId::RETURN: {
+            response = this->return_directiveHandler(directive.returnDirective, error);
+            break;
+        }
+        case Fpy::DirectiveId::LOAD_ABS: {
+            response = this->loadAbs_directiveHandler(directive.loadAbs, error);
+            break;
+        }
+        case Fpy::DirectiveId::STORE_ABS: {
+            response = this->storeAbs_directiveHandler(directive.storeAbs, error);
+            break;
+        }
+        case Fpy::DirectiveId::STORE_ABS_CONST_OFFSET: {
+            response = this->storeAbsConstOffset_directiveHandler(directive.storeAbsConstOffset, error);
+            break;
+        }
+        default: {
+            // coding err, this directive can't run inline
+            FW_ASSERT(0, static_cast<FwAssertArgType>(id));
+        }
+    }
+    this->handleDirectiveErrorCode(id, error);
+    // an inline directive never sleeps or waits
+    FW_ASSERT(response == Signal::stmtResponse_success || response == Signal::stmtResponse_failure,
+              static_cast<FwAssertArgType>(response));
+    return response;
+}
+
 Signal FpySequencer::checkShouldWake() {
     Fw::Time currentTime = this->getTime();
 
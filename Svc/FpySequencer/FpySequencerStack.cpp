@@ -1,32 +1,83 @@
 #include <cstring>
+#include <type_traits>
 #include "Svc/FpySequencer/FpySequencer.hpp"
 namespace Svc {
 
+namespace {
+
+// the stack holds values big endian, the same as the sequence file and every other
+// serialized buffer. when the host byte order is known at compile time, a value is
+// moved in and out with one memcpy and at most one byte swap
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define FPY_STACK_HOST_BIG_ENDIAN 1
+#elif defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define FPY_STACK_HOST_LITTLE_ENDIAN 1
+#endif
+
+#if defined(FPY_STACK_HOST_LITTLE_ENDIAN)
+inline U8 byteSwap(U8 val) {
+    return val;
+}
+
+inline U16 byteSwap(U16 val) {
+    return __builtin_bswap16(val);
+}
+
+inline U32 byteSwap(U32 val) {
+    return __builtin_bswap32(val);
+}
+
+inline U64 byteSwap(U64 val) {
+    return __builtin_bswap64(val);
+}
+#endif
+
+// reads an unsigned value stored big endian
+template <typename U>
+inline U loadBigEndian(const U8* src) {
+#if defined(FPY_STACK_HOST_BIG_ENDIAN)
+    U val;
+    memcpy(&val, src, sizeof(U));
+    return val;
+#elif defined(FPY_STACK_HOST_LITTLE_ENDIAN)
+    U val;
+    memcpy(&val, src, sizeof(U));
+    return byteSwap(val);
+#else
+    U val = 0;
+    for (FwSizeType i = 0; i < sizeof(U); i++) {
+        val = static_cast<U>((static_cast<U64>(val) << 8) | src[i]);
+    }
+    return val;
+#endif
+}
+
+// writes an unsigned value big endian
+template <typename U>
+inline void storeBigEndian(U8* dest, U val) {
+#if defined(FPY_STACK_HOST_BIG_ENDIAN)
+    memcpy(dest, &val, sizeof(U));
+#elif defined(FPY_STACK_HOST_LITTLE_ENDIAN)
+    val = byteSwap(val);
+    memcpy(dest, &val, sizeof(U));
+#else
+    for (FwSizeType i = 0; i < sizeof(U); i++) {
+        dest[i] = static_cast<U8>(static_cast<U64>(val) >> (8 * (sizeof(U) - 1 - i)));
+    }
+#endif
+}
+
+}  // namespace
+
 template <typename T>
 T FpySequencer::Stack::pop() {
     static_assert(sizeof(T) == 8 || sizeof(T) == 4 || sizeof(T) == 2 || sizeof(T) == 1, "size must be 1, 2, 4, 8");
     FW_ASSERT(this->size >= sizeof(T), static_cast<FwAssertArgType>(this->size),
               static_cast<FwAssertArgType>(sizeof(T)));
-    // first make a byte array which can definitely store our val
-    U8 valBytes[8] = {0};
-    // now move top of stack into byte array and shrink stack
-    memcpy(valBytes, this->top() - sizeof(T), sizeof(T));
     this->size -= static_cast<Fpy::StackSizeType>(sizeof(T));
-
-    // now do appropriate byteswap on byte array
-    if (sizeof(T) == 8) {
-        return static_cast<T>((static_cast<T>(valBytes[7]) << 0) | (static_cast<T>(valBytes[6]) << 8) |
-                              (static_cast<T>(valBytes[5]) << 16) | (static_cast<T>(valBytes[4]) << 24) |
-                              (static_cast<T>(valBytes[3]) << 32) | (static_cast<T>(valBytes[2]) << 40) |
-                              (static_cast<T>(valBytes[1]) << 48) | (static_cast<T>(valBytes[0]) << 56));
-    } else if (sizeof(T) == 4) {
-        return static_cast<T>((static_cast<T>(valBytes[3]) << 0) | (static_cast<T>(valBytes[2]) << 8) |
-                              (static_cast<T>(valBytes[1]) << 16) | (static_cast<T>(valBytes[0]) << 24));
-    } else if (sizeof(T) == 2) {
-        return static_cast<T>((static_cast<T>(valBytes[1]) << 0) | (static_cast<T>(valBytes[0]) << 8));
-    } else {
-        return static_cast<T>(valBytes[0]);
-    }
+    // convert via unsigned to avoid sign extension while assembling the value
+    using UnsignedT = typename std::make_unsigned<T>::type;
+    return static_cast<T>(loadBigEndian<UnsignedT>(&this->bytes[this->size]));
 }
 
 template U8 FpySequencer::Stack::pop();
@@ -40,17 +91,23 @@ template I64 FpySequencer::Stack::pop();
 
 template <>
 F32 FpySequencer::Stack::pop<F32>() {
-    U32 endianness = this->pop<U32>();
+    FW_ASSERT(this->size >= sizeof(F32), static_cast<FwAssertArgType>(this->size),
+              static_cast<FwAssertArgType>(sizeof(F32)));
+    this->size -= static_cast<Fpy::StackSizeType>(sizeof(F32));
+    U32 bits = loadBigEndian<U32>(&this->bytes[this->size]);
     F32 val;
-    memcpy(&val, &endianness, sizeof(val));
+    memcpy(&val, &bits, sizeof(val));
     return val;
 }
 
 template <>
 F64 FpySequencer::Stack::pop<F64>() {
-    U64 endianness = this->pop<U64>();
+    FW_ASSERT(this->size >= sizeof(F64), static_cast<FwAssertArgType>(this->size),
+              static_cast<FwAssertArgType>(sizeof(F64)));
+    this->size -= static_cast<Fpy::StackSizeType>(sizeof(F64));
+    U64 bits = loadBigEndian<U64>(&this->bytes[this->size]);
     F64 val;
-    memcpy(&val, &endianness, sizeof(val));
+    memcpy(&val, &bits, sizeof(val));
     return val;
 }
 
@@ -59,32 +116,9 @@ void FpySequencer::Stack::push(T val) {
     static_assert(sizeof(T) == 8 || sizeof(T) == 4 || sizeof(T) == 2 || sizeof(T) == 1, "size must be 1, 2, 4, 8");
     FW_ASSERT(this->size + sizeof(val) < Fpy::MAX_STACK_SIZE, static_cast<FwAssertArgType>(this->size),
               static_cast<FwAssertArgType>(sizeof(T)));
-    // first make a byte array which can definitely store our val
-    U8 valBytes[8] = {0};
     // convert val to unsigned to avoid undefined behavior for bitshifts of signed types
     using UnsignedT = typename std::make_unsigned<T>::type;
-    UnsignedT valUnsigned = static_cast<UnsignedT>(val);
-    if (sizeof(T) == 8) {
-        valBytes[0] = static_cast<U8>(valUnsigned >> 56);
-        valBytes[1] = static_cast<U8>(valUnsigned >> 48);
-        valBytes[2] = static_cast<U8>(valUnsigned >> 40);
-        valBytes[3] = static_cast<U8>(valUnsigned >> 32);
-        valBytes[4] = static_cast<U8>(valUnsigned >> 24);
-        valBytes[5] = static_cast<U8>(valUnsigned >> 16);
-        valBytes[6] = static_cast<U8>(valUnsigned >> 8);
-        valBytes[7] = static_cast<U8>(valUnsigned >> 0);
-    } else if (sizeof(T) == 4) {
-        valBytes[0] = static_cast<U8>(valUnsigned >> 24);
-        valBytes[1] = static_cast<U8>(valUnsigned >> 16);
-        valBytes[2] = static_cast<U8>(valUnsigned >> 8);
-        valBytes[3] = static_cast<U8>(valUnsigned >> 0);
-    } else if (sizeof(T) == 2) {
-        valBytes[0] = static_cast<U8>(valUnsigned >> 8);
-        valBytes[1] = static_cast<U8>(valUnsigned >> 0);
-    } else {
-        valBytes[0] = static_cast<U8>(valUnsigned);
-    }
-    memcpy(this->top(), valBytes, sizeof(T));
+    storeBigEndian<UnsignedT>(this->top(), static_cast<UnsignedT>(val));
     this->size += static_cast<Fpy::StackSizeType>(sizeof(T));
 }
 
@@ -99,16 +133,22 @@ template void FpySequencer::Stack::push(I64);
 
 template <>
 void FpySequencer::Stack::push<F32>(F32 val) {
-    U32 endianness;
-    memcpy(&endianness, &val, sizeof(val));
-    this->push(endianness);
+    FW_ASSERT(this->size + sizeof(val) < Fpy::MAX_STACK_SIZE, static_cast<FwAssertArgType>(this->size),
+              static_cast<FwAssertArgType>(sizeof(F32)));
+    U32 bits;
+    memcpy(&bits, &val, sizeof(val));
+    storeBigEndian<U32>(this->top(), bits);
+    this->size += static_cast<Fpy::StackSizeType>(sizeof(F32));
 }
 
 template <>
 void FpySequencer::Stack::push<F64>(F64 val) {
-    U64 endianness;
-    memcpy(&endianness, &val, sizeof(val));
-    this->push(endianness);
+    FW_ASSERT(this->size + sizeof(val) < Fpy::MAX_STACK_SIZE, static_cast<FwAssertArgType>(this->size),
+              static_cast<FwAssertArgType>(sizeof(F64)));
+    U64 bits;
+    memcpy(&bits, &val, sizeof(val));
+    storeBigEndian<U64>(this->top(), bits);
+    this->size += static_cast<Fpy::StackSizeType>(sizeof(F64));
 }
 
 // pops a byte array from the top of the stack into the destination array
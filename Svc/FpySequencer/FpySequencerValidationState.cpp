@@ -36,6 +36,9 @@ void FpySequencer::updateCrc(U32& crc, const U8* buffer, FwSizeType bufferSize)
 Fw::Success FpySequencer::validate() {
     FW_ASSERT(this->m_sequenceFilePath.length() > 0);
 
+    // m_sequenceObj is about to be overwritten, so anything decoded from it is stale
+    this->m_decodedStatementCount = 0;
+
     // crc needs to be initialized with a particular value
     // for the calculation to work
     this->m_computedCRC = CRC_INITIAL_VALUE;
@@ -99,9 +102,46 @@ Fw::Success FpySequencer::validate() {
         return Fw::Success::FAILURE;
     }
 
+    this->predecodeStatements();
+
     return Fw::Success::SUCCESS;
 }
 
+// decodes every statement of the loaded sequence once, into m_decodedArena, so that
+// dispatching a statement doesn't have to re-parse its bytes each time it runs.
+// statements that fail to decode, or that don't fit in the arena, are left for
+// deserializeDirective to decode (and report) when they're dispatched
+void FpySequencer::predecodeStatements() {
+    this->m_decodedStatementCount = 0;
+
+    const U16 statementCount = this->m_sequenceObj.get_header().get_statementCount();
+    FwSizeType arenaOffset = 0;
+    for (U16 idx = 0; idx < statementCount; idx++) {
+        this->m_decodedDirectives[idx] = nullptr;
+        // we don't know how big the directive is until it's decoded, so make sure the whole union would fit
+        if (arenaOffset + sizeof(DirectiveUnion) > sizeof(this->m_decodedArena)) {
+            continue;
+        }
+
+        const Fpy::Statement& stmt = this->m_sequenceObj.get_statements()[idx];
+        Fw::ExternalSerializeBuffer argBuf(const_cast<U8*>(stmt.get_argBuf().getBuffAddr()),
+                                           stmt.get_argBuf().getSize());
+        argBuf.setBuffLen(stmt.get_argBuf().getSize());
+
+        // only the member for this opcode is constructed, so each entry only takes up the size of its own type
+        DirectiveUnion* directive = reinterpret_cast<DirectiveUnion*>(&this->m_decodedArena[arenaOffset]);
+        FwSizeType decodedSize = 0;
+        if (this->decodeDirective(stmt, argBuf, *directive, decodedSize) != Fw::SerializeStatus::FW_SERIALIZE_OK) {
+            continue;
+        }
+
+        this->m_decodedDirectives[idx] = directive;
+        // keep the next entry aligned
+        arenaOffset += (decodedSize + alignof(DirectiveUnion) - 1) / alignof(DirectiveUnion) * alignof(DirectiveUnion);
+    }
+    this->m_decodedStatementCount = statementCount;
+}
+
 // reads and validates the header from the m_sequenceBuffer
 // return SUCCESS if sequence is valid, FAILURE otherwise
 Fw::Success FpySequencer::readHeader() {
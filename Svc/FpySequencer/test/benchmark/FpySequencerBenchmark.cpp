@@ -0,0 +1,93 @@
+// ======================================================================
+// \title  FpySequencerBenchmark.cpp
+// \brief  Statement throughput of a counting loop at several statement budgets
+//
+// Run the resulting executable directly to print statements per second
+// for each STATEMENT_BUDGET value. A budget of 1 dispatches every
+// statement through the state machine and is the baseline.
+// ======================================================================
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include "Os/IntervalTimer.hpp"
+#include "Svc/FpySequencer/test/ut/FpySequencerTester.hpp"
+
+namespace Svc {
+
+namespace {
+
+//! Number of loop iterations in the benchmark sequence
+constexpr U64 LOOP_COUNT = 20000;
+
+//! Statements run by the benchmark sequence
+constexpr U64 STATEMENT_COUNT = 3 + 9 * LOOP_COUNT - 1 + 2;
+
+//! Statement budgets to measure
+constexpr U32 BUDGETS[] = {1, 4, 16, 64, 256};
+
+}  // namespace
+
+class FpySequencerBenchmark : public FpySequencerTester {
+  protected:
+    //! Build a loop that counts a local variable up to LOOP_COUNT, then exits
+    void buildCountingLoop() {
+        allocMem();
+        add_ALLOCATE(8);
+        add_PUSH_VAL<U64>(0);
+        add_STORE_REL_CONST_OFFSET(0, 8);
+        // loop start
+        add_LOAD_REL(0, 8);
+        add_PUSH_VAL<U64>(1);
+        add_STACK_OP(Fpy::DirectiveId::ADD);
+        add_STORE_REL_CONST_OFFSET(0, 8);
+        add_LOAD_REL(0, 8);
+        add_PUSH_VAL<U64>(LOOP_COUNT);
+        add_STACK_OP(Fpy::DirectiveId::ULT);
+        add_IF(12);
+        add_GOTO(3);
+        // loop end
+        add_PUSH_VAL<U8>(0);
+        add_EXIT();
+        removeFile("benchmark.bin");
+        writeToFile("benchmark.bin");
+    }
+
+    //! Run the benchmark sequence once with the given budget
+    void runWithBudget(U32 budget) {
+        paramSet_STATEMENT_BUDGET(budget, Fw::ParamValid::VALID);
+        paramSend_STATEMENT_BUDGET(0, 0);
+        tester_set_m_statementsDispatched(0);
+        clearHistory();
+
+        Os::IntervalTimer timer;
+        timer.start();
+        sendCmd_RUN(0, 0, Fw::String("benchmark.bin"), FpySequencer_BlockState::BLOCK);
+        this->tester_doDispatch();
+        dispatchUntilState(State::IDLE, static_cast<U32>(STATEMENT_COUNT * 4));
+        timer.stop();
+
+        ASSERT_CMD_RESPONSE_SIZE(1);
+        ASSERT_CMD_RESPONSE(0, FpySequencerTester::get_OPCODE_RUN(), 0, Fw::CmdResponse::OK);
+        ASSERT_EQ(tester_get_m_statementsDispatched(), STATEMENT_COUNT);
+
+        const U32 usec = timer.getDiffUsec();
+        const F64 rate = (usec == 0) ? 0.0 : static_cast<F64>(STATEMENT_COUNT) * 1.0e6 / static_cast<F64>(usec);
+        (void)printf("STATEMENT_BUDGET %3u: %llu statements in %u us, %.0f statements/s\n", budget,
+                     static_cast<unsigned long long>(STATEMENT_COUNT), usec, rate);
+    }
+};
+
+TEST_F(FpySequencerBenchmark, CountingLoop) {
+    buildCountingLoop();
+    for (const U32 budget : BUDGETS) {
+        runWithBudget(budget);
+    }
+    removeFile("benchmark.bin");
+}
+
+}  // namespace Svc
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -2,6 +2,7 @@
 // TestMain.cpp
 // ----------------------------------------------------------------------
 
+#include <cstring>
 #include "FpySequencerTester.hpp"
 #include "Fw/Com/ComPacket.hpp"
 #include "Fw/Types/MallocAllocator.hpp"
@@ -2709,6 +2710,45 @@ TEST_F(FpySequencerTester, validate) {
     ASSERT_EVENTS_ExtraBytesInSequence_SIZE(1);
 }
 
+TEST_F(FpySequencerTester, predecodeStatements) {
+    add_NO_OP();
+    add_GOTO(0);
+    add_CONST_CMD(123);
+    // a no op with junk args fails to decode
+    Fw::StatementArgBuffer junk;
+    ASSERT_EQ(junk.serializeFrom(static_cast<U8>(1)), Fw::SerializeStatus::FW_SERIALIZE_OK);
+    addDirective(Fpy::DirectiveId::NO_OP, junk);
+    writeToFile("test.bin");
+    U8 data[Fpy::Sequence::SERIALIZED_SIZE] = {0};
+    tester_get_m_sequenceBuffer_ptr()->setExtBuffer(data, sizeof(data));
+    tester_set_m_sequenceFilePath("test.bin");
+    ASSERT_EQ(tester_validate(), Fw::Success::SUCCESS);
+    removeFile("test.bin");
+    // decoding during validation is silent
+    ASSERT_EVENTS_DirectiveDeserializeError_SIZE(0);
+
+    ASSERT_NE(tester_getDecodedDirective(0), nullptr);
+    ASSERT_NE(tester_getDecodedDirective(1), nullptr);
+    ASSERT_EQ(tester_getDecodedDirective(1)->gotoDirective, FpySequencer_GotoDirective(0));
+    ASSERT_NE(tester_getDecodedDirective(2), nullptr);
+    ASSERT_EQ(tester_getDecodedDirective(2)->constCmd.get_opCode(), 123);
+    ASSERT_EQ(tester_getDecodedDirective(3), nullptr);
+    ASSERT_EQ(tester_getDecodedDirective(4), nullptr);
+
+    // pre-decoded statements dispatch without being decoded again
+    ASSERT_EQ(tester_dispatchStatement(), Signal::result_dispatchStatement_success);
+    ASSERT_EQ(tester_dispatchStatement(), Signal::result_dispatchStatement_success);
+    ASSERT_EQ(tester_dispatchStatement(), Signal::result_dispatchStatement_success);
+    ASSERT_EQ(tester_get_m_runtime_ptr()->currentCmdOpcode, 123);
+    // the bad statement is decoded, and reported, when it is dispatched
+    ASSERT_EQ(tester_dispatchStatement(), Signal::result_dispatchStatement_failure);
+    ASSERT_EVENTS_DirectiveDeserializeError_SIZE(1);
+
+    // a failed validation drops the decoded statements
+    ASSERT_EQ(tester_validate(), Fw::Success::FAILURE);
+    ASSERT_EQ(tester_getDecodedDirective(0), nullptr);
+}
+
 TEST_F(FpySequencerTester, allocateBuffer) {
     Fw::MallocAllocator alloc;
     cmp.allocateBuffer(0, alloc, 100);
@@ -3463,6 +3503,29 @@ TEST_F(FpySequencerTester, StackPushPopF64) {
     ASSERT_EQ(runtime->stack.size, 0);
 }
 
+// Test that typed values are laid out big endian on the stack, the same as serialized buffers
+TEST_F(FpySequencerTester, StackByteOrder) {
+    auto* runtime = tester_get_m_runtime_ptr();
+    runtime->stack.size = 0;
+
+    tester_push<U16>(0x0102);
+    tester_push<I32>(-2);
+    tester_push<F32>(1.0f);
+    tester_push<U64>(0x0102030405060708ULL);
+    const U8 expected[] = {0x01, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0x80, 0x00, 0x00,
+                           0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+    ASSERT_EQ(runtime->stack.size, sizeof(expected));
+    ASSERT_EQ(memcmp(runtime->stack.bytes, expected, sizeof(expected)), 0);
+
+    // raw bytes read back as the same typed values
+    ASSERT_EQ(tester_pop<U64>(), 0x0102030405060708ULL);
+    ASSERT_EQ(tester_pop<U32>(), 0x3F800000U);
+    ASSERT_EQ(tester_pop<I16>(), -2);
+    ASSERT_EQ(tester_pop<I16>(), -1);
+    ASSERT_EQ(tester_pop<U16>(), 0x0102);
+    ASSERT_EQ(runtime->stack.size, 0);
+}
+
 // Test pushing/popping multiple values
 TEST_F(FpySequencerTester, StackPushPopMultiple) {
     auto* runtime = tester_get_m_runtime_ptr();
@@ -130,4 +130,69 @@ TEST_F(FpySequencerTester, NotTrueSeq) {
     ASSERT_EQ(tester_get_m_tlm_ptr()->lastDirectiveError, DirectiveError::NO_ERROR);
 }
 
+TEST_F(FpySequencerTester, RunToYield) {
+    allocMem();
+    paramSet_STATEMENT_BUDGET(64, Fw::ParamValid::VALID);
+    paramSend_STATEMENT_BUDGET(0, 0);
+
+    // count a local from 0 to 3, then send a command and exit
+    add_ALLOCATE(8);
+    add_PUSH_VAL<U64>(0);
+    add_STORE_REL_CONST_OFFSET(0, 8);
+    // loop start
+    add_LOAD_REL(0, 8);
+    add_PUSH_VAL<U64>(1);
+    add_STACK_OP(Fpy::DirectiveId::ADD);
+    add_STORE_REL_CONST_OFFSET(0, 8);
+    add_LOAD_REL(0, 8);
+    add_PUSH_VAL<U64>(3);
+    add_STACK_OP(Fpy::DirectiveId::ULT);
+    add_IF(12);
+    add_GOTO(3);
+    // loop end
+    add_CONST_CMD(123);
+    add_PUSH_VAL<U8>(0);
+    add_EXIT();
+
+    writeToFile("test.bin");
+    sendCmd_RUN(0, 0, Fw::String("test.bin"), FpySequencer_BlockState::BLOCK);
+    dispatchUntilState(State::RUNNING_AWAITING_STATEMENT_RESPONSE);
+    // the whole loop ran in one dispatch, stopping at the command
+    ASSERT_EQ(tester_get_m_statementsDispatched(), 30);
+    ASSERT_EQ(tester_get_m_runtime_ptr()->nextStatementIndex, 13);
+    ASSERT_EQ(tester_get_m_runtime_ptr()->stack.size, 8);
+
+    // execute the cmd dir, sending out the command
+    this->tester_doDispatch();
+    invoke_to_cmdResponseIn(0, 123, 0x0001001E, Fw::CmdResponse::OK);
+    dispatchUntilState(State::IDLE);
+    ASSERT_EQ(tester_get_m_tlm_ptr()->lastDirectiveError, DirectiveError::NO_ERROR);
+    ASSERT_EQ(tester_get_m_statementsDispatched(), 32);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, FpySequencerTester::get_OPCODE_RUN(), 0, Fw::CmdResponse::OK);
+}
+
+TEST_F(FpySequencerTester, RunToYieldBreakpoint) {
+    allocMem();
+    paramSet_STATEMENT_BUDGET(64, Fw::ParamValid::VALID);
+    paramSend_STATEMENT_BUDGET(0, 0);
+
+    add_NO_OP();
+    add_NO_OP();
+    add_NO_OP();
+    add_NO_OP();
+
+    // a breakpoint turns run-to-yield off so every statement is checked against it
+    sendCmd_SET_BREAKPOINT(0, 0, 2, false);
+    // dispatch cmd handler, then signal
+    this->tester_doDispatch();
+    this->tester_doDispatch();
+    ASSERT_TRUE(tester_get_m_breakpoint_ptr()->breakpointInUse);
+    writeToFile("test.bin");
+    sendCmd_RUN(0, 0, Fw::String("test.bin"), FpySequencer_BlockState::BLOCK);
+    dispatchUntilState(State::RUNNING_PAUSED);
+    ASSERT_EQ(tester_get_m_runtime_ptr()->nextStatementIndex, 2);
+    ASSERT_EQ(tester_get_m_statementsDispatched(), 2);
+}
+
 }  // namespace Svc
@@ -591,6 +591,10 @@ Fw::Success FpySequencerTester::tester_validate() {
     return this->cmp.validate();
 }
 
+const FpySequencer::DirectiveUnion* FpySequencerTester::tester_getDecodedDirective(U32 statementIdx) {
+    return this->cmp.getDecodedDirective(statementIdx);
+}
+
 Svc::Signal FpySequencerTester::tester_checkStatementTimeout() {
     return this->cmp.checkStatementTimeout();
 }
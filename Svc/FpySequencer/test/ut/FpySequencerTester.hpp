@@ -250,6 +250,7 @@ class FpySequencerTester : public FpySequencerGTestBase, public ::testing::Test
     Fpy::Sequence* tester_get_m_sequenceObj_ptr();
     Svc::Signal tester_dispatchStatement();
     Fw::Success tester_validate();
+    const FpySequencer::DirectiveUnion* tester_getDecodedDirective(U32 statementIdx);
     Fw::String tester_get_m_sequenceFilePath();
     void tester_set_m_sequenceFilePath(Fw::String str);
     Fw::Success tester_readBytes(Os::File& file,
@@ -19,14 +19,20 @@ FrameAccumulator ::FrameAccumulator(const char* const compName)
       m_detector(nullptr),
       m_memoryAllocator(nullptr),
       m_memory(nullptr),
-      m_allocatorId(0) {}
+      m_allocatorId(0),
+      m_zeroCopy(false) {
+    for (FwSizeType i = 0; i < FRAME_ACCUMULATOR_MAX_HELD_BUFFERS; i++) {
+        this->m_held[i].references = 0;
+    }
+}
 
 FrameAccumulator ::~FrameAccumulator() {}
 
 void FrameAccumulator ::configure(const FrameDetector& detector,
                                   FwEnumStoreType allocationId,
                                   Fw::MemAllocator& allocator,
-                                  FwSizeType store_size) {
+                                  FwSizeType store_size,
+                                  bool zero_copy) {
     bool recoverable = false;
     U8* const data = static_cast<U8*>(allocator.allocate(allocationId, store_size, recoverable));
     FW_ASSERT(data != nullptr);
@@ -36,6 +42,7 @@ void FrameAccumulator ::configure(const FrameDetector& detector,
     this->m_allocatorId = allocationId;
     this->m_memoryAllocator = &allocator;
     this->m_memory = data;
+    this->m_zeroCopy = zero_copy;
 }
 
 void FrameAccumulator ::cleanup() {
@@ -53,14 +60,21 @@ void FrameAccumulator ::cleanup() {
 void FrameAccumulator ::dataIn_handler(FwIndexType portNum, Fw::Buffer& buffer, const ComCfg::FrameContext& context) {
     // Check whether there is data to process
     if (buffer.isValid()) {
+        // In zero-copy mode, hold the buffer so that frames can be forwarded as slices of it
+        const FwIndexType slot = this->m_zeroCopy ? this->holdBuffer(buffer, context) : -1;
         // The buffer is not necessarily a full frame, so the attached context has no meaning and we ignore it
-        this->processBuffer(buffer);
+        this->processBuffer(buffer, slot);
+        if (slot >= 0) {
+            // Drop the processing reference. Ownership returns upstream once all slices are returned.
+            this->releaseBuffer(slot);
+            return;
+        }
     }
     // Return ownership of the incoming data
     this->dataReturnOut_out(0, buffer, context);
 }
 
-void FrameAccumulator ::processBuffer(Fw::Buffer& buffer) {
+void FrameAccumulator ::processBuffer(Fw::Buffer& buffer, FwIndexType slot) {
     const FwSizeType bufferSize = buffer.getSize();
     U8* const bufferData = buffer.getData();
     // Current offset into buffer
@@ -76,13 +90,15 @@ void FrameAccumulator ::processBuffer(Fw::Buffer& buffer) {
         // Compute the size of data to serialize
         const FwSizeType ringFreeSize = this->m_inRing.get_free_size();
         const FwSizeType serSize = (ringFreeSize <= remaining) ? ringFreeSize : remaining;
+        // Track where the chunk lands in the ring so detected frames can be sliced from the incoming buffer
+        Chunk chunk = {(slot >= 0) ? &bufferData[offset] : nullptr, this->m_inRing.get_allocated_size(), 0, slot};
         // Serialize data into the ring buffer
         const Fw::SerializeStatus status = this->m_inRing.serialize(&bufferData[offset], serSize);
         // If data does not fit, there is a coding error
         FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status),
                   static_cast<FwAssertArgType>(offset), static_cast<FwAssertArgType>(serSize));
         // Process the data
-        this->processRing();
+        this->processRing(chunk);
         // Update buffer offset and remaining
         offset += serSize;
         remaining -= serSize;
@@ -91,7 +107,18 @@ void FrameAccumulator ::processBuffer(Fw::Buffer& buffer) {
     FW_ASSERT(remaining == 0 || this->m_inRing.get_free_size() == 0, static_cast<FwAssertArgType>(remaining));
 }
 
-void FrameAccumulator ::processRing() {
+void FrameAccumulator ::consumeRing(Chunk& chunk, FwSizeType amount) {
+    const Fw::SerializeStatus status = this->m_inRing.rotate(amount);
+    FW_ASSERT(status == Fw::SerializeStatus::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+    if (amount <= chunk.lead) {
+        chunk.lead -= amount;
+    } else {
+        chunk.offset += amount - chunk.lead;
+        chunk.lead = 0;
+    }
+}
+
+void FrameAccumulator ::processRing(Chunk& chunk) {
     FW_ASSERT(this->m_detector != nullptr);
 
     // The number of remaining bytes in the ring buffer
@@ -123,7 +150,7 @@ void FrameAccumulator ::processRing() {
             // to process it. Log a warning and discard a byte, then keep iterating to look for a new frame
             this->log_WARNING_HI_FrameDetectionSizeError(size_out);
             // Discard a single byte of data and start again
-            (void)this->m_inRing.rotate(1);
+            this->consumeRing(chunk, 1);
             FW_ASSERT(m_inRing.get_allocated_size() == remaining - 1,
                       static_cast<FwAssertArgType>(m_inRing.get_allocated_size()),
                       static_cast<FwAssertArgType>(remaining));
@@ -136,6 +163,18 @@ void FrameAccumulator ::processRing() {
             FW_ASSERT(size_out != 0);
             FW_ASSERT(size_out <= remaining, static_cast<FwAssertArgType>(size_out),
                       static_cast<FwAssertArgType>(remaining));
+            // When the whole frame comes from the current incoming buffer, forward a slice of it without copying
+            if ((chunk.data != nullptr) && (chunk.lead == 0)) {
+                Fw::Buffer slice(&chunk.data[chunk.offset], size_out);
+                {
+                    Os::ScopeLock lock(this->m_heldLock);
+                    this->m_held[chunk.slot].references++;
+                }
+                this->consumeRing(chunk, size_out);
+                ComCfg::FrameContext context;
+                this->dataOut_out(0, slice, context);
+                continue;
+            }
             Fw::Buffer buffer = this->bufferAllocate_out(0, size_out);
             if (buffer.isValid()) {
                 // Copy data out of ring buffer into the allocated buffer
@@ -143,8 +182,7 @@ void FrameAccumulator ::processRing() {
                 buffer.setSize(size_out);
                 FW_ASSERT(serialize_status == Fw::SerializeStatus::FW_SERIALIZE_OK);
                 // Consume (rotate) the data from the ring buffer
-                serialize_status = this->m_inRing.rotate(size_out);
-                FW_ASSERT(serialize_status == Fw::SerializeStatus::FW_SERIALIZE_OK);
+                this->consumeRing(chunk, size_out);
                 FW_ASSERT(m_inRing.get_allocated_size() == remaining - size_out,
                           static_cast<FwAssertArgType>(m_inRing.get_allocated_size()),
                           static_cast<FwAssertArgType>(remaining), static_cast<FwAssertArgType>(size_out));
@@ -167,7 +205,7 @@ void FrameAccumulator ::processRing() {
         // No frame was detected or an unknown status was received
         else {
             // Discard a single byte of data and start again
-            (void)this->m_inRing.rotate(1);
+            this->consumeRing(chunk, 1);
             FW_ASSERT(m_inRing.get_allocated_size() == remaining - 1,
                       static_cast<FwAssertArgType>(m_inRing.get_allocated_size()),
                       static_cast<FwAssertArgType>(remaining));
@@ -178,9 +216,65 @@ void FrameAccumulator ::processRing() {
 void FrameAccumulator ::dataReturnIn_handler(FwIndexType portNum,
                                              Fw::Buffer& fwBuffer,
                                              const ComCfg::FrameContext& context) {
+    // Frames forwarded as slices of a held incoming buffer release their reference to it
+    const FwIndexType slot = this->findHeldBuffer(fwBuffer);
+    if (slot >= 0) {
+        this->releaseBuffer(slot);
+        return;
+    }
     // Frame buffer ownership is returned to the component. Component had allocated with a buffer manager,
     // so we return it to the buffer manager for deallocation
     this->bufferDeallocate_out(0, fwBuffer);
 }
 
+// ----------------------------------------------------------------------
+// Zero-copy buffer holding
+// ----------------------------------------------------------------------
+
+FwIndexType FrameAccumulator ::holdBuffer(const Fw::Buffer& buffer, const ComCfg::FrameContext& context) {
+    Os::ScopeLock lock(this->m_heldLock);
+    for (FwSizeType i = 0; i < FRAME_ACCUMULATOR_MAX_HELD_BUFFERS; i++) {
+        if (this->m_held[i].references == 0) {
+            this->m_held[i].buffer = buffer;
+            this->m_held[i].context = context;
+            this->m_held[i].references = 1;
+            return static_cast<FwIndexType>(i);
+        }
+    }
+    return -1;
+}
+
+void FrameAccumulator ::releaseBuffer(FwIndexType slot) {
+    FW_ASSERT((slot >= 0) && (static_cast<FwSizeType>(slot) < FRAME_ACCUMULATOR_MAX_HELD_BUFFERS),
+              static_cast<FwAssertArgType>(slot));
+    Fw::Buffer buffer;
+    ComCfg::FrameContext context;
+    {
+        Os::ScopeLock lock(this->m_heldLock);
+        HeldBuffer& held = this->m_held[slot];
+        FW_ASSERT(held.references > 0, static_cast<FwAssertArgType>(slot));
+        held.references--;
+        if (held.references > 0) {
+            return;
+        }
+        buffer = held.buffer;
+        context = held.context;
+    }
+    // Last reference dropped: return ownership of the incoming buffer outside of the lock
+    this->dataReturnOut_out(0, buffer, context);
+}
+
+FwIndexType FrameAccumulator ::findHeldBuffer(const Fw::Buffer& frame) {
+    const U8* const data = frame.getData();
+    Os::ScopeLock lock(this->m_heldLock);
+    for (FwSizeType i = 0; i < FRAME_ACCUMULATOR_MAX_HELD_BUFFERS; i++) {
+        const HeldBuffer& held = this->m_held[i];
+        if ((held.references > 0) && (data >= held.buffer.getData()) &&
+            (data < held.buffer.getData() + held.buffer.getSize())) {
+            return static_cast<FwIndexType>(i);
+        }
+    }
+    return -1;
+}
+
 }  // namespace Svc
@@ -7,7 +7,9 @@
 #ifndef Svc_FrameAccumulator_HPP
 #define Svc_FrameAccumulator_HPP
 
+#include <config/FrameAccumulatorCfg.hpp>
 #include "Fw/Types/MemAllocator.hpp"
+#include "Os/Mutex.hpp"
 #include "Svc/FrameAccumulator/FrameAccumulatorComponentAc.hpp"
 #include "Svc/FrameAccumulator/FrameDetector.hpp"
 #include "Utils/Types/CircularBuffer.hpp"
@@ -33,10 +35,15 @@ class FrameAccumulator final : public FrameAccumulatorComponentBase {
     //!
     //! Takes in parameters used in the Fw::MemAllocator pattern and configures a memory allocation for storing the
     //! circular buffer.
+    //!
+    //! When zero_copy is set, frames lying entirely within one incoming buffer are forwarded on dataOut as slices of
+    //! that buffer instead of being copied into a buffer obtained from bufferAllocate. The incoming buffer is held
+    //! until all of its slices are returned on dataReturnIn. Frames straddling incoming buffers are still copied.
     void configure(const FrameDetector& detector,  //!< Frame detector helper instance
                    FwEnumStoreType allocationId,   //!< Identifier used  when dealing with the Fw::MemAllocator
                    Fw::MemAllocator& allocator,    //!< Fw::MemAllocator used to acquire memory
-                   FwSizeType store_size           //!< Size to request for circular buffer
+                   FwSizeType store_size,          //!< Size to request for circular buffer
+                   bool zero_copy = false          //!< Forward frames as slices of incoming buffers when possible
     );
 
     //! \brief Deallocate internal resources (set up by configure() call)
@@ -63,12 +70,41 @@ class FrameAccumulator final : public FrameAccumulatorComponentBase {
                               ) override;
 
   private:
+    //! \brief incoming buffer held while slices of it are in use downstream (zero-copy mode)
+    struct HeldBuffer {
+        Fw::Buffer buffer;              //!< Incoming buffer, returned on dataReturnOut once released
+        ComCfg::FrameContext context;   //!< Context received with the incoming buffer
+        FwSizeType references;          //!< Outstanding slices, plus one while the buffer is being processed
+    };
+
+    //! \brief location of the chunk of an incoming buffer most recently added to the ring
+    struct Chunk {
+        U8* data;           //!< Chunk start in the incoming buffer, nullptr when frames must be copied
+        FwSizeType lead;    //!< Bytes in the ring ahead of the chunk
+        FwSizeType offset;  //!< Offset in the chunk of the ring head, once lead bytes are consumed
+        FwIndexType slot;   //!< Held buffer slot of the incoming buffer
+    };
+
     //! \brief process raw buffer
     //! \return raw data buffer
-    void processBuffer(Fw::Buffer& buffer);
+    void processBuffer(Fw::Buffer& buffer, FwIndexType slot);
 
     //! \brief process circular buffer
-    void processRing();
+    void processRing(Chunk& chunk);
+
+    //! \brief consume data from the ring head, tracking the chunk position
+    void consumeRing(Chunk& chunk, FwSizeType amount);
+
+    //! \brief hold an incoming buffer for zero-copy forwarding
+    //! \return held slot index, or -1 when none is free
+    FwIndexType holdBuffer(const Fw::Buffer& buffer, const ComCfg::FrameContext& context);
+
+    //! \brief release one reference to a held buffer, returning it upstream when unreferenced
+    void releaseBuffer(FwIndexType slot);
+
+    //! \brief find the held buffer containing a returned frame
+    //! \return held slot index, or -1 when the frame was allocated
+    FwIndexType findHeldBuffer(const Fw::Buffer& frame);
 
     //! Circular buffer for storing data
     Types::CircularBuffer m_inRing;
@@ -84,6 +120,15 @@ class FrameAccumulator final : public FrameAccumulatorComponentBase {
 
     //! Identification used with the memory allocator
     FwEnumStoreType m_allocatorId;
+
+    //! Whether frames are forwarded as slices of incoming buffers when possible
+    bool m_zeroCopy;
+
+    //! Incoming buffers held in zero-copy mode
+    HeldBuffer m_held[FRAME_ACCUMULATOR_MAX_HELD_BUFFERS];
+
+    //! Lock protecting m_held, as frames may be returned from another thread
+    Os::Mutex m_heldLock;
 };
 
 }  // namespace Svc
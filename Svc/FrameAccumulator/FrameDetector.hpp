@@ -6,6 +6,8 @@
 #ifndef SVC_FPRIME_FRAME_DETECTOR_HPP
 #define SVC_FPRIME_FRAME_DETECTOR_HPP
 #include <Fw/FPrimeBasicTypes.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <Fw/Types/Serializable.hpp>
 #include <Utils/Types/CircularBuffer.hpp>
 
 namespace Svc {
@@ -46,6 +48,52 @@ class FrameDetector {
     //! \param size_out: set as output to caller indicating size when appropriate
     //! \return status of the detection to be paired with size_out
     virtual Status detect(const Types::CircularBuffer& data, FwSizeType& size_out) const = 0;
+
+  protected:
+    //! \brief deserialize a fixed-size object (e.g. a frame header or trailer) from the circular buffer
+    //!
+    //! The object is read in place from the ring storage, and copied only when it wraps around the end of the store.
+    //!
+    //! \param data: circular buffer with read-only access
+    //! \param object: object to deserialize, providing SERIALIZED_SIZE
+    //! \param offset: offset of the object from the head of the circular buffer
+    //! \return status of the deserialization
+    template <typename T>
+    static Fw::SerializeStatus peek_object(const Types::CircularBuffer& data, T& object, FwSizeType offset) {
+        U8 scratch[T::SERIALIZED_SIZE];
+        const U8* block = nullptr;
+        Fw::SerializeStatus status = data.peek_contiguous(block, scratch, T::SERIALIZED_SIZE, offset);
+        if (status != Fw::FW_SERIALIZE_OK) {
+            return status;
+        }
+        // Deserialization only reads from the buffer, so the ring storage is not modified
+        Fw::ExternalSerializeBuffer buffer(const_cast<U8*>(block), T::SERIALIZED_SIZE);
+        status = buffer.setBuffLen(T::SERIALIZED_SIZE);
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+        return object.deserializeFrom(buffer);
+    }
+
+    //! \brief update a checksum over a region of the circular buffer, reading the ring storage in place
+    //!
+    //! \param data: circular buffer with read-only access
+    //! \param checksum: checksum providing update(data, size)
+    //! \param size: size of the region
+    //! \param offset: offset of the region from the head of the circular buffer
+    template <typename Checksum>
+    static void update_checksum(const Types::CircularBuffer& data,
+                                Checksum& checksum,
+                                FwSizeType size,
+                                FwSizeType offset) {
+        // The region lies in at most two contiguous spans of the ring storage
+        Types::CircularBuffer::Span first;
+        Types::CircularBuffer::Span second;
+        const Fw::SerializeStatus status = data.peek_spans(first, second, size, offset);
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+        checksum.update(first.data, first.size);
+        if (second.size > 0) {
+            checksum.update(second.data, second.size);
+        }
+    }
 };
 
 }  // namespace Svc
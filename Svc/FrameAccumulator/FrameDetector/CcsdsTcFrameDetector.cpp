@@ -23,18 +23,8 @@ FrameDetector::Status CcsdsTcFrameDetector::detect(const Types::CircularBuffer&
     }
 
     // ---------------- Frame Header ----------------
-    // Copy CircularBuffer data into linear buffer, for serialization into FrameHeader object
-    U8 header_data[Ccsds::TCHeader::SERIALIZED_SIZE];
-    Fw::SerializeStatus status = data.peek(header_data, Ccsds::TCHeader::SERIALIZED_SIZE, 0);
-    if (status != Fw::FW_SERIALIZE_OK) {
-        return Status::NO_FRAME_DETECTED;
-    }
-    Fw::ExternalSerializeBuffer header_ser_buffer(header_data, Ccsds::TCHeader::SERIALIZED_SIZE);
-    status = header_ser_buffer.setBuffLen(Ccsds::TCHeader::SERIALIZED_SIZE);
-    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
-    // Attempt to deserialize data into the FrameHeader object
     Ccsds::TCHeader header;
-    status = header.deserializeFrom(header_ser_buffer);
+    Fw::SerializeStatus status = peek_object(data, header, 0);
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
 
     if (header.get_flagsAndScId() != this->m_expectedFlagsAndScIdToken) {
@@ -59,26 +49,14 @@ FrameDetector::Status CcsdsTcFrameDetector::detect(const Types::CircularBuffer&
     // ---------------- Frame Trailer ----------------
     // Compute CRC on the received data
     Ccsds::Utils::CRC16 crc;
-    for (FwSizeType i = 0; i < data_to_crc_length; ++i) {
-        U8 byte = 0;
-        status = data.peek(byte, i);
-        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
-        crc.update(byte);
-    }
+    update_checksum(data, crc, data_to_crc_length, 0);
     U16 computed_fecf = crc.finalize();
     // Retrieve CRC field from the trailer
-    U8 trailer_data[Ccsds::TCTrailer::SERIALIZED_SIZE];
-    status = data.peek(trailer_data, Ccsds::TCTrailer::SERIALIZED_SIZE, data_to_crc_length);
+    Ccsds::TCTrailer trailer;
+    status = peek_object(data, trailer, data_to_crc_length);
     if (status != Fw::FW_SERIALIZE_OK) {
         return Status::NO_FRAME_DETECTED;
     }
-    Fw::ExternalSerializeBuffer trailer_ser_buffer(trailer_data, Ccsds::TCTrailer::SERIALIZED_SIZE);
-    status = trailer_ser_buffer.setBuffLen(Ccsds::TCTrailer::SERIALIZED_SIZE);
-    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
-    // Attempt to deserialize data into the FrameTrailer object
-    Ccsds::TCTrailer trailer;
-    status = trailer.deserializeFrom(trailer_ser_buffer);
-    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
     U16 transmitted_fecf = trailer.get_fecf();
     if (transmitted_fecf != computed_fecf) {
         // If the computed CRC does not match the transmitted CRC, we don't have a valid frame
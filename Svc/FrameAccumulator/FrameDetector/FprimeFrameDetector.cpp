@@ -17,30 +17,11 @@ FrameDetector::Status FprimeFrameDetector::detect(const Types::CircularBuffer& d
         return Status::MORE_DATA_NEEDED;
     }
 
-    // NOTE: it is understood and accepted that the following code is not as efficient as it could technically be
-    // We are leveraging the FPP autocoded types to do the deserialization for us.
-    // In its current implementation, CircularBuffer is not a SerializeBufferBase, which prevents us from deserializing
-    // directly from the CircularBuffer into FrameHeader/FrameTrailer. Instead, we have to copy the data into
-    // a temporary SerializeBuffer, and then deserialize from that buffer into the FrameHeader/FrameTrailer objects.
-    // A better implementation would be to have CircularBuffer implement a shared interface with SerializeBufferBase,
-    // and then we could pass the CircularBuffer directly into the FrameHeader/FrameTrailer deserializers. This is left
-    // as a TODO for future improvement as it is a significant refactor
-
     FprimeProtocol::FrameHeader header;
     FprimeProtocol::FrameTrailer trailer;
 
     // ---------------- Frame Header ----------------
-    // Copy CircularBuffer data into linear buffer, for serialization into FrameHeader object
-    U8 header_data[FprimeProtocol::FrameHeader::SERIALIZED_SIZE];
-    Fw::SerializeStatus status = data.peek(header_data, FprimeProtocol::FrameHeader::SERIALIZED_SIZE, 0);
-    if (status != Fw::FW_SERIALIZE_OK) {
-        return Status::NO_FRAME_DETECTED;
-    }
-    Fw::ExternalSerializeBuffer header_ser_buffer(header_data, FprimeProtocol::FrameHeader::SERIALIZED_SIZE);
-    status = header_ser_buffer.setBuffLen(FprimeProtocol::FrameHeader::SERIALIZED_SIZE);
-    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
-    // Attempt to deserialize data into the FrameHeader object
-    status = header.deserializeFrom(header_ser_buffer);
+    Fw::SerializeStatus status = peek_object(data, header, 0);
     if (status != Fw::FW_SERIALIZE_OK) {
         return Status::NO_FRAME_DETECTED;
     }
@@ -59,17 +40,7 @@ FrameDetector::Status FprimeFrameDetector::detect(const Types::CircularBuffer& d
     }
 
     // ---------------- Frame Trailer ----------------
-    U8 trailer_data[FprimeProtocol::FrameTrailer::SERIALIZED_SIZE];
-    Fw::ExternalSerializeBuffer trailer_ser_buffer(trailer_data, FprimeProtocol::FrameTrailer::SERIALIZED_SIZE);
-    status = data.peek(trailer_data, FprimeProtocol::FrameTrailer::SERIALIZED_SIZE,
-                       FprimeProtocol::FrameHeader::SERIALIZED_SIZE + header.get_lengthField());
-    if (status != Fw::FW_SERIALIZE_OK) {
-        return Status::NO_FRAME_DETECTED;
-    }
-    status = trailer_ser_buffer.setBuffLen(FprimeProtocol::FrameTrailer::SERIALIZED_SIZE);
-    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
-    // Deserialize trailer from circular buffer (peeked data) into trailer object
-    status = trailer.deserializeFrom(trailer_ser_buffer);
+    status = peek_object(data, trailer, FprimeProtocol::FrameHeader::SERIALIZED_SIZE + header.get_lengthField());
     if (status != Fw::FW_SERIALIZE_OK) {
         return Status::NO_FRAME_DETECTED;
     }
@@ -79,12 +50,7 @@ FrameDetector::Status FprimeFrameDetector::detect(const Types::CircularBuffer& d
     // Compute CRC over the transmitted data (header + body)
     FwSizeType hash_field_size = header.get_lengthField() + FprimeProtocol::FrameHeader::SERIALIZED_SIZE;
     hash.init();
-    for (U32 i = 0; i < hash_field_size; i++) {
-        U8 byte = 0;
-        status = data.peek(byte, i);
-        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
-        hash.update(&byte, 1);
-    }
+    update_checksum(data, hash, hash_field_size, 0);
     hash.final(hashBuffer);
 
     // Compare the transmitted CRC with the computed one
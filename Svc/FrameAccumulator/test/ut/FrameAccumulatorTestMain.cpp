@@ -52,6 +52,16 @@ TEST(FrameAccumulator, testDetectionErrorHandling) {
     tester.testDetectionErrorHandling();
 }
 
+TEST(FrameAccumulator, testZeroCopyFrameForwarded) {
+    Svc::FrameAccumulatorTester tester(true);
+    tester.testZeroCopyFrameForwarded();
+}
+
+TEST(FrameAccumulator, testZeroCopyStraddlingFrameCopied) {
+    Svc::FrameAccumulatorTester tester(true);
+    tester.testZeroCopyStraddlingFrameCopied();
+}
+
 int main(int argc, char** argv) {
     STest::Random::seed();
     ::testing::InitGoogleTest(&argc, argv);
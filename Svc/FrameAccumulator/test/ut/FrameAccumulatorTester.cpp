@@ -14,10 +14,10 @@ namespace Svc {
 // Construction and destruction
 // ----------------------------------------------------------------------
 
-FrameAccumulatorTester ::FrameAccumulatorTester()
+FrameAccumulatorTester ::FrameAccumulatorTester(bool zeroCopy)
     : FrameAccumulatorGTestBase("FrameAccumulatorTester", FrameAccumulatorTester::MAX_HISTORY_SIZE),
       component("FrameAccumulator") {
-    component.configure(this->mockDetector, 1, this->mallocator, 2048);
+    component.configure(this->mockDetector, 1, this->mallocator, 2048, zeroCopy);
     this->initComponents();
     this->connectPorts();
 }
@@ -203,6 +203,57 @@ void FrameAccumulatorTester ::testDetectionErrorHandling() {
     ASSERT_EVENTS_FrameDetectionSizeError(0, too_large_size);  // with expected size_out
 }
 
+void FrameAccumulatorTester ::testZeroCopyFrameForwarded() {
+    U32 buffer_size = STest::Random::lowerUpper(1, 1024);
+    U8 data[buffer_size];
+    Fw::Buffer buffer(data, buffer_size);
+    ComCfg::FrameContext context;
+    this->mockDetector.set_next_result(FrameDetector::Status::FRAME_DETECTED, buffer_size);
+    this->invoke_to_dataIn(0, buffer, context);
+    // Frame is a slice of the incoming buffer, which stays held until the frame is returned
+    ASSERT_from_bufferAllocate_SIZE(0);
+    ASSERT_from_dataOut_SIZE(1);
+    ASSERT_from_dataReturnOut_SIZE(0);
+    Fw::Buffer frame = this->fromPortHistory_dataOut->at(0).data;
+    ASSERT_EQ(frame.getData(), data);
+    ASSERT_EQ(frame.getSize(), buffer_size);
+    ASSERT_EQ(this->component.m_inRing.get_allocated_size(), 0);
+
+    // Returning the frame returns the incoming buffer instead of deallocating
+    this->invoke_to_dataReturnIn(0, frame, context);
+    ASSERT_from_bufferDeallocate_SIZE(0);
+    ASSERT_from_dataReturnOut_SIZE(1);
+    ASSERT_EQ(this->fromPortHistory_dataReturnOut->at(0).data.getData(), data);
+    ASSERT_EQ(this->fromPortHistory_dataReturnOut->at(0).data.getSize(), buffer_size);
+}
+
+void FrameAccumulatorTester ::testZeroCopyStraddlingFrameCopied() {
+    Fw::Buffer::SizeType buffer1_size = 10;
+    Fw::Buffer::SizeType buffer2_size = 20;
+    U8 data1[buffer1_size];
+    U8 data2[buffer2_size];
+    Fw::Buffer buffer1(data1, buffer1_size);
+    Fw::Buffer buffer2(data2, buffer2_size);
+    ComCfg::FrameContext context;
+
+    this->mockDetector.set_next_result(FrameDetector::Status::MORE_DATA_NEEDED, buffer1_size + buffer2_size);
+    this->invoke_to_dataIn(0, buffer1, context);
+    this->mockDetector.set_next_result(FrameDetector::Status::FRAME_DETECTED, buffer1_size + buffer2_size);
+    this->invoke_to_dataIn(0, buffer2, context);
+
+    // Frame spans both buffers so it is copied into an allocated buffer and the inputs are returned immediately
+    ASSERT_from_dataReturnOut_SIZE(2);
+    ASSERT_from_bufferAllocate_SIZE(1);
+    ASSERT_from_dataOut_SIZE(1);
+    ASSERT_EQ(this->fromPortHistory_dataOut->at(0).data.getData(), this->m_buffer_slot);
+    ASSERT_EQ(this->component.m_inRing.get_allocated_size(), 0);
+
+    Fw::Buffer frame = this->fromPortHistory_dataOut->at(0).data;
+    this->invoke_to_dataReturnIn(0, frame, context);
+    ASSERT_from_bufferDeallocate_SIZE(1);
+    ASSERT_from_dataReturnOut_SIZE(2);
+}
+
 // ----------------------------------------------------------------------
 // Helper functions
 // ----------------------------------------------------------------------
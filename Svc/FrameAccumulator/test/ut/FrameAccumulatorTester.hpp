@@ -32,7 +32,8 @@ class FrameAccumulatorTester : public FrameAccumulatorGTestBase {
     // ----------------------------------------------------------------------
 
     //! Construct object FrameAccumulatorTester
-    FrameAccumulatorTester();
+    explicit FrameAccumulatorTester(bool zeroCopy = false  //!< Configure the component in zero-copy mode
+    );
 
     //! Destroy object FrameAccumulatorTester
     ~FrameAccumulatorTester();
@@ -69,6 +70,12 @@ class FrameAccumulatorTester : public FrameAccumulatorGTestBase {
     //! Test handling of errors from the FrameDetector (too large size_out)
     void testDetectionErrorHandling();
 
+    //! Test zero-copy forwarding of a frame contained in one incoming buffer
+    void testZeroCopyFrameForwarded();
+
+    //! Test zero-copy fallback to copying for a frame straddling two incoming buffers
+    void testZeroCopyStraddlingFrameCopied();
+
   private:
     // ----------------------------------------------------------------------
     // Helper functions
@@ -9,9 +9,7 @@
 #include <Svc/PrmDb/PrmDbImpl.hpp>
 
 #include <Os/File.hpp>
-extern "C" {
-#include <Utils/Hash/libcrc/lib_crc.h>
-}
+#include <Utils/Hash/libcrc/CRC32Engine.hpp>
 
 #include <cstdio>
 #include <cstring>
@@ -35,6 +33,12 @@ class WorkingBuffer : public Fw::SerializeBufferBase {
     // Set to max of parameter buffer + id
     U8 m_buff[FW_PARAM_BUFFER_MAX_SIZE + sizeof(FwPrmIdType)];
 };
+
+//! Size of the delimiter, record size, and parameter ID preceding each value in the file
+constexpr FwSizeType RECORD_HEADER_SIZE = sizeof(U8) + sizeof(U32) + sizeof(FwPrmIdType);
+
+static_assert(PRMDB_SAVE_BUFFER_SIZE >= sizeof(U32) + RECORD_HEADER_SIZE + FW_PARAM_BUFFER_MAX_SIZE,
+              "PRMDB_SAVE_BUFFER_SIZE must hold the CRC and a record of maximum size");
 }  // namespace
 
 //! ----------------------------------------------------------------------
@@ -79,14 +83,10 @@ Fw::ParamValid PrmDbImpl::getPrm_handler(FwIndexType portNum, FwPrmIdType id, Fw
     // search for entry
     Fw::ParamValid stat = Fw::ParamValid::INVALID;
 
-    for (FwSizeType entry = 0; entry < PRMDB_NUM_DB_ENTRIES; entry++) {
-        if (this->m_activeDb[entry].used) {
-            if (this->m_activeDb[entry].id == id) {
-                val = this->m_activeDb[entry].val;
-                stat = Fw::ParamValid::VALID;
-                break;
-            }
-        }
+    FwSizeType slot = 0;
+    if (this->findSlot(PrmDbType::DB_ACTIVE, id, slot)) {
+        val = this->m_activeDb[slot].val;
+        stat = Fw::ParamValid::VALID;
     }
 
     // if unable to find parameter, send error message
@@ -138,10 +138,7 @@ U32 PrmDbImpl::computeCrc(U32 crc, const BYTE* buff, FwSizeType size) {
     if (size == 0) {
         return crc;
     }
-    for (FwSizeType byte = 0; byte < size; byte++) {
-        crc = static_cast<U32>(update_crc_32(crc, static_cast<char>(buff[byte])));
-    }
-    return crc;
+    return Utils::CRC32Engine::update(crc, buff, size);
 }
 
 void PrmDbImpl::PRM_SAVE_FILE_cmdHandler(FwOpcodeType opCode, U32 cmdSeq) {
@@ -154,173 +151,62 @@ void PrmDbImpl::PRM_SAVE_FILE_cmdHandler(FwOpcodeType opCode, U32 cmdSeq) {
 
     FW_ASSERT(this->m_fileName.length() > 0);
 
-    Os::File paramFile;
-    WorkingBuffer buff;
-
-    Os::File::Status stat = paramFile.open(this->m_fileName.toChar(), Os::File::OPEN_WRITE);
-    if (stat != Os::File::OP_OK) {
-        this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::OPEN, 0, stat);
-        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
-        return;
-    }
+    // Every update to the active database (setPrm, PRM_COMMIT_STAGED) is dispatched on this component's thread, so
+    // the active database cannot change while this handler runs. It is read without taking the lock, and getPrm
+    // callers are not held up while the file is written.
+    const t_dbStruct* db = getDbPtr(PrmDbType::DB_ACTIVE);
+    FW_ASSERT(db != nullptr);
 
-    // write placeholder for the CRC
+    // First pass: compute the CRC so that it can lead the first block written
     U32 crc = 0xFFFFFFFF;
-    FwSizeType writeSize = static_cast<FwSizeType>(sizeof(crc));
-    stat = paramFile.write(reinterpret_cast<const U8*>(&crc), writeSize, Os::File::WaitType::WAIT);
+    U8 header[RECORD_HEADER_SIZE];
+    Fw::ExternalSerializeBuffer headerBuff(header, static_cast<Fw::Serializable::SizeType>(sizeof(header)));
+    for (FwSizeType entry = 0; entry < PRMDB_NUM_DB_ENTRIES; entry++) {
+        if (db[entry].used) {
+            headerBuff.resetSer();
+            serializeRecordHeader(db[entry], headerBuff);
+            crc = this->computeCrc(crc, headerBuff.getBuffAddr(), headerBuff.getSize());
+            crc = this->computeCrc(crc, db[entry].val.getBuffAddr(), db[entry].val.getSize());
+        }
+    }
 
+    Os::File paramFile;
+    Os::File::Status stat = paramFile.open(this->m_fileName.toChar(), Os::File::OPEN_WRITE);
     if (stat != Os::File::OP_OK) {
-        this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::CRC_PLACE, 0, stat);
+        this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::OPEN, 0, stat);
         this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
         return;
     }
 
-    this->lock();
-    t_dbStruct* db = getDbPtr(PrmDbType::DB_ACTIVE);
-    FW_ASSERT(db != nullptr);
-
-    // Traverse the parameter list, saving each entry
+    // Second pass: serialize the CRC and records into the save buffer, writing it out whenever the next record
+    // does not fit. The CRC is stored in host byte order, matching readParamFileImpl.
+    Fw::ExternalSerializeBuffer buff(this->m_saveBuffer, static_cast<Fw::Serializable::SizeType>(sizeof(m_saveBuffer)));
+    Fw::SerializeStatus serStat =
+        buff.serializeFrom(reinterpret_cast<const U8*>(&crc), sizeof(crc), Fw::Serialization::OMIT_LENGTH);
+    FW_ASSERT(Fw::FW_SERIALIZE_OK == serStat, static_cast<FwAssertArgType>(serStat));
 
     U32 numRecords = 0;
+    U32 blockStart = 0;
 
     for (FwSizeType entry = 0; entry < PRMDB_NUM_DB_ENTRIES; entry++) {
         if (db[entry].used) {
-            // write delimiter
-            static const U8 delim = PRMDB_ENTRY_DELIMITER;
-            writeSize = static_cast<FwSizeType>(sizeof(delim));
-            stat = paramFile.write(&delim, writeSize, Os::File::WaitType::WAIT);
-            if (stat != Os::File::OP_OK) {
-                this->unLock();
-                this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::DELIMITER, static_cast<I32>(numRecords), stat);
-                this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
-                return;
-            }
-            if (writeSize != sizeof(delim)) {
-                this->unLock();
-                this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::DELIMITER_SIZE, static_cast<I32>(numRecords),
-                                                       static_cast<I32>(writeSize));
-                this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
-                return;
-            }
-
-            // add delimiter to CRC
-            crc = this->computeCrc(crc, &delim, sizeof(delim));
-
-            // serialize record size = id field + data
-            U32 recordSize = static_cast<U32>(sizeof(FwPrmIdType) + db[entry].val.getSize());
-
-            // reset buffer
-            buff.resetSer();
-            Fw::SerializeStatus serStat = buff.serializeFrom(recordSize);
-            // should always work
-            FW_ASSERT(Fw::FW_SERIALIZE_OK == serStat, static_cast<FwAssertArgType>(serStat));
-
-            // write record size
-            writeSize = static_cast<FwSizeType>(buff.getSize());
-            stat = paramFile.write(buff.getBuffAddr(), writeSize, Os::File::WaitType::WAIT);
-            if (stat != Os::File::OP_OK) {
-                this->unLock();
-                this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::RECORD_SIZE, static_cast<I32>(numRecords), stat);
-                this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
-                return;
-            }
-            if (writeSize != sizeof(recordSize)) {
-                this->unLock();
-                this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::RECORD_SIZE_SIZE, static_cast<I32>(numRecords),
-                                                       static_cast<I32>(writeSize));
-                this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
-                return;
+            const FwSizeType valSize = static_cast<FwSizeType>(db[entry].val.getSize());
+            if (buff.getSerializeSizeLeft() < RECORD_HEADER_SIZE + valSize) {
+                if (not this->writeSaveBuffer(paramFile, buff, blockStart)) {
+                    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
+                    return;
+                }
+                blockStart = numRecords;
             }
-
-            // add recordSize to CRC
-            crc = this->computeCrc(crc, buff.getBuffAddr(), writeSize);
-
-            // reset buffer
-            buff.resetSer();
-
-            // serialize parameter id
-
-            serStat = buff.serializeFrom(db[entry].id);
-            // should always work
+            serializeRecordHeader(db[entry], buff);
+            serStat = buff.serializeFrom(db[entry].val.getBuffAddr(), valSize, Fw::Serialization::OMIT_LENGTH);
+            // should always work, the space was checked above
             FW_ASSERT(Fw::FW_SERIALIZE_OK == serStat, static_cast<FwAssertArgType>(serStat));
-
-            // write parameter ID
-            writeSize = static_cast<FwSizeType>(buff.getSize());
-            stat = paramFile.write(buff.getBuffAddr(), writeSize, Os::File::WaitType::WAIT);
-            if (stat != Os::File::OP_OK) {
-                this->unLock();
-                this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::PARAMETER_ID, static_cast<I32>(numRecords), stat);
-                this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
-                return;
-            }
-            if (writeSize != static_cast<FwSizeType>(buff.getSize())) {
-                this->unLock();
-                this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::PARAMETER_ID_SIZE, static_cast<I32>(numRecords),
-                                                       static_cast<I32>(writeSize));
-                this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
-                return;
-            }
-
-            // add parameter ID to CRC
-            crc = this->computeCrc(crc, buff.getBuffAddr(), writeSize);
-
-            // write serialized parameter value
-
-            writeSize = static_cast<FwSizeType>(db[entry].val.getSize());
-            stat = paramFile.write(db[entry].val.getBuffAddr(), writeSize, Os::File::WaitType::WAIT);
-            if (stat != Os::File::OP_OK) {
-                this->unLock();
-                this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::PARAMETER_VALUE, static_cast<I32>(numRecords),
-                                                       stat);
-                this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
-                return;
-            }
-            if (writeSize != static_cast<FwSizeType>(db[entry].val.getSize())) {
-                this->unLock();
-                this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::PARAMETER_VALUE_SIZE,
-                                                       static_cast<I32>(numRecords), static_cast<I32>(writeSize));
-                this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
-                return;
-            }
-
-            // add serialized parameter value to crc
-            crc = this->computeCrc(crc, db[entry].val.getBuffAddr(), writeSize);
-
             numRecords++;
-        }  // end if record in use
-    }  // end for each record
-
-    this->unLock();
-
-    // save current location of pointer in paramFile
-    FwSizeType currPosInParamFile;
-
-    stat = paramFile.position(currPosInParamFile);
-    if (stat != Os::File::OP_OK) {
-        this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::CURR_POSITION, 0, stat);
-        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
-        return;
-    }
-
-    // seek to beginning and write CRC value
-    stat = paramFile.seek(0, Os::File::SeekType::ABSOLUTE);
-    if (stat != Os::File::OP_OK) {
-        this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::SEEK_ZERO, 0, stat);
-        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
-        return;
-    }
-    writeSize = static_cast<FwSizeType>(sizeof(crc));
-    stat = paramFile.write(reinterpret_cast<const U8*>(&crc), writeSize, Os::File::WaitType::WAIT);
-    if (stat != Os::File::OP_OK) {
-        this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::CRC_REAL, 0, stat);
-        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
-        return;
+        }
     }
 
-    // Restore pointer to previously saved location
-    stat = paramFile.seek(static_cast<FwSignedSizeType>(currPosInParamFile), Os::File::SeekType::ABSOLUTE);
-    if (stat != Os::File::OP_OK) {
-        this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::SEEK_POSITION, 0, stat);
+    if (not this->writeSaveBuffer(paramFile, buff, blockStart)) {
         this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
         return;
     }
@@ -581,29 +467,27 @@ PrmDbImpl::PrmLoadStatus PrmDbImpl::readParamFileImpl(const Fw::StringBase& file
 
 PrmDbImpl::PrmUpdateType PrmDbImpl::updateAddPrmImpl(FwPrmIdType id, Fw::ParamBuffer& val, PrmDbType prmDbType) {
     t_dbStruct* db = getDbPtr(prmDbType);
+    DbIndex& index = getDbIndex(prmDbType);
 
     PrmUpdateType updateStatus = NO_SLOTS;
 
     this->lock();
     // search for existing entry
-    bool existingEntry = false;
-
-    for (FwSizeType entry = 0; entry < PRMDB_NUM_DB_ENTRIES; entry++) {
-        if ((db[entry].used) && (id == db[entry].id)) {
-            db[entry].val = val;
-            existingEntry = true;
-            updateStatus = PARAM_UPDATED;
-            break;
-        }
-    }
-
-    // if there is no existing entry, add one
-    if (!existingEntry) {
+    FwSizeType slot = 0;
+    if (index.find(id, slot) == Fw::Success::SUCCESS) {
+        db[slot].val = val;
+        updateStatus = PARAM_UPDATED;
+    } else {
+        // Slots are filled in order, so the first free slot is normally the one after the last used one.
+        // Start the search there and wrap around to cover holes left by copying single entries.
         for (FwSizeType entry = 0; entry < PRMDB_NUM_DB_ENTRIES; entry++) {
-            if (!(db[entry].used)) {
-                db[entry].val = val;
-                db[entry].id = id;
-                db[entry].used = true;
+            slot = (index.getSize() + entry) % PRMDB_NUM_DB_ENTRIES;
+            if (!(db[slot].used)) {
+                db[slot].val = val;
+                db[slot].id = id;
+                db[slot].used = true;
+                const Fw::Success status = index.insert(id, slot);
+                FW_ASSERT(status == Fw::Success::SUCCESS, static_cast<FwAssertArgType>(id));
                 updateStatus = PARAM_ADDED;
                 break;
             }
@@ -614,6 +498,37 @@ PrmDbImpl::PrmUpdateType PrmDbImpl::updateAddPrmImpl(FwPrmIdType id, Fw::ParamBu
     return updateStatus;
 }
 
+void PrmDbImpl::serializeRecordHeader(const t_dbStruct& entry, Fw::SerialBufferBase& buff) {
+    // record size = id field + data
+    const U32 recordSize = static_cast<U32>(sizeof(FwPrmIdType) + entry.val.getSize());
+    Fw::SerializeStatus serStat = buff.serializeFrom(static_cast<U8>(PRMDB_ENTRY_DELIMITER));
+    if (serStat == Fw::FW_SERIALIZE_OK) {
+        serStat = buff.serializeFrom(recordSize);
+    }
+    if (serStat == Fw::FW_SERIALIZE_OK) {
+        serStat = buff.serializeFrom(entry.id);
+    }
+    // should always work, callers reserve RECORD_HEADER_SIZE bytes
+    FW_ASSERT(Fw::FW_SERIALIZE_OK == serStat, static_cast<FwAssertArgType>(serStat));
+}
+
+bool PrmDbImpl::writeSaveBuffer(Os::File& file, Fw::ExternalSerializeBuffer& buff, U32 recordNum) {
+    const FwSizeType size = static_cast<FwSizeType>(buff.getSize());
+    FwSizeType writeSize = size;
+    const Os::File::Status stat = file.write(buff.getBuffAddr(), writeSize, Os::File::WaitType::WAIT);
+    if (stat != Os::File::OP_OK) {
+        this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::BLOCK, static_cast<I32>(recordNum), stat);
+        return false;
+    }
+    if (writeSize != size) {
+        this->log_WARNING_HI_PrmFileWriteError(PrmWriteError::BLOCK_SIZE, static_cast<I32>(recordNum),
+                                               static_cast<I32>(writeSize));
+        return false;
+    }
+    buff.resetSer();
+    return true;
+}
+
 //! ----------------------------------------------------------------------
 //! Helpers for database management
 //! ----------------------------------------------------------------------
@@ -624,6 +539,7 @@ void PrmDbImpl::clearDb(PrmDbType prmDbType) {
         db[entry].used = false;
         db[entry].id = 0;
     }
+    getDbIndex(prmDbType).clear();
 }
 
 bool PrmDbImpl::dbEqual() {
@@ -636,9 +552,13 @@ bool PrmDbImpl::dbEqual() {
 }
 
 void PrmDbImpl::dbCopy(PrmDbType dest, PrmDbType src) {
+    t_dbStruct* srcPtr = getDbPtr(src);
+    t_dbStruct* destPtr = getDbPtr(dest);
     for (FwSizeType i = 0; i < PRMDB_NUM_DB_ENTRIES; i++) {
-        dbCopySingle(dest, src, i);
+        destPtr[i] = srcPtr[i];
     }
+    // Identical slots give identical indices
+    getDbIndex(dest) = getDbIndex(src);
     this->log_ACTIVITY_HI_PrmDbCopyAllComplete(getDbString(src), getDbString(dest));
 }
 
@@ -646,10 +566,34 @@ void PrmDbImpl::dbCopySingle(PrmDbType dest, PrmDbType src, FwSizeType index) {
     t_dbStruct* srcPtr = getDbPtr(src);
     t_dbStruct* destPtr = getDbPtr(dest);
 
+    DbIndex& destIndex = getDbIndex(dest);
+
     FW_ASSERT(index < PRMDB_NUM_DB_ENTRIES);
+    // Drop the index entry for the parameter being overwritten
+    FwSizeType slot = 0;
+    if (destPtr[index].used and (destIndex.find(destPtr[index].id, slot) == Fw::Success::SUCCESS) and
+        (slot == index)) {
+        (void)destIndex.remove(destPtr[index].id, slot);
+    }
     destPtr[index].used = srcPtr[index].used;
     destPtr[index].id = srcPtr[index].id;
     destPtr[index].val = srcPtr[index].val;
+    if (destPtr[index].used) {
+        const Fw::Success status = destIndex.insert(destPtr[index].id, index);
+        FW_ASSERT(status == Fw::Success::SUCCESS, static_cast<FwAssertArgType>(index));
+    }
+}
+
+bool PrmDbImpl::findSlot(PrmDbType dbType, FwPrmIdType id, FwSizeType& slot) {
+    return getDbIndex(dbType).find(id, slot) == Fw::Success::SUCCESS;
+}
+
+PrmDbImpl::DbIndex& PrmDbImpl::getDbIndex(PrmDbType dbType) {
+    // The index belongs to the storage array, which may be either database after a commit
+    if (getDbPtr(dbType) == this->m_dbStore1) {
+        return this->m_dbIndex1;
+    }
+    return this->m_dbIndex2;
 }
 
 PrmDbImpl::t_dbStruct* PrmDbImpl::getDbPtr(PrmDbType dbType) {
@@ -13,7 +13,9 @@
 #ifndef PRMDBIMPL_HPP_
 #define PRMDBIMPL_HPP_
 
+#include <Fw/DataStructures/RedBlackTreeMap.hpp>
 #include <Fw/Types/String.hpp>
+#include <Os/File.hpp>
 #include <Os/Mutex.hpp>
 #include <Svc/PrmDb/PrmDbComponentAc.hpp>
 #include <Svc/PrmDb/PrmDb_PrmDbFileLoadStateEnumAc.hpp>
@@ -104,6 +106,9 @@ class PrmDbImpl final : public PrmDbComponentBase {
         }
     };
 
+    //! Index from parameter ID to slot in a database array
+    using DbIndex = Fw::RedBlackTreeMap<FwPrmIdType, FwSizeType, PRMDB_NUM_DB_ENTRIES>;
+
     // helper to compute CRC over a buffer
     U32 computeCrc(U32 crc, const BYTE* buff, FwSizeType size);
 
@@ -121,6 +126,14 @@ class PrmDbImpl final : public PrmDbComponentBase {
     t_dbStruct m_dbStore1[PRMDB_NUM_DB_ENTRIES];
     t_dbStruct m_dbStore2[PRMDB_NUM_DB_ENTRIES];
 
+    // ID indices for the two storage arrays. Each index belongs to the array with the same
+    // number, so it follows its array when the active and staging pointers are swapped.
+    DbIndex m_dbIndex1;  //!< Index for m_dbStore1
+    DbIndex m_dbIndex2;  //!< Index for m_dbStore2
+
+    //! Buffer the parameter file is serialized into when saving
+    U8 m_saveBuffer[PRMDB_SAVE_BUFFER_SIZE];
+
     //! ----------------------------------------------------------------------
     //! Port & Command Handlers
     //! ----------------------------------------------------------------------
@@ -180,7 +193,8 @@ class PrmDbImpl final : public PrmDbComponentBase {
     //!
     //!  This function saves the parameter values stored in RAM to the file
     //!  specified in the constructor. Any updates to parameters are not saved
-    //!  until this function is called.
+    //!  until this function is called. Records are serialized into the save
+    //!  buffer and written a buffer at a time, without holding the lock.
     //!
     //!  \param opCode The opcode of this commands
     //!  \param cmdSeq The sequence number of the command
@@ -222,6 +236,36 @@ class PrmDbImpl final : public PrmDbComponentBase {
     //!  \param dbType The type of database to clear (active or staging)
     void clearDb(PrmDbType prmDbType);
 
+    //!  \brief Write out the serialized contents of the save buffer
+    //!
+    //!  Emits a PrmFileWriteError event on failure and resets the buffer on success.
+    //!
+    //!  \param file The open parameter file
+    //!  \param buff The save buffer
+    //!  \param recordNum The number of the first record in the buffer
+    //!  \return true if the whole buffer was written
+    bool writeSaveBuffer(Os::File& file, Fw::ExternalSerializeBuffer& buff, U32 recordNum);
+
+    //!  \brief Serialize the delimiter, record size, and ID that precede a parameter value in the file
+    //!
+    //!  \param entry The database entry
+    //!  \param buff The buffer to serialize into
+    static void serializeRecordHeader(const t_dbStruct& entry, Fw::SerialBufferBase& buff);
+
+    //!  \brief Find the slot holding a parameter
+    //!
+    //!  \param dbType The type of database to search (active or staging)
+    //!  \param id The parameter ID
+    //!  \param slot The slot index, set when the parameter is found
+    //!  \return true if the parameter is in the database
+    bool findSlot(PrmDbType dbType, FwPrmIdType id, FwSizeType& slot);
+
+    //!  \brief PrmDb get db index function
+    //!  This function returns the ID index of the requested database
+    //!  \param dbType The type of database requested (active or staging)
+    //!  \return The index for the database
+    DbIndex& getDbIndex(PrmDbType dbType);
+
     //!  \brief PrmDb get db pointer function
     //!  This function returns a pointer to the requested database
     //!  \param dbType The type of database requested (active or staging)
@@ -175,6 +175,25 @@ TEST(ParameterDbTest, PrmFileWriteError) {
     tester.runFileWriteError();
 }
 
+TEST(ParameterDbTest, PrmFileMultiBlockSave) {
+    TEST_CASE(105.2.4, "Multi-block file save");
+    COMMENT("Save a database larger than the save buffer, then load it back");
+
+    Svc::PrmDbImpl impl("PrmDbImpl");
+
+    impl.init(10, 0);
+    impl.configure("TestFile.prm");
+
+    Svc::PrmDbTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl, tester);
+
+    tester.runMultiBlockSaveFile();
+}
+
 TEST(ParameterDbTest, PrmDbEqualTest) {
     Svc::PrmDbImpl impl("PrmDbImpl");
 
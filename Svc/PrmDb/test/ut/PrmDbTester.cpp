@@ -495,47 +495,27 @@ void PrmDbTester::runFileWriteError() {
 
     this->runNominalPopulate();
 
-    FwSizeType zb = 0;
+    // The two populated records fit in one block, so the file is written with a single call
+    const FwSizeType fileSize = sizeof(U32) + 2 * (sizeof(U8) + sizeof(U32) + sizeof(FwPrmIdType) + sizeof(U32));
 
-    // Loop through all size errors testing each
+    // Short write
     Os::Stub::File::Test::StaticData::setNextStatus(Os::File::OP_OK);
     this->m_errorType = FILE_SIZE_ERROR;
-    for (FwSizeType i = 0; i < 4; i++) {
-        clearEvents();
-        this->clearHistory();
-        this->m_waits = i + zb;
-        this->sendCmd_PRM_SAVE_FILE(0, 12);
-        stat = this->m_impl.doDispatch();
-        ASSERT_EQ(stat, Fw::QueuedComponentBase::MSG_DISPATCH_OK);
-        ASSERT_EVENTS_SIZE(1);
-        switch (i) {
-            case 0:
-                ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-                ASSERT_EVENTS_PrmFileWriteError(0, PrmWriteError::DELIMITER_SIZE, 0, sizeof(U8) + 1);
-                zb++;
-                break;
-            case 1:
-                ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-                ASSERT_EVENTS_PrmFileWriteError(0, PrmWriteError::RECORD_SIZE_SIZE, 0, sizeof(U32) + 1);
-                break;
-            case 2:
-                ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-                ASSERT_EVENTS_PrmFileWriteError(0, PrmWriteError::PARAMETER_ID_SIZE, 0, sizeof(FwPrmIdType) + 1);
-                break;
-            case 3:
-                ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-                ASSERT_EVENTS_PrmFileWriteError(0, PrmWriteError::PARAMETER_VALUE_SIZE, 0, sizeof(U32) + 1);
-                break;
-            default:
-                FAIL() << "Reached unknown case";
-        }
-        ASSERT_CMD_RESPONSE_SIZE(1);
-        ASSERT_CMD_RESPONSE(0, PrmDbImpl::OPCODE_PRM_SAVE_FILE, 12, Fw::CmdResponse::EXECUTION_ERROR);
-    }
+    this->clearEvents();
+    this->clearHistory();
+    this->m_waits = 0;
+    this->sendCmd_PRM_SAVE_FILE(0, 12);
+    stat = this->m_impl.doDispatch();
+    ASSERT_EQ(stat, Fw::QueuedComponentBase::MSG_DISPATCH_OK);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
+    ASSERT_EVENTS_PrmFileWriteError(0, PrmWriteError::BLOCK_SIZE, 0, fileSize + 1);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, PrmDbImpl::OPCODE_PRM_SAVE_FILE, 12, Fw::CmdResponse::EXECUTION_ERROR);
 
     // Loop through failure statuses
+    this->m_errorType = FILE_STATUS_ERROR;
     for (FwSizeType i = 0; i < 2; i++) {
-        this->m_errorType = FILE_STATUS_ERROR;
         // Set various file errors
         switch (i) {
             case 0:
@@ -547,41 +527,81 @@ void PrmDbTester::runFileWriteError() {
             default:
                 FAIL() << "Reached unknown case";
         }
-        // Loop through various field reads
-        for (FwSizeType j = 0; j < 5; j++) {
-            clearEvents();
-            this->clearHistory();
-            this->m_waits = j;
-            this->sendCmd_PRM_SAVE_FILE(0, 12);
-            stat = this->m_impl.doDispatch();
-            ASSERT_EQ(stat, Fw::QueuedComponentBase::MSG_DISPATCH_OK);
-            ASSERT_EVENTS_SIZE(1);
-            switch (j) {
-                case 0:
-                    ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-                    ASSERT_EVENTS_PrmFileWriteError(0, PrmWriteError::CRC_PLACE, 0, this->m_status);
-                    break;
-                case 1:
-                    ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-                    ASSERT_EVENTS_PrmFileWriteError(0, PrmWriteError::DELIMITER, 0, this->m_status);
-                    break;
-                case 2:
-                    ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-                    ASSERT_EVENTS_PrmFileWriteError(0, PrmWriteError::RECORD_SIZE, 0, this->m_status);
-                    break;
-                case 3:
-                    ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-                    ASSERT_EVENTS_PrmFileWriteError(0, PrmWriteError::PARAMETER_ID, 0, this->m_status);
-                    break;
-                case 4:
-                    ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
-                    ASSERT_EVENTS_PrmFileWriteError(0, PrmWriteError::PARAMETER_VALUE, 0, this->m_status);
-                    break;
-                default:
-                    FAIL() << "Reached unknown case";
-            }
-            ASSERT_CMD_RESPONSE_SIZE(1);
-            ASSERT_CMD_RESPONSE(0, PrmDbImpl::OPCODE_PRM_SAVE_FILE, 12, Fw::CmdResponse::EXECUTION_ERROR);
+        clearEvents();
+        this->clearHistory();
+        this->m_waits = 0;
+        this->sendCmd_PRM_SAVE_FILE(0, 12);
+        stat = this->m_impl.doDispatch();
+        ASSERT_EQ(stat, Fw::QueuedComponentBase::MSG_DISPATCH_OK);
+        ASSERT_EVENTS_SIZE(1);
+        ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
+        ASSERT_EVENTS_PrmFileWriteError(0, PrmWriteError::BLOCK, 0, this->m_status);
+        ASSERT_CMD_RESPONSE_SIZE(1);
+        ASSERT_CMD_RESPONSE(0, PrmDbImpl::OPCODE_PRM_SAVE_FILE, 12, Fw::CmdResponse::EXECUTION_ERROR);
+    }
+}
+
+void PrmDbTester::runMultiBlockSaveFile() {
+    const FwSizeType recordSize = sizeof(U8) + sizeof(U32) + sizeof(FwPrmIdType) + FW_PARAM_BUFFER_MAX_SIZE;
+    // Large enough for a full database of maximum size values
+    static U8 fileData[sizeof(U32) + PRMDB_NUM_DB_ENTRIES * recordSize];
+    ASSERT_GT(sizeof fileData, static_cast<FwSizeType>(PRMDB_SAVE_BUFFER_SIZE));
+
+    // Fill the database with maximum size values so the file spans several save buffers
+    this->m_impl.clearDb(PrmDbType::DB_ACTIVE);
+    this->m_impl.clearDb(PrmDbType::DB_STAGING);
+    Fw::ParamBuffer pBuff;
+    for (FwPrmIdType id = 0; id < PRMDB_NUM_DB_ENTRIES; id++) {
+        pBuff.resetSer();
+        for (FwSizeType byte = 0; byte < FW_PARAM_BUFFER_MAX_SIZE; byte++) {
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK, pBuff.serializeFrom(static_cast<U8>(id + byte)));
+        }
+        ASSERT_EQ(PrmDbImpl::PARAM_ADDED, this->m_impl.updateAddPrmImpl(id, pBuff, PrmDbType::DB_ACTIVE));
+    }
+
+    // Fail the write of the second block
+    Os::Stub::File::Test::StaticData::setWriteResult(fileData, sizeof fileData);
+    Os::Stub::File::Test::StaticData::setNextStatus(Os::File::OP_OK);
+    this->m_errorType = FILE_STATUS_ERROR;
+    this->m_status = Os::File::Status::NO_SPACE;
+    this->m_waits = 1;
+    this->clearEvents();
+    this->clearHistory();
+    this->sendCmd_PRM_SAVE_FILE(0, 12);
+    Fw::QueuedComponentBase::MsgDispatchStatus stat = this->m_impl.doDispatch();
+    ASSERT_EQ(stat, Fw::QueuedComponentBase::MSG_DISPATCH_OK);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_PrmFileWriteError_SIZE(1);
+    ASSERT_EVENTS_PrmFileWriteError(0, PrmWriteError::BLOCK, (PRMDB_SAVE_BUFFER_SIZE - sizeof(U32)) / recordSize,
+                                    Os::File::Status::NO_SPACE);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, PrmDbImpl::OPCODE_PRM_SAVE_FILE, 12, Fw::CmdResponse::EXECUTION_ERROR);
+
+    // Save the whole file
+    this->m_errorType = FILE_READ_NO_ERROR;
+    this->clearEvents();
+    this->clearHistory();
+    this->sendCmd_PRM_SAVE_FILE(0, 12);
+    stat = this->m_impl.doDispatch();
+    ASSERT_EQ(stat, Fw::QueuedComponentBase::MSG_DISPATCH_OK);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, PrmDbImpl::OPCODE_PRM_SAVE_FILE, 12, Fw::CmdResponse::OK);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_PrmFileSaveComplete(0, PRMDB_NUM_DB_ENTRIES);
+    ASSERT_EQ(sizeof fileData, Os::Stub::File::Test::StaticData::data.pointer);
+
+    // Load the file back and verify every value
+    Os::Stub::File::Test::StaticData::setReadResult(fileData, sizeof fileData);
+    this->clearEvents();
+    this->m_impl.readParamFile();
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_PrmFileLoadComplete(0, "ACTIVE", PRMDB_NUM_DB_ENTRIES, PRMDB_NUM_DB_ENTRIES, 0);
+    for (FwPrmIdType id = 0; id < PRMDB_NUM_DB_ENTRIES; id++) {
+        pBuff.resetSer();
+        ASSERT_EQ(Fw::ParamValid::VALID, this->invoke_to_getPrm(0, id, pBuff).e);
+        ASSERT_EQ(static_cast<FwSizeType>(FW_PARAM_BUFFER_MAX_SIZE), pBuff.getSize());
+        for (FwSizeType byte = 0; byte < FW_PARAM_BUFFER_MAX_SIZE; byte++) {
+            ASSERT_EQ(static_cast<U8>(id + byte), pBuff.getBuffAddr()[byte]);
         }
     }
 }
@@ -26,6 +26,7 @@ class PrmDbTester : public PrmDbGTestBase {
     void runMissingExtraParams();
     void runFileReadError();
     void runFileWriteError();
+    void runMultiBlockSaveFile();
     void runDbEqualTest();
     void runDbCopyTest();
     void runDbCommitTest();
@@ -12,178 +12,269 @@
 #include <Fw/Com/ComBuffer.hpp>
 #include <Fw/FPrimeBasicTypes.hpp>
 #include <Fw/Types/Assert.hpp>
+#include <Os/Task.hpp>
 #include <Svc/TlmChan/TlmChan.hpp>
+#include <cstring>
 
 namespace Svc {
 
 // Definition of TLMCHAN_HASH_BUCKETS is >= number of telemetry ids
-static_assert(std::numeric_limits<FwChanIdType>::max() >= TLMCHAN_HASH_BUCKETS,
+static_assert(std::numeric_limits<FwChanIdType>::max() > TLMCHAN_HASH_BUCKETS,
               "Cannot have more hash buckets than maximum telemetry ids in the system");
-// TLMCHAN_HASH_BUCKETS >= TLMCHAN_NUM_TLM_HASH_SLOTS >= 0
-static_assert(std::numeric_limits<FwChanIdType>::max() >= TLMCHAN_NUM_TLM_HASH_SLOTS,
-              "Cannot have more hash slots than maximum telemetry ids in the system");
 
-TlmChan::TlmChan(const char* name) : TlmChanComponentBase(name), m_activeBuffer(0) {
-    // clear slot pointers
-    for (FwChanIdType entry = 0; entry < TLMCHAN_NUM_TLM_HASH_SLOTS; entry++) {
-        this->m_tlmEntries[0].slots[entry] = nullptr;
-        this->m_tlmEntries[1].slots[entry] = nullptr;
+TlmChan::TlmChan(const char* name)
+    : TlmChanComponentBase(name), m_numBuckets(0), m_activeBuffer(0), m_valueArenaUsed(0), m_compactValues(false) {
+    // clear channel index
+    for (FwSizeType slot = 0; slot < TLMCHAN_INDEX_SLOTS; slot++) {
+        this->m_channelIndex[slot].store(TLMCHAN_INDEX_EMPTY);
     }
     // clear buckets
-    for (FwChanIdType entry = 0; entry < TLMCHAN_HASH_BUCKETS; entry++) {
-        this->m_tlmEntries[0].buckets[entry].used = false;
-        this->m_tlmEntries[0].buckets[entry].updated = false;
-        this->m_tlmEntries[0].buckets[entry].bucketNo = entry;
-        this->m_tlmEntries[0].buckets[entry].next = nullptr;
-        this->m_tlmEntries[0].buckets[entry].id = 0;
-        this->m_tlmEntries[1].buckets[entry].used = false;
-        this->m_tlmEntries[1].buckets[entry].updated = false;
-        this->m_tlmEntries[1].buckets[entry].bucketNo = entry;
-        this->m_tlmEntries[1].buckets[entry].next = nullptr;
-        this->m_tlmEntries[1].buckets[entry].id = 0;
-    }
-    // clear free index
-    this->m_tlmEntries[0].free = 0;
-    this->m_tlmEntries[1].free = 0;
+    for (U32 set = 0; set < 2; set++) {
+        for (FwChanIdType entry = 0; entry < TLMCHAN_HASH_BUCKETS; entry++) {
+            this->m_tlmEntries[set].buckets[entry].used = false;
+            this->m_tlmEntries[set].buckets[entry].updated.store(false);
+            this->m_tlmEntries[set].buckets[entry].sequence.store(0);
+            this->m_tlmEntries[set].buckets[entry].bucketNo = entry;
+            this->m_tlmEntries[set].buckets[entry].id = 0;
+            this->m_tlmEntries[set].buckets[entry].value = nullptr;
+            this->m_tlmEntries[set].buckets[entry].capacity = 0;
+            this->m_tlmEntries[set].buckets[entry].size = 0;
+        }
+        // clear updated list and writer count
+        this->m_tlmEntries[set].numUpdated.store(0);
+        this->m_tlmEntries[set].writers.store(0);
+    }
 }
 
 TlmChan::~TlmChan() {}
 
-FwChanIdType TlmChan::doHash(FwChanIdType id) {
-    return (id % TLMCHAN_HASH_MOD_VALUE) % TLMCHAN_NUM_TLM_HASH_SLOTS;
+void TlmChan::configure(const ChannelSize channels[], FwSizeType numChannels) {
+    FW_ASSERT((channels != nullptr) or (numChannels == 0));
+    this->m_compactValues = true;
+    for (FwSizeType channel = 0; channel < numChannels; channel++) {
+        const ChannelSize& entry = channels[channel];
+        FW_ASSERT(entry.maxSize <= FW_TLM_BUFFER_MAX_SIZE, static_cast<FwAssertArgType>(entry.id),
+                  static_cast<FwAssertArgType>(entry.maxSize));
+        // ports may not be connected yet, so a channel that doesn't fit is reported when its value is dropped
+        FwChanIdType bucket = 0;
+        (void)this->findOrAddBucket(entry.id, entry.maxSize, bucket);
+    }
 }
 
-void TlmChan::pingIn_handler(const FwIndexType portNum, U32 key) {
-    // return key
-    this->pingOut_out(0, key);
+bool TlmChan::findSlot(FwChanIdType id, FwSizeType& slot) const {
+    // The index is never more than half full, so an empty slot always ends the probe. Slots only change from empty
+    // to a bucket number, so a slot seen as non-empty keeps the bucket it was published with.
+    return ChannelIndex::find(
+        id, slot,
+        [this](FwSizeType probe) {
+            return this->m_channelIndex[probe].load(std::memory_order_acquire) == TLMCHAN_INDEX_EMPTY;
+        },
+        [this, id](FwSizeType probe) {
+            return this->m_tlmEntries[0].buckets[this->m_channelIndex[probe].load(std::memory_order_acquire)].id == id;
+        });
 }
 
-Fw::TlmValid TlmChan::TlmGet_handler(FwIndexType portNum, FwChanIdType id, Fw::Time& timeTag, Fw::TlmBuffer& val) {
-    // Compute index for entry
+bool TlmChan::findBucket(FwChanIdType id, FwChanIdType& bucket) const {
+    FwSizeType slot = 0;
+    if (this->findSlot(id, slot)) {
+        bucket = this->m_channelIndex[slot].load(std::memory_order_acquire);
+        return true;
+    }
+    return false;
+}
 
-    FwChanIdType index = this->doHash(id);
+bool TlmChan::findOrAddBucket(FwChanIdType id, FwSizeType maxSize, FwChanIdType& bucket) {
+    if (this->findBucket(id, bucket)) {
+        return true;
+    }
+    // New channel. Adding is serialized, and the lookup is repeated in case another writer just added it
+    Os::ScopeLock lock(this->m_indexLock);
+    FwSizeType slot = 0;
+    if (this->findSlot(id, slot)) {
+        bucket = this->m_channelIndex[slot].load(std::memory_order_relaxed);
+        return true;
+    }
+    // Make sure that we haven't run out of buckets or value storage
+    FW_ASSERT(this->m_numBuckets < TLMCHAN_HASH_BUCKETS, static_cast<FwAssertArgType>(id));
+    if (2 * maxSize > static_cast<FwSizeType>(TLMCHAN_VALUE_ARENA_SIZE) - this->m_valueArenaUsed) {
+        return false;
+    }
+    // assign the next free bucket and its value slots in both sets, then publish it in the empty slot ending its
+    // probe sequence
+    bucket = this->m_numBuckets++;
+    for (U32 set = 0; set < 2; set++) {
+        TlmEntry& entry = this->m_tlmEntries[set].buckets[bucket];
+        entry.id = id;
+        entry.value = &this->m_valueArena[this->m_valueArenaUsed];
+        entry.capacity = maxSize;
+        this->m_valueArenaUsed += maxSize;
+    }
+    this->m_channelIndex[slot].store(bucket, std::memory_order_release);
+    return true;
+}
 
-    // Search to see if channel has been stored
-    // check both buffers
-    // don't need to lock because this port is guarded
-    TlmEntry* activeEntry = this->m_tlmEntries[this->m_activeBuffer].slots[index];
-    for (FwChanIdType bucket = 0; bucket < TLMCHAN_HASH_BUCKETS; bucket++) {
-        if (activeEntry) {  // If bucket exists, check id
-            if (activeEntry->id == id) {
-                break;
-            } else {  // otherwise go to next bucket
-                activeEntry = activeEntry->next;
-            }
-        } else {  // no buckets left to search
-            break;
-        }
+U8* TlmChan::allocateValue(FwSizeType size) {
+    Os::ScopeLock lock(this->m_indexLock);
+    if (size > static_cast<FwSizeType>(TLMCHAN_VALUE_ARENA_SIZE) - this->m_valueArenaUsed) {
+        return nullptr;
     }
+    U8* const value = &this->m_valueArena[this->m_valueArenaUsed];
+    this->m_valueArenaUsed += size;
+    return value;
+}
 
-    TlmEntry* inactiveEntry = this->m_tlmEntries[1 - this->m_activeBuffer].slots[index];
-    for (FwChanIdType bucket = 0; bucket < TLMCHAN_HASH_BUCKETS; bucket++) {
-        if (inactiveEntry) {  // If bucket exists, check id
-            if (inactiveEntry->id == id) {
-                break;
-            } else {  // otherwise go to next bucket
-                inactiveEntry = inactiveEntry->next;
+bool TlmChan::readEntry(const TlmEntry& entry, Fw::Time& timeTag, Fw::TlmBuffer& val, bool& updated) {
+    U32 attempts = 0;
+    while (true) {
+        const U32 before = entry.sequence.load(std::memory_order_acquire);
+        if ((before & 1U) == 0) {
+            // Copy the value, then check that no write started while copying. A torn copy is discarded below, so
+            // a bad size read mid-write only fails the copy.
+            const bool used = entry.used;
+            const Fw::Time lastUpdate = entry.lastUpdate;
+            const FwSizeType size = entry.size;
+            Fw::TlmBuffer copy;
+            const bool copied =
+                (size <= entry.capacity) and (copy.setBuff(entry.value, size) == Fw::FW_SERIALIZE_OK);
+            const bool wasUpdated = entry.updated.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (copied and (entry.sequence.load(std::memory_order_relaxed) == before)) {
+                if (used) {
+                    timeTag = lastUpdate;
+                    val = copy;
+                    updated = wasUpdated;
+                }
+                return used;
             }
-        } else {  // no buckets left to search
-            break;
         }
+        TlmChan::backOff(attempts);
+    }
+}
+
+void TlmChan::backOff(U32& attempts) {
+    // The threads being waited on only copy a value, so a short spin usually suffices. Sleeping after that lets a
+    // preempted lower priority thread finish.
+    static const U32 SPIN_ATTEMPTS = 100;
+    if (attempts < SPIN_ATTEMPTS) {
+        attempts++;
+    } else {
+        (void)Os::Task::delay(Fw::TimeInterval(0, 1));
+    }
+}
+
+void TlmChan::pingIn_handler(const FwIndexType portNum, U32 key) {
+    // return key
+    this->pingOut_out(0, key);
+}
+
+Fw::TlmValid TlmChan::TlmGet_handler(FwIndexType portNum, FwChanIdType id, Fw::Time& timeTag, Fw::TlmBuffer& val) {
+    // Search to see if channel has been stored
+    FwChanIdType bucket = 0;
+    if (not this->findBucket(id, bucket)) {
+        val.resetSer();
+        return Fw::TlmValid::INVALID;
     }
 
-    if (activeEntry && inactiveEntry) {
-        Fw::TimeComparison cmp = Fw::Time::compare(inactiveEntry->lastUpdate, activeEntry->lastUpdate);
+    // check both buffers, which share the bucket number. Each entry is read through its seqlock, so neither
+    // writers nor the run handler need to be locked out
+    const U32 active = this->m_activeBuffer.load();
+    bool activeUpdated = false;
+    const bool activeUsed = TlmChan::readEntry(this->m_tlmEntries[active].buckets[bucket], timeTag, val, activeUpdated);
+    Fw::Time inactiveTime;
+    Fw::TlmBuffer inactiveVal;
+    bool inactiveUpdated = false;
+    const bool inactiveUsed =
+        TlmChan::readEntry(this->m_tlmEntries[1 - active].buckets[bucket], inactiveTime, inactiveVal, inactiveUpdated);
+
+    if (activeUsed && inactiveUsed) {
+        Fw::TimeComparison cmp = Fw::Time::compare(inactiveTime, timeTag);
         // two entries. grab the one with the most recent time tag
-        if (cmp == Fw::TimeComparison::GT) {
-            // inactive entry is more recent
-            val = inactiveEntry->buffer;
-            timeTag = inactiveEntry->lastUpdate;
-            return Fw::TlmValid::VALID;
-        } else if (cmp != Fw::TimeComparison::INCOMPARABLE) {
-            // active entry is more recent, or they are equal
-            val = activeEntry->buffer;
-            timeTag = activeEntry->lastUpdate;
-            return Fw::TlmValid::VALID;
-        } else {
-            // times are incomparable
-            // return the one that is updated, or if neither,
-            // default to active
-            if (inactiveEntry->updated) {
-                val = inactiveEntry->buffer;
-                timeTag = inactiveEntry->lastUpdate;
-                return Fw::TlmValid::VALID;
-            } else {
-                val = activeEntry->buffer;
-                timeTag = activeEntry->lastUpdate;
-                return Fw::TlmValid::VALID;
-            }
+        // if times are incomparable, return the one that is updated, or if neither, default to active
+        if ((cmp == Fw::TimeComparison::GT) || ((cmp == Fw::TimeComparison::INCOMPARABLE) && inactiveUpdated)) {
+            val = inactiveVal;
+            timeTag = inactiveTime;
         }
-    } else if (activeEntry) {
+        return Fw::TlmValid::VALID;
+    } else if (activeUsed) {
         // only one entry, and it's in the active buf
-        val = activeEntry->buffer;
-        timeTag = activeEntry->lastUpdate;
         return Fw::TlmValid::VALID;
-    } else if (inactiveEntry) {
+    } else if (inactiveUsed) {
         // only one entry, and it's in the inactive buf
-        val = inactiveEntry->buffer;
-        timeTag = inactiveEntry->lastUpdate;
+        val = inactiveVal;
+        timeTag = inactiveTime;
         return Fw::TlmValid::VALID;
-    } else {
-        val.resetSer();
     }
+    val.resetSer();
     return Fw::TlmValid::INVALID;
 }
 
 void TlmChan::TlmRecv_handler(FwIndexType portNum, FwChanIdType id, Fw::Time& timeTag, Fw::TlmBuffer& val) {
-    // Compute index for entry
-
-    FwChanIdType index = this->doHash(id);
-    TlmEntry* entryToUse = nullptr;
-    TlmEntry* prevEntry = nullptr;
-
-    // Search to see if channel has already been stored or a bucket needs to be added
-    if (this->m_tlmEntries[this->m_activeBuffer].slots[index]) {
-        entryToUse = this->m_tlmEntries[this->m_activeBuffer].slots[index];
-        // Loop one extra time so that we don't inadvertently fall through the end of the loop early.
-        for (FwChanIdType bucket = 0; bucket < TLMCHAN_HASH_BUCKETS + 1; bucket++) {
-            if (entryToUse) {
-                if (entryToUse->id == id) {  // found the matching entry
-                    break;
-                } else {  // try next entry
-                    prevEntry = entryToUse;
-                    entryToUse = entryToUse->next;
-                }
-            } else {
-                // Make sure that we haven't run out of buckets
-                FW_ASSERT(this->m_tlmEntries[this->m_activeBuffer].free < TLMCHAN_HASH_BUCKETS);
-                // add new bucket from free list
-                entryToUse =
-                    &this->m_tlmEntries[this->m_activeBuffer].buckets[this->m_tlmEntries[this->m_activeBuffer].free++];
-                FW_ASSERT(prevEntry);
-                prevEntry->next = entryToUse;
-                // clear next pointer
-                entryToUse->next = nullptr;
-                break;
-            }
+    // Find the bucket for the channel, adding one if it is new. Compact storage sizes it to this value
+    const FwSizeType size = val.getSize();
+    const FwSizeType slotSize = this->m_compactValues ? size : static_cast<FwSizeType>(FW_TLM_BUFFER_MAX_SIZE);
+    FwChanIdType bucket = 0;
+    if (not this->findOrAddBucket(id, slotSize, bucket)) {
+        this->log_WARNING_HI_ValueStorageFull(id, static_cast<U32>(size));
+        return;
+    }
+
+    // Enter the active set. If the run handler switched sets in between, leave and try the new active set
+    U32 active = this->m_activeBuffer.load();
+    this->m_tlmEntries[active].writers.fetch_add(1);
+    while (this->m_activeBuffer.load() != active) {
+        this->m_tlmEntries[active].writers.fetch_sub(1);
+        active = this->m_activeBuffer.load();
+        this->m_tlmEntries[active].writers.fetch_add(1);
+    }
+    TlmSet& set = this->m_tlmEntries[active];
+    TlmEntry* entryToUse = &set.buckets[bucket];
+
+    // Take the entry's seqlock. Only writers of this same channel can hold it
+    U32 attempts = 0;
+    U32 sequence = entryToUse->sequence.load(std::memory_order_relaxed);
+    while (((sequence & 1U) != 0) ||
+           not entryToUse->sequence.compare_exchange_weak(sequence, sequence + 1, std::memory_order_acquire,
+                                                          std::memory_order_relaxed)) {
+        TlmChan::backOff(attempts);
+        sequence = entryToUse->sequence.load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+
+    // A value larger than its slot, such as a longer string, moves to a full size slot so it only moves once.
+    // Readers copy through the seqlock, and the old slot stays valid for any copy already in progress
+    bool stored = true;
+    if (size > entryToUse->capacity) {
+        FW_ASSERT(size <= FW_TLM_BUFFER_MAX_SIZE, static_cast<FwAssertArgType>(id), static_cast<FwAssertArgType>(size));
+        U8* const value = this->allocateValue(FW_TLM_BUFFER_MAX_SIZE);
+        if (value != nullptr) {
+            entryToUse->value = value;
+            entryToUse->capacity = FW_TLM_BUFFER_MAX_SIZE;
+        } else {
+            stored = false;
         }
-    } else {
-        // Make sure that we haven't run out of buckets
-        FW_ASSERT(this->m_tlmEntries[this->m_activeBuffer].free < TLMCHAN_HASH_BUCKETS);
-        // create new entry at slot head
-        this->m_tlmEntries[this->m_activeBuffer].slots[index] =
-            &this->m_tlmEntries[this->m_activeBuffer].buckets[this->m_tlmEntries[this->m_activeBuffer].free++];
-        entryToUse = this->m_tlmEntries[this->m_activeBuffer].slots[index];
-        entryToUse->next = nullptr;
     }
 
     // copy into entry
-    FW_ASSERT(entryToUse);
-    entryToUse->used = true;
-    entryToUse->id = id;
-    entryToUse->updated = true;
-    entryToUse->lastUpdate = timeTag;
-    entryToUse->buffer = val;
+    if (stored) {
+        entryToUse->used = true;
+        entryToUse->lastUpdate = timeTag;
+        (void)memcpy(entryToUse->value, val.getBuffAddr(), static_cast<size_t>(size));
+        entryToUse->size = size;
+    }
+    entryToUse->sequence.store(sequence + 2, std::memory_order_release);
+    if (not stored) {
+        set.writers.fetch_sub(1);
+        this->log_WARNING_HI_ValueStorageFull(id, static_cast<U32>(size));
+        return;
+    }
+
+    // record the first update since the last send so the run handler only visits updated channels
+    if (not entryToUse->updated.exchange(true)) {
+        const FwChanIdType update = set.numUpdated.fetch_add(1);
+        FW_ASSERT(update < TLMCHAN_HASH_BUCKETS, static_cast<FwAssertArgType>(update));
+        set.updatedList[update] = bucket;
+    }
+    set.writers.fetch_sub(1);
 }
 
 void TlmChan::Run_handler(FwIndexType portNum, U32 context) {
@@ -192,45 +283,49 @@ void TlmChan::Run_handler(FwIndexType portNum, U32 context) {
         return;
     }
 
-    // lock mutex long enough to modify active telemetry buffer
-    // so the data can be read without worrying about updates
-    this->lock();
-    this->m_activeBuffer = 1 - this->m_activeBuffer;
-    // set activeBuffer to not updated
-    for (U32 entry = 0; entry < TLMCHAN_HASH_BUCKETS; entry++) {
-        this->m_tlmEntries[this->m_activeBuffer].buckets[entry].updated = false;
+    // Switch the active telemetry buffer so the data can be read without worrying about updates.
+    // The newly active buffer was drained by the previous run, so none of its entries are marked updated
+    const U32 previous = this->m_activeBuffer.load();
+    FW_ASSERT(this->m_tlmEntries[1 - previous].numUpdated.load() == 0,
+              static_cast<FwAssertArgType>(this->m_tlmEntries[1 - previous].numUpdated.load()));
+    this->m_activeBuffer.store(1 - previous);
+
+    // wait for writers that entered the previous buffer before the switch to finish their copy
+    TlmSet& set = this->m_tlmEntries[previous];
+    U32 attempts = 0;
+    while (set.writers.load() != 0) {
+        TlmChan::backOff(attempts);
     }
-    this->unLock();
 
-    // go through each entry and send a packet if it has been updated
+    // go through each updated entry and send a packet
     Fw::TlmPacket pkt;
     pkt.resetPktSer();
 
-    for (U32 entry = 0; entry < TLMCHAN_HASH_BUCKETS; entry++) {
-        TlmEntry* p_entry = &this->m_tlmEntries[1 - this->m_activeBuffer].buckets[entry];
-        if ((p_entry->updated) && (p_entry->used)) {
-            Fw::SerializeStatus stat = pkt.addValue(p_entry->id, p_entry->lastUpdate, p_entry->buffer);
-
-            // check to see if this packet is full, if so, send it
-            if (Fw::FW_SERIALIZE_NO_ROOM_LEFT == stat) {
-                this->PktSend_out(0, pkt.getBuffer(), 0);
-                // reset packet for more entries
-                pkt.resetPktSer();
-                // add entry to new packet
-                stat = pkt.addValue(p_entry->id, p_entry->lastUpdate, p_entry->buffer);
-                // if this doesn't work, that means packet isn't big enough for
-                // even one channel, so assert
-                FW_ASSERT(Fw::FW_SERIALIZE_OK == stat, static_cast<FwAssertArgType>(stat));
-            } else if (Fw::FW_SERIALIZE_OK == stat) {
-                // if there was still room, do nothing move on to the next channel in the packet
-            } else  // any other status is an assert, since it shouldn't happen
-            {
-                FW_ASSERT(0, static_cast<FwAssertArgType>(stat));
-            }
-            // flag as updated
-            p_entry->updated = false;
-        }  // end if entry was updated
-    }  // end for each entry
+    const FwChanIdType numUpdated = set.numUpdated.load();
+    for (FwChanIdType update = 0; update < numUpdated; update++) {
+        TlmEntry* p_entry = &set.buckets[set.updatedList[update]];
+        Fw::SerializeStatus stat = pkt.addValue(p_entry->id, p_entry->lastUpdate, p_entry->value, p_entry->size);
+
+        // check to see if this packet is full, if so, send it
+        if (Fw::FW_SERIALIZE_NO_ROOM_LEFT == stat) {
+            this->PktSend_out(0, pkt.getBuffer(), 0);
+            // reset packet for more entries
+            pkt.resetPktSer();
+            // add entry to new packet
+            stat = pkt.addValue(p_entry->id, p_entry->lastUpdate, p_entry->value, p_entry->size);
+            // if this doesn't work, that means packet isn't big enough for
+            // even one channel, so assert
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == stat, static_cast<FwAssertArgType>(stat));
+        } else if (Fw::FW_SERIALIZE_OK == stat) {
+            // if there was still room, do nothing move on to the next channel in the packet
+        } else  // any other status is an assert, since it shouldn't happen
+        {
+            FW_ASSERT(0, static_cast<FwAssertArgType>(stat));
+        }
+        // flag as updated
+        p_entry->updated.store(false);
+    }  // end for each updated entry
+    set.numUpdated.store(0);
 
     // send remnant entries
     if (pkt.getNumEntries() > 0) {
@@ -14,7 +14,10 @@
 #define TELEMCHANIMPL_HPP_
 
 #include <Fw/Tlm/TlmPacket.hpp>
+#include <Os/Mutex.hpp>
 #include <Svc/TlmChan/TlmChanComponentAc.hpp>
+#include <Utils/Types/HashIndex.hpp>
+#include <atomic>
 #include <config/TlmChanImplCfg.hpp>
 
 namespace Svc {
@@ -23,12 +26,22 @@ class TlmChan final : public TlmChanComponentBase {
     friend class TlmChanTester;
 
   public:
+    //! Maximum serialized size of one telemetry channel, as listed in the dictionary
+    struct ChannelSize {
+        FwChanIdType id;     //!< channel id
+        FwSizeType maxSize;  //!< maximum serialized size of the channel value
+    };
+
     TlmChan(const char* compName);
     virtual ~TlmChan();
 
-  protected:
-    // can be overridden for alternate algorithms
-    FwChanIdType doHash(FwChanIdType id);
+    //! Opt in to compact value storage. Listed channels are given slots of their maximum serialized size up front,
+    //! and channels not listed get slots of their first value's size when first written. Without this call, every
+    //! channel gets full size slots. Call before any telemetry is received. A channel that does not fit in the arena
+    //! is left out and reported when written.
+    void configure(const ChannelSize channels[],  //!< channel sizes, typically generated from the dictionary
+                   FwSizeType numChannels         //!< number of entries in channels
+    );
 
   private:
     // Port functions
@@ -41,23 +54,75 @@ class TlmChan final : public TlmChanComponentBase {
                         U32 key                    /*!< Value to return to pinger*/
     );
 
+    //! Find the channel index slot of a channel
+    //! \return true if the channel has a bucket, with its slot in `slot`. Otherwise `slot` is the empty slot where
+    //! it would be added
+    bool findSlot(FwChanIdType id, FwSizeType& slot) const;
+
+    //! Find the bucket assigned to a channel
+    //! \return true if the channel has a bucket, with the bucket number in `bucket`
+    bool findBucket(FwChanIdType id, FwChanIdType& bucket) const;
+
+    //! Find the bucket assigned to a channel, assigning the next free bucket if there is none. A new bucket gets
+    //! value slots of maxSize bytes in each set
+    //! \return true if the channel has a bucket, with the bucket number in `bucket`. false if the value arena has
+    //! no room for the slots of a new channel
+    bool findOrAddBucket(FwChanIdType id, FwSizeType maxSize, FwChanIdType& bucket);
+
+    //! Take a value slot from the arena. Slots are never returned
+    //! \return the slot, or nullptr if the arena has no room left
+    U8* allocateValue(FwSizeType size);
+
     typedef struct tlmEntry {
         FwChanIdType id;  //!< telemetry id stored in slot
-        bool updated;     //!< set whenever a value has been written. Used to skip if writing out values for downlinking
-        Fw::Time lastUpdate;    //!< last updated time
-        Fw::TlmBuffer buffer;   //!< buffer to store serialized telemetry
-        tlmEntry* next;         //!< pointer to next bucket in table
-        bool used;              //!< if entry has been used
-        FwChanIdType bucketNo;  //!< for testing
+        std::atomic<bool> updated;  //!< set whenever a value has been written. Used to skip if writing out values for
+                                    //!< downlinking
+        std::atomic<U32> sequence;  //!< seqlock sequence number, odd while a write is in progress
+        Fw::Time lastUpdate;        //!< last updated time
+        U8* value;                  //!< slot in m_valueArena storing the serialized value
+        FwSizeType capacity;        //!< size of the value slot
+        FwSizeType size;            //!< bytes of the value slot in use
+        bool used;                  //!< if entry has been used
+        FwChanIdType bucketNo;      //!< for testing
     } TlmEntry;
 
+    //! Copy a consistent value out of an entry, retrying while a write is in progress
+    //! \return true if the entry has been used, in which case timeTag, val and updated are set
+    static bool readEntry(const TlmEntry& entry, Fw::Time& timeTag, Fw::TlmBuffer& val, bool& updated);
+
+    //! Spin briefly, then sleep, while waiting on another thread to finish a short critical section
+    static void backOff(U32& attempts);
+
+    //! Channel index, sized to at least twice the buckets to keep probe sequences short
+    using ChannelIndex = Types::HashIndex<Types::hashIndexBits(2 * TLMCHAN_HASH_BUCKETS)>;
+    //! Number of slots in the channel index
+    static constexpr FwSizeType TLMCHAN_INDEX_SLOTS = ChannelIndex::SLOTS;
+    //! Channel index value marking an empty slot
+    static constexpr FwChanIdType TLMCHAN_INDEX_EMPTY = TLMCHAN_HASH_BUCKETS;
+
+    //! Open-addressing (linear probing) hash index from channel id to bucket number. A channel has the same bucket
+    //! number in both sets, so one lookup serves both. Buckets are never released, so a lookup stops at the first
+    //! empty slot. Lookups read it without locking; new channels are added under m_indexLock.
+    std::atomic<FwChanIdType> m_channelIndex[TLMCHAN_INDEX_SLOTS];
+    FwChanIdType m_numBuckets;  //!< number of buckets assigned to channels, which are assigned in order
+    Os::Mutex m_indexLock;      //!< serializes adding channels to m_channelIndex and taking value slots
+
+    //! Set of channel values. Writers only enter the active set, and the run handler only reads a set once it is
+    //! inactive and every writer that entered it has left.
     struct TlmSet {
-        TlmEntry* slots[TLMCHAN_NUM_TLM_HASH_SLOTS];  //!< set of hash slots in hash table
-        TlmEntry buckets[TLMCHAN_HASH_BUCKETS];       //!< set of buckets used in hash table
-        FwChanIdType free;                            //!< next free bucket
+        TlmEntry buckets[TLMCHAN_HASH_BUCKETS];          //!< set of buckets, indexed by m_channelIndex
+        FwChanIdType updatedList[TLMCHAN_HASH_BUCKETS];  //!< buckets updated since the set was last sent
+        std::atomic<FwChanIdType> numUpdated;            //!< number of entries in updatedList
+        std::atomic<U32> writers;                        //!< number of writers currently in the set
     } m_tlmEntries[2];
 
-    U32 m_activeBuffer;  // !< which buffer is active for storing telemetry
+    std::atomic<U32> m_activeBuffer;  // !< which buffer is active for storing telemetry
+
+    //! Storage for channel values. Each bucket is given a slot in both sets when it is assigned, so a value is
+    //! copied in and out at its used size only. A value that outgrows its slot moves to a full size slot
+    U8 m_valueArena[TLMCHAN_VALUE_ARENA_SIZE];
+    FwSizeType m_valueArenaUsed;  //!< bytes of m_valueArena assigned to buckets
+    bool m_compactValues;         //!< size new channels' slots to their first value. Set by configure()
 };
 
 }  // namespace Svc
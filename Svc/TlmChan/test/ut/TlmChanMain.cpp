@@ -44,6 +44,46 @@ TEST(TlmChanTest, OffNominal) {
     tester.runOffNominal();
 }
 
+TEST(TlmChanTest, UpdatedOnlyTest) {
+    TEST_CASE(107.1.3, "Send only updated channels");
+    COMMENT("Write many channels, then update a few and verify only those are pushed.");
+
+    Svc::TlmChanTester tester;
+
+    // run test
+    tester.runUpdatedOnly();
+}
+
+TEST(TlmChanTest, ConcurrentWritersTest) {
+    TEST_CASE(107.1.4, "Concurrent channel writers");
+    COMMENT("Write channels from several tasks while running and reading, and verify values are never torn.");
+
+    Svc::TlmChanTester tester;
+
+    // run test
+    tester.runConcurrentWriters();
+}
+
+TEST(TlmChanTest, ConfiguredSizesTest) {
+    TEST_CASE(107.1.5, "Channel storage sized from the dictionary");
+    COMMENT("Configure channel sizes, then verify values are stored and pushed from slots of those sizes.");
+
+    Svc::TlmChanTester tester;
+
+    // run test
+    tester.runConfiguredSizes();
+}
+
+TEST(TlmChanTest, StorageFullTest) {
+    TEST_CASE(107.1.6, "Value storage exhausted");
+    COMMENT("Fill the value arena, then verify values that don't fit are dropped and reported.");
+
+    Svc::TlmChanTester tester;
+
+    // run test
+    tester.runStorageFull();
+}
+
 // TEST(TlmChanTest,TooManyChannels) {
 
 //     COMMENT("Too Many Channel Test");
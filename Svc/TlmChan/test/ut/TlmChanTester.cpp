@@ -6,6 +6,9 @@
 
 #include "TlmChanTester.hpp"
 #include <Fw/Test/UnitTest.hpp>
+#include <Fw/Types/String.hpp>
+#include <Os/Task.hpp>
+#include <atomic>
 
 #define INSTANCE 0
 #define MAX_HISTORY_SIZE 10
@@ -18,8 +21,20 @@ static constexpr FwSizeType INTEGER_DIVISION_ROUNDED_UP(FwSizeType a, FwSizeType
     return ((a % b) == 0) ? (a / b) : (a / b) + 1;
 }
 
+static const U32 WRITERS = 4;
+static const FwChanIdType CHANNELS_PER_WRITER = 20;
+static const U32 WRITER_ITERATIONS = 2000;
+// every writer also writes this channel
+static const FwChanIdType SHARED_CHANNEL = 0x7000;
+
 namespace Svc {
 
+struct WriterArgs {
+    TlmChanTester* tester;
+    U32 writer;
+    std::atomic<bool>* done;
+};
+
 // ----------------------------------------------------------------------
 // Construction and destruction
 // ----------------------------------------------------------------------
@@ -42,6 +57,9 @@ void TlmChanTester::runNominalChannel() {
     this->clearBuffs();
     // send first buffer
     this->sendBuff(27, 10);
+    // without configure(), channels get full size slots in both sets, so no value is dropped
+    ASSERT_EQ(static_cast<FwSizeType>(FW_TLM_BUFFER_MAX_SIZE), this->component.m_tlmEntries[0].buckets[0].capacity);
+    ASSERT_EQ(static_cast<FwSizeType>(FW_TLM_BUFFER_MAX_SIZE), this->component.m_tlmEntries[1].buckets[0].capacity);
     this->doRun(true);
     this->checkBuff(0, 1, 27, 10);
 
@@ -75,13 +93,13 @@ void TlmChanTester::runMultiChannel() {
         this->sendBuff(ID_0[n], static_cast<U32>(n));
     }
 
-    ASSERT_EQ(0, this->component.m_activeBuffer);
+    ASSERT_EQ(0, this->component.m_activeBuffer.load());
 
     // do a run, and all the packets should be sent
     this->doRun(true);
     ASSERT_TRUE(this->m_bufferRecv);
     ASSERT_EQ(INTEGER_DIVISION_ROUNDED_UP(FW_NUM_ARRAY_ELEMENTS(ID_0), CHANS_PER_COMBUFFER), this->m_numBuffs);
-    ASSERT_EQ(1, this->component.m_activeBuffer);
+    ASSERT_EQ(1, this->component.m_activeBuffer.load());
 
     // verify packets
     for (FwChanIdType n = 0; n < FW_NUM_ARRAY_ELEMENTS(ID_0); n++) {
@@ -102,13 +120,13 @@ void TlmChanTester::runMultiChannel() {
         this->sendBuff(ID_1[n], static_cast<U32>(n));
     }
 
-    ASSERT_EQ(1, this->component.m_activeBuffer);
+    ASSERT_EQ(1, this->component.m_activeBuffer.load());
 
     // do a run, and all the packets should be sent
     this->doRun(true);
     ASSERT_TRUE(this->m_bufferRecv);
     ASSERT_EQ(INTEGER_DIVISION_ROUNDED_UP(FW_NUM_ARRAY_ELEMENTS(ID_1), CHANS_PER_COMBUFFER), this->m_numBuffs);
-    ASSERT_EQ(0, this->component.m_activeBuffer);
+    ASSERT_EQ(0, this->component.m_activeBuffer.load());
 
     // verify packets
     for (FwChanIdType n = 0; n < FW_NUM_ARRAY_ELEMENTS(ID_1); n++) {
@@ -135,6 +153,228 @@ void TlmChanTester::runOffNominal() {
     ASSERT_EQ(valid, Fw::TlmValid::INVALID);
 }
 
+void TlmChanTester::runUpdatedOnly() {
+    // IDs from many components, including ones that share a home slot in the channel index
+    const FwChanIdType CHANNELS = 200;
+    this->clearBuffs();
+    for (FwChanIdType n = 0; n < CHANNELS; n++) {
+        this->sendBuff(static_cast<FwChanIdType>(((n / 10) * 0x100) + (n % 10)), static_cast<U32>(n));
+    }
+    ASSERT_EQ(CHANNELS, this->component.m_numBuckets);
+    ASSERT_EQ(CHANNELS, this->component.m_tlmEntries[0].numUpdated.load());
+    this->doRun(true);
+    ASSERT_EQ(INTEGER_DIVISION_ROUNDED_UP(CHANNELS, CHANS_PER_COMBUFFER), this->m_numBuffs);
+    ASSERT_EQ(0, this->component.m_tlmEntries[0].numUpdated.load());
+
+    // update a few channels, some twice, and only those are sent, in the order they were first updated
+    const FwChanIdType UPDATED[] = {0x1203, 0x0005, 0x0c07};
+    this->clearBuffs();
+    for (FwChanIdType n = 0; n < FW_NUM_ARRAY_ELEMENTS(UPDATED); n++) {
+        this->sendBuff(UPDATED[n], 1000);
+    }
+    for (FwChanIdType n = 0; n < FW_NUM_ARRAY_ELEMENTS(UPDATED); n++) {
+        this->sendBuff(UPDATED[n], 2000 + n);
+    }
+    ASSERT_EQ(FW_NUM_ARRAY_ELEMENTS(UPDATED), this->component.m_tlmEntries[1].numUpdated.load());
+    this->doRun(true);
+    ASSERT_EQ(1, this->m_numBuffs);
+    for (FwChanIdType n = 0; n < FW_NUM_ARRAY_ELEMENTS(UPDATED); n++) {
+        this->checkBuff(n, FW_NUM_ARRAY_ELEMENTS(UPDATED), UPDATED[n], 2000 + n);
+    }
+
+    // nothing updated, nothing sent
+    this->clearBuffs();
+    ASSERT_FALSE(this->doRun(false));
+
+    // values stay readable from either buffer
+    Fw::TlmBuffer buff;
+    Fw::Time timeTag;
+    U32 val = 0;
+    ASSERT_EQ(Fw::TlmValid::VALID, this->invoke_to_TlmGet(0, 0x0c07, timeTag, buff));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, buff.deserializeTo(val));
+    ASSERT_EQ(2002u, val);
+    ASSERT_EQ(Fw::TlmValid::VALID, this->invoke_to_TlmGet(0, 0x0c08, timeTag, buff));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, buff.deserializeTo(val));
+    ASSERT_EQ(128u, val);
+}
+
+void TlmChanTester::runConcurrentWriters() {
+    Os::Task tasks[WRITERS];
+    WriterArgs args[WRITERS];
+    std::atomic<bool> done[WRITERS];
+    for (U32 writer = 0; writer < WRITERS; writer++) {
+        done[writer].store(false);
+        args[writer] = {this, writer, &done[writer]};
+        Os::Task::Arguments arguments(Fw::String("TlmWriter"), TlmChanTester::writerTask, &args[writer]);
+        ASSERT_EQ(Os::Task::OP_OK, tasks[writer].start(arguments));
+    }
+
+    // run and read back while the writers are active
+    U32 lastSeen[WRITERS] = {0};
+    bool running = true;
+    while (running) {
+        running = false;
+        for (U32 writer = 0; writer < WRITERS; writer++) {
+            running = running || not done[writer].load();
+        }
+        this->clearBuffs();
+        this->clearHistory();
+        this->doRun(false);
+        for (U32 writer = 0; writer < WRITERS; writer++) {
+            const U32 iteration = this->checkWriterChannel(static_cast<FwChanIdType>(writer * 0x100));
+            // newest value by time tag is returned, so a channel never goes backwards
+            ASSERT_GE(iteration, lastSeen[writer]);
+            lastSeen[writer] = iteration;
+        }
+        (void)this->checkWriterChannel(SHARED_CHANNEL);
+    }
+    for (U32 writer = 0; writer < WRITERS; writer++) {
+        ASSERT_EQ(Os::Task::OP_OK, tasks[writer].join());
+    }
+
+    // every channel ends with its final value
+    for (U32 writer = 0; writer < WRITERS; writer++) {
+        for (FwChanIdType chan = 0; chan < CHANNELS_PER_WRITER; chan++) {
+            ASSERT_EQ(WRITER_ITERATIONS, this->checkWriterChannel(static_cast<FwChanIdType>((writer * 0x100) + chan)));
+        }
+    }
+    ASSERT_EQ(WRITER_ITERATIONS, this->checkWriterChannel(SHARED_CHANNEL));
+    ASSERT_EQ(WRITERS * CHANNELS_PER_WRITER + 1, this->component.m_numBuckets);
+}
+
+void TlmChanTester::runConfiguredSizes() {
+    // U32 channels listed with their dictionary size take only that much storage per set
+    const TlmChan::ChannelSize SIZES[] = {{0x100, sizeof(U32)}, {0x101, sizeof(U32)}, {0x200, sizeof(U32)}};
+    this->component.configure(SIZES, FW_NUM_ARRAY_ELEMENTS(SIZES));
+    ASSERT_EQ(FW_NUM_ARRAY_ELEMENTS(SIZES), this->component.m_numBuckets);
+    ASSERT_EQ(2 * FW_NUM_ARRAY_ELEMENTS(SIZES) * sizeof(U32), this->component.m_valueArenaUsed);
+
+    this->clearBuffs();
+    for (FwChanIdType n = 0; n < FW_NUM_ARRAY_ELEMENTS(SIZES); n++) {
+        this->sendBuff(SIZES[n].id, 100 + n);
+    }
+    this->doRun(true);
+    for (FwChanIdType n = 0; n < FW_NUM_ARRAY_ELEMENTS(SIZES); n++) {
+        this->checkBuff(n, FW_NUM_ARRAY_ELEMENTS(SIZES), SIZES[n].id, 100 + n);
+    }
+
+    // writes to the other set use the other slot
+    this->clearBuffs();
+    this->sendBuff(0x101, 200);
+    this->doRun(true);
+    this->checkBuff(0, 1, 0x101, 200);
+    ASSERT_NE(this->component.m_tlmEntries[0].buckets[1].value, this->component.m_tlmEntries[1].buckets[1].value);
+
+    // a channel that was not listed gets slots of its first value's size
+    const FwSizeType listedSize = 2 * FW_NUM_ARRAY_ELEMENTS(SIZES) * sizeof(U32);
+    this->sendBuff(0x300, 300);
+    ASSERT_EQ(listedSize + 2 * sizeof(U32), this->component.m_valueArenaUsed);
+    ASSERT_EQ(sizeof(U32), this->component.m_tlmEntries[0].buckets[3].capacity);
+
+    // a larger value moves the channel to a full size slot in the set written
+    Fw::TlmBuffer buff;
+    Fw::TlmBuffer readBack;
+    Fw::Time timeTag;
+    const U64 wide = 0x0123456789ABCDEFULL;
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, buff.serializeFrom(wide));
+    this->invoke_to_TlmRecv(0, 0x300, timeTag, buff);
+    const U32 active = this->component.m_activeBuffer.load();
+    ASSERT_EQ(static_cast<FwSizeType>(FW_TLM_BUFFER_MAX_SIZE),
+              this->component.m_tlmEntries[active].buckets[3].capacity);
+    ASSERT_EQ(listedSize + 2 * sizeof(U32) + FW_TLM_BUFFER_MAX_SIZE, this->component.m_valueArenaUsed);
+    ASSERT_EQ(Fw::TlmValid::VALID, this->invoke_to_TlmGet(0, 0x300, timeTag, readBack));
+    U64 readValue = 0;
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, readBack.deserializeTo(readValue));
+    ASSERT_EQ(wide, readValue);
+    ASSERT_EVENTS_SIZE(0);
+}
+
+void TlmChanTester::runStorageFull() {
+    // compact storage with no channels listed, so each channel's slots start at its first value's size
+    this->component.configure(nullptr, 0);
+    Fw::TlmBuffer full;
+    for (FwSizeType byte = 0; byte < FW_TLM_BUFFER_MAX_SIZE; byte++) {
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK, full.serializeFrom(static_cast<U8>(byte)));
+    }
+    Fw::TlmBuffer readBack;
+    Fw::Time timeTag;
+
+    // each channel starts with a U32, then grows to full size slots in both sets, until the arena runs low
+    const FwSizeType arenaSize = static_cast<FwSizeType>(TLMCHAN_VALUE_ARENA_SIZE);
+    const FwSizeType perChannel = 2 * sizeof(U32) + 2 * FW_TLM_BUFFER_MAX_SIZE;
+    FwChanIdType id = 0x100;
+    while (this->component.m_valueArenaUsed + perChannel <= arenaSize) {
+        this->sendBuff(id, id);
+        for (U32 set = 0; set < 2; set++) {
+            this->invoke_to_TlmRecv(0, id, timeTag, full);
+            this->component.m_activeBuffer.store(1 - this->component.m_activeBuffer.load());
+        }
+        ASSERT_EQ(Fw::TlmValid::VALID, this->invoke_to_TlmGet(0, id, timeTag, readBack));
+        ASSERT_EQ(full, readBack);
+        id++;
+    }
+    ASSERT_EVENTS_SIZE(0);
+    ASSERT_LT(this->component.m_numBuckets, static_cast<FwChanIdType>(TLMCHAN_HASH_BUCKETS));
+    const FwSizeType remaining = arenaSize - this->component.m_valueArenaUsed;
+    ASSERT_LT(remaining, 2 * static_cast<FwSizeType>(FW_TLM_BUFFER_MAX_SIZE));
+    const FwChanIdType buckets = this->component.m_numBuckets;
+
+    // a new channel that does not fit is dropped and reported, without taking a bucket
+    this->invoke_to_TlmRecv(0, id, timeTag, full);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_ValueStorageFull_SIZE(1);
+    ASSERT_EVENTS_ValueStorageFull(0, id, FW_TLM_BUFFER_MAX_SIZE);
+    ASSERT_EQ(buckets, this->component.m_numBuckets);
+    ASSERT_EQ(Fw::TlmValid::INVALID, this->invoke_to_TlmGet(0, id, timeTag, readBack));
+
+    // a small channel still fits in what is left
+    ASSERT_GE(remaining, 2 * sizeof(U32));
+    this->sendBuff(id + 1, 42);
+
+    // a value that outgrows its slot and can't move is dropped and the previous value is kept
+    ASSERT_LT(remaining - 2 * sizeof(U32), static_cast<FwSizeType>(FW_TLM_BUFFER_MAX_SIZE));
+    this->clearEvents();
+    this->invoke_to_TlmRecv(0, id + 1, timeTag, full);
+    ASSERT_EVENTS_ValueStorageFull_SIZE(1);
+    ASSERT_EVENTS_ValueStorageFull(0, id + 1, FW_TLM_BUFFER_MAX_SIZE);
+    ASSERT_EQ(Fw::TlmValid::VALID, this->invoke_to_TlmGet(0, id + 1, timeTag, readBack));
+    U32 value = 0;
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, readBack.deserializeTo(value));
+    ASSERT_EQ(42U, value);
+}
+
+void TlmChanTester::writerTask(void* pointer) {
+    WriterArgs* args = static_cast<WriterArgs*>(pointer);
+    for (U32 iteration = 1; iteration <= WRITER_ITERATIONS; iteration++) {
+        // both halves carry the iteration so a torn read is detectable
+        Fw::TlmBuffer buff;
+        (void)buff.serializeFrom(iteration);
+        (void)buff.serializeFrom(iteration);
+        Fw::Time timeTag(TimeBase::TB_NONE, iteration, 0);
+        for (FwChanIdType chan = 0; chan < CHANNELS_PER_WRITER; chan++) {
+            args->tester->invoke_to_TlmRecv(0, static_cast<FwChanIdType>((args->writer * 0x100) + chan), timeTag,
+                                            buff);
+        }
+        args->tester->invoke_to_TlmRecv(0, SHARED_CHANNEL, timeTag, buff);
+    }
+    args->done->store(true);
+}
+
+U32 TlmChanTester::checkWriterChannel(FwChanIdType id) {
+    Fw::TlmBuffer buff;
+    Fw::Time timeTag;
+    U32 first = 0;
+    U32 second = 0;
+    if (this->invoke_to_TlmGet(0, id, timeTag, buff) == Fw::TlmValid::INVALID) {
+        return 0;
+    }
+    EXPECT_EQ(Fw::FW_SERIALIZE_OK, buff.deserializeTo(first));
+    EXPECT_EQ(Fw::FW_SERIALIZE_OK, buff.deserializeTo(second));
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(first, timeTag.getSeconds());
+    return first;
+}
+
 // ----------------------------------------------------------------------
 // Handlers for typed from ports
 // ----------------------------------------------------------------------
@@ -271,55 +511,20 @@ void TlmChanTester::dumpTlmEntry(TlmChan::TlmEntry* entry) {
     printf(
         "Entry "
         " Ptr: %p"
-        " id: 0x%" PRI_FwChanIdType " bucket: %" PRI_FwChanIdType " next: %p\n",
-        static_cast<void*>(entry), entry->id, entry->bucketNo, static_cast<void*>(entry->next));
+        " id: 0x%" PRI_FwChanIdType " bucket: %" PRI_FwChanIdType "\n",
+        static_cast<void*>(entry), entry->id, entry->bucketNo);
 }
 
 void TlmChanTester::dumpHash() {
-    //        printf("**Buffer 0\n");
-    for (FwChanIdType slot = 0; slot < TLMCHAN_NUM_TLM_HASH_SLOTS; slot++) {
-        printf("Slot: %" PRI_FwChanIdType "\n", slot);
-        if (this->component.m_tlmEntries[0].slots[slot]) {
-            TlmChan::TlmEntry* entry = component.m_tlmEntries[0].slots[slot];
-            for (FwChanIdType bucket = 0; bucket < TLMCHAN_HASH_BUCKETS; bucket++) {
-                dumpTlmEntry(entry);
-                if (entry->next == nullptr) {
-                    break;
-                } else {
-                    entry = entry->next;
-                }
-            }
-        } else {
-            printf("EMPTY\n");
+    for (FwSizeType slot = 0; slot < TlmChan::TLMCHAN_INDEX_SLOTS; slot++) {
+        const FwChanIdType bucket = this->component.m_channelIndex[slot].load();
+        if (bucket != TlmChan::TLMCHAN_INDEX_EMPTY) {
+            printf("Slot: %" PRI_FwSizeType " home: %" PRI_FwSizeType " ", slot,
+                   TlmChan::ChannelIndex::home(this->component.m_tlmEntries[0].buckets[bucket].id));
+            dumpTlmEntry(&this->component.m_tlmEntries[0].buckets[bucket]);
         }
     }
     printf("\n");
-    //        for (FwChanIdType bucket = 0; bucket < TLMCHAN_HASH_BUCKETS; bucket++) {
-    //            printf("Bucket: %d ",bucket);
-    //            dumpTlmEntry(&m_impl.m_tlmEntries[0].buckets[bucket]);
-    //        }
-    //        printf("**Buffer 1\n");
-    //        for (FwChanIdType slot = 0; slot < TLMCHAN_NUM_TLM_HASH_SLOTS; slot++) {
-    //            printf("Slot: %d\n",slot);
-    //            if (m_impl.m_tlmEntries[1].slots[slot]) {
-    //                TlmChanImpl::TlmEntry* entry = m_impl.m_tlmEntries[1].slots[slot];
-    //                for (FwChanIdType bucket = 0; bucket < TLMCHAN_HASH_BUCKETS; bucket++) {
-    //                    dumpTlmEntry(entry);
-    //                    if (entry->next == 0) {
-    //                        break;
-    //                    } else {
-    //                        entry = entry->next;
-    //                    }
-    //                }
-    //            } else {
-    //                printf("EMPTY\n");
-    //            }
-    //        }
-    //        printf("\n");
-    //        for (FwChanIdType bucket = 0; bucket < TLMCHAN_HASH_BUCKETS; bucket++) {
-    //            printf("Bucket: %d\n",bucket);
-    //            dumpTlmEntry(&m_impl.m_tlmEntries[1].buckets[bucket]);
-    //        }
 }
 
 void TlmChanTester ::connectPorts() {
@@ -340,6 +545,15 @@ void TlmChanTester ::connectPorts() {
 
     // pingOut
     this->component.set_pingOut_OutputPort(0, this->get_from_pingOut(0));
+
+    // eventOut
+    this->component.set_eventOut_OutputPort(0, this->get_from_eventOut(0));
+
+    // textEventOut
+    this->component.set_textEventOut_OutputPort(0, this->get_from_textEventOut(0));
+
+    // timeGetOut
+    this->component.set_timeGetOut_OutputPort(0, this->get_from_timeGetOut(0));
 }
 
 void TlmChanTester ::initComponents() {
@@ -34,6 +34,10 @@ class TlmChanTester : public TlmChanGTestBase {
     void runNominalChannel();
     void runMultiChannel();
     void runOffNominal();
+    void runUpdatedOnly();
+    void runConcurrentWriters();
+    void runConfiguredSizes();
+    void runStorageFull();
 
   private:
     // ----------------------------------------------------------------------
@@ -72,6 +76,13 @@ class TlmChanTester : public TlmChanGTestBase {
 
     void clearBuffs();
 
+    //! Task routine writing a range of channels, argument is a WriterArgs
+    static void writerTask(void* pointer);
+
+    //! Read a channel written by writerTask and check that its value is consistent
+    //! \return the iteration stored in the channel
+    U32 checkWriterChannel(FwChanIdType id);
+
     // dump functions
     void dumpHash();
     static void dumpTlmEntry(TlmChan::TlmEntry* entry);
@@ -24,7 +24,7 @@ static_assert(Svc::TelemetrySection::NUM_SECTIONS >= 1, "At least one telemetry
 // ----------------------------------------------------------------------
 
 TlmPacketizer ::TlmPacketizer(const char* const compName)
-    : TlmPacketizerComponentBase(compName), m_numPackets(0), m_configured(false) {
+    : TlmPacketizerComponentBase(compName), m_numPackets(0), m_numPlacements(0), m_configured(false) {
     // clear slot pointers
     for (FwChanIdType entry = 0; entry < TLMPACKETIZER_NUM_TLM_HASH_SLOTS; entry++) {
         this->m_tlmEntries.slots[entry] = nullptr;
@@ -35,6 +35,8 @@ TlmPacketizer ::TlmPacketizer(const char* const compName)
         this->m_tlmEntries.buckets[entry].bucketNo = entry;
         this->m_tlmEntries.buckets[entry].next = nullptr;
         this->m_tlmEntries.buckets[entry].id = 0;
+        this->m_tlmEntries.buckets[entry].firstPlacement = 0;
+        this->m_tlmEntries.buckets[entry].numPlacements = 0;
     }
     // clear free index
     this->m_tlmEntries.free = 0;
@@ -44,10 +46,15 @@ TlmPacketizer ::TlmPacketizer(const char* const compName)
         this->m_missTlmCheck[entry].id = 0;
     }
 
-    // clear packet buffers
-    for (FwChanIdType buffer = 0; buffer < MAX_PACKETIZER_PACKETS; buffer++) {
-        this->m_fillBuffers[buffer].updated = false;
-        this->m_sendBuffers[buffer].updated = false;
+    // clear packet state
+    for (FwChanIdType pkt = 0; pkt < MAX_PACKETIZER_PACKETS; pkt++) {
+        this->m_packets[pkt].fill = &this->m_packetBuffers[0][pkt];
+        this->m_packets[pkt].send = &this->m_packetBuffers[1][pkt];
+        this->m_packets[pkt].id = 0;
+        this->m_packets[pkt].level = 0;
+        this->m_packets[pkt].updated = false;
+        this->m_packets[pkt].sendUpdated = false;
+        this->m_packets[pkt].synced = true;
     }
 
     // enable sections
@@ -68,17 +75,14 @@ void TlmPacketizer::setPacketList(const TlmPacketizerPacketList& packetList,
     FW_ASSERT(packetList.list);
     FW_ASSERT(ignoreList.list);
     FW_ASSERT(packetList.numEntries <= MAX_PACKETIZER_PACKETS, static_cast<FwAssertArgType>(packetList.numEntries));
-    // validate packet sizes against maximum com buffer size and populate hash
-    // table
-    FwChanIdType maxLevel = 0;
+    // drop placements from any earlier packet list
+    for (FwChanIdType bucket = 0; bucket < this->m_tlmEntries.free; bucket++) {
+        this->m_tlmEntries.buckets[bucket].numPlacements = 0;
+    }
+    // populate hash table and count the packets each channel is placed in
     for (FwChanIdType pktEntry = 0; pktEntry < packetList.numEntries; pktEntry++) {
-        // Initial size is packetized telemetry descriptor + size of time tag + sizeof packet ID
-        FwSizeType packetLen =
-            sizeof(FwPacketDescriptorType) + Fw::Time::SERIALIZED_SIZE + sizeof(FwTlmPacketizeIdType);
         FW_ASSERT(packetList.list[pktEntry]->list, static_cast<FwAssertArgType>(pktEntry));
-        // add up entries for each defined packet
         for (FwChanIdType tlmEntry = 0; tlmEntry < packetList.list[pktEntry]->numEntries; tlmEntry++) {
-            // get hash value for id
             FwChanIdType id = packetList.list[pktEntry]->list[tlmEntry].id;
             TlmEntry* entryToUse = this->findBucket(id);
             // copy into entry
@@ -89,32 +93,62 @@ void TlmPacketizer::setPacketList(const TlmPacketizerPacketList& packetList,
             entryToUse->id = id;
             entryToUse->hasValue = false;
             entryToUse->channelSize = packetList.list[pktEntry]->list[tlmEntry].size;
+            entryToUse->numPlacements++;
+        }
+    }
+    // reserve a contiguous run of placements for each channel
+    this->m_numPlacements = 0;
+    for (FwChanIdType bucket = 0; bucket < this->m_tlmEntries.free; bucket++) {
+        TlmEntry& entry = this->m_tlmEntries.buckets[bucket];
+        entry.firstPlacement = this->m_numPlacements;
+        FW_ASSERT(entry.numPlacements <= TLMPACKETIZER_MAX_PACKET_PLACEMENTS - this->m_numPlacements,
+                  static_cast<FwAssertArgType>(entry.numPlacements),
+                  static_cast<FwAssertArgType>(this->m_numPlacements));
+        this->m_numPlacements += entry.numPlacements;
+        // counted again as placements are stored
+        entry.numPlacements = 0;
+    }
+    // validate packet sizes against maximum com buffer size and store placements
+    FwChanIdType maxLevel = 0;
+    for (FwChanIdType pktEntry = 0; pktEntry < packetList.numEntries; pktEntry++) {
+        // Initial size is packetized telemetry descriptor + size of time tag + sizeof packet ID
+        FwSizeType packetLen =
+            sizeof(FwPacketDescriptorType) + Fw::Time::SERIALIZED_SIZE + sizeof(FwTlmPacketizeIdType);
+        // add up entries for each defined packet
+        for (FwChanIdType tlmEntry = 0; tlmEntry < packetList.list[pktEntry]->numEntries; tlmEntry++) {
+            TlmEntry* entryToUse = this->findEntry(packetList.list[pktEntry]->list[tlmEntry].id);
+            FW_ASSERT(entryToUse);
             // the offset into the buffer will be the current packet length
-            // the offset must fit within FwSignedSizeType to allow for negative values
-            FW_ASSERT(packetLen <= static_cast<FwSizeType>(std::numeric_limits<FwSignedSizeType>::max()),
-                      static_cast<FwAssertArgType>(packetLen));
-            entryToUse->packetOffset[pktEntry] = static_cast<FwSignedSizeType>(packetLen);
+            PacketPlacement& placement = this->m_placements[entryToUse->firstPlacement + entryToUse->numPlacements++];
+            placement.packet = pktEntry;
+            placement.offset = packetLen;
 
             packetLen += entryToUse->channelSize;
 
         }  // end channel in packet
         FW_ASSERT(packetLen <= FW_COM_BUFFER_MAX_SIZE, static_cast<FwAssertArgType>(packetLen),
                   static_cast<FwAssertArgType>(pktEntry));
+        PacketState& packet = this->m_packets[pktEntry];
+        Fw::ComBuffer& buffer = packet.fill->buffer;
         // clear contents
-        memset(this->m_fillBuffers[pktEntry].buffer.getBuffAddr(), 0, static_cast<size_t>(packetLen));
+        buffer.resetSer();
+        memset(buffer.getBuffAddr(), 0, static_cast<size_t>(packetLen));
         // serialize packet descriptor and packet ID now since it will always be the same
-        Fw::SerializeStatus stat = this->m_fillBuffers[pktEntry].buffer.serializeFrom(
-            static_cast<FwPacketDescriptorType>(Fw::ComPacketType::FW_PACKET_PACKETIZED_TLM));
+        Fw::SerializeStatus stat =
+            buffer.serializeFrom(static_cast<FwPacketDescriptorType>(Fw::ComPacketType::FW_PACKET_PACKETIZED_TLM));
         FW_ASSERT(Fw::FW_SERIALIZE_OK == stat, stat);
-        stat = this->m_fillBuffers[pktEntry].buffer.serializeFrom(packetList.list[pktEntry]->id);
+        stat = buffer.serializeFrom(packetList.list[pktEntry]->id);
         FW_ASSERT(Fw::FW_SERIALIZE_OK == stat, stat);
         // set packet buffer length
-        stat = this->m_fillBuffers[pktEntry].buffer.setBuffLen(packetLen);
+        stat = buffer.setBuffLen(packetLen);
         FW_ASSERT(Fw::FW_SERIALIZE_OK == stat, stat);
+        // both buffers start out with the same layout
+        (void)(packet.send->buffer = buffer);
+        packet.synced = true;
         // save ID
-        this->m_fillBuffers[pktEntry].id = packetList.list[pktEntry]->id;
+        packet.id = packetList.list[pktEntry]->id;
         // save level
-        this->m_fillBuffers[pktEntry].level = packetList.list[pktEntry]->level;
+        packet.level = packetList.list[pktEntry]->level;
         // store max level
         if (packetList.list[pktEntry]->level > maxLevel) {
             maxLevel = packetList.list[pktEntry]->level;
@@ -184,10 +218,7 @@ TlmPacketizer::TlmEntry* TlmPacketizer::findBucket(FwChanIdType id) {
                 prevEntry->next = entryToUse;
                 // clear next pointer
                 entryToUse->next = nullptr;
-                // set all packet offsets to -1 for new entry
-                for (FwChanIdType pktOffsetEntry = 0; pktOffsetEntry < MAX_PACKETIZER_PACKETS; pktOffsetEntry++) {
-                    entryToUse->packetOffset[pktOffsetEntry] = -1;
-                }
+                entryToUse->numPlacements = 0;
                 break;
             }
         }
@@ -199,15 +230,36 @@ TlmPacketizer::TlmEntry* TlmPacketizer::findBucket(FwChanIdType id) {
         this->m_tlmEntries.slots[index] = &this->m_tlmEntries.buckets[this->m_tlmEntries.free++];
         entryToUse = this->m_tlmEntries.slots[index];
         entryToUse->next = nullptr;
-        // set all packet offsets to -1 for new entry
-        for (FwChanIdType pktOffsetEntry = 0; pktOffsetEntry < MAX_PACKETIZER_PACKETS; pktOffsetEntry++) {
-            entryToUse->packetOffset[pktOffsetEntry] = -1;
-        }
+        entryToUse->numPlacements = 0;
     }
 
     return entryToUse;
 }
 
+TlmPacketizer::TlmEntry* TlmPacketizer::findEntry(FwChanIdType id) {
+    TlmEntry* entryToUse = this->m_tlmEntries.slots[this->doHash(id)];
+    while ((entryToUse != nullptr) and (entryToUse->id != id)) {
+        entryToUse = entryToUse->next;
+    }
+    return entryToUse;
+}
+
+TlmPacketizer::BufferEntry& TlmPacketizer::fillBuffer(PacketState& packet) {
+    if (not packet.synced) {
+        // The send buffer holds the latest value of every channel. Copy only the channel values since the
+        // descriptor and packet ID never change and Run may be writing the time tag of the send buffer.
+        constexpr FwSizeType HEADER_SIZE =
+            sizeof(FwPacketDescriptorType) + sizeof(FwTlmPacketizeIdType) + Fw::Time::SERIALIZED_SIZE;
+        const FwSizeType packetLen = packet.send->buffer.getSize();
+        FW_ASSERT(packetLen >= HEADER_SIZE, static_cast<FwAssertArgType>(packetLen));
+        (void)memcpy(&packet.fill->buffer.getBuffAddr()[HEADER_SIZE], &packet.send->buffer.getBuffAddr()[HEADER_SIZE],
+                     static_cast<size_t>(packetLen - HEADER_SIZE));
+        packet.fill->latestTime = packet.send->latestTime;
+        packet.synced = true;
+    }
+    return *packet.fill;
+}
+
 // ----------------------------------------------------------------------
 // Handler implementations for user-defined typed input ports
 // ----------------------------------------------------------------------
@@ -217,53 +269,33 @@ void TlmPacketizer ::TlmRecv_handler(const FwIndexType portNum,
                                      Fw::Time& timeTag,
                                      Fw::TlmBuffer& val) {
     FW_ASSERT(this->m_configured);
-    // get hash value for id
-    FwChanIdType index = this->doHash(id);
-    TlmEntry* entryToUse = nullptr;
-
     // Search to see if the channel is being sent
-    entryToUse = this->m_tlmEntries.slots[index];
+    TlmEntry* entryToUse = this->findEntry(id);
 
-    // if no entries at hash, channel not part of a packet or is not ignored
+    // if no entry, channel not part of a packet or is not ignored
     if (not entryToUse) {
         this->missingChannel(id);
         return;
     }
-
-    for (FwChanIdType bucket = 0; bucket < TLMPACKETIZER_HASH_BUCKETS; bucket++) {
-        if (entryToUse) {
-            if (entryToUse->id == id) {  // found the matching entry
-                // check to see if the channel is ignored. If so, just return.
-                if (entryToUse->ignored) {
-                    return;
-                }
-                break;
-            } else {  // try next entry
-                entryToUse = entryToUse->next;
-            }
-        } else {
-            // telemetry channel not in any packets
-            this->missingChannel(id);
-            return;
-        }
+    // check to see if the channel is ignored. If so, just return.
+    if (entryToUse->ignored) {
+        return;
     }
 
-    // copy telemetry value into active buffers
-    for (FwChanIdType pkt = 0; pkt < MAX_PACKETIZER_PACKETS; pkt++) {
-        // check if current packet has this channel
-        if (entryToUse->packetOffset[pkt] != -1) {
-            // get destination address
-            this->m_lock.lock();
-            this->m_fillBuffers[pkt].updated = true;
-            this->m_fillBuffers[pkt].latestTime = timeTag;
-            U8* ptr = &this->m_fillBuffers[pkt].buffer.getBuffAddr()[entryToUse->packetOffset[pkt]];
-            (void)memcpy(ptr, val.getBuffAddr(), static_cast<size_t>(val.getSize()));
-            // record that this chan has a value. could do this outside of the loop only once
-            // but then we'd need to grab the lock again.
-            entryToUse->hasValue = true;
-            this->m_lock.unLock();
-        }
+    // copy telemetry value into the fill buffer of each packet holding the channel
+    const PacketPlacement* placement = &this->m_placements[entryToUse->firstPlacement];
+    this->m_lock.lock();
+    for (FwChanIdType entry = 0; entry < entryToUse->numPlacements; entry++, placement++) {
+        PacketState& packet = this->m_packets[placement->packet];
+        BufferEntry& fill = this->fillBuffer(packet);
+        packet.updated = true;
+        fill.latestTime = timeTag;
+        U8* ptr = &fill.buffer.getBuffAddr()[placement->offset];
+        (void)memcpy(ptr, val.getBuffAddr(), static_cast<size_t>(val.getSize()));
     }
+    // record that this chan has a value
+    entryToUse->hasValue = true;
+    this->m_lock.unLock();
 }
 
 void TlmPacketizer ::configureSectionGroupRate_handler(FwIndexType portNum,
@@ -283,39 +315,20 @@ Fw::TlmValid TlmPacketizer ::TlmGet_handler(FwIndexType portNum,  //!< The port
                                                                   //!< Size set to 0 if channel not found.
 ) {
     FW_ASSERT(this->m_configured);
-    // get hash value for id
-    FwChanIdType index = this->doHash(id);
-    TlmEntry* entryToUse = nullptr;
-
     // Search to see if the channel is being sent
-    entryToUse = this->m_tlmEntries.slots[index];
+    TlmEntry* entryToUse = this->findEntry(id);
 
-    // if no entries at hash, channel not part of a packet or is not ignored
+    // if no entry, channel not part of a packet or is not ignored
     if (not entryToUse) {
         this->missingChannel(id);
         val.resetSer();
         return Fw::TlmValid::INVALID;
     }
-
-    for (FwChanIdType bucket = 0; bucket < TLMPACKETIZER_HASH_BUCKETS; bucket++) {
-        if (entryToUse) {
-            if (entryToUse->id == id) {  // found the matching entry
-                // check to see if the channel is ignored. If so, just return, as
-                // we don't store the bytes of ignored channels
-                if (entryToUse->ignored) {
-                    val.resetSer();
-                    return Fw::TlmValid::INVALID;
-                }
-                break;
-            } else {  // try next entry
-                entryToUse = entryToUse->next;
-            }
-        } else {
-            // telemetry channel not in any packets
-            this->missingChannel(id);
-            val.resetSer();
-            return Fw::TlmValid::INVALID;
-        }
+    // check to see if the channel is ignored. If so, just return, as
+    // we don't store the bytes of ignored channels
+    if (entryToUse->ignored) {
+        val.resetSer();
+        return Fw::TlmValid::INVALID;
     }
 
     if (!entryToUse->hasValue) {
@@ -327,57 +340,54 @@ Fw::TlmValid TlmPacketizer ::TlmGet_handler(FwIndexType portNum,  //!< The port
     // make sure we have enough space to store this entry in our buf
     FW_ASSERT(entryToUse->channelSize <= val.getCapacity(), static_cast<FwAssertArgType>(entryToUse->channelSize),
               static_cast<FwAssertArgType>(val.getCapacity()));
+    // coding error if not ignored and not in a packet
+    FW_ASSERT(entryToUse->numPlacements > 0, static_cast<FwAssertArgType>(entryToUse->id));
 
-    // okay, we have the matching entry.
-    // go over each packet and find the first one which stores this channel
-
-    for (FwChanIdType pkt = 0; pkt < MAX_PACKETIZER_PACKETS; pkt++) {
-        // check if current packet has this channel
-        if (entryToUse->packetOffset[pkt] != -1) {
-            // okay, it has the channel. copy chan val into the tlm buf
-            this->m_lock.lock();
-            timeTag = this->m_fillBuffers[pkt].latestTime;
-            U8* ptr = &this->m_fillBuffers[pkt].buffer.getBuffAddr()[entryToUse->packetOffset[pkt]];
-            (void)memcpy(val.getBuffAddr(), ptr, static_cast<size_t>(entryToUse->channelSize));
-            // set buf len to the channelSize. keep in mind, this is the MAX serialized size of the channel.
-            // so we may actually be filling val with some junk after the value of the channel.
-            FW_ASSERT(val.setBuffLen(entryToUse->channelSize) == Fw::SerializeStatus::FW_SERIALIZE_OK);
-            this->m_lock.unLock();
-            return Fw::TlmValid::VALID;
-        }
-    }
-
-    // did not find a packet which stores this channel.
-    // coding error, this was not an ignored channel so it must be in a packet somewhere
-    FW_ASSERT(0, static_cast<FwAssertArgType>(entryToUse->id));
-    // TPP (tim paranoia principle)
-    val.resetSer();
-    return Fw::TlmValid::INVALID;
+    // okay, we have the matching entry. copy chan val from the first packet storing it into the tlm buf
+    const PacketPlacement& placement = this->m_placements[entryToUse->firstPlacement];
+    this->m_lock.lock();
+    const PacketState& packet = this->m_packets[placement.packet];
+    // a stale fill buffer has not been written since the swap, so the send buffer holds the latest value
+    const BufferEntry& current = packet.synced ? *packet.fill : *packet.send;
+    timeTag = current.latestTime;
+    const U8* ptr = &current.buffer.getBuffAddr()[placement.offset];
+    (void)memcpy(val.getBuffAddr(), ptr, static_cast<size_t>(entryToUse->channelSize));
+    // set buf len to the channelSize. keep in mind, this is the MAX serialized size of the channel.
+    // so we may actually be filling val with some junk after the value of the channel.
+    FW_ASSERT(val.setBuffLen(entryToUse->channelSize) == Fw::SerializeStatus::FW_SERIALIZE_OK);
+    this->m_lock.unLock();
+    return Fw::TlmValid::VALID;
 }
 
 void TlmPacketizer ::Run_handler(const FwIndexType portNum, U32 context) {
     FW_ASSERT(this->m_configured);
 
-    // lock mutex long enough to copy fill buffers to send buffers
+    // lock mutex long enough to swap the fill and send buffers of updated packets
     // so the data can be read without worrying about updates
     this->m_lock.lock();
-    // copy buffers from fill side to send side
     for (FwChanIdType pkt = 0; pkt < this->m_numPackets; pkt++) {
-        if (this->m_fillBuffers[pkt].updated == true) {
-            (void)(this->m_sendBuffers[pkt] = this->m_fillBuffers[pkt]);
+        PacketState& packet = this->m_packets[pkt];
+        packet.sendUpdated = packet.updated;
+        if (packet.updated) {
+            BufferEntry* filled = packet.fill;
+            packet.fill = packet.send;
+            packet.send = filled;
+            // the new fill buffer is missing this cycle's updates until it is next written
+            packet.synced = false;
+            packet.updated = false;
         }
-        this->m_fillBuffers[pkt].updated = false;
     }
     this->m_lock.unLock();
 
     // push all updated packet buffers
     for (FwChanIdType pkt = 0; pkt < this->m_numPackets; pkt++) {
-        FwChanIdType entryGroup = this->m_sendBuffers[pkt].level;
+        BufferEntry& sendBuffer = *this->m_packets[pkt].send;
+        FwChanIdType entryGroup = this->m_packets[pkt].level;
 
         // Iterate through output sections
         for (FwIndexType section = 0; section < TelemetrySection::NUM_SECTIONS; section++) {
             // Packet is updated and not REQUESTED (Keep REQUESTED marking to bypass disable checks)
-            if (this->m_sendBuffers[pkt].updated and
+            if (this->m_packets[pkt].sendUpdated and
                 this->m_packetFlags[section][pkt].updateFlag != UpdateFlag::REQUESTED) {
                 this->m_packetFlags[section][pkt].updateFlag = UpdateFlag::NEW;
             }
@@ -450,17 +460,16 @@ void TlmPacketizer ::Run_handler(const FwIndexType portNum, U32 context) {
             if (sendOutFlag) {
                 // serialize time into time offset in packet
                 Fw::ExternalSerializeBuffer buff(
-                    &this->m_sendBuffers[pkt]
-                         .buffer.getBuffAddr()[sizeof(FwPacketDescriptorType) + sizeof(FwTlmPacketizeIdType)],
+                    &sendBuffer.buffer.getBuffAddr()[sizeof(FwPacketDescriptorType) + sizeof(FwTlmPacketizeIdType)],
                     Fw::Time::SERIALIZED_SIZE);
-                Fw::SerializeStatus stat = buff.serializeFrom(this->m_sendBuffers[pkt].latestTime);
+                Fw::SerializeStatus stat = buff.serializeFrom(sendBuffer.latestTime);
                 FW_ASSERT(Fw::FW_SERIALIZE_OK == stat, stat);
-                this->PktSend_out(outIndex, this->m_sendBuffers[pkt].buffer, pktEntryFlags.prevSentCounter);
+                this->PktSend_out(outIndex, sendBuffer.buffer, pktEntryFlags.prevSentCounter);
                 pktEntryFlags.prevSentCounter = 0;
                 pktEntryFlags.updateFlag = UpdateFlag::PAST;
             }
         }
-        this->m_sendBuffers[pkt].updated = false;
+        this->m_packets[pkt].sendUpdated = false;
     }
 }
 
@@ -507,10 +516,12 @@ void TlmPacketizer ::SEND_PKT_cmdHandler(const FwOpcodeType opCode,
     FW_ASSERT(section.isValid());
     FwChanIdType pkt = 0;
     for (pkt = 0; pkt < this->m_numPackets; pkt++) {
-        if (this->m_fillBuffers[pkt].id == id) {
+        if (this->m_packets[pkt].id == id) {
+            const Fw::Time now = this->getTime();
             this->m_lock.lock();
-            this->m_fillBuffers[pkt].updated = true;
-            this->m_fillBuffers[pkt].latestTime = this->getTime();
+            PacketState& packet = this->m_packets[pkt];
+            this->fillBuffer(packet).latestTime = now;
+            packet.updated = true;
             this->m_lock.unLock();
 
             this->m_packetFlags[section][pkt].updateFlag = UpdateFlag::REQUESTED;
@@ -148,33 +148,50 @@ class TlmPacketizer final : public TlmPacketizerComponentBase {
 
     // number of packets to fill
     FwChanIdType m_numPackets;
-    // Array of packet buffers to send
-    // Double-buffered to fill one while sending one
 
     struct BufferEntry {
         Fw::ComBuffer buffer;  //!< buffer for packetized channels
         Fw::Time latestTime;   //!< latest update time
-        FwChanIdType id;       //!< channel id
-        FwChanIdType level;    //!< channel level
-        bool updated;          //!< if packet had any updates during last cycle
     };
 
-    // buffers for filling with telemetry
-    BufferEntry m_fillBuffers[MAX_PACKETIZER_PACKETS];
-    // buffers for sending - will be copied from fill buffers
-    BufferEntry m_sendBuffers[MAX_PACKETIZER_PACKETS];
+    // Double-buffered packet storage. Each packet fills one buffer while the other is sent. Run swaps the two
+    // pointers of every updated packet instead of copying buffers.
+    BufferEntry m_packetBuffers[2][MAX_PACKETIZER_PACKETS];
+
+    struct PacketState {
+        BufferEntry* fill;   //!< buffer receiving telemetry updates
+        BufferEntry* send;   //!< buffer holding the last swapped packet, read by Run when sending
+        FwChanIdType id;     //!< packet id
+        FwChanIdType level;  //!< packet level
+        bool updated;        //!< if the fill buffer had any updates during the current cycle
+        bool sendUpdated;    //!< if the send buffer was swapped in during the last run
+        bool synced;         //!< if the fill buffer holds every channel value of the send buffer
+    } m_packets[MAX_PACKETIZER_PACKETS];
+
+    //! Get the fill buffer of a packet, first bringing its channel values up to date with the send buffer if a swap
+    //! left it stale. Must be called with m_lock held.
+    BufferEntry& fillBuffer(PacketState& packet);
+
+    //! Location of a channel value within a packet
+    struct PacketPlacement {
+        FwChanIdType packet;  //!< index of the packet
+        FwSizeType offset;    //!< offset of the channel value in the packet buffer
+    };
+
+    // placements of all packetized channels. The placements of a channel are stored contiguously.
+    PacketPlacement m_placements[TLMPACKETIZER_MAX_PACKET_PLACEMENTS];
+    FwChanIdType m_numPlacements;  //!< number of placements in use
 
     struct TlmEntry {
-        FwChanIdType id;  //!< telemetry id stored in slot
-        // Offsets into packet buffers.
-        // -1 means that channel is not in that packet
-        FwSignedSizeType packetOffset[MAX_PACKETIZER_PACKETS];
-        FwSizeType channelSize;  //!< max serialized size of the channel in bytes
-        TlmEntry* next;          //!< pointer to next bucket in table
-        bool used;               //!< if entry has been used
-        bool ignored;            //!< ignored channel id
-        bool hasValue;           //!< if the entry has received a value at least once
-        FwChanIdType bucketNo;   //!< for testing
+        FwChanIdType id;              //!< telemetry id stored in slot
+        FwChanIdType firstPlacement;  //!< index of the first placement of the channel in m_placements
+        FwChanIdType numPlacements;   //!< number of packets the channel is placed in
+        FwSizeType channelSize;       //!< max serialized size of the channel in bytes
+        TlmEntry* next;               //!< pointer to next bucket in table
+        bool used;                    //!< if entry has been used
+        bool ignored;                 //!< ignored channel id
+        bool hasValue;                //!< if the entry has received a value at least once
+        FwChanIdType bucketNo;        //!< for testing
     };
 
     struct TlmSet {
@@ -199,6 +216,10 @@ class TlmPacketizer final : public TlmPacketizerComponentBase {
 
     TlmEntry* findBucket(FwChanIdType id);
 
+    //! Look up the entry for a channel without adding one
+    //! \return the entry, or nullptr if the channel is not in the table
+    TlmEntry* findEntry(FwChanIdType id);
+
     TlmPacketizer_SectionEnabled m_sectionEnabled{};
 
     TlmPacketizer_SectionConfigs m_groupConfigs{};
@@ -990,6 +990,74 @@ void TlmPacketizerTester ::getChannelValueTest() {
     ASSERT_EQ(valid, Fw::TlmValid::INVALID);
 }
 
+//! swapped buffers test
+//!
+void TlmPacketizerTester ::swappedBuffersTest() {
+    this->component.setPacketList(packetList2, ignore, 3);
+    Fw::Time ts(100, 1000);
+    Fw::Time time;
+    Fw::TlmBuffer buff;
+    Fw::ComBuffer comBuff;
+
+    // channel 10 is in packets 1, 2, and 4
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, buff.serializeFrom(static_cast<U32>(20)));
+    this->invoke_to_TlmRecv(0, 10, ts, buff);
+    this->invoke_to_Run(0, 0);
+    this->component.doDispatch();
+    ASSERT_from_PktSend_SIZE(3 * Svc::TelemetrySection::NUM_SECTIONS);
+
+    // the fill buffers of the swapped packets are stale until written, reads must still see the latest value
+    buff.resetSer();
+    Fw::TlmValid valid = this->invoke_to_TlmGet(0, 10, time, buff);
+    ASSERT_EQ(valid, Fw::TlmValid::VALID);
+    ASSERT_EQ(time, ts);
+    U32 value = 0;
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, buff.deserializeTo(value));
+    ASSERT_EQ(value, 20u);
+
+    // update only channel 60, packet 4 must keep the value of channel 10
+    Fw::Time ts2(101, 1000);
+    buff.resetSer();
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, buff.serializeFrom(static_cast<U32>(30)));
+    this->invoke_to_TlmRecv(0, 60, ts2, buff);
+    this->clearFromPortHistory();
+    this->invoke_to_Run(0, 0);
+    this->component.doDispatch();
+    ASSERT_from_PktSend_SIZE(1 * Svc::TelemetrySection::NUM_SECTIONS);
+
+    comBuff.resetSer();
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,
+              comBuff.serializeFrom(static_cast<FwPacketDescriptorType>(Fw::ComPacketType::FW_PACKET_PACKETIZED_TLM)));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, comBuff.serializeFrom(static_cast<FwTlmPacketizeIdType>(16)));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, comBuff.serializeFrom(ts2));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, comBuff.serializeFrom(static_cast<U32>(20)));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, comBuff.serializeFrom(static_cast<U32>(30)));
+    for (FwIndexType section = 0; section < Svc::TelemetrySection::NUM_SECTIONS; section++) {
+        ASSERT_from_PktSend(section, comBuff, static_cast<U32>(1));
+    }
+
+    // update channel 10 again, packet 4 must keep the value of channel 60
+    Fw::Time ts3(102, 1000);
+    buff.resetSer();
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, buff.serializeFrom(static_cast<U32>(40)));
+    this->invoke_to_TlmRecv(0, 10, ts3, buff);
+    this->clearFromPortHistory();
+    this->invoke_to_Run(0, 0);
+    this->component.doDispatch();
+    ASSERT_from_PktSend_SIZE(3 * Svc::TelemetrySection::NUM_SECTIONS);
+
+    comBuff.resetSer();
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,
+              comBuff.serializeFrom(static_cast<FwPacketDescriptorType>(Fw::ComPacketType::FW_PACKET_PACKETIZED_TLM)));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, comBuff.serializeFrom(static_cast<FwTlmPacketizeIdType>(16)));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, comBuff.serializeFrom(ts3));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, comBuff.serializeFrom(static_cast<U32>(40)));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, comBuff.serializeFrom(static_cast<U32>(30)));
+    for (FwIndexType section = 0; section < Svc::TelemetrySection::NUM_SECTIONS; section++) {
+        ASSERT_from_PktSend((2 * Svc::TelemetrySection::NUM_SECTIONS) + section, comBuff, static_cast<U32>(1));
+    }
+}
+
 //! Configured tlm groups test
 //!
 void TlmPacketizerTester ::configuredTelemetryGroupsTests() {
@@ -79,6 +79,10 @@ class TlmPacketizerTester : public TlmPacketizerGTestBase {
     //!
     void getChannelValueTest(void);
 
+    //! swapped buffers test
+    //!
+    void swappedBuffersTest(void);
+
     //! Configured tlm groups test
     //!
     void configuredTelemetryGroupsTests(void);
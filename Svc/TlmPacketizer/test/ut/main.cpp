@@ -84,6 +84,11 @@ TEST(TestNominal, advancedControlGroupTests) {
     Svc::TlmPacketizerTester tester;
     tester.advancedControlGroupTests();
 }
+TEST(TestNominal, SwappedBuffersTest) {
+    TEST_CASE(100.1.11, "Packet values retained across buffer swaps");
+    Svc::TlmPacketizerTester tester;
+    tester.swappedBuffersTest();
+}
 
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,248 @@
+// ======================================================================
+// \title  CRC32Engine.cpp
+// \brief  cpp file for block-oriented CRC32 kernels
+//
+// \copyright
+// Copyright 2009-2025, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Fw/Types/Assert.hpp>
+#include <Utils/Hash/libcrc/CRC32Engine.hpp>
+
+extern "C" {
+#include <Utils/Hash/libcrc/lib_crc.h>
+}
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define UTILS_CRC32_HAVE_PCLMUL 1
+#include <emmintrin.h>
+#include <wmmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32) && defined(__BYTE_ORDER__) && \
+    (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define UTILS_CRC32_HAVE_ARMV8 1
+#include <arm_acle.h>
+#endif
+
+#include <cstring>
+
+namespace Utils {
+
+namespace {
+
+//! Reflected CRC32 polynomial, as used by lib_crc
+constexpr U32 CRC32_POLYNOMIAL = 0xEDB88320U;
+
+//! Slice-by-8 lookup tables. Table 0 is the classic byte-wise table; table k advances a byte
+//! through k additional zero bytes.
+struct SliceTables {
+    U32 table[8][256];
+};
+
+constexpr SliceTables makeSliceTables() {
+    SliceTables tables{};
+    for (U32 i = 0; i < 256; i++) {
+        U32 crc = i;
+        for (U32 bit = 0; bit < 8; bit++) {
+            crc = (crc & 1U) ? ((crc >> 1) ^ CRC32_POLYNOMIAL) : (crc >> 1);
+        }
+        tables.table[0][i] = crc;
+    }
+    for (U32 i = 0; i < 256; i++) {
+        for (U32 k = 1; k < 8; k++) {
+            const U32 previous = tables.table[k - 1][i];
+            tables.table[k][i] = (previous >> 8) ^ tables.table[0][previous & 0xFFU];
+        }
+    }
+    return tables;
+}
+
+constexpr SliceTables SLICE_TABLES = makeSliceTables();
+
+//! Load four bytes in little-endian order. Compilers reduce this to a single load on
+//! little-endian targets while remaining correct on big-endian ones.
+inline U32 loadLe32(const U8* data) {
+    return static_cast<U32>(data[0]) | (static_cast<U32>(data[1]) << 8) | (static_cast<U32>(data[2]) << 16) |
+           (static_cast<U32>(data[3]) << 24);
+}
+
+#if defined(UTILS_CRC32_HAVE_PCLMUL)
+// Folding constants for the reflected CRC32 polynomial (x^n mod P, bit-reflected and shifted by one)
+alignas(16) const U64 FOLD_BY_4[2] = {0x0154442bd4ULL, 0x01c6e41596ULL};  // x^(4*128+32), x^(4*128-32)
+alignas(16) const U64 FOLD_BY_1[2] = {0x01751997d0ULL, 0x00ccaa009eULL};  // x^(128+32), x^(128-32)
+alignas(16) const U64 FOLD_TO_64[2] = {0x0163cd6124ULL, 0x0ULL};          // x^64
+alignas(16) const U64 BARRETT[2] = {0x01db710641ULL, 0x01f7011641ULL};    // P', mu
+
+//! Minimum length for which the folding kernel is used; shorter inputs use slice-by-8
+constexpr FwSizeType PCLMUL_MIN_LENGTH = 64;
+
+inline __m128i loadBlock(const U8* data) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+}
+
+//! Fold a 128-bit accumulator forward by the distance encoded in `constants` and add `next`
+__attribute__((target("pclmul"))) inline __m128i fold(__m128i accumulator, __m128i constants, __m128i next) {
+    const __m128i low = _mm_clmulepi64_si128(accumulator, constants, 0x00);
+    const __m128i high = _mm_clmulepi64_si128(accumulator, constants, 0x11);
+    return _mm_xor_si128(_mm_xor_si128(high, low), next);
+}
+
+//! PCLMULQDQ folding kernel. `len` must be a multiple of 16 and at least PCLMUL_MIN_LENGTH.
+__attribute__((target("pclmul"))) U32 updatePclmul(U32 crc, const U8* data, FwSizeType len) {
+    __m128i x1 = loadBlock(data + 0x00);
+    __m128i x2 = loadBlock(data + 0x10);
+    __m128i x3 = loadBlock(data + 0x20);
+    __m128i x4 = loadBlock(data + 0x30);
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+    data += 64;
+    len -= 64;
+
+    // Fold four lanes of 128 bits in parallel
+    __m128i constants = _mm_load_si128(reinterpret_cast<const __m128i*>(FOLD_BY_4));
+    while (len >= 64) {
+        x1 = fold(x1, constants, loadBlock(data + 0x00));
+        x2 = fold(x2, constants, loadBlock(data + 0x10));
+        x3 = fold(x3, constants, loadBlock(data + 0x20));
+        x4 = fold(x4, constants, loadBlock(data + 0x30));
+        data += 64;
+        len -= 64;
+    }
+
+    // Reduce the four lanes into one, then fold any remaining 16-byte blocks
+    constants = _mm_load_si128(reinterpret_cast<const __m128i*>(FOLD_BY_1));
+    x1 = fold(x1, constants, x2);
+    x1 = fold(x1, constants, x3);
+    x1 = fold(x1, constants, x4);
+    while (len >= 16) {
+        x1 = fold(x1, constants, loadBlock(data));
+        data += 16;
+        len -= 16;
+    }
+    FW_ASSERT(len == 0, static_cast<FwAssertArgType>(len));
+
+    // Fold 128 bits down to 64 bits
+    const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+    __m128i x2r = _mm_clmulepi64_si128(x1, constants, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2r);
+    constants = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(FOLD_TO_64));
+    x2r = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, mask32);
+    x1 = _mm_clmulepi64_si128(x1, constants, 0x00);
+    x1 = _mm_xor_si128(x1, x2r);
+
+    // Barrett reduction to 32 bits
+    constants = _mm_load_si128(reinterpret_cast<const __m128i*>(BARRETT));
+    x2r = _mm_and_si128(x1, mask32);
+    x2r = _mm_clmulepi64_si128(x2r, constants, 0x10);
+    x2r = _mm_and_si128(x2r, mask32);
+    x2r = _mm_clmulepi64_si128(x2r, constants, 0x00);
+    x1 = _mm_xor_si128(x1, x2r);
+    return static_cast<U32>(_mm_cvtsi128_si32(_mm_srli_si128(x1, 4)));
+}
+
+bool detectPclmul() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("pclmul") != 0;
+}
+#endif
+
+}  // namespace
+
+U32 CRC32Engine ::update(U32 crc, const void* data, FwSizeType len) {
+    return CRC32Engine::update(CONFIGURED_BACKEND, crc, data, len);
+}
+
+U32 CRC32Engine ::update(Backend backend, U32 crc, const void* data, FwSizeType len) {
+    FW_ASSERT(data != nullptr || len == 0);
+    const U8* bytes = static_cast<const U8*>(data);
+    switch (backend) {
+        case BYTEWISE:
+            return CRC32Engine::updateBytewise(crc, bytes, len);
+        case SLICE_BY_8:
+            return CRC32Engine::updateSliceBy8(crc, bytes, len);
+        case ACCELERATED:
+            return CRC32Engine::updateAccelerated(crc, bytes, len);
+        default:
+            FW_ASSERT(0, static_cast<FwAssertArgType>(backend));
+            return crc;
+    }
+}
+
+bool CRC32Engine ::hasHardwareSupport() {
+#if defined(UTILS_CRC32_HAVE_PCLMUL)
+    static const bool supported = detectPclmul();
+    return supported;
+#elif defined(UTILS_CRC32_HAVE_ARMV8)
+    return true;
+#else
+    return false;
+#endif
+}
+
+const char* CRC32Engine ::getBackendName(Backend backend) {
+    switch (backend) {
+        case BYTEWISE:
+            return "BYTEWISE";
+        case SLICE_BY_8:
+            return "SLICE_BY_8";
+        case ACCELERATED:
+            return "ACCELERATED";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+U32 CRC32Engine ::updateBytewise(U32 crc, const U8* data, FwSizeType len) {
+    for (FwSizeType index = 0; index < len; index++) {
+        crc = static_cast<U32>(update_crc_32(crc, static_cast<char>(data[index])));
+    }
+    return crc;
+}
+
+U32 CRC32Engine ::updateSliceBy8(U32 crc, const U8* data, FwSizeType len) {
+    const U32(&table)[8][256] = SLICE_TABLES.table;
+    while (len >= 8) {
+        const U32 one = crc ^ loadLe32(data);
+        const U32 two = loadLe32(data + 4);
+        crc = table[7][one & 0xFFU] ^ table[6][(one >> 8) & 0xFFU] ^ table[5][(one >> 16) & 0xFFU] ^
+              table[4][one >> 24] ^ table[3][two & 0xFFU] ^ table[2][(two >> 8) & 0xFFU] ^
+              table[1][(two >> 16) & 0xFFU] ^ table[0][two >> 24];
+        data += 8;
+        len -= 8;
+    }
+    while (len > 0) {
+        crc = (crc >> 8) ^ table[0][(crc ^ *data) & 0xFFU];
+        data++;
+        len--;
+    }
+    return crc;
+}
+
+U32 CRC32Engine ::updateAccelerated(U32 crc, const U8* data, FwSizeType len) {
+#if defined(UTILS_CRC32_HAVE_PCLMUL)
+    if ((len >= PCLMUL_MIN_LENGTH) && CRC32Engine::hasHardwareSupport()) {
+        const FwSizeType folded = len & ~static_cast<FwSizeType>(0xF);
+        crc = updatePclmul(crc, data, folded);
+        data += folded;
+        len -= folded;
+    }
+#elif defined(UTILS_CRC32_HAVE_ARMV8)
+    while (len >= 8) {
+        U64 word;
+        (void)std::memcpy(&word, data, sizeof(word));
+        crc = __crc32d(crc, word);
+        data += 8;
+        len -= 8;
+    }
+    while (len > 0) {
+        crc = __crc32b(crc, *data);
+        data++;
+        len--;
+    }
+#endif
+    return CRC32Engine::updateSliceBy8(crc, data, len);
+}
+
+}  // namespace Utils
@@ -0,0 +1,76 @@
+// ======================================================================
+// \title  CRC32Engine.hpp
+// \brief  hpp file for block-oriented CRC32 kernels
+//
+// \copyright
+// Copyright 2009-2025, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef UTILS_CRC32_ENGINE_HPP
+#define UTILS_CRC32_ENGINE_HPP
+
+#include <Fw/FPrimeBasicTypes.hpp>
+#include <config/CRC32Cfg.hpp>
+
+namespace Utils {
+
+//! \class CRC32Engine
+//! \brief Block-oriented CRC32 kernels
+//!
+//! Each kernel updates a running CRC32 register exactly as repeated calls to lib_crc's
+//! `update_crc_32` would. The register is not complemented: callers seed it with 0xFFFFFFFF
+//! and complement the final value, just as Utils::Hash does.
+//!
+class CRC32Engine {
+  public:
+    //! Available backends, see config/CRC32Cfg.hpp
+    enum Backend : U8 {
+        BYTEWISE = CRC32_BACKEND_BYTEWISE,        //!< lib_crc table, one byte per step
+        SLICE_BY_8 = CRC32_BACKEND_SLICE_BY_8,    //!< portable slice-by-8
+        ACCELERATED = CRC32_BACKEND_ACCELERATED,  //!< CPU CRC/carry-less multiply instructions when present
+    };
+
+    //! Backend selected at build time by CRC32_BACKEND
+    static constexpr Backend CONFIGURED_BACKEND = static_cast<Backend>(CRC32_BACKEND);
+
+    //! Update a CRC32 register using the build-time configured backend
+    //! \param crc: current CRC32 register value
+    //! \param data: pointer to start of data
+    //! \param len: length of the data
+    //! \return updated CRC32 register value
+    static U32 update(U32 crc, const void* data, FwSizeType len);
+
+    //! Update a CRC32 register using a specific backend
+    //! \param backend: backend to use
+    //! \param crc: current CRC32 register value
+    //! \param data: pointer to start of data
+    //! \param len: length of the data
+    //! \return updated CRC32 register value
+    static U32 update(Backend backend, U32 crc, const void* data, FwSizeType len);
+
+    //! Check whether the ACCELERATED backend found usable CPU support on this machine
+    //! \return true when CPU instructions are used, false when ACCELERATED runs slice-by-8
+    static bool hasHardwareSupport();
+
+    //! Get a printable name for a backend
+    //! \param backend: backend to name
+    //! \return backend name
+    static const char* getBackendName(Backend backend);
+
+  private:
+    //! lib_crc table kernel
+    static U32 updateBytewise(U32 crc, const U8* data, FwSizeType len);
+
+    //! Portable slice-by-8 kernel
+    static U32 updateSliceBy8(U32 crc, const U8* data, FwSizeType len);
+
+    //! Hardware kernel with slice-by-8 fallback
+    static U32 updateAccelerated(U32 crc, const U8* data, FwSizeType len);
+};
+
+}  // namespace Utils
+
+#endif
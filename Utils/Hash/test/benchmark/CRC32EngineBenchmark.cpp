@@ -0,0 +1,63 @@
+// ======================================================================
+// \title  CRC32EngineBenchmark.cpp
+// \brief  Throughput comparison of the CRC32 backends across buffer sizes
+//
+// Run the resulting executable directly to print a MB/s table. Each backend
+// hashes the same data so the results are also cross-checked.
+// ======================================================================
+
+#include <gtest/gtest.h>
+#include <Utils/Hash/libcrc/CRC32Engine.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+//! Bytes hashed per measurement, independent of buffer size
+constexpr FwSizeType BYTES_PER_MEASUREMENT = 16 * 1024 * 1024;
+const FwSizeType BUFFER_SIZES[] = {16, 64, 256, 1024, 4096, 65536};
+const Utils::CRC32Engine::Backend BACKENDS[] = {Utils::CRC32Engine::BYTEWISE, Utils::CRC32Engine::SLICE_BY_8,
+                                                Utils::CRC32Engine::ACCELERATED};
+
+}  // namespace
+
+TEST(CRC32EngineBenchmark, Throughput) {
+    std::vector<U8> data(BUFFER_SIZES[sizeof(BUFFER_SIZES) / sizeof(BUFFER_SIZES[0]) - 1]);
+    for (FwSizeType i = 0; i < data.size(); i++) {
+        data[i] = static_cast<U8>(i * 131 + 7);
+    }
+    std::printf("Hardware support: %s\n", Utils::CRC32Engine::hasHardwareSupport() ? "yes" : "no");
+    std::printf("%10s", "size");
+    for (const Utils::CRC32Engine::Backend backend : BACKENDS) {
+        std::printf(" %14s", Utils::CRC32Engine::getBackendName(backend));
+    }
+    std::printf("   (MB/s)\n");
+
+    for (const FwSizeType size : BUFFER_SIZES) {
+        const FwSizeType iterations = BYTES_PER_MEASUREMENT / size;
+        std::printf("%10llu", static_cast<unsigned long long>(size));
+        U32 reference = 0;
+        for (const Utils::CRC32Engine::Backend backend : BACKENDS) {
+            U32 crc = 0xFFFFFFFFU;
+            const auto start = std::chrono::steady_clock::now();
+            for (FwSizeType i = 0; i < iterations; i++) {
+                crc = Utils::CRC32Engine::update(backend, crc, data.data(), size);
+            }
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            const double megabytes = static_cast<double>(iterations * size) / 1.0e6;
+            std::printf(" %14.1f", megabytes / elapsed.count());
+            if (backend == BACKENDS[0]) {
+                reference = crc;
+            }
+            ASSERT_EQ(reference, crc) << Utils::CRC32Engine::getBackendName(backend);
+        }
+        std::printf("\n");
+    }
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,92 @@
+// ======================================================================
+// \title  CRC32EngineTest.cpp
+// \brief  Unit tests checking CRC32 backends against lib_crc
+// ======================================================================
+
+#include <gtest/gtest.h>
+#include <STest/Random/Random.hpp>
+#include <Utils/Hash/Hash.hpp>
+#include <Utils/Hash/libcrc/CRC32Engine.hpp>
+
+extern "C" {
+#include <Utils/Hash/libcrc/lib_crc.h>
+}
+
+namespace {
+
+constexpr FwSizeType MAX_TEST_LENGTH = 4096;
+constexpr U32 NUM_RANDOM_TRIALS = 2000;
+const Utils::CRC32Engine::Backend BACKENDS[] = {Utils::CRC32Engine::BYTEWISE, Utils::CRC32Engine::SLICE_BY_8,
+                                                Utils::CRC32Engine::ACCELERATED};
+
+//! Reference CRC32 register update using the original byte-at-a-time library
+U32 referenceUpdate(U32 crc, const U8* data, FwSizeType len) {
+    for (FwSizeType i = 0; i < len; i++) {
+        crc = static_cast<U32>(update_crc_32(crc, static_cast<char>(data[i])));
+    }
+    return crc;
+}
+
+void fillRandom(U8* data, FwSizeType len) {
+    for (FwSizeType i = 0; i < len; i++) {
+        data[i] = static_cast<U8>(STest::Random::lowerUpper(0, 255));
+    }
+}
+
+}  // namespace
+
+TEST(CRC32EngineTest, KnownAnswer) {
+    const char* const check = "123456789";
+    U32 value = 0;
+    Utils::Hash hash;
+    hash.update(check, 9);
+    hash.final(value);
+    ASSERT_EQ(0xCBF43926U, value);
+    for (const Utils::CRC32Engine::Backend backend : BACKENDS) {
+        ASSERT_EQ(0xCBF43926U, ~Utils::CRC32Engine::update(backend, 0xFFFFFFFFU, check, 9))
+            << Utils::CRC32Engine::getBackendName(backend);
+    }
+}
+
+TEST(CRC32EngineTest, EveryLengthMatchesReference) {
+    // Covers all head/tail splits around the 8-byte and 64-byte kernel boundaries
+    U8 data[MAX_TEST_LENGTH + 16];
+    fillRandom(data, sizeof(data));
+    for (FwSizeType offset = 0; offset < 16; offset++) {
+        for (FwSizeType len = 0; len <= 300; len++) {
+            const U32 expected = referenceUpdate(0xFFFFFFFFU, data + offset, len);
+            for (const Utils::CRC32Engine::Backend backend : BACKENDS) {
+                ASSERT_EQ(expected, Utils::CRC32Engine::update(backend, 0xFFFFFFFFU, data + offset, len))
+                    << Utils::CRC32Engine::getBackendName(backend) << " offset " << offset << " length " << len;
+            }
+        }
+    }
+}
+
+TEST(CRC32EngineTest, RandomIncrementalMatchesReference) {
+    U8 data[MAX_TEST_LENGTH];
+    for (U32 trial = 0; trial < NUM_RANDOM_TRIALS; trial++) {
+        const FwSizeType len = STest::Random::lowerUpper(0, MAX_TEST_LENGTH);
+        const FwSizeType split = STest::Random::lowerUpper(0, static_cast<U32>(len));
+        const U32 seed = STest::Random::lowerUpper(0, 0xFFFFFFFFU);
+        fillRandom(data, len);
+        const U32 expected = referenceUpdate(seed, data, len);
+        for (const Utils::CRC32Engine::Backend backend : BACKENDS) {
+            U32 crc = Utils::CRC32Engine::update(backend, seed, data, split);
+            crc = Utils::CRC32Engine::update(backend, crc, data + split, len - split);
+            ASSERT_EQ(expected, crc) << Utils::CRC32Engine::getBackendName(backend) << " length " << len;
+        }
+        // Utils::Hash must stay bit-identical to the historical implementation
+        Utils::HashBuffer buffer;
+        Utils::Hash::hash(data, len, buffer);
+        U32 hashValue = 0;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK, buffer.deserializeTo(hashValue));
+        ASSERT_EQ(~referenceUpdate(0xFFFFFFFFU, data, len), hashValue);
+    }
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    STest::Random::seed();
+    return RUN_ALL_TESTS();
+}
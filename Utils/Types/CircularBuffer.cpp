@@ -15,6 +15,7 @@
 #include <Fw/FPrimeBasicTypes.hpp>
 #include <Fw/Types/Assert.hpp>
 #include <Utils/Types/CircularBuffer.hpp>
+#include <cstring>
 
 namespace Types {
 
@@ -61,13 +62,12 @@ Fw::SerializeStatus CircularBuffer ::serialize(const U8* const buffer, const FwS
     if (size > get_free_size()) {
         return Fw::FW_SERIALIZE_NO_ROOM_LEFT;
     }
-    // Copy in all the supplied data
-    FwSizeType idx = advance_idx(m_head_idx, m_allocated_size);
-    for (U32 i = 0; i < size; i++) {
-        FW_ASSERT(idx < m_store_size, static_cast<FwAssertArgType>(idx));
-        m_store[idx] = buffer[i];
-        idx = advance_idx(idx);
-    }
+    // Copy in all the supplied data, in at most two pieces when wrapping around the end of the store
+    const FwSizeType idx = advance_idx(m_head_idx, m_allocated_size);
+    const FwSizeType until_end = m_store_size - idx;
+    const FwSizeType first_size = (size < until_end) ? size : until_end;
+    (void)::memcpy(&m_store[idx], buffer, static_cast<size_t>(first_size));
+    (void)::memcpy(m_store, &buffer[first_size], static_cast<size_t>(size - first_size));
     m_allocated_size += size;
     FW_ASSERT(m_allocated_size <= this->get_capacity(), static_cast<FwAssertArgType>(m_allocated_size));
     m_high_water_mark = (m_high_water_mark > m_allocated_size) ? m_high_water_mark : m_allocated_size;
@@ -116,12 +116,47 @@ Fw::SerializeStatus CircularBuffer ::peek(U8* buffer, FwSizeType size, FwSizeTyp
     if ((size + offset) > m_allocated_size) {
         return Fw::FW_DESERIALIZE_BUFFER_EMPTY;
     }
-    FwSizeType idx = advance_idx(m_head_idx, offset);
-    // Deserialize all the bytes from network format
-    for (FwSizeType i = 0; i < size; i++) {
-        FW_ASSERT(idx < m_store_size, static_cast<FwAssertArgType>(idx));
-        buffer[i] = m_store[idx];
-        idx = advance_idx(idx);
+    Span first;
+    Span second;
+    const Fw::SerializeStatus status = peek_spans(first, second, size, offset);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+    (void)::memcpy(buffer, first.data, static_cast<size_t>(first.size));
+    (void)::memcpy(&buffer[first.size], second.data, static_cast<size_t>(second.size));
+    return Fw::FW_SERIALIZE_OK;
+}
+
+Fw::SerializeStatus CircularBuffer ::peek_spans(Span& first, Span& second, FwSizeType size, FwSizeType offset) const {
+    FW_ASSERT(m_store != nullptr && m_store_size != 0);  // setup method was called
+    // Check there is sufficient data
+    if ((size + offset) > m_allocated_size) {
+        return Fw::FW_DESERIALIZE_BUFFER_EMPTY;
+    }
+    const FwSizeType idx = advance_idx(m_head_idx, offset);
+    const FwSizeType until_end = m_store_size - idx;
+    first.data = &m_store[idx];
+    first.size = (size < until_end) ? size : until_end;
+    second.data = m_store;
+    second.size = size - first.size;
+    return Fw::FW_SERIALIZE_OK;
+}
+
+Fw::SerializeStatus CircularBuffer ::peek_contiguous(const U8*& block,
+                                                     U8* scratch,
+                                                     FwSizeType size,
+                                                     FwSizeType offset) const {
+    FW_ASSERT(scratch != nullptr);
+    Span first;
+    Span second;
+    const Fw::SerializeStatus status = peek_spans(first, second, size, offset);
+    if (status != Fw::FW_SERIALIZE_OK) {
+        return status;
+    }
+    if (second.size == 0) {
+        block = first.data;
+    } else {
+        (void)::memcpy(scratch, first.data, static_cast<size_t>(first.size));
+        (void)::memcpy(&scratch[first.size], second.data, static_cast<size_t>(second.size));
+        block = scratch;
     }
     return Fw::FW_SERIALIZE_OK;
 }
@@ -26,6 +26,14 @@ class CircularBuffer {
     friend class CircularBufferTester;
 
   public:
+    /**
+     * Read-only view of a contiguous region of the underlying data store
+     */
+    struct Span {
+        const U8* data;   //!< Start of the region
+        FwSizeType size;  //!< Number of bytes in the region
+    };
+
     /**
      * Circular buffer constructor. Wraps the supplied buffer as the new data store. Buffer
      * size is supplied in the 'size' argument.
@@ -97,6 +105,30 @@ class CircularBuffer {
      */
     Fw::SerializeStatus peek(U8* buffer, FwSizeType size, FwSizeType offset = 0) const;
 
+    /**
+     * Expose allocated data as at most two contiguous spans of the data store without copying or moving the head
+     * index. The data is `first` followed by `second`; `second` is empty unless the region wraps around the end of
+     * the store. Spans are invalidated by any call that modifies the buffer.
+     * \param first: set to the span starting at the given offset from head
+     * \param second: set to the wrapped remainder of the region (size 0 when not wrapped)
+     * \param size: size in bytes of the region to expose
+     * \param offset: offset from head to start of the region. Default: 0
+     * \return Fw::FW_SERIALIZE_OK on success or something else on error
+     */
+    Fw::SerializeStatus peek_spans(Span& first, Span& second, FwSizeType size, FwSizeType offset = 0) const;
+
+    /**
+     * Expose allocated data as one contiguous block without moving the head index. The block points into the data
+     * store when the region does not wrap around the end of the store, and is copied into `scratch` otherwise. The
+     * block is invalidated by any call that modifies the buffer.
+     * \param block: set to the start of the contiguous region
+     * \param scratch: buffer of at least `size` bytes, used only when the region wraps
+     * \param size: size in bytes of the region to expose
+     * \param offset: offset from head to start of the region. Default: 0
+     * \return Fw::FW_SERIALIZE_OK on success or something else on error
+     */
+    Fw::SerializeStatus peek_contiguous(const U8*& block, U8* scratch, FwSizeType size, FwSizeType offset = 0) const;
+
     /**
      * Rotate the head index, deleting data from the circular buffer and making
      * space. Cannot rotate more than the available space.
@@ -0,0 +1,111 @@
+// ======================================================================
+// \title  HashIndex.hpp
+// \brief  Slot arithmetic for power-of-two open-addressing hash tables
+//
+// HashIndex provides the hashing, linear probing, and deletion steps of
+// an open-addressing hash table whose slots are stored by the caller.
+// Keeping the storage outside lets each user pick its own slot type,
+// e.g. plain values, std::atomic values read by other threads, or
+// indices into a separate table of entries.
+//
+// Keys are hashed with Fibonacci hashing: the key is multiplied by
+// 2^32 divided by the golden ratio and the top BITS bits of the 32-bit
+// product select the home slot. The top bits are well mixed even for
+// sequential keys such as opcodes, channel ids, and event ids.
+//
+// Lookups probe linearly from the home slot and stop at the first empty
+// slot, so the caller must keep at least one slot empty. Sizing the table
+// to twice the number of entries (see hashIndexBits) keeps probe
+// sequences short. Removal uses backward shift deletion, which moves
+// later entries of the probe run back so lookups still stop at the first
+// empty slot without tombstones.
+//
+// HashIndex does not provide concurrency control.
+// ======================================================================
+
+#ifndef UTILS_TYPES_HASH_INDEX_HPP
+#define UTILS_TYPES_HASH_INDEX_HPP
+
+#include <Fw/FPrimeBasicTypes.hpp>
+
+namespace Types {
+
+//! \brief number of bits needed to index a power-of-two table holding at least `entries` slots
+constexpr U32 hashIndexBits(FwSizeType entries, U32 bits = 0) {
+    return ((static_cast<FwSizeType>(1) << bits) >= entries) ? bits : hashIndexBits(entries, bits + 1);
+}
+
+//! \class HashIndex
+//! \brief hashing, probing, and deletion for a table of 2^BITS slots
+template <U32 BITS>
+class HashIndex {
+  public:
+    static_assert((BITS > 0) && (BITS < 32), "Hash index limited to range of 32-bit hash");
+
+    //! Number of slots in the table
+    static constexpr FwSizeType SLOTS = static_cast<FwSizeType>(1) << BITS;
+
+    //! \brief home slot of a key, where its probe sequence starts
+    template <typename Key>
+    static FwSizeType home(Key key) {
+        const U32 product = static_cast<U32>(static_cast<U32>(key) * 2654435769U);
+        return static_cast<FwSizeType>(product >> (32 - BITS));
+    }
+
+    //! \brief slot following `slot` in a probe sequence
+    static FwSizeType next(FwSizeType slot) { return (slot + 1) & (SLOTS - 1); }
+
+    //! \brief walk the probe sequence of a key
+    //!
+    //! Stops at the first slot for which `isEmpty(slot)` or `hasKey(slot)` is true.
+    //!
+    //! \param key: key to look up
+    //! \param slot: (output) slot holding the key, or the empty slot ending its probe sequence
+    //! \param isEmpty: callable returning whether a slot is empty
+    //! \param hasKey: callable returning whether a non-empty slot holds `key`
+    //! \return true if the key was found
+    template <typename Key, typename IsEmpty, typename HasKey>
+    static bool find(Key key, FwSizeType& slot, IsEmpty isEmpty, HasKey hasKey) {
+        slot = HashIndex::home(key);
+        while (not isEmpty(slot)) {
+            if (hasKey(slot)) {
+                return true;
+            }
+            slot = HashIndex::next(slot);
+        }
+        return false;
+    }
+
+    //! \brief remove the entry in a slot by backward shift deletion
+    //!
+    //! Calls `move(from, to)` for each later entry of the probe run that must fill the gap, in probe order. Each
+    //! entry is moved into its new slot before its old slot is overwritten. The caller empties the returned slot.
+    //!
+    //! \param slot: slot of the entry to remove
+    //! \param isEmpty: callable returning whether a slot is empty
+    //! \param keyAt: callable returning the key held in a non-empty slot
+    //! \param move: callable copying the entry in slot `from` to slot `to`
+    //! \return the slot left without an entry
+    template <typename IsEmpty, typename KeyAt, typename Move>
+    static FwSizeType remove(FwSizeType slot, IsEmpty isEmpty, KeyAt keyAt, Move move) {
+        FwSizeType hole = slot;
+        FwSizeType probe = HashIndex::next(hole);
+        while (not isEmpty(probe)) {
+            // an entry may fill the hole unless its home slot lies after the hole
+            const FwSizeType home = HashIndex::home(keyAt(probe));
+            if (((probe - home) & (SLOTS - 1)) >= ((probe - hole) & (SLOTS - 1))) {
+                move(probe, hole);
+                hole = probe;
+            }
+            probe = HashIndex::next(probe);
+        }
+        return hole;
+    }
+};
+
+template <U32 BITS>
+constexpr FwSizeType HashIndex<BITS>::SLOTS;
+
+}  // namespace Types
+
+#endif  // UTILS_TYPES_HASH_INDEX_HPP
@@ -0,0 +1,145 @@
+/*
+ * PacketQueue.cpp:
+ *
+ * Implementation of the packet queue data type.
+ *
+ */
+#include "PacketQueue.hpp"
+#include <Fw/Types/Assert.hpp>
+#include <limits>
+
+namespace Types {
+
+PacketQueue::PacketQueue()
+    : m_internal(), m_count(0), m_high_water_mark(0), m_mode(QUEUE_FIFO), m_overflow_mode(QUEUE_DROP_NEWEST) {}
+
+FwSizeType PacketQueue::get_stored_size(const FwSizeType size, const QueueMode mode) {
+    return size + ((mode == QUEUE_LIFO) ? 2 : 1) * LENGTH_RECORD_SIZE;
+}
+
+void PacketQueue::setup(U8* const storage,
+                        const FwSizeType storage_size,
+                        const QueueMode mode,
+                        const QueueOverflowMode overflow_mode) {
+    FW_ASSERT(storage_size > 0, static_cast<FwAssertArgType>(storage_size));
+    FW_ASSERT(mode == QUEUE_FIFO || mode == QUEUE_LIFO, static_cast<FwAssertArgType>(mode));
+    FW_ASSERT(overflow_mode == QUEUE_DROP_OLDEST || overflow_mode == QUEUE_DROP_NEWEST,
+              static_cast<FwAssertArgType>(overflow_mode));
+    m_internal.setup(storage, storage_size);
+    m_count = 0;
+    m_high_water_mark = 0;
+    m_mode = mode;
+    m_overflow_mode = overflow_mode;
+}
+
+Fw::SerializeStatus PacketQueue::enqueue(const U8* const packet, const FwSizeType size) {
+    FW_ASSERT(packet != nullptr);
+    FW_ASSERT(size <= std::numeric_limits<U32>::max(), static_cast<FwAssertArgType>(size));
+    const FwSizeType needed = get_stored_size(size, m_mode);
+    // A packet that cannot fit an empty ring is rejected without disturbing queued packets
+    if (needed > m_internal.get_capacity()) {
+        return Fw::FW_SERIALIZE_NO_ROOM_LEFT;
+    }
+    Fw::SerializeStatus result = Fw::FW_SERIALIZE_OK;
+    if (needed > m_internal.get_free_size()) {
+        if (m_overflow_mode == QUEUE_DROP_NEWEST) {
+            return Fw::FW_SERIALIZE_NO_ROOM_LEFT;
+        }
+        // Drop from the front until the packet fits, then let the caller know data was deleted
+        while (needed > m_internal.get_free_size()) {
+            drop_oldest();
+        }
+        result = Fw::FW_SERIALIZE_DISCARDED_EXISTING;
+    }
+
+    // Length records are stored big-endian to match CircularBuffer::peek(U32&)
+    const U32 length = static_cast<U32>(size);
+    const U8 record[LENGTH_RECORD_SIZE] = {static_cast<U8>(length >> 24), static_cast<U8>(length >> 16),
+                                           static_cast<U8>(length >> 8), static_cast<U8>(length)};
+    Fw::SerializeStatus status = m_internal.serialize(record, sizeof(record));
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+    status = m_internal.serialize(packet, size);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+    if (m_mode == QUEUE_LIFO) {
+        status = m_internal.serialize(record, sizeof(record));
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+    }
+    m_count++;
+    m_high_water_mark = (m_high_water_mark > m_count) ? m_high_water_mark : m_count;
+    return result;
+}
+
+Fw::SerializeStatus PacketQueue::peek_size(FwSizeType& size) const {
+    if (m_count == 0) {
+        return Fw::FW_DESERIALIZE_BUFFER_EMPTY;
+    }
+    if (m_mode == QUEUE_FIFO) {
+        size = read_length(0);
+    } else {
+        size = read_length(m_internal.get_allocated_size() - LENGTH_RECORD_SIZE);
+    }
+    return Fw::FW_SERIALIZE_OK;
+}
+
+Fw::SerializeStatus PacketQueue::dequeue(U8* const packet, const FwSizeType capacity, FwSizeType& size) {
+    FW_ASSERT(packet != nullptr);
+    FwSizeType length = 0;
+    Fw::SerializeStatus status = peek_size(length);
+    if (status != Fw::FW_SERIALIZE_OK) {
+        return status;
+    }
+    if (length > capacity) {
+        return Fw::FW_DESERIALIZE_SIZE_MISMATCH;
+    }
+    const FwSizeType stored = get_stored_size(length, m_mode);
+    if (m_mode == QUEUE_FIFO) {
+        // FIFO: the oldest packet follows the length record at the front
+        status = m_internal.peek(packet, length, LENGTH_RECORD_SIZE);
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+        status = m_internal.rotate(stored);
+    } else {
+        // LIFO: the newest packet precedes the length record at the back
+        const FwSizeType offset = m_internal.get_allocated_size() - stored + LENGTH_RECORD_SIZE;
+        status = m_internal.peek(packet, length, offset);
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+        status = m_internal.trim(stored);
+    }
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+    m_count--;
+    size = length;
+    return Fw::FW_SERIALIZE_OK;
+}
+
+FwSizeType PacketQueue::get_high_water_mark() const {
+    return m_high_water_mark;
+}
+
+void PacketQueue::clear_high_water_mark() {
+    m_high_water_mark = 0;
+}
+
+FwSizeType PacketQueue::getQueueSize() const {
+    return m_count;
+}
+
+FwSizeType PacketQueue::get_allocated_size() const {
+    return m_internal.get_allocated_size();
+}
+
+FwSizeType PacketQueue::read_length(const FwSizeType offset) const {
+    U32 length = 0;
+    const Fw::SerializeStatus status = m_internal.peek(length, offset);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+    return static_cast<FwSizeType>(length);
+}
+
+void PacketQueue::drop_oldest() {
+    FW_ASSERT(m_count > 0);
+    // The front length record is present in both modes
+    const FwSizeType stored = get_stored_size(read_length(0), m_mode);
+    const Fw::SerializeStatus status = m_internal.rotate(stored);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+    m_count--;
+}
+
+}  // namespace Types
@@ -0,0 +1,127 @@
+/*
+ * PacketQueue.hpp:
+ *
+ * FIFO/LIFO queue of variable size packets. Each packet is stored in a byte ring at its actual size, framed by a
+ * length record, such that the number of packets held is bounded by the bytes they use rather than by a worst-case
+ * message size. Wraps circular buffer to perform actual storage of packets. This implementation is not thread safe and
+ * the expectation is that the user will wrap it in concurrency constructs where necessary.
+ *
+ */
+#ifndef _UTILS_TYPES_PACKET_QUEUE_HPP
+#define _UTILS_TYPES_PACKET_QUEUE_HPP
+#include <Fw/FPrimeBasicTypes.hpp>
+#include <Fw/Types/Serializable.hpp>
+#include <Utils/Types/CircularBuffer.hpp>
+#include <Utils/Types/Queue.hpp>
+
+namespace Types {
+
+class PacketQueue {
+  public:
+    //! Size of one length record. FIFO queues store a record before each packet; LIFO queues also store one after it
+    //! so the newest packet can be located from the back of the ring.
+    static constexpr FwSizeType LENGTH_RECORD_SIZE = sizeof(U32);
+
+    /**
+     * \brief constructs an uninitialized queue
+     */
+    PacketQueue();
+
+    /**
+     * \brief get the storage used by one packet of the given size
+     *
+     * \param size: packet size in bytes
+     * \param mode: queue ordering mode the packet will be stored with
+     * \return: bytes of ring storage consumed by the packet and its length records
+     */
+    static FwSizeType get_stored_size(const FwSizeType size, const QueueMode mode);
+
+    /**
+     * \brief setup the queue object to setup storage
+     *
+     * The queue must be configured before use to setup storage parameters. All of the supplied storage is used as the
+     * byte ring.
+     *
+     * \param storage: storage memory allocation
+     * \param storage_size: size of the provided allocation
+     * \param mode: queue ordering mode (FIFO or LIFO), defaults to FIFO
+     * \param overflow_mode: overflow handling mode, defaults to DROP_NEWEST
+     */
+    void setup(U8* const storage,
+               const FwSizeType storage_size,
+               const QueueMode mode = QUEUE_FIFO,
+               const QueueOverflowMode overflow_mode = QUEUE_DROP_NEWEST);
+
+    /**
+     * \brief pushes a packet onto the queue
+     *
+     * Copies `size` bytes of the packet into the ring. When the ring lacks room, behavior depends on the overflow mode:
+     * - DROP_NEWEST: Returns FW_SERIALIZE_NO_ROOM_LEFT without modifying the queue
+     * - DROP_OLDEST: Removes the oldest packets until the new one fits, returns FW_SERIALIZE_DISCARDED_EXISTING
+     *
+     * A packet larger than the whole ring is rejected with FW_SERIALIZE_NO_ROOM_LEFT in either mode.
+     *
+     * \param packet: packet data to enqueue
+     * \param size: size of the packet
+     * \return: Fw::SERIALIZE_OK on success, FW_SERIALIZE_NO_ROOM_LEFT when rejected, FW_SERIALIZE_DISCARDED_EXISTING
+     * when older packets were dropped to make room
+     */
+    Fw::SerializeStatus enqueue(const U8* const packet, const FwSizeType size);
+
+    /**
+     * \brief get the size of the packet the next dequeue will return
+     *
+     * \param size: (output) size of the next packet
+     * \return: Fw::SERIALIZE_OK on success, FW_DESERIALIZE_BUFFER_EMPTY when the queue is empty
+     */
+    Fw::SerializeStatus peek_size(FwSizeType& size) const;
+
+    /**
+     * \brief pops a packet off the queue
+     *
+     * Copies the next packet (oldest for FIFO, newest for LIFO) into the supplied buffer and removes it. The packet is
+     * left queued when the buffer is too small.
+     *
+     * \param packet: buffer to fill with the packet data
+     * \param capacity: size of the supplied buffer
+     * \param size: (output) size of the packet dequeued
+     * \return: Fw::SERIALIZE_OK on success, FW_DESERIALIZE_BUFFER_EMPTY when empty, FW_DESERIALIZE_SIZE_MISMATCH when
+     * the buffer cannot hold the packet
+     */
+    Fw::SerializeStatus dequeue(U8* const packet, const FwSizeType capacity, FwSizeType& size);
+
+    /**
+     * Return the largest tracked number of queued packets
+     */
+    FwSizeType get_high_water_mark() const;
+
+    /**
+     * Clear tracking of the largest number of queued packets
+     */
+    void clear_high_water_mark();
+
+    /**
+     * Return the number of queued packets
+     */
+    FwSizeType getQueueSize() const;
+
+    /**
+     * Return the number of bytes of ring storage in use
+     */
+    FwSizeType get_allocated_size() const;
+
+  private:
+    //! Read the length record at the given ring offset
+    FwSizeType read_length(const FwSizeType offset) const;
+
+    //! Remove the oldest packet from the front of the ring
+    void drop_oldest();
+
+    CircularBuffer m_internal;
+    FwSizeType m_count;
+    FwSizeType m_high_water_mark;
+    QueueMode m_mode;
+    QueueOverflowMode m_overflow_mode;
+};
+}  // namespace Types
+#endif  // _UTILS_TYPES_PACKET_QUEUE_HPP
@@ -100,6 +100,19 @@ void PeekOkRule::action(MockTypes::CircularState& state) {
         for (FwSizeType i = 0; i < state.getRandomSize(); i++) {
             ASSERT_EQ(buffer[i], peek_buffer[i]);
         }
+        // Spans must expose the same bytes without copying
+        Types::CircularBuffer::Span first;
+        Types::CircularBuffer::Span second;
+        ASSERT_EQ(state.getTestBuffer().peek_spans(first, second, state.getRandomSize(), state.getPeekOffset()),
+                  Fw::FW_SERIALIZE_OK);
+        ASSERT_EQ(first.size + second.size, state.getRandomSize());
+        ASSERT_TRUE(second.size == 0 || first.size > 0);
+        for (FwSizeType i = 0; i < first.size; i++) {
+            ASSERT_EQ(buffer[i], first.data[i]);
+        }
+        for (FwSizeType i = 0; i < second.size; i++) {
+            ASSERT_EQ(buffer[first.size + i], second.data[i]);
+        }
     } else {
         ASSERT_TRUE(false);  // Fail the test, bad type
     }
@@ -136,6 +149,10 @@ void PeekBadRule::action(MockTypes::CircularState& state) {
     } else if (state.getPeekType() == 3) {
         ASSERT_EQ(state.getTestBuffer().peek(peek_buffer, state.getRandomSize(), state.getPeekOffset()),
                   Fw::FW_DESERIALIZE_BUFFER_EMPTY);
+        Types::CircularBuffer::Span first;
+        Types::CircularBuffer::Span second;
+        ASSERT_EQ(state.getTestBuffer().peek_spans(first, second, state.getRandomSize(), state.getPeekOffset()),
+                  Fw::FW_DESERIALIZE_BUFFER_EMPTY);
     } else {
         ASSERT_TRUE(false);  // Fail the test, bad type
     }
@@ -16,6 +16,7 @@
 
 #include <cmath>
 #include <cstdio>
+#include <cstring>
 
 #define STEP_COUNT 1000
 
@@ -206,6 +207,53 @@ TEST(CircularBufferTests, BoundaryCases) {
     serializeOk.apply(state);
 }
 
+/**
+ * Test that spans split exactly at the end of the store
+ */
+TEST(CircularBufferTests, WrappedSpans) {
+    U8 store[8];
+    U8 data[6] = {1, 2, 3, 4, 5, 6};
+    Types::CircularBuffer buffer(store, sizeof(store));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, buffer.serialize(data, sizeof(data)));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, buffer.rotate(5));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, buffer.serialize(data, 4));
+    // Allocated data is now {6, 1, 2, 3, 4} starting at store index 5
+    Types::CircularBuffer::Span first;
+    Types::CircularBuffer::Span second;
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, buffer.peek_spans(first, second, 5));
+    ASSERT_EQ(&store[5], first.data);
+    ASSERT_EQ(3U, first.size);
+    ASSERT_EQ(&store[0], second.data);
+    ASSERT_EQ(2U, second.size);
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, buffer.peek_spans(first, second, 2, 3));
+    ASSERT_EQ(&store[0], first.data);
+    ASSERT_EQ(2U, first.size);
+    ASSERT_EQ(0U, second.size);
+    ASSERT_EQ(Fw::FW_DESERIALIZE_BUFFER_EMPTY, buffer.peek_spans(first, second, 5, 1));
+}
+
+/**
+ * Test that a contiguous block points into the store unless the region wraps
+ */
+TEST(CircularBufferTests, ContiguousBlock) {
+    U8 store[8];
+    U8 data[6] = {1, 2, 3, 4, 5, 6};
+    U8 scratch[5] = {};
+    Types::CircularBuffer buffer(store, sizeof(store));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, buffer.serialize(data, sizeof(data)));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, buffer.rotate(5));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, buffer.serialize(data, 4));
+    // Allocated data is now {6, 1, 2, 3, 4} starting at store index 5
+    const U8* block = nullptr;
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, buffer.peek_contiguous(block, scratch, 2));
+    ASSERT_EQ(&store[5], block);
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, buffer.peek_contiguous(block, scratch, 5));
+    ASSERT_EQ(scratch, block);
+    const U8 expected[5] = {6, 1, 2, 3, 4};
+    ASSERT_EQ(0, ::memcmp(expected, block, sizeof(expected)));
+    ASSERT_EQ(Fw::FW_DESERIALIZE_BUFFER_EMPTY, buffer.peek_contiguous(block, scratch, 5, 1));
+}
+
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
     STest::Random::seed();
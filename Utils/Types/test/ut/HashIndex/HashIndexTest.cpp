@@ -0,0 +1,157 @@
+// ======================================================================
+// \title  HashIndexTest.cpp
+// \brief  cpp file for HashIndex unit tests
+//
+// Test index sizing, home slot range, lookup, and backward shift deletion against a reference set
+// ======================================================================
+
+#include <gtest/gtest.h>
+#include <Utils/Types/HashIndex.hpp>
+#include <set>
+#include "STest/Random/Random.hpp"
+
+namespace {
+
+//! Small table so that probe runs collide and wrap around the end of the table
+using TestIndex = Types::HashIndex<4>;
+constexpr FwSizeType MAX_ENTRIES = TestIndex::SLOTS / 2;
+
+//! Table of keys where 0 marks an empty slot
+class KeyTable {
+  public:
+    KeyTable() : m_count(0) {
+        for (FwSizeType slot = 0; slot < TestIndex::SLOTS; slot++) {
+            this->m_slots[slot] = 0;
+        }
+    }
+
+    bool contains(U32 key) const {
+        FwSizeType slot = 0;
+        return this->find(key, slot);
+    }
+
+    bool insert(U32 key) {
+        FwSizeType slot = 0;
+        if (this->find(key, slot)) {
+            return false;
+        }
+        this->m_slots[slot] = key;
+        this->m_count++;
+        return true;
+    }
+
+    bool erase(U32 key) {
+        FwSizeType slot = 0;
+        if (not this->find(key, slot)) {
+            return false;
+        }
+        U32* slots = this->m_slots;
+        const FwSizeType hole = TestIndex::remove(
+            slot, [slots](FwSizeType probe) { return slots[probe] == 0; },
+            [slots](FwSizeType probe) { return slots[probe]; },
+            [slots](FwSizeType from, FwSizeType to) { slots[to] = slots[from]; });
+        this->m_slots[hole] = 0;
+        this->m_count--;
+        return true;
+    }
+
+    FwSizeType count() const { return this->m_count; }
+
+    //! Every stored key is reachable from its home slot without crossing an empty slot
+    void checkInvariant() const {
+        FwSizeType stored = 0;
+        for (FwSizeType slot = 0; slot < TestIndex::SLOTS; slot++) {
+            const U32 key = this->m_slots[slot];
+            if (key != 0) {
+                stored++;
+                for (FwSizeType probe = TestIndex::home(key); probe != slot; probe = TestIndex::next(probe)) {
+                    ASSERT_NE(this->m_slots[probe], 0U) << "key " << key << " unreachable";
+                }
+            }
+        }
+        ASSERT_EQ(stored, this->m_count);
+    }
+
+  private:
+    bool find(U32 key, FwSizeType& slot) const {
+        const U32* slots = this->m_slots;
+        return TestIndex::find(
+            key, slot, [slots](FwSizeType probe) { return slots[probe] == 0; },
+            [slots, key](FwSizeType probe) { return slots[probe] == key; });
+    }
+
+    U32 m_slots[TestIndex::SLOTS];
+    FwSizeType m_count;
+};
+
+}  // namespace
+
+TEST(HashIndex, IndexBits) {
+    static_assert(Types::hashIndexBits(1) == 0, "one slot needs no bits");
+    static_assert(Types::hashIndexBits(2) == 1, "two slots need one bit");
+    static_assert(Types::hashIndexBits(3) == 2, "rounds up to a power of two");
+    static_assert(Types::hashIndexBits(1024) == 10, "exact power of two");
+    static_assert(Types::hashIndexBits(1025) == 11, "rounds up past a power of two");
+    static_assert(Types::HashIndex<Types::hashIndexBits(2 * 100)>::SLOTS >= 200, "table holds twice the entries");
+}
+
+TEST(HashIndex, HomeInRange) {
+    FwSizeType used[TestIndex::SLOTS] = {};
+    for (U32 key = 0; key < 1000; key++) {
+        const FwSizeType home = TestIndex::home(key);
+        ASSERT_LT(home, TestIndex::SLOTS);
+        used[home]++;
+    }
+    // sequential keys spread over every slot
+    for (FwSizeType slot = 0; slot < TestIndex::SLOTS; slot++) {
+        EXPECT_GT(used[slot], 0U) << "slot " << slot;
+    }
+    EXPECT_EQ(TestIndex::next(TestIndex::SLOTS - 1), 0U);
+}
+
+TEST(HashIndex, InsertFindRemove) {
+    KeyTable table;
+    // sequential keys collide in a table this small
+    for (U32 key = 1; key <= MAX_ENTRIES; key++) {
+        ASSERT_TRUE(table.insert(key));
+        ASSERT_FALSE(table.insert(key));
+        table.checkInvariant();
+    }
+    for (U32 key = 1; key <= MAX_ENTRIES; key++) {
+        ASSERT_TRUE(table.contains(key));
+    }
+    ASSERT_FALSE(table.contains(MAX_ENTRIES + 1));
+    // removing from the front of each probe run moves later entries back
+    for (U32 key = 1; key <= MAX_ENTRIES; key += 2) {
+        ASSERT_TRUE(table.erase(key));
+        ASSERT_FALSE(table.erase(key));
+        table.checkInvariant();
+    }
+    for (U32 key = 1; key <= MAX_ENTRIES; key++) {
+        ASSERT_EQ(table.contains(key), (key % 2) == 0) << "key " << key;
+    }
+}
+
+TEST(HashIndex, RandomizedAgainstSet) {
+    KeyTable table;
+    std::set<U32> reference;
+    for (U32 step = 0; step < 20000; step++) {
+        const U32 key = STest::Random::lowerUpper(1, 40);
+        if ((STest::Random::lowerUpper(0, 1) == 0) && (reference.size() < MAX_ENTRIES)) {
+            ASSERT_EQ(table.insert(key), reference.insert(key).second);
+        } else {
+            ASSERT_EQ(table.erase(key), reference.erase(key) == 1);
+        }
+        ASSERT_EQ(table.count(), reference.size());
+        table.checkInvariant();
+        for (U32 probe = 1; probe <= 40; probe++) {
+            ASSERT_EQ(table.contains(probe), reference.count(probe) == 1) << "key " << probe;
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    STest::Random::seed();
+    return RUN_ALL_TESTS();
+}
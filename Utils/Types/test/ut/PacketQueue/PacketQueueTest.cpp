@@ -0,0 +1,183 @@
+// ======================================================================
+// \title  PacketQueueTest.cpp
+// \brief  cpp file for PacketQueue unit tests
+//
+// Test variable size storage, FIFO/LIFO order, and DROP_NEWEST/DROP_OLDEST functionality
+// ======================================================================
+
+#include <gtest/gtest.h>
+#include <Fw/Types/Assert.hpp>
+#include <Utils/Types/PacketQueue.hpp>
+
+class PacketQueueTest : public ::testing::Test {
+  protected:
+    static const FwSizeType BUFFER_SIZE = 64;
+    static const FwSizeType MAX_PACKET = 32;
+
+    //! Enqueue a packet of `size` bytes all holding `value`
+    Fw::SerializeStatus enqueuePacket(Types::PacketQueue& queue, U8 value, FwSizeType size) {
+        U8 packet[MAX_PACKET];
+        for (FwSizeType i = 0; i < size; i++) {
+            packet[i] = value;
+        }
+        return queue.enqueue(packet, size);
+    }
+
+    //! Dequeue a packet checking its size and contents
+    void dequeueAndCheck(Types::PacketQueue& queue, U8 value, FwSizeType size) {
+        U8 packet[MAX_PACKET];
+        FwSizeType actual = 0;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK, queue.dequeue(packet, sizeof(packet), actual));
+        ASSERT_EQ(size, actual);
+        for (FwSizeType i = 0; i < size; i++) {
+            ASSERT_EQ(value, packet[i]);
+        }
+    }
+};
+
+// Test packets of differing sizes round trip in FIFO order
+TEST_F(PacketQueueTest, FIFOMode) {
+    U8 storage[BUFFER_SIZE];
+    Types::PacketQueue queue;
+    queue.setup(storage, BUFFER_SIZE);
+
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, enqueuePacket(queue, 1, 3));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, enqueuePacket(queue, 2, 17));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, enqueuePacket(queue, 3, 1));
+    EXPECT_EQ(3, queue.getQueueSize());
+    EXPECT_EQ(3 + 17 + 1 + 3 * Types::PacketQueue::LENGTH_RECORD_SIZE, queue.get_allocated_size());
+
+    FwSizeType size = 0;
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, queue.peek_size(size));
+    EXPECT_EQ(3, size);
+    dequeueAndCheck(queue, 1, 3);
+    dequeueAndCheck(queue, 2, 17);
+    dequeueAndCheck(queue, 3, 1);
+    EXPECT_EQ(0, queue.getQueueSize());
+    EXPECT_EQ(Fw::FW_DESERIALIZE_BUFFER_EMPTY, queue.peek_size(size));
+}
+
+// Test packets of differing sizes round trip in LIFO order
+TEST_F(PacketQueueTest, LIFOMode) {
+    U8 storage[BUFFER_SIZE];
+    Types::PacketQueue queue;
+    queue.setup(storage, BUFFER_SIZE, Types::QUEUE_LIFO);
+
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, enqueuePacket(queue, 1, 3));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, enqueuePacket(queue, 2, 17));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, enqueuePacket(queue, 3, 1));
+
+    dequeueAndCheck(queue, 3, 1);
+    dequeueAndCheck(queue, 2, 17);
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, enqueuePacket(queue, 4, 5));
+    dequeueAndCheck(queue, 4, 5);
+    dequeueAndCheck(queue, 1, 3);
+    EXPECT_EQ(0, queue.get_allocated_size());
+}
+
+// Test that the number of packets held depends on their size
+TEST_F(PacketQueueTest, SizeProportionalDepth) {
+    U8 storage[BUFFER_SIZE];
+    Types::PacketQueue queue;
+    queue.setup(storage, BUFFER_SIZE);
+
+    const FwSizeType stored = Types::PacketQueue::get_stored_size(4, Types::QUEUE_FIFO);
+    for (FwSizeType i = 0; i < BUFFER_SIZE / stored; i++) {
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK, enqueuePacket(queue, static_cast<U8>(i), 4));
+    }
+    EXPECT_EQ(BUFFER_SIZE / stored, queue.getQueueSize());
+    EXPECT_EQ(Fw::FW_SERIALIZE_NO_ROOM_LEFT, enqueuePacket(queue, 0xFF, 4));
+    for (FwSizeType i = 0; i < BUFFER_SIZE / stored; i++) {
+        dequeueAndCheck(queue, static_cast<U8>(i), 4);
+    }
+}
+
+// Test DROP_OLDEST removes as many old packets as needed for the new one
+TEST_F(PacketQueueTest, DropOldestMode) {
+    U8 storage[BUFFER_SIZE];
+    Types::PacketQueue queue;
+    queue.setup(storage, BUFFER_SIZE, Types::QUEUE_FIFO, Types::QUEUE_DROP_OLDEST);
+
+    // Four packets of 12 bytes stored fill 48 of the 64 bytes
+    for (U8 i = 1; i <= 4; i++) {
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK, enqueuePacket(queue, i, 8));
+    }
+    // A packet needing 28 bytes must drop the two oldest
+    EXPECT_EQ(Fw::FW_SERIALIZE_DISCARDED_EXISTING, enqueuePacket(queue, 5, 24));
+    EXPECT_EQ(3, queue.getQueueSize());
+    dequeueAndCheck(queue, 3, 8);
+    dequeueAndCheck(queue, 4, 8);
+    dequeueAndCheck(queue, 5, 24);
+}
+
+// Test DROP_OLDEST in LIFO mode still drops from the oldest end
+TEST_F(PacketQueueTest, LIFOWithDropOldest) {
+    U8 storage[BUFFER_SIZE];
+    Types::PacketQueue queue;
+    queue.setup(storage, BUFFER_SIZE, Types::QUEUE_LIFO, Types::QUEUE_DROP_OLDEST);
+
+    // Four packets of 16 bytes stored fill the ring
+    for (U8 i = 1; i <= 4; i++) {
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK, enqueuePacket(queue, i, 8));
+    }
+    EXPECT_EQ(Fw::FW_SERIALIZE_DISCARDED_EXISTING, enqueuePacket(queue, 5, 8));
+    dequeueAndCheck(queue, 5, 8);
+    dequeueAndCheck(queue, 4, 8);
+    dequeueAndCheck(queue, 3, 8);
+    dequeueAndCheck(queue, 2, 8);
+    EXPECT_EQ(0, queue.getQueueSize());
+}
+
+// Test packets that could never fit are rejected without dropping queued data
+TEST_F(PacketQueueTest, OversizePacket) {
+    U8 storage[16];
+    Types::PacketQueue queue;
+    queue.setup(storage, sizeof(storage), Types::QUEUE_FIFO, Types::QUEUE_DROP_OLDEST);
+
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, enqueuePacket(queue, 1, 4));
+    EXPECT_EQ(Fw::FW_SERIALIZE_NO_ROOM_LEFT, enqueuePacket(queue, 2, 13));
+    EXPECT_EQ(1, queue.getQueueSize());
+
+    // A destination too small for the packet leaves it queued
+    U8 small[2];
+    FwSizeType size = 0;
+    EXPECT_EQ(Fw::FW_DESERIALIZE_SIZE_MISMATCH, queue.dequeue(small, sizeof(small), size));
+    dequeueAndCheck(queue, 1, 4);
+}
+
+// Test wrapping around the end of the ring many times
+TEST_F(PacketQueueTest, Wraparound) {
+    U8 storage[BUFFER_SIZE];
+    Types::PacketQueue queue;
+    queue.setup(storage, BUFFER_SIZE);
+
+    for (U32 i = 0; i < 100; i++) {
+        const FwSizeType size = 1 + (i % 13);
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK, enqueuePacket(queue, static_cast<U8>(i), size));
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK, enqueuePacket(queue, static_cast<U8>(i + 1), size + 1));
+        dequeueAndCheck(queue, static_cast<U8>(i), size);
+        dequeueAndCheck(queue, static_cast<U8>(i + 1), size + 1);
+    }
+    EXPECT_EQ(0, queue.get_allocated_size());
+}
+
+// Test high water mark tracks packet count
+TEST_F(PacketQueueTest, HighWaterMark) {
+    U8 storage[BUFFER_SIZE];
+    Types::PacketQueue queue;
+    queue.setup(storage, BUFFER_SIZE);
+
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, enqueuePacket(queue, 1, 2));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, enqueuePacket(queue, 2, 2));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, enqueuePacket(queue, 3, 2));
+    EXPECT_EQ(3, queue.get_high_water_mark());
+    dequeueAndCheck(queue, 1, 2);
+    EXPECT_EQ(3, queue.get_high_water_mark());
+    queue.clear_high_water_mark();
+    EXPECT_EQ(0, queue.get_high_water_mark());
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
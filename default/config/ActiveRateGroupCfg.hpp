@@ -20,6 +20,10 @@ namespace Svc {
 enum {
     //! Number of overruns allowed before overrun event is throttled
     ACTIVE_RATE_GROUP_OVERRUN_THROTTLE = 5,
+    //! Whether member timing is enabled at startup (1) or left off until commanded (0)
+    ACTIVE_RATE_GROUP_PROFILE_ENABLED = 1,
+    //! Number of cycles between updates of the member timing telemetry
+    ACTIVE_RATE_GROUP_PROFILE_TLM_CYCLES = 10,
 };
 
 }
@@ -4,7 +4,10 @@
 #include <Fw/FPrimeBasicTypes.hpp>
 
 namespace Svc {
-static const U16 BUFFERMGR_MAX_NUM_BINS = 10;
+// Set through the BufferManagerBins constant in AcConstants.fpp, which also sizes the per-bin telemetry
+static const U16 BUFFERMGR_MAX_NUM_BINS = BufferManagerBins;
+// Emit the per-bin BinHiBuffs and BinNoBuffs telemetry channels on schedIn
+static const bool BUFFERMGR_BIN_TELEMETRY = false;
 }
 
 #endif  // __BUFFERMANAGERCOMPONENTIMPLCFG_HPP__
@@ -0,0 +1,24 @@
+// ======================================================================
+// \title  CRC32Cfg.hpp
+// \brief  Configuration file for the CRC32 engine behind Utils::Hash
+// ======================================================================
+
+#ifndef CONFIG_CRC32_CFG_HPP
+#define CONFIG_CRC32_CFG_HPP
+
+// Available CRC32 backends. All backends produce bit-identical results.
+//
+// BYTEWISE:    the original lib_crc 256-entry table, one byte per step (1 KiB table)
+// SLICE_BY_8:  portable slice-by-8 tables, eight bytes per step (8 KiB table)
+// ACCELERATED: carry-less multiply folding (x86 PCLMULQDQ) or ARMv8 CRC32 instructions when
+//              the CPU supports them, falling back to SLICE_BY_8 otherwise
+#define CRC32_BACKEND_BYTEWISE 0
+#define CRC32_BACKEND_SLICE_BY_8 1
+#define CRC32_BACKEND_ACCELERATED 2
+
+// Backend used by Utils::Hash (CRC32 implementation) and Os::File::calculateCrc
+#ifndef CRC32_BACKEND
+#define CRC32_BACKEND CRC32_BACKEND_ACCELERATED
+#endif
+
+#endif
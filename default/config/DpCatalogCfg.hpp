@@ -15,6 +15,10 @@ namespace Svc {
 // this size.
 static const FwIndexType DP_MAX_DIRECTORIES = 2;
 static const FwIndexType DP_MAX_FILES = 127;
+// Suffix appended to the state file name to form the name
+// of the persisted catalog index. No index is kept when no
+// state file is given.
+static const char DP_CATALOG_INDEX_SUFFIX[] = ".idx";
 }  // namespace Svc
 
 #endif /* SVC_DPCATALOG_CONFIG_HPP_ */
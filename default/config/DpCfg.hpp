@@ -20,4 +20,28 @@
 #define DP_EXT ".fdp"  // NO_CODESONAR  LANG.PREPROC.MACROSTART/END
 constexpr const char* DP_FILENAME_FORMAT = "%s/Dp_%08" PRI_FwDpIdType "_%08" PRIu32 "_%08" PRIu32 DP_EXT;
 
+// The format string for a segment file name, used when DpWriter runs in SEGMENTED mode
+// The format arguments are base directory, the time seconds and microseconds of the first
+// container in the segment, and the segment sequence number
+#define DP_SEGMENT_EXT ".fdps"  // NO_CODESONAR  LANG.PREPROC.MACROSTART/END
+constexpr const char* DP_SEGMENT_FILENAME_FORMAT =
+    "%s/DpSeg_%08" PRIu32 "_%08" PRIu32 "_%08" PRIu32 DP_SEGMENT_EXT;
+
+// The file a container in a segment file is copied to before it is downlinked
+// The format argument is the base directory of the segment file
+constexpr const char* DP_SEGMENT_XMIT_FILENAME_FORMAT = "%s/DpSegXmit.tmp";
+
+// The capacity in bytes of each of the two DpWriter segment write batches
+constexpr FwSizeType DP_SEGMENT_BATCH_SIZE = 16 * 1024;
+
+// The maximum number of container bytes in one segment file
+// A container larger than this is written to its own file
+constexpr FwSizeType DP_SEGMENT_MAX_SIZE = 1024 * 1024;
+
+// The maximum number of containers in one segment file
+constexpr FwSizeType DP_SEGMENT_MAX_CONTAINERS = 256;
+
+// The number of DpWriter schedIn ticks after which an open segment is closed
+constexpr U32 DP_SEGMENT_MAX_AGE_TICKS = 10;
+
 #endif
@@ -23,4 +23,17 @@ enum {
     TELEM_ID_FILTER_SIZE = 25,  //!< Size of telemetry ID filter
 };
 
+// event packing and throttling
+
+enum {
+    EVENT_MANAGER_PACK_EVENTS_DEFAULT = false,  //!< Pack events back to back into each outgoing packet
+};
+
+enum {
+    EVENT_MANAGER_THROTTLE_COUNT_DEFAULT = 0,           //!< Events allowed per ID per interval. 0 disables throttling
+    EVENT_MANAGER_THROTTLE_INTERVAL_DEFAULT = 10,       //!< Throttle interval in run port calls
+    EVENT_MANAGER_THROTTLE_IDS = 32,                    //!< Number of event IDs throttled at once
+    EVENT_MANAGER_THROTTLE_REPORT_TICKS = 10,           //!< Run ticks between throttle reports. 0 reports every tick
+};
+
 #endif /* Config_EventManagerCfg_HPP_ */
@@ -22,6 +22,12 @@ static const bool FILEDOWNLINK_COMMAND_FAILURES_DISABLED = true;
 // Size of the internal file downlink buffer. This must now be static as
 // file down maintains its own internal buffer.
 static const U32 FILEDOWNLINK_INTERNAL_BUFFER_SIZE = FW_FILE_BUFFER_MAX_SIZE;
+// Maximum number of data packets in flight at once. A data packet is in flight from when it is sent until its
+// buffer is returned. Set to 1 for stop-and-wait downlink.
+static const U32 FILEDOWNLINK_WINDOW_SIZE = 4;
+// Number of file chunks in the read-ahead ring, each FILEDOWNLINK_INTERNAL_BUFFER_SIZE bytes. Chunks that are
+// not in flight are read ahead so the next packet is ready when a buffer returns. Must be >= the window size.
+static const U32 FILEDOWNLINK_READ_AHEAD_CHUNKS = FILEDOWNLINK_WINDOW_SIZE + 1;
 
 }  // namespace Svc
 
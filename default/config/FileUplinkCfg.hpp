@@ -0,0 +1,27 @@
+/*
+ * FileUplinkCfg.hpp:
+ *
+ * Configuration settings for file uplink component.
+ */
+
+#ifndef SVC_FILEUPLINK_FILEUPLINKCFG_HPP_
+#define SVC_FILEUPLINK_FILEUPLINKCFG_HPP_
+#include <Fw/FPrimeBasicTypes.hpp>
+
+namespace Svc {
+
+// Size of the write-back buffer. Data packets that continue the buffered run are appended to it and written to the
+// file in one write when the run breaks, the buffer fills, or the file ends. Packets at least this large are written
+// directly.
+static const U32 FILEUPLINK_WRITE_BUFFER_SIZE = 4096;
+// Maximum number of disjoint received extents tracked per file. Each gap left by lost or reordered packets splits
+// the received data into one more extent. A packet that would need an extent beyond this limit is still written to
+// the file, but it is not recorded as received or added to the checksum. It is reported as missing when the END
+// packet arrives, so it must be sent again.
+static const U32 FILEUPLINK_MAX_EXTENTS = 64;
+// Maximum number of missing ranges reported individually when an END packet arrives before all data
+static const U32 FILEUPLINK_MAX_REPORTED_GAPS = 8;
+
+}  // namespace Svc
+
+#endif /* SVC_FILEUPLINK_FILEUPLINKCFG_HPP_ */
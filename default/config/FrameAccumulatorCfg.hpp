@@ -0,0 +1,20 @@
+/*
+ * FrameAccumulatorCfg.hpp:
+ *
+ * Configuration settings for the frame accumulator component.
+ */
+
+#ifndef SVC_FRAMEACCUMULATOR_FRAMEACCUMULATORCFG_HPP_
+#define SVC_FRAMEACCUMULATOR_FRAMEACCUMULATORCFG_HPP_
+#include <Fw/FPrimeBasicTypes.hpp>
+
+namespace Svc {
+
+// Number of incoming buffers the frame accumulator may hold at once in zero-copy mode. Each held buffer stays
+// checked out from the driver until every frame forwarded as a slice of it has been returned on dataReturnIn.
+// When all slots are in use, incoming buffers are processed by copying frames out as in the default mode.
+static const FwSizeType FRAME_ACCUMULATOR_MAX_HELD_BUFFERS = 4;
+
+}  // namespace Svc
+
+#endif /* SVC_FRAMEACCUMULATOR_FRAMEACCUMULATORCFG_HPP_ */
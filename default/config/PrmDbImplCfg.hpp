@@ -13,8 +13,10 @@ namespace {
 
 enum {
     PRMDB_NUM_DB_ENTRIES = 25,    // !< Number of entries in the parameter database
-    PRMDB_ENTRY_DELIMITER = 0xA5  // !< Byte value that should precede each parameter in file; sanity check against
-                                  // file integrity. Should match ground system.
+    PRMDB_ENTRY_DELIMITER = 0xA5,  // !< Byte value that should precede each parameter in file; sanity check against
+                                   // file integrity. Should match ground system.
+    PRMDB_SAVE_BUFFER_SIZE = 4096  // !< Size of the buffer records are serialized into when saving the parameter file.
+                                   // Must hold the CRC plus one record of maximum size.
 };
 
 }
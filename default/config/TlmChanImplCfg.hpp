@@ -13,41 +13,43 @@
 #ifndef TLMCHANIMPLCFG_HPP_
 #define TLMCHANIMPLCFG_HPP_
 
+#include <Fw/FPrimeBasicTypes.hpp>
+
 // Anonymous namespace for configuration parameters
 
-// The parameters below provide for tuning of the hash function used to
-// write and read entries in the database. The has function is very simple;
-// It first takes the telemetry ID and does a modulo computation with
-// TLMCHAN_HASH_MOD_VALUE. It then does a second modulo with the number
-// of slots to make sure the value lands in the provided slots.
-// The values can be experimented with to try and balance the number
-// of slots versus the number of buckets.
-// To test the set of telemetry ID in the system to see if the hash is
-// balanced, do the following:
-//  1) From the deployment directory (e.g Ref), do a full build then type:
-//      "make comp_report_gen"
-//     This will generate a list in "<deployment dir>/ComponentReport.txt"
-//     with all the telemetry IDs in the deployment.
-//  2) Cut and paste the ID list to the array declared in the TlmChan unit test
-//     file TelemChanImplTester.cpp in the runMultiChannel() method.
-//  3) Run the unit test ("make ut run_ut")
-//  4) After writing all the telemetry IDs to the component, the
-//     unit test will dump the hash table. The output looks like the following:
-//        Slot: <n> - slot number
-//        Entry - a bucket assigned to the slot
-//        ... (Other buckets in the slot)
-//     The number of buckets assigned to each slot can be checked for balance.
+// Channels are located through an open-addressing hash index that maps a
+// telemetry ID to its bucket. The index is sized automatically to at least
+// twice TLMCHAN_HASH_BUCKETS, so lookups typically take a single probe
+// regardless of how the IDs in the deployment are distributed.
+// The number of telemetry IDs in a deployment can be found by counting the
+// channels in its dictionary.
+//
+// Channel values are stored in one arena of TLMCHAN_VALUE_ARENA_SIZE bytes.
+// Each channel takes two slots, one per telemetry set. By default every
+// channel gets slots of FW_TLM_BUFFER_MAX_SIZE, and the default arena holds
+// that for every bucket, so no value is ever dropped.
+//
+// A deployment can opt in to a compact arena by calling TlmChan::configure
+// with a table of channel IDs and their maximum serialized sizes from the
+// dictionary. A listed channel then gets slots of its own size; any other
+// channel gets slots of its first value's size. A later value larger than
+// its slot, e.g. a longer string, moves the channel to slots of
+// FW_TLM_BUFFER_MAX_SIZE. Slots are never freed. When the arena has no room
+// for a value, TlmChan drops it and reports a ValueStorageFull event.
+//
+// To size a compact arena, add up the maximum serialized size of each
+// channel in the dictionary and double it:
+//   - primitive types take their width (e.g. U32 takes 4 bytes)
+//   - enums take the width of their representation type
+//   - arrays and structs take the sum of their elements and members
+//   - strings take their maximum length plus sizeof(FwSizeStoreType)
 
 namespace {
 
 enum {
-    TLMCHAN_NUM_TLM_HASH_SLOTS = 15,  // !< Number of slots in the hash table.
-                                      // Works best when set to about twice the number of components producing telemetry
-    TLMCHAN_HASH_MOD_VALUE = 99,      // !< The modulo value of the hashing function.
-                                      // Should be set to a little below the ID gaps to spread the entries around
-
-    TLMCHAN_HASH_BUCKETS = 500  // !< Buckets assignable to a hash slot.
-                                // Buckets must be >= number of telemetry channels in system
+    TLMCHAN_HASH_BUCKETS = 500,  // !< Buckets assignable to telemetry channels.
+                                 // Buckets must be >= number of telemetry channels in system
+    TLMCHAN_VALUE_ARENA_SIZE = 2 * TLMCHAN_HASH_BUCKETS * FW_TLM_BUFFER_MAX_SIZE  // !< Bytes of channel value storage
 };
 
 }
@@ -27,6 +27,9 @@ static const FwChanIdType TLMPACKETIZER_HASH_MOD_VALUE = 99;  // !< The modulo v
 // Buckets must be >= number of telemetry channels in system
 static const FwChanIdType TLMPACKETIZER_HASH_BUCKETS = 1000;  // !< Buckets assignable to a hash slot.
 
+// Placements must be >= total number of channel entries across all packets in the packet list
+static const FwChanIdType TLMPACKETIZER_MAX_PACKET_PLACEMENTS = 2000;  // !< Channel locations in packets.
+
 static const FwChanIdType TLMPACKETIZER_MAX_MISSING_TLM_CHECK = 25;  // !< Max number of missing channel checks
 
 }  // namespace Svc